@@ -0,0 +1,855 @@
+#include <control/CommandHandler.hpp>
+
+#include <app_version.h>
+
+#include <cstring>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+LOG_MODULE_DECLARE(Dispatcher, CONFIG_CONTROL_LOG_LEVEL);
+
+/**
+ * @brief Mount operations run by the executor, arguments as queued by the handler
+ */
+static void runSetTargetRa(Mount &mount, const Executor::Job &job) {
+    if (!mount.setTargetRa(job.args[0], job.args[1], job.args[2])) {
+        LOG_WRN("Target RA refused by the mount");
+    }
+}
+
+static void runSetTargetDec(Mount &mount, const Executor::Job &job) {
+    if (!mount.setTargetDec(job.args[0])) {
+        LOG_WRN("Target DEC refused by the mount");
+    }
+}
+
+static void runSetTarget(Mount &mount, const Executor::Job &job) {
+    if (!mount.setTarget(job.args[0], job.args[1])) {
+        LOG_WRN("Target refused by the mount");
+    }
+}
+
+static void runSlewToTarget(Mount &mount, const Executor::Job &job) {
+    mount.slewToTarget();
+}
+
+static void runSetTargetAltitude(Mount &mount, const Executor::Job &job) {
+    if (!mount.setTargetAltitude(job.args[0])) {
+        LOG_WRN("Target altitude refused by the mount");
+    }
+}
+
+static void runSetTargetAzimuth(Mount &mount, const Executor::Job &job) {
+    if (!mount.setTargetAzimuth(job.args[0])) {
+        LOG_WRN("Target azimuth refused by the mount");
+    }
+}
+
+static void runSlewToAltAz(Mount &mount, const Executor::Job &job) {
+    if (!mount.slewToAltAz()) {
+        LOG_WRN("Alt-az slew refused by the mount");
+    }
+}
+
+static void runFindHome(Mount &mount, const Executor::Job &job) {
+    mount.findHome();
+}
+
+static void runPark(Mount &mount, const Executor::Job &job) {
+    mount.park();
+}
+
+static void runAbortMotion(Mount &mount, const Executor::Job &job) {
+    mount.abortMotion();
+}
+
+CommandHandler::CommandHandler(Mount &mount, Executor &executor, lx200_cache_t &cache)
+    : mount(mount), executor(executor), cache(cache) {
+}
+
+void CommandHandler::handle(lx200_session_t &session, const lx200_frame_t &frame,
+                            const lx200_command_view_t &view) {
+    const auto id = static_cast<lx200_command_id_t>(view.id);
+    const lx200_cache_slot_t slot = lx200_cache_slot(id);
+
+    if (slot != LX200_CACHE_COUNT) {
+        replyPosition(session, slot);
+        return;
+    }
+
+    switch (id) {
+    case LX200_ID_TOGGLE_PRECISION:
+        lx200_session_toggle_precision(&session);
+        break;
+    case LX200_ID_TOGGLE_HIGH_PRECISION:
+        lx200_response_append_str(&session.response,
+                                  lx200_session_toggle_precision(&session) ==
+                                          LX200_COORD_HIGH_PRECISION
+                                      ? "HIGH PRECISION"
+                                      : "LOW PRECISION");
+        break;
+    case LX200_ID_SET_TARGET_RA:
+    case LX200_ID_SET_TARGET_DEC:
+    case LX200_ID_SET_TARGET_ALTITUDE:
+    case LX200_ID_SET_TARGET_AZIMUTH:
+        lx200_response_append_str(&session.response, setTarget(frame, view) ? "1" : "0");
+        break;
+    case LX200_ID_SLEW_TARGET: {
+        int32_t altArcsec;
+        int32_t azArcsec;
+
+        // Without a latitude the horizon is unknown, the slew is left to the user
+        if (mount.horizontal(targetRaSeconds, targetDecArcsec, altArcsec, azArcsec) &&
+            altArcsec < 0) {
+            lx200_response_append_str(&session.response, "1Object Below Horizon#");
+            break;
+        }
+
+        // Answered right away, the slew is planned and run by the executor thread
+        lx200_response_append_str(&session.response,
+                                  executor.submit(Executor::Priority::Normal,
+                                                  {runSlewToTarget, {}}) == 0
+                                      ? "0"
+                                      : "1Mount busy#");
+        break;
+    }
+    case LX200_ID_SLEW_ALTAZ: {
+        int32_t latitude;
+
+        // Converted to RA and DEC at the sidereal time the executor starts the slew
+        lx200_response_append_str(&session.response,
+                                  mount.latitude(latitude) &&
+                                          executor.submit(Executor::Priority::Normal,
+                                                          {runSlewToAltAz, {}}) == 0
+                                      ? "0"
+                                      : "1");
+        break;
+    }
+    case LX200_ID_DISTANCE_BARS: {
+        // One bar per eighth of the slew left, its duration is planned when it starts
+        static const char bars[] = "||||||||#";
+        uint32_t remainingMs;
+        uint32_t totalMs;
+        size_t count = 0;
+
+        if (mount.slewProgress(remainingMs, totalMs)) {
+            count = CLAMP(DIV_ROUND_UP(remainingMs * 8ULL, totalMs), 1U, 8U);
+        }
+        lx200_response_append(&session.response, &bars[8 - count], count + 1);
+        break;
+    }
+    case LX200_ID_HOME_FIND:
+        executor.submit(Executor::Priority::Normal, {runFindHome, {}});
+        break;
+    case LX200_ID_HOME_PARK:
+        executor.submit(Executor::Priority::Normal, {runPark, {}});
+        break;
+    case LX200_ID_STOP_ALL:
+        // Step generation was already stopped by the framer when the '#' arrived
+        abort();
+        break;
+    case LX200_ID_STOP_NORTH:
+    case LX200_ID_STOP_SOUTH:
+    case LX200_ID_STOP_EAST:
+    case LX200_ID_STOP_WEST:
+        // Already signalled to the mount by the framer when the '#' arrived, a move handled
+        // after that is ended here
+        mount.guide(id == LX200_ID_STOP_NORTH || id == LX200_ID_STOP_SOUTH
+                        ? Mount::GuideDirection::North
+                        : Mount::GuideDirection::West,
+                    0);
+        break;
+    case LX200_ID_RATE_GUIDE:
+    case LX200_ID_RATE_CENTERING:
+    case LX200_ID_RATE_FIND:
+    case LX200_ID_RATE_SLEW:
+        guideRate = id == LX200_ID_RATE_GUIDE;
+        break;
+    case LX200_ID_MOVE_NORTH:
+    case LX200_ID_MOVE_SOUTH:
+    case LX200_ID_MOVE_EAST:
+    case LX200_ID_MOVE_WEST:
+        move(id);
+        break;
+    case LX200_ID_LIBRARY_PREVIOUS:
+    case LX200_ID_LIBRARY_SELECT_DEEP_SKY:
+    case LX200_ID_LIBRARY_INFO:
+    case LX200_ID_LIBRARY_SELECT_MESSIER:
+    case LX200_ID_LIBRARY_NEXT:
+    case LX200_ID_LIBRARY_DEEP_SKY_CATALOG:
+    case LX200_ID_LIBRARY_STAR_CATALOG:
+    case LX200_ID_LIBRARY_SELECT_STAR:
+    case LX200_ID_LIBRARY_FIND:
+    case LX200_ID_LIBRARY_IDENTIFY:
+        handleLibrary(session, frame, view);
+        break;
+    case LX200_ID_SET_BRIGHTER_LIMIT:
+        // The only set command that answers 0 for valid
+        lx200_response_append_str(&session.response, setFindLimit(frame, view) ? "0" : "1");
+        break;
+    case LX200_ID_SET_FAINT_LIMIT:
+    case LX200_ID_SET_FIELD_DIAMETER:
+    case LX200_ID_SET_HIGH_LIMIT:
+    case LX200_ID_SET_SMALLER_SIZE_LIMIT:
+    case LX200_ID_SET_LARGER_SIZE_LIMIT:
+        lx200_response_append_str(&session.response, setFindLimit(frame, view) ? "1" : "0");
+        break;
+    case LX200_ID_PEC_TOGGLE:
+        // On records a new worm turn and plays it back, off stops recording and playback
+        mount.setPecMode(mount.pecMode() == Mount::PecMode::Off ? Mount::PecMode::Record
+                                                                : Mount::PecMode::Off);
+        break;
+    case LX200_ID_PEC_RA_ENABLE:
+        mount.setPecMode(Mount::PecMode::Play);
+        break;
+    case LX200_ID_PEC_RA_DISABLE:
+        mount.setPecMode(Mount::PecMode::Off);
+        break;
+    case LX200_ID_TRACK_DEFAULT:
+        mount.setTrackingRate(Mount::TrackingRate::Sidereal);
+        break;
+    case LX200_ID_TRACK_LUNAR:
+        mount.setTrackingRate(Mount::TrackingRate::Lunar);
+        break;
+    case LX200_ID_TRACK_CUSTOM:
+        mount.setTrackingRate(Mount::TrackingRate::Custom);
+        break;
+    case LX200_ID_TRACK_INCREMENT:
+    case LX200_ID_TRACK_DECREMENT:
+        // 0.1 Hz of drive frequency per command
+        mount.adjustCustomRate(id == LX200_ID_TRACK_INCREMENT ? 100 : -100);
+        break;
+    case LX200_ID_SET_TRACKING_RATE:
+    case LX200_ID_TRACK_SET_MANUAL_RATE: {
+        // :ST# also selects the rate, :T# only sets the rate selected by :TM#
+        float hz;
+        const bool valid =
+            lx200_parse_tracking_rate(lx200_command_view_parameter(frame.data, &view), &hz) ==
+                LX200_PARSE_OK &&
+            mount.setCustomRate(static_cast<uint32_t>(hz * 1000.0f + 0.5f)) &&
+            (id == LX200_ID_TRACK_SET_MANUAL_RATE ||
+             mount.setTrackingRate(Mount::TrackingRate::Custom));
+
+        lx200_response_append_str(&session.response, valid ? "1" : "0");
+        break;
+    }
+    case LX200_ID_GET_TRACKING_RATE: {
+        const uint32_t tenths = (mount.trackingFrequency() + 50) / 100;
+        char text[12];
+        const int length = snprintk(text, sizeof(text), "%02u.%u#", tenths / 10, tenths % 10);
+
+        lx200_response_append(&session.response, text, length);
+        break;
+    }
+    case LX200_ID_SET_LONGITUDE: {
+        // West positive on the LX200
+        lx200_coordinate_t coord;
+        const bool valid =
+            lx200_parse_longitude(lx200_command_view_parameter(frame.data, &view), &coord) ==
+                LX200_PARSE_OK &&
+            mount.setLongitude(-lx200_coordinate_to_arcsec(&coord));
+
+        lx200_response_append_str(&session.response, valid ? "1" : "0");
+        break;
+    }
+    case LX200_ID_SET_UTC_OFFSET: {
+        float hours;
+        const bool valid =
+            lx200_parse_utc_offset(lx200_command_view_parameter(frame.data, &view), &hours) ==
+                LX200_PARSE_OK &&
+            mount.setUtcOffset(static_cast<int32_t>(hours * 60.0f + (hours < 0 ? -0.5f : 0.5f)));
+
+        lx200_response_append_str(&session.response, valid ? "1" : "0");
+        break;
+    }
+    case LX200_ID_SET_DATE: {
+        lx200_date_t date;
+        const bool valid =
+            lx200_parse_date(lx200_command_view_parameter(frame.data, &view), &date) ==
+                LX200_PARSE_OK &&
+            mount.setLocalDate(2000 + date.year, date.month, date.day);
+
+        lx200_response_append_str(
+            &session.response,
+            valid ? "1Updating Planetary Data#                                           #" : "0");
+        break;
+    }
+    case LX200_ID_SET_LOCAL_TIME:
+    case LX200_ID_SET_SIDEREAL_TIME: {
+        lx200_time_t time;
+        bool valid = lx200_parse_time(lx200_command_view_parameter(frame.data, &view), &time) ==
+                     LX200_PARSE_OK;
+
+        if (valid && id == LX200_ID_SET_LOCAL_TIME) {
+            valid = mount.setLocalTime(time.hours, time.minutes, time.seconds);
+        } else if (valid) {
+            valid = mount.setSiderealTime((time.hours * 60 + time.minutes) * 60 + time.seconds);
+        }
+
+        lx200_response_append_str(&session.response, valid ? "1" : "0");
+        break;
+    }
+    case LX200_ID_SET_LATITUDE: {
+        lx200_coordinate_t coord;
+        const bool valid =
+            lx200_parse_latitude(lx200_command_view_parameter(frame.data, &view), &coord) ==
+                LX200_PARSE_OK &&
+            mount.setLatitude(lx200_coordinate_to_arcsec(&coord));
+
+        lx200_response_append_str(&session.response, valid ? "1" : "0");
+        break;
+    }
+    case LX200_ID_VENDOR_LATENCY:
+        replyLatency(session, frame, view);
+        break;
+    case LX200_ID_GET_PRODUCT_NAME:
+        lx200_response_append_str(&session.response, "OpenAstroFirmware#");
+        break;
+    case LX200_ID_GET_FIRMWARE_NUMBER:
+        lx200_response_append_str(&session.response, APP_VERSION_STRING "#");
+        break;
+    default:
+        LOG_DBG("Session %u: command %d not handled", session.index, id);
+        break;
+    }
+}
+
+void CommandHandler::move(lx200_command_id_t id) {
+    if (!guideRate) {
+        LOG_WRN("Only moves at the guide rate of :RG# are supported");
+        return;
+    }
+
+    Mount::GuideDirection direction;
+
+    switch (id) {
+    case LX200_ID_MOVE_NORTH:
+        direction = Mount::GuideDirection::North;
+        break;
+    case LX200_ID_MOVE_SOUTH:
+        direction = Mount::GuideDirection::South;
+        break;
+    case LX200_ID_MOVE_EAST:
+        direction = Mount::GuideDirection::East;
+        break;
+    default:
+        direction = Mount::GuideDirection::West;
+        break;
+    }
+
+    // Guides until :Qn#, :Qs#, :Qe#, :Qw# or :Q# stops the axis
+    if (!mount.guide(direction, -1)) {
+        LOG_WRN("Move refused by the mount");
+    }
+}
+
+void CommandHandler::replyPosition(lx200_session_t &session, lx200_cache_slot_t slot) {
+    const lx200_precision_t precision = session.precision;
+
+    if (lx200_cache_lookup(&cache, slot, precision, &session.response)) {
+        return;
+    }
+
+    // Read the generation first, so a position update while formatting is not hidden
+    const uint32_t generation = lx200_cache_generation(&cache, slot, precision);
+    const Mount::Position position = mount.position();
+    // Sidereal time is always reported as HH:MM:SS
+    const lx200_precision_t shown =
+        slot == LX200_CACHE_SIDEREAL_TIME ? LX200_COORD_HIGH_PRECISION : precision;
+    int32_t value;
+
+    switch (slot) {
+    case LX200_CACHE_RA:
+        value = position.raSeconds;
+        break;
+    case LX200_CACHE_DEC:
+        value = position.decArcsec;
+        break;
+    case LX200_CACHE_ALT:
+        value = position.altArcsec;
+        break;
+    case LX200_CACHE_AZ:
+        value = position.azArcsec;
+        break;
+    default:
+        value = position.lstSeconds;
+        break;
+    }
+
+    lx200_coordinate_t coordinate;
+    char text[LX200_CACHE_ENTRY_LENGTH + 1];
+    int length;
+
+    if (lx200_coordinate_from_arcsec(value, shown, &coordinate) < 0) {
+        return;
+    }
+
+    switch (slot) {
+    case LX200_CACHE_RA:
+    case LX200_CACHE_SIDEREAL_TIME:
+        length = lx200_format_ra_coordinate(&coordinate, text, sizeof(text));
+        break;
+    case LX200_CACHE_AZ:
+        length = lx200_format_azimuth_coordinate(&coordinate, text, sizeof(text));
+        break;
+    default:
+        length = lx200_format_dec_coordinate(&coordinate, text, sizeof(text));
+        break;
+    }
+
+    if (length <= 0) {
+        return;
+    }
+
+    lx200_cache_store(&cache, slot, precision, generation, text, length);
+    lx200_response_append(&session.response, text, length);
+}
+
+bool CommandHandler::setTarget(const lx200_frame_t &frame, const lx200_command_view_t &view) {
+    // The parameter is terminated by the '#' of the frame, no copy needed
+    const char *parameter = lx200_command_view_parameter(frame.data, &view);
+    lx200_coordinate_t coord;
+
+    if (view.id == LX200_ID_SET_TARGET_RA) {
+        if (lx200_parse_ra_coordinate(parameter, &coord) != LX200_PARSE_OK) {
+            return false;
+        }
+
+        const int32_t s = coord.precision == LX200_COORD_LOW_PRECISION ? coord.tenths * 6
+                                                                       : coord.seconds;
+        if (executor.submit(Executor::Priority::Normal,
+                            {runSetTargetRa, {coord.degrees, coord.minutes, s}}) != 0) {
+            return false;
+        }
+
+        targetRaSeconds = (coord.degrees * 60 + coord.minutes) * 60 + s;
+        return true;
+    }
+
+    if (view.id == LX200_ID_SET_TARGET_ALTITUDE || view.id == LX200_ID_SET_TARGET_AZIMUTH) {
+        const bool altitude = view.id == LX200_ID_SET_TARGET_ALTITUDE;
+        const lx200_parse_result_t result = altitude
+                                                ? lx200_parse_alt_coordinate(parameter, &coord)
+                                                : lx200_parse_az_coordinate(parameter, &coord);
+
+        if (result != LX200_PARSE_OK) {
+            return false;
+        }
+
+        return executor.submit(Executor::Priority::Normal,
+                               {altitude ? runSetTargetAltitude : runSetTargetAzimuth,
+                                {lx200_coordinate_to_arcsec(&coord)}}) == 0;
+    }
+
+    if (lx200_parse_dec_coordinate(parameter, &coord) != LX200_PARSE_OK) {
+        return false;
+    }
+
+    // In arcseconds, degrees alone lose the sign of -00*30
+    const int32_t arcsec = lx200_coordinate_to_arcsec(&coord);
+
+    // Queued like the slew, so a :Sr#/:Sd#/:MS# sequence reaches the mount in order
+    if (executor.submit(Executor::Priority::Normal, {runSetTargetDec, {arcsec}}) != 0) {
+        return false;
+    }
+
+    targetDecArcsec = arcsec;
+    return true;
+}
+
+/**
+ * @brief Parse the decimal NNNN parameter of a library command
+ */
+static bool parseNumber(const char *text, size_t length, uint16_t &number) {
+    uint32_t value = 0;
+
+    if (length == 0 || length > 5) {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        if (text[i] < '0' || text[i] > '9') {
+            return false;
+        }
+        value = value * 10 + (text[i] - '0');
+    }
+
+    if (value > UINT16_MAX) {
+        return false;
+    }
+
+    number = value;
+    return true;
+}
+
+/**
+ * @brief Parse the sMM.M magnitude parameter of :Sb# and :Sf# into tenths
+ */
+static bool parseMagnitude(const char *text, size_t length, int16_t &tenths) {
+    const bool negative = length > 0 && text[0] == '-';
+    size_t i = length > 0 && (text[0] == '-' || text[0] == '+') ? 1 : 0;
+    const size_t digits = i;
+    int32_t value = 0;
+
+    for (; i < length && i < digits + 2 && text[i] >= '0' && text[i] <= '9'; i++) {
+        value = value * 10 + (text[i] - '0');
+    }
+
+    if (i == digits) {
+        return false;
+    }
+
+    value *= 10;
+    if (i < length && text[i] == '.') {
+        if (i + 2 != length || text[i + 1] < '0' || text[i + 1] > '9') {
+            return false;
+        }
+        value += text[i + 1] - '0';
+        i += 2;
+    }
+
+    if (i != length) {
+        return false;
+    }
+
+    tenths = negative ? -value : value;
+    return true;
+}
+
+bool CommandHandler::setFindLimit(const lx200_frame_t &frame, const lx200_command_view_t &view) {
+#if defined(CONFIG_CATALOG)
+    const char *parameter = lx200_command_view_parameter(frame.data, &view);
+    int16_t magnitude;
+    uint16_t number;
+
+    switch (view.id) {
+    case LX200_ID_SET_BRIGHTER_LIMIT:
+    case LX200_ID_SET_FAINT_LIMIT:
+        if (!parseMagnitude(parameter, view.length, magnitude)) {
+            return false;
+        }
+        (view.id == LX200_ID_SET_BRIGHTER_LIMIT ? findLimits.brighter : findLimits.fainter) =
+            magnitude;
+        return true;
+    default:
+        break;
+    }
+
+    if (!parseNumber(parameter, view.length, number)) {
+        return false;
+    }
+
+    switch (view.id) {
+    case LX200_ID_SET_FIELD_DIAMETER:
+        if (number == 0) {
+            return false;
+        }
+        fieldDiameter = number;
+        return true;
+    case LX200_ID_SET_HIGH_LIMIT:
+        if (number > 90) {
+            return false;
+        }
+        minElevation = number;
+        return true;
+    default:
+        // Sizes are kept in tenths of an arcminute like the catalog
+        if (number > UINT16_MAX / 10) {
+            return false;
+        }
+        (view.id == LX200_ID_SET_SMALLER_SIZE_LIMIT ? findLimits.smallest : findLimits.largest) =
+            number * 10;
+        return true;
+    }
+#else
+    ARG_UNUSED(frame);
+    ARG_UNUSED(view);
+
+    // No catalogs built in, nothing to limit
+    return false;
+#endif
+}
+
+#if defined(CONFIG_CATALOG)
+/**
+ * @brief Pick the :LF# result, the object after the selected one in catalog order
+ */
+struct FindState {
+    /** index of the selected object, -1 if it is in another catalog */
+    int32_t after;
+    const catalog_record_t *first;
+    const catalog_record_t *next;
+};
+
+static bool pickNext(const catalog_t *catalog, const catalog_record_t *record, uint32_t distance,
+                     void *userData) {
+    auto &state = *static_cast<FindState *>(userData);
+    const int32_t index = record - catalog->records;
+
+    if (state.first == nullptr || record < state.first) {
+        state.first = record;
+    }
+    if (index > state.after && (state.next == nullptr || record < state.next)) {
+        state.next = record;
+    }
+
+    return true;
+}
+
+void CommandHandler::findObject() {
+    FindState state{-1, nullptr, nullptr};
+    int32_t latitude;
+    // The cone around the zenith holds everything above the minimum elevation
+    uint32_t radius = (90 - minElevation) * 3600;
+    // In tenths of seconds of RA
+    const uint32_t zenithRa = mount.siderealTimeMs() / 100;
+
+    if (!mount.latitude(latitude)) {
+        // Without a site the sky overhead is unknown, search all of it
+        latitude = 0;
+        radius = 648000;
+    }
+
+    if (library.catalog == deepSky) {
+        state.after = library.index;
+    }
+
+    catalog_query_cone(deepSky, zenithRa, latitude, radius, &findLimits, pickNext, &state);
+
+    const catalog_record_t *record = state.next != nullptr ? state.next : state.first;
+
+    if (record == nullptr) {
+        LOG_DBG("No %s object within the find limits", deepSky->prefix);
+        return;
+    }
+
+    catalog_select(&library, deepSky, record->number);
+}
+
+/**
+ * @brief Objects seen by :Lf#
+ */
+struct FieldState {
+    uint32_t count;
+    uint32_t distance;
+    const catalog_t *catalog;
+    const catalog_record_t *closest;
+};
+
+static bool countObject(const catalog_t *catalog, const catalog_record_t *record,
+                        uint32_t distance, void *userData) {
+    auto &state = *static_cast<FieldState *>(userData);
+
+    state.count++;
+    if (state.closest == nullptr || distance < state.distance) {
+        state.catalog = catalog;
+        state.closest = record;
+        state.distance = distance;
+    }
+
+    return true;
+}
+
+void CommandHandler::identifyField(lx200_session_t &session) {
+    const Mount::Position position = mount.position();
+    int32_t raSeconds = position.raSeconds;
+    int32_t decArcsec = position.decArcsec;
+
+#if !defined(CONFIG_MOUNT_APPARENT_PLACE)
+    // The client works in places of the date, the catalogs hold J2000.0
+    mount.catalogPlace(raSeconds, decArcsec);
+#endif
+
+    const uint32_t ra = (raSeconds % 86400) * 10;
+    const uint32_t radius = fieldDiameter * 30;
+    FieldState state{};
+
+    for (const catalog_t *catalog : {deepSky, stars}) {
+        catalog_query_cone(catalog, ra, decArcsec, radius, nullptr, countObject, &state);
+    }
+
+    char text[40];
+    int length = snprintk(text, sizeof(text), "%u - Objects found", state.count);
+
+    if (state.closest != nullptr) {
+        length += snprintk(&text[length], sizeof(text) - length, ", %s%u",
+                           state.catalog->prefix, state.closest->number);
+    }
+    length += snprintk(&text[length], sizeof(text) - length, "#");
+    lx200_response_append(&session.response, text, length);
+}
+#endif
+
+void CommandHandler::handleLibrary(lx200_session_t &session, const lx200_frame_t &frame,
+                                   const lx200_command_view_t &view) {
+#if defined(CONFIG_CATALOG)
+    const char *parameter = lx200_command_view_parameter(frame.data, &view);
+    const catalog_record_t *record = nullptr;
+    uint16_t number;
+
+    switch (view.id) {
+    case LX200_ID_LIBRARY_SELECT_MESSIER:
+    case LX200_ID_LIBRARY_SELECT_DEEP_SKY:
+    case LX200_ID_LIBRARY_SELECT_STAR: {
+        const catalog_t *catalog = view.id == LX200_ID_LIBRARY_SELECT_MESSIER ? &catalog_messier
+                                   : view.id == LX200_ID_LIBRARY_SELECT_STAR  ? stars
+                                                                              : deepSky;
+
+        if (!parseNumber(parameter, view.length, number) ||
+            catalog_select(&library, catalog, number) != 0) {
+            LOG_DBG("No object %.*s in the selected catalog", view.length, parameter);
+            return;
+        }
+        record = catalog_current(&library);
+        break;
+    }
+    case LX200_ID_LIBRARY_NEXT:
+        record = catalog_next(&library, deepSky);
+        break;
+    case LX200_ID_LIBRARY_PREVIOUS:
+        record = catalog_previous(&library, deepSky);
+        break;
+    case LX200_ID_LIBRARY_FIND: {
+        const catalog_record_t *selected = catalog_current(&library);
+
+        findObject();
+        record = catalog_current(&library);
+        if (record == selected) {
+            return;
+        }
+        break;
+    }
+    case LX200_ID_LIBRARY_IDENTIFY:
+        identifyField(session);
+        return;
+    case LX200_ID_LIBRARY_DEEP_SKY_CATALOG: {
+        const catalog_t *catalog = catalog_deep_sky(parameter[0] - '0');
+
+        if (catalog != nullptr) {
+            deepSky = catalog;
+        }
+        lx200_response_append_str(&session.response, catalog != nullptr ? "1" : "0");
+        return;
+    }
+    case LX200_ID_LIBRARY_STAR_CATALOG: {
+        const catalog_t *catalog = catalog_star_library(parameter[0] - '0');
+
+        if (catalog != nullptr) {
+            stars = catalog;
+        }
+        lx200_response_append_str(&session.response, catalog != nullptr ? "1" : "2");
+        return;
+    }
+    default: {
+        // :LI# "<designation> <name> <type> MAG <magnitude>#"
+        record = catalog_current(&library);
+        if (record == nullptr) {
+            lx200_response_append_str(&session.response, "#");
+            return;
+        }
+
+        const char *name = catalog_name(library.catalog, record);
+        const int16_t magnitude = catalog_magnitude(record);
+        // Names are cut, so the reply always fits
+        char text[80];
+        int length = snprintk(text, sizeof(text), "%s%u %.40s%s%s", library.catalog->prefix,
+                              record->number, name != nullptr ? name : "",
+                              name != nullptr ? " " : "",
+                              catalog_type_to_string(
+                                  static_cast<catalog_object_type_t>(record->type)));
+
+        if (magnitude != INT16_MAX) {
+            const int16_t tenths = magnitude < 0 ? -magnitude : magnitude;
+
+            length += snprintk(&text[length], sizeof(text) - length, " MAG %s%d.%d",
+                               magnitude < 0 ? "-" : "", tenths / 10, tenths % 10);
+        }
+        length += snprintk(&text[length], sizeof(text) - length, "#");
+        lx200_response_append(&session.response, text, length);
+        return;
+    }
+    }
+
+    if (record == nullptr) {
+        return;
+    }
+
+    // The catalog keeps tenths of a second of time, the mount whole seconds
+    const int32_t raSeconds = ((record->ra + 5) / 10) % 86400;
+
+    if (executor.submit(Executor::Priority::Normal, {runSetTarget, {raSeconds, record->dec}}) ==
+        0) {
+        targetRaSeconds = raSeconds;
+        targetDecArcsec = record->dec;
+    }
+#else
+    ARG_UNUSED(frame);
+
+    // No catalogs built in: :LoD# and :LsD# report the catalog as missing
+    if (view.id == LX200_ID_LIBRARY_DEEP_SKY_CATALOG) {
+        lx200_response_append_str(&session.response, "0");
+    } else if (view.id == LX200_ID_LIBRARY_STAR_CATALOG) {
+        lx200_response_append_str(&session.response, "2");
+    } else if (view.id == LX200_ID_LIBRARY_INFO) {
+        lx200_response_append_str(&session.response, "#");
+    } else if (view.id == LX200_ID_LIBRARY_IDENTIFY) {
+        lx200_response_append_str(&session.response, "0 - Objects found#");
+    }
+#endif
+}
+
+void CommandHandler::abort() {
+    const size_t dropped = executor.cancel(Executor::Priority::Normal);
+
+    if (dropped > 0) {
+        LOG_INF("Stop dropped %zu queued operations", dropped);
+    }
+
+    executor.submit(Executor::Priority::High, {runAbortMotion, {}});
+}
+
+#if defined(CONFIG_LX200_LATENCY)
+void CommandHandler::setLatency(const lx200_latency_t *latency) {
+    this->latency = latency;
+}
+#endif
+
+void CommandHandler::replyLatency(lx200_session_t &session, const lx200_frame_t &frame,
+                                  const lx200_command_view_t &view) {
+#if defined(CONFIG_LX200_LATENCY)
+    const char *designator = lx200_command_view_parameter(frame.data, &view);
+
+    for (int i = 0; latency != nullptr && i < LX200_CMD_UNKNOWN; i++) {
+        const auto family = static_cast<lx200_command_family_t>(i);
+        const char *name = lx200_command_family_to_string(family);
+
+        if (strlen(name) != view.length || memcmp(name, designator, view.length) != 0) {
+            continue;
+        }
+
+        // "count,min,p99,max" in microseconds per stage, separated by ';'
+        char text[LX200_LATENCY_STAGES * 44 + 2];
+        int length = 0;
+
+        for (int stage = 0; stage < LX200_LATENCY_STAGES; stage++) {
+            const lx200_histogram_t *histogram = lx200_latency_histogram(
+                latency, family, static_cast<lx200_latency_stage_t>(stage));
+
+            length += snprintk(&text[length], sizeof(text) - length, "%s%u,%u,%u,%u",
+                               stage == 0 ? "" : ";", histogram->count, histogram->min_us,
+                               lx200_histogram_percentile(histogram, 990), histogram->max_us);
+        }
+
+        length += snprintk(&text[length], sizeof(text) - length, "#");
+        lx200_response_append(&session.response, text, length);
+        return;
+    }
+#else
+    ARG_UNUSED(frame);
+    ARG_UNUSED(view);
+#endif
+
+    // Unknown family or latency measurement not built in
+    lx200_response_append_str(&session.response, "0#");
+}
@@ -0,0 +1,220 @@
+#include <control/Dispatcher.hpp>
+
+#include <zephyr/devicetree.h>
+#include <zephyr/logging/log.h>
+#if defined(CONFIG_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+#include <zephyr/sys/util.h>
+LOG_MODULE_REGISTER(Dispatcher, CONFIG_CONTROL_LOG_LEVEL);
+
+#define SESSION_NODE(node_id) {.uart = DEVICE_DT_GET(DT_PHANDLE(node_id, uart))},
+
+// One session per "oaf,lx200-session" node, the control UART otherwise
+static ControlSession sessions[] = {
+#if DT_HAS_COMPAT_STATUS_OKAY(oaf_lx200_session)
+    DT_FOREACH_STATUS_OKAY(oaf_lx200_session, SESSION_NODE)
+#else
+    {.uart = DEVICE_DT_GET(DT_CHOSEN(oaf_uart_control))},
+#endif
+};
+
+K_THREAD_STACK_DEFINE(dispatcherStack, CONFIG_CONTROL_THREAD_STACK_SIZE);
+
+#if defined(CONFIG_LX200_LATENCY)
+// Latency of the commands of all sessions, only recorded by the dispatcher thread
+static lx200_latency_t latencies;
+#endif
+
+/**
+ * @brief Transmit callback of the session response builders
+ */
+static int transmit(const char *data, size_t length, void *user_data) {
+    auto *session = static_cast<ControlSession *>(user_data);
+
+    return session->transport.transmit(data, length);
+}
+
+Dispatcher::Dispatcher(Mount &mount, Executor &executor)
+    : handler(mount, executor, cache), mount(mount) {
+    lx200_cache_init(&cache);
+    k_sem_init(&work, 0, 1);
+
+#if defined(CONFIG_LX200_LATENCY)
+    lx200_latency_init(&latencies);
+    handler.setLatency(&latencies);
+#endif
+}
+
+int Dispatcher::start() {
+    for (size_t i = 0; i < ARRAY_SIZE(sessions); i++) {
+        if (!device_is_ready(sessions[i].uart)) {
+            LOG_ERR("Session %zu: %s not ready", i, sessions[i].uart->name);
+            return -ENODEV;
+        }
+
+        lx200_session_init(&sessions[i].state, i, transmit, &sessions[i]);
+        // Stops bypass the queue and reach the mount straight from the receive path
+        lx200_framer_set_stop_handler(&sessions[i].state.framer, stopReceived, this);
+    }
+
+    mount.setResponseCache(&cache);
+
+    k_thread_create(&thread, dispatcherStack, K_THREAD_STACK_SIZEOF(dispatcherStack),
+                    threadEntry, this, nullptr, nullptr, CONFIG_CONTROL_THREAD_PRIORITY, 0,
+                    K_NO_WAIT);
+    k_thread_name_set(&thread, "dispatcher");
+
+    for (auto &session : sessions) {
+        int ret = session.transport.start(session.uart, session.state, *this);
+
+        if (ret < 0) {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
+void Dispatcher::notify() {
+    k_sem_give(&work);
+}
+
+size_t Dispatcher::sessionCount() const {
+    return ARRAY_SIZE(sessions);
+}
+
+ControlSession *Dispatcher::session(size_t index) {
+    return index < ARRAY_SIZE(sessions) ? &sessions[index] : nullptr;
+}
+
+void Dispatcher::threadEntry(void *p1, void *p2, void *p3) {
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    static_cast<Dispatcher *>(p1)->run();
+}
+
+void Dispatcher::stopReceived(lx200_stop_t stop, void *user_data) {
+    uint32_t axes;
+
+    switch (stop) {
+    case LX200_STOP_NORTH:
+    case LX200_STOP_SOUTH:
+        axes = MOTION_AXIS_DEC;
+        break;
+    case LX200_STOP_EAST:
+    case LX200_STOP_WEST:
+        axes = MOTION_AXIS_RA;
+        break;
+    default:
+        axes = MOTION_AXIS_ALL;
+        break;
+    }
+
+    static_cast<Dispatcher *>(user_data)->mount.emergencyStop(axes);
+}
+
+void Dispatcher::run() {
+    while (true) {
+        k_sem_take(&work, K_FOREVER);
+
+        bool busy;
+
+        do {
+            busy = false;
+
+            for (auto &session : sessions) {
+                busy |= serviceOne(session);
+            }
+        } while (busy);
+    }
+}
+
+bool Dispatcher::serviceOne(ControlSession &session) {
+    lx200_command_view_t view;
+    lx200_frame_t frame;
+
+    if (!session.transport.canTransmit(CONFIG_LX200_RESPONSE_BUFFER_SIZE)) {
+        // The client reads slower than it asks, keep its commands queued until the
+        // transmitter drains. The transport wakes the dispatcher then.
+        return false;
+    }
+
+    if (!lx200_session_next(&session.state, &frame, &view)) {
+        // All commands of the burst handled, send the replies with one write
+        lx200_session_flush(&session.state);
+#if defined(CONFIG_LX200_LATENCY)
+        lx200_latency_transmitted(&latencies, &session.latency, k_cycle_get_32());
+#endif
+        return false;
+    }
+
+    handler.handle(session.state, frame, view);
+#if defined(CONFIG_LX200_LATENCY)
+    lx200_latency_handled(&latencies, &session.latency,
+                          static_cast<lx200_command_family_t>(view.family), &frame,
+                          k_cycle_get_32());
+#endif
+    lx200_session_complete(&session.state);
+
+    return true;
+}
+
+#if defined(CONFIG_SHELL) && defined(CONFIG_LX200_LATENCY)
+
+static int cmdLatencyShow(const struct shell *sh, size_t argc, char **argv) {
+    static const char *const stages[] = {"receive", "handle", "transmit", "total"};
+
+    BUILD_ASSERT(ARRAY_SIZE(stages) == LX200_LATENCY_STAGES);
+
+    shell_print(sh, "%-7s %-9s %10s %10s %10s %10s", "family", "stage", "count", "min us",
+                "p99 us", "max us");
+
+    for (int i = 0; i < LX200_CMD_UNKNOWN; i++) {
+        const auto family = static_cast<lx200_command_family_t>(i);
+
+        // Only list the families that have been used
+        if (lx200_latency_histogram(&latencies, family, LX200_LATENCY_HANDLE)->count == 0) {
+            continue;
+        }
+
+        for (int stage = 0; stage < LX200_LATENCY_STAGES; stage++) {
+            const lx200_histogram_t *histogram = lx200_latency_histogram(
+                &latencies, family, static_cast<lx200_latency_stage_t>(stage));
+
+            shell_print(sh, "%-7s %-9s %10u %10u %10u %10u",
+                        lx200_command_family_to_string(family), stages[stage], histogram->count,
+                        histogram->min_us, lx200_histogram_percentile(histogram, 990),
+                        histogram->max_us);
+        }
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(sessions); i++) {
+        if (sessions[i].latency.dropped > 0) {
+            shell_print(sh, "session %zu: %u transmit samples dropped", i,
+                        sessions[i].latency.dropped);
+        }
+    }
+
+    return 0;
+}
+
+static int cmdLatencyReset(const struct shell *sh, size_t argc, char **argv) {
+    // Races with the dispatcher recording a sample, at worst that sample is lost
+    lx200_latency_init(&latencies);
+    shell_print(sh, "latency histograms reset");
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(latencyCommands,
+    SHELL_CMD(reset, NULL, "Reset the latency histograms", cmdLatencyReset),
+    SHELL_SUBCMD_SET_END);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(lx200Commands,
+    SHELL_CMD(latency, &latencyCommands, "Show the command latency per family", cmdLatencyShow),
+    SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(lx200, &lx200Commands, "LX200 command sessions", NULL);
+
+#endif
@@ -0,0 +1,264 @@
+#include <control/UartTransport.hpp>
+
+#include <errno.h>
+#include <string.h>
+
+#include <control/Dispatcher.hpp>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(Dispatcher, CONFIG_CONTROL_LOG_LEVEL);
+
+int UartTransport::start(const struct device *uart, lx200_session_t &session,
+                         Dispatcher &dispatcher) {
+    this->uart = uart;
+    this->session = &session;
+    this->dispatcher = &dispatcher;
+
+    lx200_framer_set_ack_handler(&session.framer, ackReceived, this);
+
+#if defined(CONFIG_UART_ASYNC_API)
+    if (startAsync() == 0) {
+        LOG_INF("Session %u: %s receiving asynchronously", session.index, uart->name);
+        return 0;
+    }
+#endif
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN)
+    if (startInterrupt() == 0) {
+        LOG_INF("Session %u: %s receiving by interrupt", session.index, uart->name);
+        return 0;
+    }
+#endif
+
+    LOG_ERR("Session %u: %s supports neither async nor interrupt driven receive",
+            session.index, uart->name);
+    return -ENOTSUP;
+}
+
+void UartTransport::receive(const uint8_t *data, size_t length) {
+    const size_t frames =
+        lx200_session_receive(session, reinterpret_cast<const char *>(data), length);
+
+    stats.bytes += length;
+
+    // Partial frames stay in the framer, only wake the dispatcher for whole ones
+    if (frames > 0) {
+        stats.frames += frames;
+        dispatcher->notify();
+    }
+}
+
+int UartTransport::transmit(const char *data, size_t length) {
+    return queue(data, length);
+}
+
+bool UartTransport::canTransmit(size_t length) {
+    k_spinlock_key_t key = k_spin_lock(&txLock);
+    const bool fits = txLength[txCollect] + length <= sizeof(txBuffers[0]);
+
+    k_spin_unlock(&txLock, key);
+    return fits;
+}
+
+int UartTransport::queue(const char *data, size_t length) {
+    k_spinlock_key_t key = k_spin_lock(&txLock);
+
+    if (txLength[txCollect] + length > sizeof(txBuffers[0])) {
+        stats.overflows++;
+        k_spin_unlock(&txLock, key);
+        return -ENOBUFS;
+    }
+
+    memcpy(&txBuffers[txCollect][txLength[txCollect]], data, length);
+    txLength[txCollect] += length;
+
+    const bool start = !txBusy;
+
+    if (start) {
+        // The collected buffer goes on the wire, the other one collects
+        txBusy = true;
+        txCollect ^= 1;
+    }
+
+    k_spin_unlock(&txLock, key);
+
+    // The buffer in flight is left alone until writeDone(), no lock needed
+    if (start) {
+        startWrite();
+    }
+
+    return 0;
+}
+
+void UartTransport::startWrite() {
+    const uint8_t flight = txCollect ^ 1;
+
+    stats.writes++;
+
+#if defined(CONFIG_UART_ASYNC_API)
+    if (async) {
+        if (uart_tx(uart, reinterpret_cast<const uint8_t *>(txBuffers[flight]),
+                    txLength[flight], SYS_FOREVER_US) < 0) {
+            stats.txErrors++;
+            writeDone();
+        }
+        return;
+    }
+#endif
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN)
+    uart_irq_tx_enable(uart);
+#endif
+}
+
+void UartTransport::writeDone() {
+    k_spinlock_key_t key = k_spin_lock(&txLock);
+
+    txLength[txCollect ^ 1] = 0;
+
+    const bool start = txLength[txCollect] > 0;
+
+    if (start) {
+        txCollect ^= 1;
+    } else {
+        txBusy = false;
+    }
+
+    k_spin_unlock(&txLock, key);
+
+    if (start) {
+        startWrite();
+    }
+
+    // Sessions held back for a full transmit buffer can go on
+    dispatcher->notify();
+}
+
+void UartTransport::ackReceived(void *userData) {
+    auto *transport = static_cast<UartTransport *>(userData);
+
+    transport->stats.acks++;
+
+    // OpenAstroTech mounts are equatorial. Queued after the replies, never inside one.
+    const char answer = LX200_ALIGNMENT_POLAR;
+
+    transport->queue(&answer, 1);
+}
+
+#if defined(CONFIG_UART_ASYNC_API)
+
+int UartTransport::startAsync() {
+    int ret = uart_callback_set(uart, asyncCallback, this);
+
+    if (ret < 0) {
+        return ret;
+    }
+
+    nextBuffer = 1;
+    ret = uart_rx_enable(uart, buffers[0], sizeof(buffers[0]), CONFIG_CONTROL_UART_RX_TIMEOUT_US);
+
+    if (ret == 0) {
+        async = true;
+    }
+
+    return ret;
+}
+
+void UartTransport::asyncCallback(const struct device *dev, struct uart_event *evt,
+                                  void *userData) {
+    auto *transport = static_cast<UartTransport *>(userData);
+
+    switch (evt->type) {
+    case UART_TX_DONE:
+        transport->writeDone();
+        break;
+    case UART_TX_ABORTED:
+        transport->stats.txErrors++;
+        transport->writeDone();
+        break;
+    case UART_RX_RDY:
+        // Buffer full or line idle for CONFIG_CONTROL_UART_RX_TIMEOUT_US
+        transport->receive(&evt->data.rx.buf[evt->data.rx.offset], evt->data.rx.len);
+        break;
+    case UART_RX_BUF_REQUEST:
+        uart_rx_buf_rsp(dev, transport->buffers[transport->nextBuffer],
+                        sizeof(transport->buffers[0]));
+        transport->nextBuffer ^= 1;
+        break;
+    case UART_RX_STOPPED:
+        transport->stats.errors++;
+        break;
+    case UART_RX_DISABLED:
+        // Stopped by an error, start over with the first buffer
+        transport->nextBuffer = 1;
+        uart_rx_enable(dev, transport->buffers[0], sizeof(transport->buffers[0]),
+                       CONFIG_CONTROL_UART_RX_TIMEOUT_US);
+        break;
+    default:
+        break;
+    }
+}
+
+#endif
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN)
+
+int UartTransport::startInterrupt() {
+    int ret = uart_irq_callback_user_data_set(uart, interruptCallback, this);
+
+    if (ret < 0) {
+        return ret;
+    }
+
+    uart_irq_rx_enable(uart);
+    return 0;
+}
+
+void UartTransport::interruptCallback(const struct device *dev, void *userData) {
+    auto *transport = static_cast<UartTransport *>(userData);
+    uint8_t chunk[16];
+
+    if (uart_irq_update(dev) <= 0) {
+        return;
+    }
+
+    while (uart_irq_rx_ready(dev) > 0) {
+        const int length = uart_fifo_read(dev, chunk, sizeof(chunk));
+
+        if (length <= 0) {
+            break;
+        }
+
+        transport->receive(chunk, length);
+    }
+
+    if (uart_irq_tx_ready(dev) > 0) {
+        transport->fillFifo();
+    }
+}
+
+void UartTransport::fillFifo() {
+    const uint8_t flight = txCollect ^ 1;
+
+    if (!txBusy) {
+        uart_irq_tx_disable(uart);
+        return;
+    }
+
+    const int filled =
+        uart_fifo_fill(uart, reinterpret_cast<const uint8_t *>(&txBuffers[flight][txFilled]),
+                       txLength[flight] - txFilled);
+
+    if (filled > 0) {
+        txFilled += filled;
+    }
+
+    if (txFilled >= txLength[flight]) {
+        // Reset here, the next buffer may start from writeDone() right away
+        txFilled = 0;
+        uart_irq_tx_disable(uart);
+        writeDone();
+    }
+}
+
+#endif
@@ -1,6 +1,13 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#if defined(CONFIG_USB_DEVICE_STACK)
+#include <zephyr/usb/usb_device.h>
+#endif
 
+#if defined(CONFIG_CONTROL)
+#include <control/Dispatcher.hpp>
+#endif
+#include <mount/Executor.hpp>
 #include <mount/Mount.hpp>
 
 #include <lx200/lx200.h>
@@ -9,9 +16,32 @@ LOG_MODULE_REGISTER(main, CONFIG_APP_LOG_LEVEL);
 
 // Mount
 Mount mount;
+// Long mount operations, run on the executor thread
+Executor executor(mount);
+
+#if defined(CONFIG_CONTROL)
+// LX200 command sessions
+Dispatcher dispatcher(mount, executor);
+#endif
 
 int main()
 {
+	mount.initialize();
+	mount.start();
+	executor.start();
+
+#if defined(CONFIG_USB_DEVICE_STACK)
+	// USB CDC ACM sessions need the device stack running before they can receive
+	if (usb_enable(NULL) != 0) {
+		LOG_ERR("Failed to enable USB");
+	}
+#endif
+
+#if defined(CONFIG_CONTROL)
+	if (dispatcher.start() != 0) {
+		LOG_ERR("Failed to start the command dispatcher");
+	}
+#endif
 
 	// ReSharper disable CppDFAEndlessLoop
 	while (true)
@@ -0,0 +1,92 @@
+#include <mount/Executor.hpp>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(Mount, CONFIG_MOUNT_LOG_LEVEL);
+
+K_THREAD_STACK_DEFINE(executorStack, CONFIG_MOUNT_EXECUTOR_STACK_SIZE);
+
+Executor::Executor(Mount &mount) : mount(mount) {
+    for (size_t i = 0; i < priorities; i++) {
+        k_msgq_init(&queues[i], buffers[i], sizeof(Job), CONFIG_MOUNT_EXECUTOR_QUEUE_DEPTH);
+    }
+    k_sem_init(&ready, 0, K_SEM_MAX_LIMIT);
+}
+
+void Executor::start() {
+    k_thread_create(&thread, executorStack, K_THREAD_STACK_SIZEOF(executorStack), threadEntry,
+                    this, nullptr, nullptr, CONFIG_MOUNT_EXECUTOR_PRIORITY, 0, K_NO_WAIT);
+    k_thread_name_set(&thread, "executor");
+}
+
+int Executor::submit(Priority priority, const Job &job) {
+    if (k_msgq_put(&queues[static_cast<size_t>(priority)], &job, K_NO_WAIT) != 0) {
+        counters.rejected++;
+        LOG_WRN("Executor queue %u full", static_cast<unsigned int>(priority));
+        return -ENOMEM;
+    }
+
+    counters.submitted++;
+    k_sem_give(&ready);
+    return 0;
+}
+
+size_t Executor::cancel(Priority priority) {
+    struct k_msgq *queue = &queues[static_cast<size_t>(priority)];
+    size_t dropped = 0;
+    Job job;
+
+    // Taken one by one rather than purged, so a job the worker takes meanwhile is not counted
+    while (k_msgq_get(queue, &job, K_NO_WAIT) == 0) {
+        dropped++;
+    }
+
+    counters.cancelled += dropped;
+    return dropped;
+}
+
+size_t Executor::pending() {
+    size_t count = 0;
+
+    for (auto &queue : queues) {
+        count += k_msgq_num_used_get(&queue);
+    }
+
+    return count;
+}
+
+Executor::Stats Executor::stats() const {
+    return counters;
+}
+
+void Executor::threadEntry(void *p1, void *p2, void *p3) {
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    static_cast<Executor *>(p1)->run();
+}
+
+void Executor::run() {
+    Job job;
+
+    while (true) {
+        k_sem_take(&ready, K_FOREVER);
+
+        // Cancelled jobs leave their semaphore count behind, so the queues may be empty
+        if (!next(job)) {
+            continue;
+        }
+
+        job.run(mount, job);
+        counters.completed++;
+    }
+}
+
+bool Executor::next(Job &job) {
+    for (auto &queue : queues) {
+        if (k_msgq_get(&queue, &job, K_NO_WAIT) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -1,12 +1,165 @@
 #include <mount/Mount.hpp>
 
+#include <cstring>
+
+#include <zephyr/devicetree.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/zbus/zbus.h>
+#include <motion/motion_track.h>
+#if defined(CONFIG_MOTION_STEP)
+#include <motion/motion_ramp.h>
+#endif
+#if defined(CONFIG_MOTION_STEP_COUNTER) && DT_NODE_HAS_STATUS(DT_NODELABEL(stepper0), okay)
+#include <motion/motion_step_counter.h>
+#define RA_STEPPER DT_NODELABEL(stepper0)
+#if DT_NODE_HAS_STATUS(DT_NODELABEL(stepper1), okay)
+#define DEC_STEPPER DT_NODELABEL(stepper1)
+#endif
+#elif defined(CONFIG_MOTION_STEP_EMUL)
+#define STEP_EMUL
+#endif
 LOG_MODULE_REGISTER(Mount, CONFIG_MOUNT_LOG_LEVEL);
 
+// Deadlines are absolute tick counts
+BUILD_ASSERT(IS_ENABLED(CONFIG_TIMEOUT_64BIT), "the mount control loop needs 64 bit timeouts");
+
+K_THREAD_STACK_DEFINE(controlStack, CONFIG_MOUNT_THREAD_STACK_SIZE);
+
+// Commands reach the control thread as copies, so publishers never wait for a period
+ZBUS_MSG_SUBSCRIBER_DEFINE(mount_control_sub);
+ZBUS_CHAN_DEFINE(mount_command_chan, Mount::Command, nullptr, nullptr,
+                 ZBUS_OBSERVERS(mount_control_sub),
+                 ZBUS_MSG_INIT(.type = Mount::Command::Type::Stop));
+
+/**
+ * @brief Horizontal coordinates of a position in seconds of RA and arcseconds
+ */
+static void toHorizontal(const astro_site_t &site, uint32_t lst, int32_t raSeconds,
+                         int32_t decArcsec, int32_t &altArcsec, int32_t &azArcsec) {
+    const astro_equatorial_t equatorial = {
+        .ra = astro_ra_seconds_to_angle(raSeconds),
+        .dec = static_cast<int32_t>(astro_arcsec_to_angle(decArcsec)),
+    };
+    astro_horizontal_t horizontal;
+
+    astro_to_horizontal(&site, lst, &equatorial, &horizontal, 1);
+    altArcsec = astro_angle_to_arcsec(horizontal.alt);
+    azArcsec = astro_angle_to_arcsec_unsigned(horizontal.az);
+}
+
+// Milliseconds of RA in a turn of the RA axis
+static constexpr int64_t raTurnMs = 86400000;
+
+/**
+ * @brief Wrap milliseconds of RA or hour angle into a turn
+ */
+static uint32_t wrapRaMs(int64_t ms) {
+    const int64_t wrapped = ms % raTurnMs;
+
+    return static_cast<uint32_t>(wrapped < 0 ? wrapped + raTurnMs : wrapped);
+}
+
+#if defined(CONFIG_MOTION_STEP)
+// Sidereal day in milliseconds
+static constexpr uint64_t siderealDayMs = 86164091;
+// Arcseconds in a turn of the DEC axis
+static constexpr int64_t decTurnArcsec = 1296000;
+// Slews are planned again with the duration of the last plan until the RA steps settle
+static constexpr int slewPlanPasses = 4;
+// RA rates are held in halves of the tracking rate, a guide pulse adds or takes one half
+static constexpr int32_t trackingHalves = 2;
+// The RA hold runs at a tracking rate selected before the last one, it is started again
+static constexpr int32_t raHalvesStale = INT32_MIN;
+// DEC guide pulses run as moves of at most a minute, each planned at the RA rate of the moment
+static constexpr uint32_t guideChunkPeriods = 60 * USEC_PER_SEC / CONFIG_MOUNT_CONTROL_PERIOD_US;
+
+#if defined(CONFIG_MOUNT_PEC)
+// Guide pulses move RA at half the sidereal rate, in thousandths of a step per control period
+static constexpr int32_t guideMillisteps = CONFIG_MOUNT_RA_STEPS_PER_REV * 1000000ULL /
+                                           siderealDayMs * CONFIG_MOUNT_CONTROL_PERIOD_US /
+                                           2 / 1000000;
+#endif
+
+// Planned once, slews of any length read a ramp up and back down
+static uint32_t rampFromRest[CONFIG_MOUNT_SLEW_RAMP_SIZE];
+static uint32_t rampFromTracking[CONFIG_MOUNT_SLEW_RAMP_SIZE];
+#endif
+
+#if defined(RA_STEPPER)
+/**
+ * @brief Levels of the M0 and M1 pins of the DRV8424 for a microstep resolution
+ */
+struct MicrostepPins
+{
+    uint32_t microsteps;
+    motion_step_pin_level_t m0;
+    motion_step_pin_level_t m1;
+};
+
+// 1/64 needs a resistor on M1
+static constexpr MicrostepPins drv8424Microsteps[] = {
+    {1, MOTION_STEP_PIN_LOW, MOTION_STEP_PIN_LOW},
+    {2, MOTION_STEP_PIN_OPEN, MOTION_STEP_PIN_LOW},
+    {4, MOTION_STEP_PIN_LOW, MOTION_STEP_PIN_HIGH},
+    {8, MOTION_STEP_PIN_HIGH, MOTION_STEP_PIN_HIGH},
+    {16, MOTION_STEP_PIN_OPEN, MOTION_STEP_PIN_HIGH},
+    {32, MOTION_STEP_PIN_LOW, MOTION_STEP_PIN_OPEN},
+    {128, MOTION_STEP_PIN_OPEN, MOTION_STEP_PIN_OPEN},
+    {256, MOTION_STEP_PIN_HIGH, MOTION_STEP_PIN_OPEN},
+};
+
+static constexpr size_t microstepIndex() {
+    size_t i = 0;
+
+    while (i < ARRAY_SIZE(drv8424Microsteps) &&
+           drv8424Microsteps[i].microsteps != CONFIG_MOUNT_MICROSTEPS) {
+        i++;
+    }
+    return i;
+}
+
+BUILD_ASSERT(microstepIndex() < ARRAY_SIZE(drv8424Microsteps),
+             "CONFIG_MOUNT_MICROSTEPS is not a resolution of the DRV8424");
+
+// Enabled, awake and microstepping once the axis is added, pins missing from the node are left out
+#define STEPPER_DRIVER(node)                                                                       \
+    {                                                                                              \
+        .enable = GPIO_DT_SPEC_GET_OR(node, en_gpios, {}),                                         \
+        .sleep = GPIO_DT_SPEC_GET_OR(node, sleep_gpios, {}),                                       \
+        .mode = {GPIO_DT_SPEC_GET_OR(node, m0_gpios, {}),                                          \
+                 GPIO_DT_SPEC_GET_OR(node, m1_gpios, {})},                                         \
+        .mode_level = {drv8424Microsteps[microstepIndex()].m0,                                     \
+                       drv8424Microsteps[microstepIndex()].m1},                                    \
+    }
+
+// Step edges of both axes are scheduled on the counter of the RA stepper node
+static motion_step_counter_t stepBackend;
+static const struct gpio_dt_spec raStepPin = GPIO_DT_SPEC_GET(RA_STEPPER, step_gpios);
+static const struct gpio_dt_spec raDirPin = GPIO_DT_SPEC_GET(RA_STEPPER, dir_gpios);
+static const motion_step_driver_t raDriver = STEPPER_DRIVER(RA_STEPPER);
+#endif
+#if defined(DEC_STEPPER)
+static const struct gpio_dt_spec decStepPin = GPIO_DT_SPEC_GET(DEC_STEPPER, step_gpios);
+static const struct gpio_dt_spec decDirPin = GPIO_DT_SPEC_GET(DEC_STEPPER, dir_gpios);
+static const motion_step_driver_t decDriver = STEPPER_DRIVER(DEC_STEPPER);
+#endif
+#if defined(STEP_EMUL)
+// Without a stepper node both axes step on a software counter, advanced by the tests
+static motion_step_emul_t stepEmul;
+static constexpr uint32_t stepEmulFrequency = 1000000;
+#endif
+
 Mount::Mount() {
     LOG_DBG("creating Mount");
-    // Constructor implementation
+    motion_stop_init(&stop);
+    astro_lst_init(&siderealTime, CONFIG_SYS_CLOCK_TICKS_PER_SEC);
+    astro_corrections_init(&corrections);
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+    astro_corrections_init(&slewCorrections);
+#else
+    astro_corrections_init(&catalogCorrections);
+#endif
 }
 
 Mount::~Mount() {
@@ -16,14 +169,1188 @@ Mount::~Mount() {
 void Mount::initialize() {
 
     LOG_INF("Initializing the mount");
+
+#if defined(RA_STEPPER) || defined(STEP_EMUL)
+    uint32_t axes = MOTION_AXIS_RA;
+
+#if defined(RA_STEPPER)
+    const struct device *counter = DEVICE_DT_GET(DT_PHANDLE(RA_STEPPER, counter));
+
+    stepsReady = motion_step_counter_init(&stepBackend, &steps, counter, 0) == 0 &&
+                 motion_step_counter_add_axis(&stepBackend, MOTION_AXIS_RA, &raStepPin,
+                                              &raDirPin, &raDriver) == 0;
+#if defined(DEC_STEPPER)
+    if (stepsReady && motion_step_counter_add_axis(&stepBackend, MOTION_AXIS_DEC, &decStepPin,
+                                                   &decDirPin, &decDriver) == 0) {
+        axes |= MOTION_AXIS_DEC;
+    }
+#endif
+    stepsReady = stepsReady && motion_step_init(&steps, &stepBackend.hw, &stop, axes,
+                                                CONFIG_MOTION_STEP_PULSE_NS) == 0;
+#else
+    axes |= MOTION_AXIS_DEC;
+    motion_step_emul_init(&stepEmul, &steps, stepEmulFrequency);
+    stepsReady =
+        motion_step_init(&steps, &stepEmul.hw, &stop, axes, CONFIG_MOTION_STEP_PULSE_NS) == 0;
+#endif
+    if (!stepsReady) {
+        LOG_ERR("Step generation not available");
+    } else {
+        if ((axes & MOTION_AXIS_DEC) == 0) {
+            LOG_WRN("No DEC stepper, slews only move RA");
+        }
+#if defined(CONFIG_MOUNT_PEC)
+        pecReady = motion_pec_init(&pec, MOTION_AXIS_RA, CONFIG_MOUNT_RA_WORM_STEPS) == 0 &&
+                   motion_step_set_pec(&steps, &pec) == 0;
+        if (!pecReady) {
+            LOG_ERR("Periodic error correction not available");
+        }
+#endif
+        planRamps();
+    }
+#endif
+}
+
+#if defined(CONFIG_MOTION_STEP)
+void Mount::planRamps() {
+    const uint32_t sidereal = CONFIG_MOUNT_RA_STEPS_PER_REV * 1000000ULL / siderealDayMs;
+    motion_ramp_profile_t profile = {
+        .start_mhz = 0,
+        .cruise_mhz = sidereal * CONFIG_MOUNT_SLEW_RATE,
+        .accel = CONFIG_MOUNT_SLEW_ACCEL,
+        .jerk = CONFIG_MOUNT_SLEW_JERK,
+    };
+    const uint32_t frequency = steps.hw->frequency;
+    const int rest = motion_ramp_build(&profile, frequency, rampFromRest, ARRAY_SIZE(rampFromRest));
+
+    profile.start_mhz = sidereal;
+    const int tracking =
+        motion_ramp_build(&profile, frequency, rampFromTracking, ARRAY_SIZE(rampFromTracking));
+
+    if (rest < 0 || tracking < 0) {
+        LOG_ERR("Slew ramp needs %u entries, increase CONFIG_MOUNT_SLEW_RAMP_SIZE",
+                motion_ramp_steps(&profile));
+        stepsReady = false;
+        return;
+    }
+
+    restRampSize = rest;
+    trackingRampSize = tracking;
+    LOG_INF("Slew ramp of %d steps up to %u mHz", rest, profile.cruise_mhz);
+    updateTrackingPeriod();
+}
+#endif
+
+void Mount::start() {
+    k_thread_create(&thread, controlStack, K_THREAD_STACK_SIZEOF(controlStack), threadEntry,
+                    this, nullptr, nullptr, CONFIG_MOUNT_THREAD_PRIORITY, 0, K_NO_WAIT);
+    k_thread_name_set(&thread, "mount");
+}
+
+int Mount::submit(const Command &command) {
+    return zbus_chan_pub(&mount_command_chan, &command, K_NO_WAIT);
+}
+
+Mount::ControlStats Mount::controlStats() const {
+    return counters;
+}
+
+void Mount::threadEntry(void *p1, void *p2, void *p3) {
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    static_cast<Mount *>(p1)->controlLoop();
+}
+
+void Mount::controlLoop() {
+    const int64_t period = k_us_to_ticks_ceil64(CONFIG_MOUNT_CONTROL_PERIOD_US);
+    int64_t deadline = k_uptime_ticks();
+
+    while (true) {
+        deadline += period;
+        k_sleep(K_TIMEOUT_ABS_TICKS(deadline));
+
+        const int64_t late = k_uptime_ticks() - deadline;
+
+        counters.maxLatenessUs = MAX(counters.maxLatenessUs, k_ticks_to_us_ceil32(late));
+        if (late >= period) {
+            // Keep the cadence rather than running the missed periods back to back
+            counters.overruns++;
+            deadline += late / period * period;
+        }
+
+        const struct zbus_channel *channel;
+        Command command;
+
+        while (zbus_sub_wait_msg(&mount_control_sub, &channel, &command, K_NO_WAIT) == 0) {
+            apply(command);
+            counters.commands++;
+        }
+
+        controlStep();
+        counters.periods++;
+    }
+}
+
+void Mount::apply(const Command &command) {
+    switch (command.type) {
+    case Command::Type::Track:
+        control.tracking = command.args[0] != 0;
+        break;
+    case Command::Type::TrackRate:
+        control.trackingRate = static_cast<TrackingRate>(command.args[0]);
+        control.customRateMhz = command.args[1];
+#if defined(CONFIG_MOTION_STEP)
+        if (stepsReady) {
+            updateTrackingPeriod();
+        }
+#endif
+        break;
+    case Command::Type::Slew:
+    case Command::Type::Park:
+#if defined(CONFIG_MOUNT_PEC)
+        if (pec.recording) {
+            // The worm phase jumps, the recording would mix two parts of the turn
+            LOG_WRN("Slew drops the periodic error recording");
+            applyPec(PecMode::Off);
+        }
+#endif
+        control.slewing = true;
+        control.slewStarted = false;
+        control.slewRaSeconds = command.args[0];
+        control.slewDecArcsec = command.args[1];
+        control.slewPointRaSeconds = command.args[2];
+        control.slewPointDecArcsec = command.args[3];
+        // Park and home are positions of the axes, the sky turns past them
+        control.slewHourAngle = command.type == Command::Type::Park;
+        if (control.slewHourAngle) {
+            control.tracking = false;
+        }
+        break;
+    case Command::Type::Guide: {
+        const auto direction = static_cast<GuideDirection>(command.args[0]);
+        const size_t axis =
+            direction == GuideDirection::East || direction == GuideDirection::West ? 0 : 1;
+        const uint64_t us = static_cast<uint64_t>(MAX(command.args[1], 0)) * USEC_PER_MSEC;
+
+        // Pulses until stopped outlast any session
+        control.guidePeriods[axis] = command.args[1] < 0
+                                         ? UINT32_MAX
+                                         : DIV_ROUND_UP(us, CONFIG_MOUNT_CONTROL_PERIOD_US);
+        control.guideSign[axis] =
+            direction == GuideDirection::North || direction == GuideDirection::West ? 1 : -1;
+        break;
+    }
+    case Command::Type::Stop:
+        if (command.args[0] & MOTION_AXIS_RA) {
+            control.guidePeriods[0] = 0;
+        }
+        if (command.args[0] & MOTION_AXIS_DEC) {
+            control.guidePeriods[1] = 0;
+        }
+        if (command.args[0] != 0) {
+            // A started slew stops short of its target, it is reported from its steps at rest
+            control.settling = control.settling || control.slewStarted;
+            control.slewing = false;
+            control.slewStarted = false;
+            atomic_set(&slewTotalMs, 0);
+        }
+        break;
+    case Command::Type::Site:
+        control.siteKnown = astro_site_init(&control.site, command.args[0]) == 0;
+        updateEquatorial(reported.raSeconds, reported.decArcsec);
+        break;
+    case Command::Type::Pec:
+#if defined(CONFIG_MOUNT_PEC)
+        if (pecReady) {
+            applyPec(static_cast<PecMode>(command.args[0]));
+        }
+#endif
+        break;
+    }
+}
+
+void Mount::controlStep() {
+    const uint32_t stopped = motion_stop_pending(&stop);
+
+    if (stopped != 0) {
+        uint32_t acknowledged = stopped;
+
+#if defined(CONFIG_MOTION_STEP)
+        // An axis standing still is acknowledged here, tracking of the other one goes on
+        if (stepsReady && (stopped & motion_step_moving_axes(&steps)) != 0) {
+            if (!motion_step_arrived(&steps)) {
+                // The step ISR runs both axes down the ramp and acknowledges them at rest
+                acknowledged &= ~steps.axes;
+            } else if ((stopped & MOTION_AXIS_RA) != 0) {
+                motion_step_stop(&steps);
+            }
+        }
+#endif
+        // Tracking goes on after a stop, like on the LX200
+        apply({Command::Type::Stop, {static_cast<int32_t>(stopped)}});
+        if (acknowledged != 0) {
+            motion_stop_complete(&stop, acknowledged);
+        }
+    }
+
+#if defined(CONFIG_MOTION_STEP)
+    if (stepsReady && control.settling && motion_step_arrived(&steps)) {
+        control.settling = false;
+        updateFromSteps();
+    }
+#endif
+
+    if (control.slewing && runSlew()) {
+        control.slewing = false;
+        control.slewStarted = false;
+        atomic_set(&slewTotalMs, 0);
+        if (control.slewHourAngle) {
+            const int32_t raSeconds = wrapRaMs(static_cast<int64_t>(siderealTimeMs()) -
+                                               static_cast<int64_t>(control.slewRaSeconds) *
+                                                   MSEC_PER_SEC) /
+                                      MSEC_PER_SEC;
+
+            control.slewRaSeconds = raSeconds;
+            control.slewPointRaSeconds = raSeconds;
+        }
+        // The client gets its target back, the mount points at its observed place
+        control.pointRaSeconds = control.slewPointRaSeconds;
+        control.pointDecArcsec = control.slewPointDecArcsec;
+        updateEquatorial(control.slewRaSeconds, control.slewDecArcsec);
+#if defined(CONFIG_MOTION_STEP)
+        if (stepsReady) {
+            // The plan aimed at the target on arrival, the steps point at it from here
+            anchorSteps(control.pointRaSeconds, control.pointDecArcsec);
+        }
+#endif
+        LOG_INF("Slew arrived at RA %ds DEC %d\"", control.slewRaSeconds,
+                control.slewDecArcsec);
+    }
+
+#if defined(CONFIG_MOTION_STEP)
+    if (stepsReady && !control.slewing) {
+        updateTracking();
+    }
+#endif
+
+#if defined(CONFIG_MOUNT_PEC)
+    if (pecReady && pec.recording) {
+        recordPec();
+    }
+#endif
+
+    for (auto &periods : control.guidePeriods) {
+        if (periods > 0) {
+            periods--;
+        }
+    }
+
+    const int32_t lstSeconds = siderealTimeMs() / MSEC_PER_SEC;
+
+    if (lstSeconds != reported.lstSeconds) {
+        updateSiderealTime(lstSeconds);
+        // The sky turns, the altitude and azimuth of a tracked position follow it
+        updateEquatorial(reported.raSeconds, reported.decArcsec);
+    }
+}
+
+bool Mount::runSlew() {
+#if defined(CONFIG_MOTION_STEP)
+    if (stepsReady) {
+        if (!control.slewStarted) {
+            startSlew();
+            return false;
+        }
+        return motion_step_arrived(&steps);
+    }
+#endif
+
+    // Without step generation the slew arrives within one period
+    return true;
+}
+
+#if defined(CONFIG_MOTION_STEP)
+void Mount::startSlew() {
+    if (motion_step_busy(&steps) && !motion_step_arrived(&steps)) {
+        // Bring the previous slew to rest, it is reported from there before planning
+        motion_step_decelerate(&steps);
+        control.settling = true;
+        return;
+    }
+
+    if (!control.anchored) {
+        anchorSteps(control.pointRaSeconds, control.pointDecArcsec);
+    }
+
+    const int32_t decDelta =
+        control.slewPointDecArcsec - stepDeclination(motion_step_position(&steps, MOTION_AXIS_DEC));
+    const bool decForward = decDelta > 0;
+    const uint32_t decSteps =
+        (steps.axes & MOTION_AXIS_DEC) == 0
+            ? 0
+            : static_cast<uint64_t>(decDelta < 0 ? -decDelta : decDelta) *
+                  CONFIG_MOUNT_DEC_STEPS_PER_REV / decTurnArcsec;
+    const uint32_t haMs = stepHourAngleMs(motion_step_position(&steps, MOTION_AXIS_RA));
+    const uint32_t lstMs = siderealTimeMs();
+    uint32_t raSteps = 0;
+    bool raForward = false;
+    motion_step_move_t move = slewMove(0, false, decSteps, decForward);
+
+    // The sky turns while the slew runs, RA aims at the hour angle of the target on arrival
+    for (int pass = 0; pass < slewPlanPasses; pass++) {
+        const int64_t elapsedMs =
+            motion_step_move_ticks(&move) * MSEC_PER_SEC / steps.hw->frequency;
+        const uint32_t targetHaMs =
+            control.slewHourAngle
+                ? control.slewPointRaSeconds * MSEC_PER_SEC
+                : wrapRaMs(lstMs + elapsedMs * raTurnMs / static_cast<int64_t>(siderealDayMs) -
+                           static_cast<int64_t>(control.slewPointRaSeconds) * MSEC_PER_SEC);
+        // RA steps count hour angle, the shorter way round
+        int64_t delta = static_cast<int64_t>(targetHaMs) - haMs;
+
+        if (delta > raTurnMs / 2) {
+            delta -= raTurnMs;
+        } else if (delta <= -raTurnMs / 2) {
+            delta += raTurnMs;
+        }
+
+        const uint32_t planned =
+            (delta < 0 ? -delta : delta) * CONFIG_MOUNT_RA_STEPS_PER_REV / raTurnMs;
+
+        if (pass > 0 && planned == raSteps && (delta > 0) == raForward) {
+            break;
+        }
+        raSteps = planned;
+        raForward = delta > 0;
+        move = slewMove(raSteps, raForward, decSteps, decForward);
+    }
+
+    if (raSteps == 0 && decSteps == 0) {
+        control.slewStarted = true;
+        return;
+    }
+
+    if (motion_step_busy(&steps)) {
+        motion_step_stop(&steps);
+    }
+
+    if (motion_step_start(&steps, &move) != 0) {
+        LOG_ERR("Slew of %u RA and %u DEC steps not started", raSteps, decSteps);
+        control.slewing = false;
+        return;
+    }
+
+    const uint32_t durationMs =
+        motion_step_move_ticks(&move) * MSEC_PER_SEC / steps.hw->frequency;
+
+    atomic_set(&slewEndMs, k_uptime_get_32() + durationMs);
+    atomic_set(&slewTotalMs, MAX(durationMs, 1U));
+
+    control.slewStarted = true;
+    control.raHalves = move.hold != 0 ? trackingHalves : 0;
+    LOG_INF("Slewing RA %u steps %s, DEC %u steps %s in %u ms", raSteps,
+            raForward ? "west" : "east", decSteps, decForward ? "north" : "south", durationMs);
+}
+
+motion_step_move_t Mount::slewMove(uint32_t raSteps, bool raForward, uint32_t decSteps,
+                                   bool decForward) const {
+    // Both axes move in one move planned for the longer one, the other follows by DDA
+    const bool raLeads = raSteps >= decSteps;
+    // Blend into tracking when RA leads and ends in the tracking direction
+    const bool blend = control.tracking && raLeads && raForward;
+
+    return {
+        .intervals = blend ? rampFromTracking : rampFromRest,
+        .count = blend ? trackingRampSize : restRampSize,
+        .steps = raLeads ? raSteps : decSteps,
+        .hold = blend ? raPeriods[trackingHalves].ticks : 0,
+        .forward = raLeads ? raForward : decForward,
+        .axis = static_cast<uint32_t>(raLeads ? MOTION_AXIS_RA : MOTION_AXIS_DEC),
+        .follow_steps = raLeads ? decSteps : raSteps,
+        .follow_forward = raLeads ? decForward : raForward,
+        .hold_frac = blend ? raPeriods[trackingHalves].frac : 0,
+        .hold_modulus = blend ? raPeriods[trackingHalves].modulus : 0,
+    };
+}
+
+void Mount::anchorSteps(int32_t raSeconds, int32_t decArcsec) {
+    const int32_t raPosition = motion_step_position(&steps, MOTION_AXIS_RA);
+    const int32_t decPosition = motion_step_position(&steps, MOTION_AXIS_DEC);
+    const int64_t haMs =
+        static_cast<int64_t>(siderealTimeMs()) - static_cast<int64_t>(raSeconds) * MSEC_PER_SEC;
+
+    control.raZeroMs = wrapRaMs(haMs - static_cast<int64_t>(raPosition) * raTurnMs /
+                                           CONFIG_MOUNT_RA_STEPS_PER_REV);
+    control.decZeroArcsec = static_cast<int32_t>(
+        decArcsec - static_cast<int64_t>(decPosition) * decTurnArcsec / CONFIG_MOUNT_DEC_STEPS_PER_REV);
+    control.anchored = true;
+}
+
+uint32_t Mount::stepHourAngleMs(int32_t raPosition) const {
+    return wrapRaMs(control.raZeroMs +
+                    static_cast<int64_t>(raPosition) * raTurnMs / CONFIG_MOUNT_RA_STEPS_PER_REV);
+}
+
+int32_t Mount::stepDeclination(int32_t decPosition) const {
+    return static_cast<int32_t>(control.decZeroArcsec + static_cast<int64_t>(decPosition) *
+                                                             decTurnArcsec /
+                                                             CONFIG_MOUNT_DEC_STEPS_PER_REV);
+}
+
+void Mount::updateFromSteps() {
+    if (!control.anchored) {
+        return;
+    }
+
+    const uint32_t haMs = stepHourAngleMs(motion_step_position(&steps, MOTION_AXIS_RA));
+    const uint32_t raMs = wrapRaMs(static_cast<int64_t>(siderealTimeMs()) - haMs);
+
+    control.pointRaSeconds = raMs / MSEC_PER_SEC;
+    control.pointDecArcsec = stepDeclination(motion_step_position(&steps, MOTION_AXIS_DEC));
+
+    int32_t raSeconds = control.pointRaSeconds;
+    int32_t decArcsec = control.pointDecArcsec;
+
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+    k_spinlock_key_t key = k_spin_lock(&correctionsLock);
+
+    // Reported in the catalog frame the client set its target in
+    if (slewCorrected) {
+        meanPlace(slewCorrections, slewRefracted && control.siteKnown ? &control.site : nullptr,
+                  raSeconds, decArcsec);
+    }
+    k_spin_unlock(&correctionsLock, key);
+#endif
+
+    updateEquatorial(raSeconds, decArcsec);
+    LOG_INF("Slew stopped at RA %ds DEC %d\"", reported.raSeconds, reported.decArcsec);
+}
+
+void Mount::updateTracking() {
+    if (!motion_step_arrived(&steps)) {
+        // Still running down the ramp of a stopped slew, or a DEC guide pulse
+        return;
+    }
+
+    int32_t halves = control.tracking ? trackingHalves : 0;
+
+    if (control.guidePeriods[0] > 0) {
+        const int32_t guided = halves + control.guideSign[0];
+
+        // RA also guides with tracking off, east of a half rate turns it around
+        if (guided == 0 || raPeriods[guided < 0 ? -guided : guided].ticks != 0) {
+            halves = guided;
+        }
+    }
+
+    if (control.guidePeriods[1] > 0 && (steps.axes & MOTION_AXIS_DEC) != 0 &&
+        startDecGuide(halves)) {
+        return;
+    }
+
+    const bool busy = motion_step_busy(&steps);
+    const int32_t held = busy ? control.raHalves : 0;
+
+    if (halves == held) {
+        return;
+    }
+
+    const motion_step_period_t &period = raPeriods[halves < 0 ? -halves : halves];
+
+    // A hold in the same direction changes rate on its next step, keeping its phase
+    if (held != raHalvesStale && held != 0 && halves != 0 && (held > 0) == (halves > 0) &&
+        motion_step_set_hold(&steps, &period) == 0) {
+        control.raHalves = halves;
+        return;
+    }
+
+    if (busy) {
+        motion_step_stop(&steps);
+    }
+    control.raHalves = 0;
+
+    if (halves != 0) {
+        const motion_step_move_t move = {
+            .hold = period.ticks,
+            .forward = halves > 0,
+            .axis = MOTION_AXIS_RA,
+            .hold_frac = period.frac,
+            .hold_modulus = period.modulus,
+        };
+
+        if (motion_step_start(&steps, &move) != 0) {
+            LOG_ERR("Tracking not started");
+            return;
+        }
+        control.raHalves = halves;
+    }
+}
+
+bool Mount::startDecGuide(int32_t raHalves) {
+    // Planned again when the RA guide pulse ends, the RA rate changes there
+    uint32_t periods = MIN(control.guidePeriods[1], guideChunkPeriods);
+
+    if (control.guidePeriods[0] > 0) {
+        periods = MIN(periods, control.guidePeriods[0]);
+    }
+
+    const uint64_t us = static_cast<uint64_t>(periods) * CONFIG_MOUNT_CONTROL_PERIOD_US;
+    const uint64_t ticks = us * steps.hw->frequency / USEC_PER_SEC;
+    // DEC guides at half the sidereal rate
+    const uint32_t decSteps = DIV_ROUND_CLOSEST(us * CONFIG_MOUNT_DEC_STEPS_PER_REV,
+                                                2 * siderealDayMs * USEC_PER_MSEC);
+    const motion_step_period_t &period = raPeriods[raHalves < 0 ? -raHalves : raHalves];
+    const uint32_t raSteps = raHalves == 0 ? 0 : ticks / period.ticks;
+
+    if (decSteps == 0) {
+        // Less than a DEC step left, RA goes on at its rate
+        return false;
+    }
+
+    // RA leads at its rate and holds it after the pulse, DEC follows by DDA
+    const bool raLeads = raSteps >= decSteps;
+    const bool decForward = control.guideSign[1] > 0;
+
+    guideInterval = raLeads ? period.ticks : ticks / decSteps;
+
+    const motion_step_move_t move = {
+        .intervals = &guideInterval,
+        .count = 1,
+        .steps = raLeads ? raSteps : decSteps,
+        .hold = raLeads ? period.ticks : 0,
+        .forward = raLeads ? raHalves > 0 : decForward,
+        .axis = static_cast<uint32_t>(raLeads ? MOTION_AXIS_RA : MOTION_AXIS_DEC),
+        .follow_steps = raLeads ? decSteps : raSteps,
+        .follow_forward = raLeads ? decForward : raHalves > 0,
+        .hold_frac = raLeads ? period.frac : 0,
+        .hold_modulus = raLeads ? period.modulus : 0,
+    };
+
+    if (motion_step_busy(&steps)) {
+        motion_step_stop(&steps);
+    }
+    control.raHalves = 0;
+
+    if (motion_step_start(&steps, &move) != 0) {
+        LOG_ERR("DEC guide pulse of %u steps not started", decSteps);
+        control.guidePeriods[1] = 0;
+        return false;
+    }
+
+    control.raHalves = raLeads ? raHalves : 0;
+    return true;
+}
+
+void Mount::updateTrackingPeriod() {
+    static constexpr uint32_t days[] = {
+        MOTION_TRACK_SIDEREAL_DAY,
+        MOTION_TRACK_SOLAR_DAY,
+        MOTION_TRACK_LUNAR_DAY,
+        MOTION_TRACK_SOLAR_DAY,
+    };
+    const bool custom = control.trackingRate == TrackingRate::Custom;
+    const uint32_t rateMhz = custom ? control.customRateMhz : MOTION_TRACK_DAY_MHZ;
+    motion_step_period_t periods[ARRAY_SIZE(raPeriods)] = {};
+
+    // Halves of the rate on a day of twice the length keep the interval exact
+    for (uint32_t halves = 1; halves < ARRAY_SIZE(periods); halves++) {
+        const motion_track_rate_t rate = {
+            .steps_per_rev = CONFIG_MOUNT_RA_STEPS_PER_REV,
+            .rate_mhz = rateMhz * halves,
+            .day = 2 * days[static_cast<size_t>(control.trackingRate)],
+        };
+
+        if (motion_track_period(&rate, steps.hw->frequency, &periods[halves]) != 0) {
+            // Guide pulses leave a rate out of range alone
+            periods[halves] = {};
+        }
+    }
+
+    if (periods[trackingHalves].ticks == 0) {
+        LOG_ERR("Tracking rate of %u mHz out of range", rateMhz);
+        return;
+    }
+
+    memcpy(raPeriods, periods, sizeof(raPeriods));
+
+    if (!motion_step_busy(&steps) || control.raHalves == 0) {
+        return;
+    }
+
+    // A running RA hold changes rate on its next step, keeping its phase
+    if (control.slewing || !motion_step_arrived(&steps) || control.raHalves == raHalvesStale ||
+        motion_step_set_hold(&steps, &raPeriods[control.raHalves < 0 ? -control.raHalves
+                                                                      : control.raHalves]) != 0) {
+        control.raHalves = raHalvesStale;
+    }
+}
+
+#if defined(CONFIG_MOUNT_PEC)
+void Mount::applyPec(PecMode mode) {
+    motion_pec_record_cancel(&pec);
+    motion_pec_play(&pec, false);
+
+    if (mode == PecMode::Play && motion_pec_play(&pec, true) != 0) {
+        // Nothing to play yet, the recording is played back once done
+        mode = PecMode::Record;
+    }
+
+    if (mode == PecMode::Record) {
+        motion_pec_record_start(&pec, motion_step_position(&steps, MOTION_AXIS_RA));
+        LOG_INF("Recording the guide corrections of %u RA steps", CONFIG_MOUNT_RA_WORM_STEPS);
+    }
+
+    atomic_set(&pecState, static_cast<atomic_val_t>(mode));
+}
+
+void Mount::recordPec() {
+    // West is the tracking direction, the positive direction of the RA steps
+    const int32_t millisteps =
+        control.guidePeriods[0] > 0 ? control.guideSign[0] * guideMillisteps : 0;
+
+    if (motion_pec_record(&pec, motion_step_position(&steps, MOTION_AXIS_RA), millisteps) == 1) {
+        LOG_INF("Periodic error recorded, playing it back");
+        motion_pec_play(&pec, true);
+        atomic_set(&pecState, static_cast<atomic_val_t>(PecMode::Play));
+    }
+}
+#endif
+#endif
+
+bool Mount::setTrackingRate(TrackingRate rate) {
+    const int32_t customMhz = atomic_get(&customRateMhz);
+
+    atomic_set(&trackingRate, static_cast<atomic_val_t>(rate));
+    return submit({Command::Type::TrackRate, {static_cast<int32_t>(rate), customMhz}}) == 0;
+}
+
+bool Mount::setCustomRate(uint32_t mhz) {
+    if (mhz == 0 || mhz > maxCustomRateMhz) {
+        return false;
+    }
+
+    atomic_set(&customRateMhz, mhz);
+    if (static_cast<TrackingRate>(atomic_get(&trackingRate)) != TrackingRate::Custom) {
+        return true;
+    }
+    return setTrackingRate(TrackingRate::Custom);
+}
+
+bool Mount::adjustCustomRate(int32_t mhz) {
+    const int32_t rate = atomic_get(&customRateMhz) + mhz;
+
+    return rate > 0 && setCustomRate(rate);
+}
+
+bool Mount::guide(GuideDirection direction, int32_t ms) {
+#if defined(CONFIG_MOTION_STEP)
+    return submit({Command::Type::Guide, {static_cast<int32_t>(direction), ms}}) == 0;
+#else
+    ARG_UNUSED(direction);
+    ARG_UNUSED(ms);
+    return false;
+#endif
+}
+
+bool Mount::setPecMode(PecMode mode) {
+#if defined(CONFIG_MOUNT_PEC)
+    return submit({Command::Type::Pec, {static_cast<int32_t>(mode)}}) == 0;
+#else
+    ARG_UNUSED(mode);
+    return false;
+#endif
+}
+
+Mount::PecMode Mount::pecMode() const {
+    return static_cast<PecMode>(atomic_get(&pecState));
+}
+
+uint32_t Mount::trackingFrequency() const {
+    // Drive frequencies on the solar day
+    switch (static_cast<TrackingRate>(atomic_get(&trackingRate))) {
+    case TrackingRate::Sidereal:
+        return static_cast<uint64_t>(MOTION_TRACK_DAY_MHZ) * MOTION_TRACK_SOLAR_DAY /
+               MOTION_TRACK_SIDEREAL_DAY;
+    case TrackingRate::Lunar:
+        return static_cast<uint64_t>(MOTION_TRACK_DAY_MHZ) * MOTION_TRACK_SOLAR_DAY /
+               MOTION_TRACK_LUNAR_DAY;
+    case TrackingRate::Custom:
+        return atomic_get(&customRateMhz);
+    default:
+        return MOTION_TRACK_DAY_MHZ;
+    }
+}
+
+bool Mount::slewProgress(uint32_t &remainingMs, uint32_t &totalMs) const {
+    const uint32_t total = atomic_get(&slewTotalMs);
+
+    if (total == 0) {
+        return false;
+    }
+
+    // Differences of 32 bit uptimes stay right across the wrap
+    const int32_t remaining = static_cast<int32_t>(atomic_get(&slewEndMs) - k_uptime_get_32());
+
+    remainingMs = MIN(static_cast<uint32_t>(MAX(remaining, 0)), total);
+    totalMs = total;
+    return true;
 }
 
 bool Mount::setTargetDec(int d, unsigned int m, unsigned int s) {
     LOG_INF("Setting the target DEC to %d*%d'%d\"", d, m, s);
+    const int32_t magnitude = (d < 0 ? -d : d) * 3600 + m * 60 + s;
+    targetDecArcsec = d < 0 ? -magnitude : magnitude;
+    return true;
+}
+
+bool Mount::setTargetDec(int32_t arcsec) {
+    if (arcsec < -324000 || arcsec > 324000) {
+        return false;
+    }
+
+    LOG_INF("Setting the target DEC to %d\"", arcsec);
+    targetDecArcsec = arcsec;
     return true;
 }
 
 bool Mount::setTargetRa(unsigned int h, unsigned int m, unsigned int s) {
     LOG_INF("Setting the target RA to %d:%d:%d", h, m, s);
+    targetRaSeconds = h * 3600 + m * 60 + s;
+    return true;
+}
+
+bool Mount::setTarget(int32_t raSeconds, int32_t decArcsec) {
+    LOG_INF("Setting the target to RA %ds DEC %d\"", raSeconds, decArcsec);
+    targetRaSeconds = raSeconds;
+    targetDecArcsec = decArcsec;
+    return true;
+}
+
+void Mount::slewToTarget() {
+    int32_t raSeconds = targetRaSeconds;
+    int32_t decArcsec = targetDecArcsec;
+
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+    // Corrected once per slew, tracking at the sidereal rate follows the place from there
+    observedPlace(raSeconds, decArcsec);
+#endif
+    slewTo(targetRaSeconds, targetDecArcsec, raSeconds, decArcsec);
+}
+
+void Mount::slewTo(int32_t raSeconds, int32_t decArcsec, int32_t pointRaSeconds,
+                   int32_t pointDecArcsec) {
+    LOG_INF("Slewing to RA %ds DEC %d\"", pointRaSeconds, pointDecArcsec);
+
+    if (submit({Command::Type::Slew, {raSeconds, decArcsec, pointRaSeconds, pointDecArcsec}}) !=
+        0) {
+        LOG_WRN("Slew not accepted by the control loop");
+    }
+}
+
+void Mount::observedPlace(int32_t &raSeconds, int32_t &decArcsec) {
+    int64_t utcMs;
+
+    if (!utcNow(utcMs)) {
+        LOG_WRN("No date and time, slewing to the catalog place");
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+        shareCorrections(false, false);
+#endif
+        return;
+    }
+
+    // Only the terms whose cadence ran out are recomputed
+    astro_corrections_update(&corrections, utcMs);
+
+    astro_equatorial_t place = {
+        .ra = astro_ra_seconds_to_angle(raSeconds),
+        .dec = static_cast<int32_t>(astro_arcsec_to_angle(decArcsec)),
+    };
+
+    astro_apparent_place(&corrections, &place, &place, 1);
+
+    const bool refracted = atomic_get(&siteLatitude) != latitudeUnknown;
+
+    if (refracted) {
+        const astro_site_t rotation = site.load();
+        const uint32_t lst = siderealAngle();
+        astro_horizontal_t horizontal;
+
+        astro_to_horizontal(&rotation, lst, &place, &horizontal, 1);
+        astro_refract(&corrections, &horizontal, &horizontal, 1);
+        astro_to_equatorial(&rotation, lst, &horizontal, &place, 1);
+    }
+
+    raSeconds = astro_angle_to_ra_seconds(place.ra);
+    decArcsec = astro_angle_to_arcsec(place.dec);
+
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+    shareCorrections(true, refracted);
+#endif
+}
+
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+void Mount::shareCorrections(bool corrected, bool refracted) {
+    // A copy, the control thread preempts this one and reads it at any time
+    k_spinlock_key_t key = k_spin_lock(&correctionsLock);
+
+    if (corrected) {
+        slewCorrections = corrections;
+    }
+    slewCorrected = corrected;
+    slewRefracted = refracted;
+    k_spin_unlock(&correctionsLock, key);
+}
+#endif
+
+void Mount::meanPlace(const astro_corrections_t &corrections, const astro_site_t *site,
+                      int32_t &raSeconds, int32_t &decArcsec) {
+    astro_equatorial_t place = {
+        .ra = astro_ra_seconds_to_angle(raSeconds),
+        .dec = static_cast<int32_t>(astro_arcsec_to_angle(decArcsec)),
+    };
+
+    // The corrections of observedPlace() taken out in reverse order
+    if (site != nullptr) {
+        const uint32_t lst = siderealAngle();
+        astro_horizontal_t horizontal;
+
+        astro_to_horizontal(site, lst, &place, &horizontal, 1);
+        astro_unrefract(&corrections, &horizontal, &horizontal, 1);
+        astro_to_equatorial(site, lst, &horizontal, &place, 1);
+    }
+
+    astro_mean_place(&corrections, &place, &place, 1);
+
+    raSeconds = astro_angle_to_ra_seconds(place.ra);
+    decArcsec = astro_angle_to_arcsec(place.dec);
+}
+
+#if !defined(CONFIG_MOUNT_APPARENT_PLACE)
+void Mount::catalogPlace(int32_t &raSeconds, int32_t &decArcsec) {
+    int64_t utcMs;
+
+    if (!utcNow(utcMs)) {
+        return;
+    }
+
+    astro_corrections_update(&catalogCorrections, utcMs);
+    meanPlace(catalogCorrections, nullptr, raSeconds, decArcsec);
+}
+#endif
+
+bool Mount::setTargetAltitude(int32_t arcsec) {
+    if (arcsec < -324000 || arcsec > 324000) {
+        return false;
+    }
+
+    LOG_INF("Setting the target altitude to %d\"", arcsec);
+    targetAltArcsec = arcsec;
+    return true;
+}
+
+bool Mount::setTargetAzimuth(int32_t arcsec) {
+    if (arcsec < 0 || arcsec >= 1296000) {
+        return false;
+    }
+
+    LOG_INF("Setting the target azimuth to %d\"", arcsec);
+    targetAzArcsec = arcsec;
+    return true;
+}
+
+bool Mount::slewToAltAz() {
+    if (atomic_get(&siteLatitude) == latitudeUnknown) {
+        LOG_WRN("Alt-az slew needs the site latitude");
+        return false;
+    }
+
+    const astro_site_t rotation = site.load();
+    const astro_horizontal_t horizontal = {
+        .az = astro_arcsec_to_angle(targetAzArcsec),
+        .alt = static_cast<int32_t>(astro_arcsec_to_angle(targetAltArcsec)),
+    };
+    astro_equatorial_t equatorial;
+
+    astro_to_equatorial(&rotation, siderealAngle(), &horizontal, &equatorial, 1);
+    targetRaSeconds = astro_angle_to_ra_seconds(equatorial.ra);
+    targetDecArcsec = astro_angle_to_arcsec(equatorial.dec);
+    LOG_INF("Alt %d\" Az %d\" is RA %ds DEC %d\" now", targetAltArcsec, targetAzArcsec,
+            targetRaSeconds, targetDecArcsec);
+
+    int32_t raSeconds = targetRaSeconds;
+    int32_t decArcsec = targetDecArcsec;
+
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+    int64_t utcMs;
+    const bool dated = utcNow(utcMs);
+
+    if (dated) {
+        // Reported in the catalog frame of the targets set with :Sr# and :Sd#
+        astro_corrections_update(&corrections, utcMs);
+        meanPlace(corrections, nullptr, raSeconds, decArcsec);
+    }
+    shareCorrections(dated, false);
+#endif
+
+    // Already a place of the date at the site, not a catalog place
+    slewTo(raSeconds, decArcsec, targetRaSeconds, targetDecArcsec);
+    return true;
+}
+
+void Mount::findHome() {
+    LOG_INF("Slewing to the home position");
+
+    if (submit({Command::Type::Park,
+                {CONFIG_MOUNT_HOME_HA, CONFIG_MOUNT_HOME_DEC, CONFIG_MOUNT_HOME_HA,
+                 CONFIG_MOUNT_HOME_DEC}}) != 0) {
+        LOG_WRN("Home not accepted by the control loop");
+    }
+}
+
+void Mount::park() {
+    LOG_INF("Parking the mount");
+
+    if (submit({Command::Type::Park,
+                {CONFIG_MOUNT_PARK_HA, CONFIG_MOUNT_PARK_DEC, CONFIG_MOUNT_PARK_HA,
+                 CONFIG_MOUNT_PARK_DEC}}) != 0) {
+        LOG_WRN("Park not accepted by the control loop");
+    }
+}
+
+void Mount::abortMotion() {
+    LOG_INF("Motion aborted");
+
+    // Also drops a slew the executor handed over after the stop signal was acknowledged
+    if (submit({Command::Type::Stop, {MOTION_AXIS_ALL}}) != 0) {
+        LOG_WRN("Stop not accepted by the control loop");
+    }
+}
+
+void Mount::setResponseCache(lx200_cache_t *cache) {
+    responseCache = cache;
+    if (responseCache != nullptr) {
+        lx200_cache_invalidate_all(responseCache);
+    }
+}
+
+void Mount::updateEquatorial(int32_t raSeconds, int32_t decArcsec) {
+    int32_t altArcsec = reported.altArcsec;
+    int32_t azArcsec = reported.azArcsec;
+
+    if (control.siteKnown) {
+        toHorizontal(control.site, siderealAngle(), control.pointRaSeconds,
+                     control.pointDecArcsec, altArcsec, azArcsec);
+    }
+
+    updatePosition(raSeconds, decArcsec, altArcsec, azArcsec);
+}
+
+void Mount::updatePosition(int32_t raSeconds, int32_t decArcsec, int32_t altArcsec,
+                           int32_t azArcsec) {
+    reported.raSeconds = raSeconds;
+    reported.decArcsec = decArcsec;
+    reported.altArcsec = altArcsec;
+    reported.azArcsec = azArcsec;
+    published.store(reported);
+
+    if (responseCache == nullptr) {
+        return;
+    }
+
+    lx200_cache_update(responseCache, LX200_CACHE_RA, raSeconds);
+    lx200_cache_update(responseCache, LX200_CACHE_DEC, decArcsec);
+    lx200_cache_update(responseCache, LX200_CACHE_ALT, altArcsec);
+    lx200_cache_update(responseCache, LX200_CACHE_AZ, azArcsec);
+}
+
+bool Mount::setLatitude(int32_t arcsec) {
+    if (arcsec < -324000 || arcsec > 324000) {
+        return false;
+    }
+
+    astro_site_t rotation;
+
+    if (astro_site_init(&rotation, arcsec) != 0) {
+        return false;
+    }
+
+    LOG_INF("Setting the site latitude to %d\"", arcsec);
+    // The control thread preempts this one, it gets its own copy on the command channel
+    site.store(rotation);
+    atomic_set(&siteLatitude, arcsec);
+    if (submit({Command::Type::Site, {arcsec}}) != 0) {
+        LOG_WRN("Site not accepted by the control loop");
+    }
+    return true;
+}
+
+bool Mount::latitude(int32_t &arcsec) const {
+    const atomic_val_t value = atomic_get(&siteLatitude);
+
+    if (value == latitudeUnknown) {
+        return false;
+    }
+
+    arcsec = value;
+    return true;
+}
+
+bool Mount::horizontal(int32_t raSeconds, int32_t decArcsec, int32_t &altArcsec,
+                       int32_t &azArcsec) {
+    if (atomic_get(&siteLatitude) == latitudeUnknown) {
+        return false;
+    }
+
+    toHorizontal(site.load(), siderealAngle(), raSeconds, decArcsec, altArcsec, azArcsec);
+    return true;
+}
+
+bool Mount::setLongitude(int32_t arcsec) {
+    if (astro_lst_set_longitude(&siderealTime, arcsec) != 0) {
+        return false;
+    }
+
+    LOG_INF("Setting the site longitude to %d\"", arcsec);
+    return true;
+}
+
+bool Mount::setUtcOffset(int32_t minutes) {
+    if (minutes < -14 * 60 || minutes > 14 * 60) {
+        return false;
+    }
+
+    LOG_INF("Setting the UTC offset to %d minutes", minutes);
+    k_spinlock_key_t key = k_spin_lock(&siteLock);
+
+    siteClock.utcOffsetMinutes = minutes;
+    anchorSiderealTime();
+    k_spin_unlock(&siteLock, key);
+    return true;
+}
+
+bool Mount::setLocalDate(uint32_t year, uint32_t month, uint32_t day) {
+    if (year < 2000 || year > 2099 || month < 1 || month > 12 || day < 1 || day > 31) {
+        return false;
+    }
+
+    LOG_INF("Setting the local date to %u-%02u-%02u", year, month, day);
+    const int64_t dateMs = astro_lst_j2000_ms(year, month, day, 0);
+    k_spinlock_key_t key = k_spin_lock(&siteLock);
+
+    siteClock.dateMs = dateMs;
+    siteClock.dateSet = true;
+    anchorSiderealTime();
+    k_spin_unlock(&siteLock, key);
     return true;
 }
+
+bool Mount::setLocalTime(uint32_t h, uint32_t m, uint32_t s) {
+    if (h > 23 || m > 59 || s > 59) {
+        return false;
+    }
+
+    LOG_INF("Setting the local time to %02u:%02u:%02u", h, m, s);
+    k_spinlock_key_t key = k_spin_lock(&siteLock);
+
+    siteClock.timeMs = ((h * 60 + m) * 60 + s) * MSEC_PER_SEC;
+    siteClock.timeTick = k_uptime_ticks();
+    siteClock.timeSet = true;
+    anchorSiderealTime();
+    k_spin_unlock(&siteLock, key);
+    return true;
+}
+
+bool Mount::setSiderealTime(uint32_t seconds) {
+    if (seconds >= 86400) {
+        return false;
+    }
+
+    LOG_INF("Setting the sidereal time to %us", seconds);
+    return astro_lst_anchor_lst(&siderealTime, k_uptime_ticks(), seconds * MSEC_PER_SEC) == 0;
+}
+
+uint32_t Mount::siderealTimeMs() {
+    return astro_lst_ms(&siderealTime, k_uptime_ticks());
+}
+
+uint32_t Mount::siderealAngle() {
+    // The top 32 bits of the 64 bit turn fraction
+    return astro_lst_turns(&siderealTime, k_uptime_ticks()) >> 32;
+}
+
+bool Mount::utcNow(int64_t &utcMs) {
+    k_spinlock_key_t key = k_spin_lock(&siteLock);
+    const bool known = siteClock.dateSet && siteClock.timeSet;
+
+    if (known) {
+        utcMs = siteClock.dateMs + siteClock.timeMs +
+                static_cast<int64_t>(siteClock.utcOffsetMinutes) * 60 * MSEC_PER_SEC +
+                k_ticks_to_ms_floor64(k_uptime_ticks() - siteClock.timeTick);
+    }
+    k_spin_unlock(&siteLock, key);
+    return known;
+}
+
+void Mount::anchorSiderealTime() {
+    if (!siteClock.dateSet || !siteClock.timeSet) {
+        return;
+    }
+
+    // The local time was set at timeTick, a date set later applies to the same instant
+    const int64_t utcMs = siteClock.dateMs + siteClock.timeMs +
+                          static_cast<int64_t>(siteClock.utcOffsetMinutes) * 60 * MSEC_PER_SEC;
+
+    astro_lst_anchor_utc(&siderealTime, siteClock.timeTick, utcMs);
+}
+
+void Mount::updateSiderealTime(int32_t lstSeconds) {
+    reported.lstSeconds = lstSeconds;
+    published.store(reported);
+
+    if (responseCache == nullptr) {
+        return;
+    }
+
+    lx200_cache_update(responseCache, LX200_CACHE_SIDEREAL_TIME, lstSeconds);
+}
+
+Mount::Position Mount::position() const {
+    return published.load();
+}
+
+void Mount::emergencyStop(uint32_t axes) {
+    motion_stop_request(&stop, axes);
+}
+
+motion_stop_t &Mount::stopSignal() {
+    return stop;
+}
+
+motion_stop_stats_t Mount::stopStats() {
+    motion_stop_stats_t stats;
+
+    motion_stop_get_stats(&stop, &stats);
+    return stats;
+}
+
+#if defined(CONFIG_MOTION_STEP_EMUL)
+motion_step_emul_t *Mount::stepEmulator() {
+#if defined(STEP_EMUL)
+    return &stepEmul;
+#else
+    return nullptr;
+#endif
+}
+#endif
+
+#if defined(CONFIG_MOTION_STEP)
+motion_step_stats_t Mount::stepStats() {
+    motion_step_stats_t stats{};
+
+    if (stepsReady) {
+        motion_step_get_stats(&steps, &stats);
+    }
+    return stats;
+}
+#endif
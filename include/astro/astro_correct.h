@@ -0,0 +1,201 @@
+/**
+ * @file astro_correct.h
+ * @brief Corrections from catalog coordinates to the apparent place
+ *
+ * Catalog coordinates are mean places of J2000.0. Pointing at them needs
+ * precession and nutation to the true equator of date, annual aberration
+ * and, close to the horizon, refraction. All of these change slowly, so
+ * each term is recomputed on its own cadence and kept:
+ *
+ * - precession and nutation as one combined rotation matrix
+ * - aberration as the velocity of the Earth over the speed of light
+ * - refraction as a table indexed by altitude, rebuilt when the
+ *   temperature or pressure changes
+ *
+ * Applying them is then one matrix product and a vector sum per point,
+ * plus a table lookup for refraction. Everything is single precision with
+ * the polynomial kernels of astro_transform.h. Precession follows IAU
+ * 1976, nutation the four largest terms of IAU 1980, good to about half an
+ * arcsecond, and refraction the formula of Saemundsson.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <astro/astro_transform.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup astro
+ * @{
+ */
+
+/* ============================================================================
+ * CONSTANTS AND DEFINITIONS
+ * ============================================================================ */
+
+/** Precession was recomputed */
+#define ASTRO_TERM_PRECESSION 0x01U
+/** Nutation was recomputed */
+#define ASTRO_TERM_NUTATION 0x02U
+/** Aberration was recomputed */
+#define ASTRO_TERM_ABERRATION 0x04U
+/** All terms on a cadence */
+#define ASTRO_TERM_ALL 0x07U
+
+/** Lowest altitude of the refraction table in degrees, lower altitudes use it */
+#define ASTRO_REFRACTION_MIN_DEGREES (-2)
+/** Refraction table entries per degree of altitude */
+#define ASTRO_REFRACTION_PER_DEGREE 4
+/** Refraction table entries, up to the zenith */
+#define ASTRO_REFRACTION_ENTRIES                                                                   \
+	((90 - ASTRO_REFRACTION_MIN_DEGREES) * ASTRO_REFRACTION_PER_DEGREE + 1)
+
+/** Standard temperature of the refraction formula in degrees Celsius */
+#define ASTRO_REFRACTION_TEMPERATURE 10
+/** Standard pressure of the refraction formula in hectopascal */
+#define ASTRO_REFRACTION_PRESSURE 1010
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Corrections to the apparent place, with their cadences
+ */
+typedef struct {
+	/** Nutation times precession, J2000.0 to the true equator of date */
+	float matrix[3][3];
+	/** Precession of the last update */
+	float precession[3][3];
+	/** Nutation of the last update */
+	float nutation[3][3];
+	/** Velocity of the Earth over the speed of light, true equator of date */
+	float aberration[3];
+	/** Time of the last update of each term, milliseconds since J2000.0 */
+	int64_t updated_ms[3];
+	/** ASTRO_TERM_* bits of the terms computed since init */
+	uint32_t valid;
+	/** Refraction by altitude in tenths of arcseconds */
+	uint16_t refraction[ASTRO_REFRACTION_ENTRIES];
+} astro_corrections_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the corrections
+ *
+ * No term is applied until the first astro_corrections_update(), the
+ * refraction table is built for the standard temperature and pressure.
+ *
+ * @param corrections Corrections to initialize
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_corrections_init(astro_corrections_t *corrections);
+
+/**
+ * @brief Recompute the terms whose cadence has run out
+ *
+ * Cheap when nothing is due, so it can be called before every use. A
+ * term is due once the time moved by its CONFIG_ASTRO_*_PERIOD from the
+ * last update, in either direction so a clock set back is followed.
+ *
+ * @param corrections Corrections to update
+ * @param j2000_ms Time in milliseconds since J2000.0, see astro_lst_j2000_ms()
+ * @return ASTRO_TERM_* bits of the terms recomputed, -EINVAL on invalid parameters
+ */
+int astro_corrections_update(astro_corrections_t *corrections, int64_t j2000_ms);
+
+/**
+ * @brief Rebuild the refraction table for the weather at the site
+ *
+ * @param corrections Corrections to update
+ * @param celsius Air temperature in degrees Celsius (-60 to 60)
+ * @param hpa Air pressure in hectopascal (0 to 1100), 0 turns refraction off
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_corrections_set_weather(astro_corrections_t *corrections, int32_t celsius,
+				  uint32_t hpa);
+
+/**
+ * @brief Apparent places of catalog coordinates
+ *
+ * Applies precession, nutation and aberration as of the last update.
+ *
+ * @param corrections Corrections to apply
+ * @param in Mean places of J2000.0
+ * @param out Apparent places, may be the same array as @p in
+ * @param count Number of points
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_apparent_place(const astro_corrections_t *corrections, const astro_equatorial_t *in,
+			 astro_equatorial_t *out, size_t count);
+
+/**
+ * @brief Catalog places of apparent places
+ *
+ * Inverse of astro_apparent_place() with the same corrections, to report a
+ * place pointed at in the frame of the catalog.
+ *
+ * @param corrections Corrections to take out
+ * @param in Apparent places
+ * @param out Mean places of J2000.0, may be the same array as @p in
+ * @param count Number of points
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_mean_place(const astro_corrections_t *corrections, const astro_equatorial_t *in,
+		     astro_equatorial_t *out, size_t count);
+
+/**
+ * @brief Refraction at an altitude
+ *
+ * @param corrections Corrections holding the refraction table
+ * @param altitude Geometric altitude, binary angle
+ * @return Refraction to add to the altitude, binary angle
+ */
+int32_t astro_refraction(const astro_corrections_t *corrections, int32_t altitude);
+
+/**
+ * @brief Observed places of geometric horizontal coordinates
+ *
+ * @param corrections Corrections holding the refraction table
+ * @param in Geometric horizontal coordinates
+ * @param out Refracted coordinates, may be the same array as @p in
+ * @param count Number of points
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_refract(const astro_corrections_t *corrections, const astro_horizontal_t *in,
+		  astro_horizontal_t *out, size_t count);
+
+/**
+ * @brief Geometric horizontal coordinates of observed places
+ *
+ * Inverse of astro_refract(), the refraction is read again at the geometric
+ * altitude found so far until the altitude settles.
+ *
+ * @param corrections Corrections holding the refraction table
+ * @param in Refracted coordinates
+ * @param out Geometric horizontal coordinates, may be the same array as @p in
+ * @param count Number of points
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_unrefract(const astro_corrections_t *corrections, const astro_horizontal_t *in,
+		    astro_horizontal_t *out, size_t count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
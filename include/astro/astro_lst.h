@@ -0,0 +1,176 @@
+/**
+ * @file astro_lst.h
+ * @brief Local sidereal time kept from a monotonic tick
+ *
+ * Sidereal time is anchored once, from the UTC date and time or from a
+ * sidereal time set directly, and then advanced from a monotonic hardware
+ * tick. Reading it is a few integer multiplications: no Julian date
+ * polynomial and no floating point.
+ *
+ * Angles are binary fractions of a turn, 2^64 is 24 hours of sidereal
+ * time, so they wrap at midnight without a modulo. The sidereal rate is
+ * kept per tick with 96 bits, which holds the time to well under a
+ * millisecond over years of uptime.
+ *
+ * Reads take a spinlock, so they can run in an ISR, and the anchor can be
+ * replaced at any time when a better time source arrives.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup astro Astronomical time and coordinates
+ * @{
+ */
+
+/* ============================================================================
+ * CONSTANTS AND DEFINITIONS
+ * ============================================================================ */
+
+/** Mean sidereal day in microseconds of solar time, 23h 56m 4.0905308s */
+#define ASTRO_SIDEREAL_DAY_US 86164090531ULL
+
+/** Milliseconds in a day */
+#define ASTRO_DAY_MS 86400000U
+
+/** Highest tick frequency, the sidereal day in ticks must fit 64 bits */
+#define ASTRO_LST_MAX_FREQUENCY 200000000U
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Sidereal time service
+ */
+typedef struct {
+	/** Guards the anchor against a concurrent read */
+	struct k_spinlock lock;
+	/** Sidereal turns per tick, 64 bit binary fraction */
+	uint64_t rate;
+	/** Further 32 bits of the rate */
+	uint32_t rate_frac;
+	/** Tick of the anchor */
+	uint64_t anchor_tick;
+	/** Greenwich sidereal time at the anchor, binary fraction of a turn */
+	uint64_t anchor_gmst;
+	/** East longitude of the site, binary fraction of a turn */
+	uint64_t longitude;
+	/** Anchored to a time source since init */
+	bool anchored;
+} astro_lst_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the sidereal time service
+ *
+ * Sidereal time starts at 0 at tick 0 and longitude 0, until anchored.
+ *
+ * @param lst Sidereal time service
+ * @param frequency Frequency of the tick in Hz (1 to ASTRO_LST_MAX_FREQUENCY)
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_lst_init(astro_lst_t *lst, uint32_t frequency);
+
+/**
+ * @brief Milliseconds of UTC since J2000.0
+ *
+ * J2000.0 is 2000-01-01 12:00 UTC. Integer only, proleptic Gregorian
+ * calendar.
+ *
+ * @param year Year, 2000 for 2000
+ * @param month Month (1-12)
+ * @param day Day of the month (1-31)
+ * @param ms Milliseconds since midnight
+ * @return Milliseconds since J2000.0, negative before
+ */
+int64_t astro_lst_j2000_ms(int32_t year, uint32_t month, uint32_t day, uint32_t ms);
+
+/**
+ * @brief Anchor sidereal time to UTC
+ *
+ * Greenwich mean sidereal time is computed once from the UTC time, the
+ * longitude set with astro_lst_set_longitude() is kept. UT1 is taken as
+ * UTC, which is at most 0.9 s off.
+ *
+ * @param lst Sidereal time service
+ * @param tick Tick at which @p j2000_ms was the time
+ * @param j2000_ms UTC in milliseconds since J2000.0, see astro_lst_j2000_ms()
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_lst_anchor_utc(astro_lst_t *lst, uint64_t tick, int64_t j2000_ms);
+
+/**
+ * @brief Anchor local sidereal time directly
+ *
+ * Kept at the same longitude, so a later longitude change moves the local
+ * sidereal time with it.
+ *
+ * @param lst Sidereal time service
+ * @param tick Tick at which @p ms was the local sidereal time
+ * @param ms Local sidereal time in milliseconds (0-86399999)
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_lst_anchor_lst(astro_lst_t *lst, uint64_t tick, uint32_t ms);
+
+/**
+ * @brief Set the longitude of the site
+ *
+ * @param lst Sidereal time service
+ * @param arcsec Longitude in arcseconds (-648000 to 648000), east positive
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_lst_set_longitude(astro_lst_t *lst, int32_t arcsec);
+
+/**
+ * @brief Local sidereal time as a fraction of a turn
+ *
+ * O(1) and ISR safe.
+ *
+ * @param lst Sidereal time service
+ * @param tick Current tick, may be a little before the anchor
+ * @return Local sidereal time, 2^64 is 24 hours
+ */
+uint64_t astro_lst_turns(astro_lst_t *lst, uint64_t tick);
+
+/**
+ * @brief Local sidereal time in milliseconds
+ *
+ * O(1) and ISR safe.
+ *
+ * @param lst Sidereal time service
+ * @param tick Current tick, may be a little before the anchor
+ * @return Local sidereal time rounded to milliseconds (0-86399999)
+ */
+uint32_t astro_lst_ms(astro_lst_t *lst, uint64_t tick);
+
+/**
+ * @brief Check if sidereal time was anchored to a time source
+ *
+ * @param lst Sidereal time service
+ * @return true once anchored since init
+ */
+bool astro_lst_anchored(const astro_lst_t *lst);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,199 @@
+/**
+ * @file astro_transform.h
+ * @brief Conversions between equatorial and horizontal coordinates
+ *
+ * The rotation from the hour angle frame to the horizon frame only depends
+ * on the site latitude. It is computed once per site and kept in an
+ * astro_site_t, so a conversion is two sin/cos pairs, a 3x3 matrix product
+ * and two atan2. All of it is single precision with polynomial kernels,
+ * no libm calls, which the FPU of the Cortex-M4F runs in hardware.
+ *
+ * Angles are binary fractions of a turn in 32 bits, 2^32 is 360 degrees
+ * or 24 hours: about 0.0003 arcseconds per unit. Right ascension, hour
+ * angle and azimuth are unsigned, declination and altitude are signed,
+ * so 90 degrees is 2^30. Conversions are within 0.1 arcseconds of the
+ * same formulas in double precision.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup astro
+ * @{
+ */
+
+/* ============================================================================
+ * CONSTANTS AND DEFINITIONS
+ * ============================================================================ */
+
+/** Arcseconds in a turn */
+#define ASTRO_TURN_ARCSEC 1296000
+
+/** Seconds of right ascension in a turn */
+#define ASTRO_TURN_SECONDS 86400
+
+/** Binary angle of 90 degrees */
+#define ASTRO_ANGLE_90 0x40000000
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Equatorial coordinates
+ */
+typedef struct {
+	/** Right ascension, binary angle */
+	uint32_t ra;
+	/** Declination, binary angle, north positive */
+	int32_t dec;
+} astro_equatorial_t;
+
+/**
+ * @brief Horizontal coordinates
+ */
+typedef struct {
+	/** Azimuth from north through east, binary angle */
+	uint32_t az;
+	/** Altitude above the horizon, binary angle */
+	int32_t alt;
+} astro_horizontal_t;
+
+/**
+ * @brief Site of the mount, with its rotation cached
+ */
+typedef struct {
+	/** Rotation from the hour angle frame to north, east and up */
+	float matrix[3][3];
+	/** Latitude, binary angle, north positive */
+	int32_t latitude;
+} astro_site_t;
+
+/* ============================================================================
+ * ANGLE CONVERSIONS
+ * ============================================================================ */
+
+/**
+ * @brief Binary angle of an angle in arcseconds, wrapped to a turn
+ */
+static inline uint32_t astro_arcsec_to_angle(int32_t arcsec)
+{
+	return (uint32_t)(((int64_t)arcsec * ((int64_t)1 << 32)) / ASTRO_TURN_ARCSEC);
+}
+
+/**
+ * @brief Signed binary angle in arcseconds, rounded (-648000 to 647999)
+ */
+static inline int32_t astro_angle_to_arcsec(int32_t angle)
+{
+	return (int32_t)(((int64_t)angle * ASTRO_TURN_ARCSEC + ((int64_t)1 << 31)) >> 32);
+}
+
+/**
+ * @brief Unsigned binary angle in arcseconds, rounded (0 to 1295999)
+ */
+static inline uint32_t astro_angle_to_arcsec_unsigned(uint32_t angle)
+{
+	const uint32_t arcsec =
+		(uint32_t)(((uint64_t)angle * ASTRO_TURN_ARCSEC + ((uint64_t)1 << 31)) >> 32);
+
+	return arcsec < ASTRO_TURN_ARCSEC ? arcsec : 0;
+}
+
+/**
+ * @brief Binary angle of a right ascension in seconds
+ */
+static inline uint32_t astro_ra_seconds_to_angle(uint32_t seconds)
+{
+	return (uint32_t)(((uint64_t)(seconds % ASTRO_TURN_SECONDS) << 32) / ASTRO_TURN_SECONDS);
+}
+
+/**
+ * @brief Right ascension in seconds of a binary angle, rounded (0 to 86399)
+ */
+static inline uint32_t astro_angle_to_ra_seconds(uint32_t angle)
+{
+	const uint32_t seconds =
+		(uint32_t)(((uint64_t)angle * ASTRO_TURN_SECONDS + ((uint64_t)1 << 31)) >> 32);
+
+	return seconds < ASTRO_TURN_SECONDS ? seconds : 0;
+}
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Sine and cosine of a binary angle
+ *
+ * Reduced to an eighth of a turn without division, then polynomials.
+ *
+ * @param angle Binary angle
+ * @param sine Output sine
+ * @param cosine Output cosine
+ */
+void astro_sincos(uint32_t angle, float *sine, float *cosine);
+
+/**
+ * @brief Angle of the vector (x, y) as a binary angle
+ *
+ * @param y Y component
+ * @param x X component
+ * @return Binary angle from the x axis towards the y axis, 0 for (0, 0)
+ */
+uint32_t astro_atan2(float y, float x);
+
+/**
+ * @brief Cache the rotation of a site
+ *
+ * Only needs to run again when the latitude changes.
+ *
+ * @param site Site to initialize
+ * @param latitude Latitude in arcseconds (-324000 to 324000), north positive
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_site_init(astro_site_t *site, int32_t latitude);
+
+/**
+ * @brief Convert equatorial coordinates to horizontal coordinates
+ *
+ * @param site Site of the mount
+ * @param lst Local sidereal time, binary angle
+ * @param in Equatorial coordinates
+ * @param out Horizontal coordinates, may not overlap @p in
+ * @param count Number of points
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_to_horizontal(const astro_site_t *site, uint32_t lst, const astro_equatorial_t *in,
+			astro_horizontal_t *out, size_t count);
+
+/**
+ * @brief Convert horizontal coordinates to equatorial coordinates
+ *
+ * @param site Site of the mount
+ * @param lst Local sidereal time, binary angle
+ * @param in Horizontal coordinates
+ * @param out Equatorial coordinates, may not overlap @p in
+ * @param count Number of points
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int astro_to_equatorial(const astro_site_t *site, uint32_t lst, const astro_horizontal_t *in,
+			astro_equatorial_t *out, size_t count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
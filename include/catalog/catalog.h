@@ -0,0 +1,382 @@
+/**
+ * @file catalog.h
+ * @brief Read-only object catalogs for the LX200 library commands
+ *
+ * The Messier, NGC, IC and STAR catalogs are generated at build time by
+ * scripts/gen_catalog.py from the CSV files in lib/catalog/data. Each catalog
+ * is a const array of packed 12 byte records sorted by catalog number, so it
+ * stays in flash: a lookup is a binary search returning a pointer into the
+ * array and nothing is ever copied to RAM.
+ *
+ * A cursor remembers the selected object as an index into its catalog, which
+ * makes stepping to the next or previous object (:LN#, :LB#) a single index
+ * increment.
+ *
+ * Every catalog also gets a spatial index, generated with it. The sky is cut
+ * into declination zones and each zone into right ascension cells of about
+ * the same area, sized for a handful of objects per cell. The objects of a
+ * cell are listed brightest first and every cell records its brightest and
+ * largest object, so a cone query (:Lf#, :LF#) only visits the cells the cone
+ * touches and skips cells or the rest of a cell as soon as the magnitude and
+ * size limits rule them out.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup catalog Object catalogs
+ * @{
+ */
+
+/* ============================================================================
+ * CONSTANTS AND DEFINITIONS
+ * ============================================================================ */
+
+/** Tenths of a magnitude added to the stored magnitude, so it fits unsigned */
+#define CATALOG_MAGNITUDE_BIAS 50
+
+/** Stored magnitude of objects without a known magnitude */
+#define CATALOG_MAGNITUDE_UNKNOWN 0xFF
+
+/** Name offset of objects without a name */
+#define CATALOG_NO_NAME 0xFFFF
+
+/** Right ascension units per hour, a unit is a tenth of a second of time */
+#define CATALOG_RA_PER_HOUR 36000
+
+/** Right ascension units in a full circle */
+#define CATALOG_RA_FULL (24 * CATALOG_RA_PER_HOUR)
+
+/** Largest size that can be stored, in tenths of an arcminute */
+#define CATALOG_SIZE_MAX 0xFFF
+
+/* ============================================================================
+ * ENUMERATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Object types
+ */
+typedef enum {
+	/** Single star */
+	CATALOG_STAR,
+	/** Double or multiple star */
+	CATALOG_DOUBLE_STAR,
+	/** Galaxy */
+	CATALOG_GALAXY,
+	/** Open cluster */
+	CATALOG_OPEN_CLUSTER,
+	/** Globular cluster */
+	CATALOG_GLOBULAR_CLUSTER,
+	/** Planetary nebula */
+	CATALOG_PLANETARY_NEBULA,
+	/** Diffuse (emission or reflection) nebula */
+	CATALOG_DIFFUSE_NEBULA,
+	/** Supernova remnant */
+	CATALOG_SUPERNOVA_REMNANT,
+	/** Asterism */
+	CATALOG_ASTERISM,
+	/** Anything else, e.g. star clouds */
+	CATALOG_OTHER,
+	/** Number of object types */
+	CATALOG_TYPE_COUNT
+} catalog_object_type_t;
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief One catalog object as stored in flash
+ */
+typedef struct {
+	/** Catalog number */
+	uint16_t number;
+	/** Object type, see catalog_object_type_t */
+	uint8_t type;
+	/** Visual magnitude in tenths plus CATALOG_MAGNITUDE_BIAS, or CATALOG_MAGNITUDE_UNKNOWN */
+	uint8_t magnitude;
+	/** J2000 right ascension in tenths of a second of time (0 to 863999) */
+	uint32_t ra : 20;
+	/** Major axis in tenths of an arcminute, 0 for stars and unknown sizes */
+	uint32_t size : 12;
+	/** J2000 declination in arcseconds (-324000 to 324000) */
+	int32_t dec;
+} catalog_record_t;
+
+BUILD_ASSERT(sizeof(catalog_record_t) == 12, "catalog records must stay packed");
+
+/**
+ * @brief Spatial index of a catalog, generated into flash
+ *
+ * Zone z covers declinations from -90 degrees plus z times the zone height,
+ * the cells of a zone split the full circle of right ascension evenly.
+ */
+typedef struct {
+	/** Number of declination zones */
+	uint16_t zones;
+	/** First cell of each zone, followed by the number of cells */
+	const uint16_t *zone_cells;
+	/** First entry of each cell, followed by the number of entries */
+	const uint16_t *cell_entries;
+	/** Stored magnitude of the brightest object of each cell */
+	const uint8_t *cell_brightest;
+	/** Size of the largest object of each cell */
+	const uint16_t *cell_largest;
+	/** Record indices, grouped by cell, brightest first within a cell */
+	const uint16_t *entries;
+} catalog_index_t;
+
+/**
+ * @brief A catalog, generated into flash
+ */
+typedef struct {
+	/** Designation prefix, e.g. "M" or "NGC" */
+	const char *prefix;
+	/** Records sorted by ascending catalog number */
+	const catalog_record_t *records;
+	/** Offset of each record's name in catalog_names, NULL if no record has a name */
+	const uint16_t *names;
+	/** Spatial index, NULL to scan all records */
+	const catalog_index_t *index;
+	/** Number of records */
+	uint16_t count;
+} catalog_t;
+
+/**
+ * @brief Limits of the objects returned by a query
+ *
+ * Objects with an unknown magnitude count as infinitely faint, objects with
+ * an unknown size (and stars) as infinitely small.
+ */
+typedef struct {
+	/** Objects brighter than this are skipped, magnitude in tenths (:Sb) */
+	int16_t brighter;
+	/** Objects fainter than this are skipped, magnitude in tenths (:Sf) */
+	int16_t fainter;
+	/** Objects smaller than this are skipped, tenths of an arcminute (:Sl) */
+	uint16_t smallest;
+	/** Objects larger than this are skipped, tenths of an arcminute (:Ss) */
+	uint16_t largest;
+} catalog_limits_t;
+
+/**
+ * @brief Called for every object of a query
+ *
+ * @param catalog Catalog of the object
+ * @param record Record of the object
+ * @param distance Distance from the cone center in arcseconds
+ * @param user_data User data passed to the query
+ * @return true to continue the query, false to stop it
+ */
+typedef bool (*catalog_visit_t)(const catalog_t *catalog, const catalog_record_t *record,
+				uint32_t distance, void *user_data);
+
+/**
+ * @brief Selected object of a catalog
+ */
+typedef struct {
+	/** Catalog of the object, NULL if nothing is selected */
+	const catalog_t *catalog;
+	/** Index of the object in the catalog records */
+	uint16_t index;
+} catalog_cursor_t;
+
+/* ============================================================================
+ * GENERATED CATALOGS
+ * ============================================================================ */
+
+/** Messier objects */
+extern const catalog_t catalog_messier;
+/** New General Catalogue objects */
+extern const catalog_t catalog_ngc;
+/** Index Catalogue objects */
+extern const catalog_t catalog_ic;
+/** Bright stars, numbered by brightness */
+extern const catalog_t catalog_star;
+/** NUL separated object names */
+extern const char catalog_names[];
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Get the deep sky catalog selected by :LoD#
+ * @param library Library digit, 0 for NGC and 1 for IC
+ * @return Catalog, or NULL if the library is not available
+ */
+const catalog_t *catalog_deep_sky(int library);
+
+/**
+ * @brief Get the star catalog selected by :LsD#
+ * @param library Library digit, 0 for the STAR library
+ * @return Catalog, or NULL if the library is not available
+ */
+const catalog_t *catalog_star_library(int library);
+
+/**
+ * @brief Find an object by catalog number
+ *
+ * Binary search over the records in flash.
+ *
+ * @param catalog Catalog to search
+ * @param number Catalog number
+ * @return Record in flash, or NULL if the catalog has no such object
+ */
+const catalog_record_t *catalog_find(const catalog_t *catalog, uint16_t number);
+
+/**
+ * @brief Get the name of an object
+ * @param catalog Catalog of the object
+ * @param record Record of the object, must belong to @p catalog
+ * @return Name in flash, or NULL if the object has no name
+ */
+const char *catalog_name(const catalog_t *catalog, const catalog_record_t *record);
+
+/**
+ * @brief Get the short name of an object type, e.g. "GAL"
+ * @param type Object type
+ * @return Type name, "OTHER" for unknown types
+ */
+const char *catalog_type_to_string(catalog_object_type_t type);
+
+/**
+ * @brief Get the magnitude of an object in tenths
+ * @param record Record of the object
+ * @return Magnitude in tenths, or INT16_MAX if it is not known
+ */
+static inline int16_t catalog_magnitude(const catalog_record_t *record)
+{
+	if (record->magnitude == CATALOG_MAGNITUDE_UNKNOWN) {
+		return INT16_MAX;
+	}
+
+	return (int16_t)record->magnitude - CATALOG_MAGNITUDE_BIAS;
+}
+
+/**
+ * @brief Set limits that let every object pass
+ * @param limits Pointer to limits
+ */
+void catalog_limits_init(catalog_limits_t *limits);
+
+/**
+ * @brief Check an object against query limits
+ * @param limits Query limits
+ * @param record Record of the object
+ * @return true if the object passes all limits
+ */
+bool catalog_limits_pass(const catalog_limits_t *limits, const catalog_record_t *record);
+
+/**
+ * @brief Get the angular distance between two positions
+ * @param ra1 First right ascension in tenths of a second of time
+ * @param dec1 First declination in arcseconds
+ * @param ra2 Second right ascension in tenths of a second of time
+ * @param dec2 Second declination in arcseconds
+ * @return Distance in arcseconds (0 to 648000)
+ */
+uint32_t catalog_distance(uint32_t ra1, int32_t dec1, uint32_t ra2, int32_t dec2);
+
+/**
+ * @brief Visit every object within a cone that passes the limits
+ *
+ * Only the index cells overlapping the cone are walked, cells and objects
+ * ruled out by the limits are skipped without computing a distance. Objects
+ * are visited cell by cell, not ordered by distance.
+ *
+ * @param catalog Catalog to query
+ * @param ra Cone center right ascension in tenths of a second of time
+ * @param dec Cone center declination in arcseconds
+ * @param radius Cone radius in arcseconds, 648000 or more for the whole sky
+ * @param limits Object limits, NULL for none
+ * @param visit Called for every object found
+ * @param user_data User data passed to @p visit
+ * @return Number of objects visited, negative errno for invalid parameters
+ */
+int catalog_query_cone(const catalog_t *catalog, uint32_t ra, int32_t dec, uint32_t radius,
+		       const catalog_limits_t *limits, catalog_visit_t visit, void *user_data);
+
+/**
+ * @brief Find the object closest to a position within a cone
+ * @param catalog Catalog to query
+ * @param ra Cone center right ascension in tenths of a second of time
+ * @param dec Cone center declination in arcseconds
+ * @param radius Cone radius in arcseconds
+ * @param limits Object limits, NULL for none
+ * @param distance Distance of the object found in arcseconds, may be NULL
+ * @return Closest record, or NULL if the cone holds no object within the limits
+ */
+const catalog_record_t *catalog_nearest(const catalog_t *catalog, uint32_t ra, int32_t dec,
+					uint32_t radius, const catalog_limits_t *limits,
+					uint32_t *distance);
+
+/**
+ * @brief Clear a cursor, nothing is selected
+ * @param cursor Pointer to cursor
+ */
+void catalog_cursor_init(catalog_cursor_t *cursor);
+
+/**
+ * @brief Select an object by catalog number
+ *
+ * The cursor is left unchanged if the object does not exist.
+ *
+ * @param cursor Pointer to cursor
+ * @param catalog Catalog to search
+ * @param number Catalog number
+ * @return 0 on success, -ENOENT if the catalog has no such object, -EINVAL
+ *         for invalid parameters
+ */
+int catalog_select(catalog_cursor_t *cursor, const catalog_t *catalog, uint16_t number);
+
+/**
+ * @brief Get the selected object
+ * @param cursor Pointer to cursor
+ * @return Record in flash, or NULL if nothing is selected
+ */
+const catalog_record_t *catalog_current(const catalog_cursor_t *cursor);
+
+/**
+ * @brief Select the object following the current one, wrapping around
+ *
+ * Selects the first object of @p catalog if nothing is selected yet.
+ *
+ * @param cursor Pointer to cursor
+ * @param catalog Catalog to start in if nothing is selected
+ * @return Newly selected record, or NULL if the catalog is empty
+ */
+const catalog_record_t *catalog_next(catalog_cursor_t *cursor, const catalog_t *catalog);
+
+/**
+ * @brief Select the object preceding the current one, wrapping around
+ *
+ * Selects the last object of @p catalog if nothing is selected yet.
+ *
+ * @param cursor Pointer to cursor
+ * @param catalog Catalog to start in if nothing is selected
+ * @return Newly selected record, or NULL if the catalog is empty
+ */
+const catalog_record_t *catalog_previous(catalog_cursor_t *cursor, const catalog_t *catalog);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
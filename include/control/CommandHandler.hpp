@@ -0,0 +1,132 @@
+#ifndef OPEN_ASTRO_FIRMWARE_CONTROL_COMMAND_HANDLER_HPP
+#define OPEN_ASTRO_FIRMWARE_CONTROL_COMMAND_HANDLER_HPP
+
+#if defined(CONFIG_CATALOG)
+#include <catalog/catalog.h>
+#endif
+#include <lx200/lx200_cache.h>
+#include <lx200/lx200_session.h>
+#if defined(CONFIG_LX200_LATENCY)
+#include <lx200/lx200_latency.h>
+#endif
+
+#include <mount/Executor.hpp>
+#include <mount/Mount.hpp>
+
+class CommandHandler
+{
+public:
+    /**
+     * @brief Create a command handler
+     *
+     * @param mount mount the commands act on
+     * @param executor runs the long operations of the commands on the executor thread
+     * @param cache response cache shared by all sessions
+     */
+    CommandHandler(Mount &mount, Executor &executor, lx200_cache_t &cache);
+
+    /**
+     * @brief Handle one command and append its reply to the session
+     *
+     * @param session session the command was received on
+     * @param frame frame holding the command
+     * @param view parsed command
+     */
+    void handle(lx200_session_t &session, const lx200_frame_t &frame,
+                const lx200_command_view_t &view);
+
+#if defined(CONFIG_LX200_LATENCY)
+    /**
+     * @brief Attach the latency histograms reported by :XL<family>#
+     *
+     * @param latency latency histograms, or nullptr to detach
+     */
+    void setLatency(const lx200_latency_t *latency);
+#endif
+
+private:
+    /**
+     * @brief Reply to a position poll, from the cache if possible
+     */
+    void replyPosition(lx200_session_t &session, lx200_cache_slot_t slot);
+
+    /**
+     * @brief Queue setting the target coordinate from the command parameter
+     *
+     * Handles the equatorial target of :Sr#/:Sd# and the horizontal one of :Sa#/:Sz#.
+     *
+     * @return true if the parameter was valid and the change was queued
+     */
+    bool setTarget(const lx200_frame_t &frame, const lx200_command_view_t &view);
+
+    /**
+     * @brief Reply to :XL<family># with the latencies of a command family
+     */
+    void replyLatency(lx200_session_t &session, const lx200_frame_t &frame,
+                      const lx200_command_view_t &view);
+
+    /**
+     * @brief Handle the L family: select, step through and describe catalog objects
+     */
+    void handleLibrary(lx200_session_t &session, const lx200_frame_t &frame,
+                       const lx200_command_view_t &view);
+
+    /**
+     * @brief Handle :Sb/:Sf/:Sl/:Ss/:Sh/:SF#, the limits of :LF# and the field of :Lf#
+     *
+     * @return true if the parameter was valid and the limit was set
+     */
+    bool setFindLimit(const lx200_frame_t &frame, const lx200_command_view_t &view);
+
+#if defined(CONFIG_CATALOG)
+    /**
+     * @brief Select the next object above the elevation limit that passes the find limits
+     */
+    void findObject();
+
+    /**
+     * @brief Reply to :Lf# with the objects in the field and the one closest to its center
+     */
+    void identifyField(lx200_session_t &session);
+#endif
+
+    /**
+     * @brief Drop queued operations and have the mount forget the running one
+     */
+    void abort();
+
+    /**
+     * @brief Start a move of :Mn#, :Ms#, :Me# or :Mw# at the selected rate
+     */
+    void move(lx200_command_id_t id);
+
+    Mount &mount;
+    Executor &executor;
+    lx200_cache_t &cache;
+
+    /** target RA as queued to the mount, for the horizon check of :MS# */
+    int32_t targetRaSeconds = 0;
+    /** target DEC as queued to the mount, for the horizon check of :MS# */
+    int32_t targetDecArcsec = 0;
+    /** :RG# selected the guide rate for the moves, :RC#, :RM# and :RS# the faster ones */
+    bool guideRate = false;
+#if defined(CONFIG_LX200_LATENCY)
+    const lx200_latency_t *latency = nullptr;
+#endif
+#if defined(CONFIG_CATALOG)
+    /** catalog object selected by the library commands, shared like the mount target */
+    catalog_cursor_t library{};
+    /** deep sky catalog selected by :LoD# */
+    const catalog_t *deepSky = &catalog_ngc;
+    /** star catalog selected by :LsD# */
+    const catalog_t *stars = &catalog_star;
+    /** magnitude and size limits of :LF# */
+    catalog_limits_t findLimits{INT16_MIN, INT16_MAX, 0, UINT16_MAX};
+    /** minimum elevation of :LF# in degrees */
+    int32_t minElevation = 0;
+    /** field diameter of :Lf# in arcminutes */
+    uint16_t fieldDiameter = 15;
+#endif
+};
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef OPEN_ASTRO_FIRMWARE_CONTROL_DISPATCHER_HPP
+#define OPEN_ASTRO_FIRMWARE_CONTROL_DISPATCHER_HPP
+
+#include <cstddef>
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+#include <lx200/lx200_cache.h>
+#if defined(CONFIG_LX200_LATENCY)
+#include <lx200/lx200_latency.h>
+#endif
+#include <lx200/lx200_session.h>
+
+#include <control/CommandHandler.hpp>
+#include <control/UartTransport.hpp>
+#include <mount/Executor.hpp>
+#include <mount/Mount.hpp>
+
+/**
+ * @brief One client connection
+ */
+struct ControlSession
+{
+    /** serial port of the client */
+    const struct device *uart;
+    /** framer, precision mode and replies of the client */
+    lx200_session_t state;
+    /** receive path feeding the framer */
+    UartTransport transport;
+#if defined(CONFIG_LX200_LATENCY)
+    /** commands handled since the last transmit */
+    lx200_latency_batch_t latency;
+#endif
+};
+
+/**
+ * @brief Runs the LX200 commands of all client connections
+ *
+ * One thread serves every session round robin, one command per session and
+ * round, so a client flooding the mount with commands cannot starve another
+ * one. Replies are queued to the session transport without waiting for the
+ * port, and a session whose client does not read its replies is skipped
+ * until they are sent. Sessions are the "oaf,lx200-session" devicetree nodes, or the
+ * "oaf,uart-control" chosen node if there are none. Slews and other long
+ * operations are handed to the Executor, so a command is never answered
+ * late because the mount is busy.
+ *
+ * With CONFIG_LX200_LATENCY the latency of every command is kept per command
+ * family. It is reported by the :XL<family># command and, with
+ * CONFIG_SHELL, by the "lx200 latency" shell command.
+ */
+class Dispatcher
+{
+public:
+    /**
+     * @brief Create the dispatcher
+     *
+     * @param mount mount the commands act on
+     * @param executor runs the long operations of the commands on the executor thread
+     */
+    Dispatcher(Mount &mount, Executor &executor);
+
+    /**
+     * @brief Initialize the sessions and start the dispatcher thread
+     *
+     * @return 0 on success, negative errno if a session port is not ready
+     */
+    int start();
+
+    /**
+     * @brief Wake the dispatcher after frames were received
+     *
+     * Called by the session transports, safe to call from interrupt context.
+     */
+    void notify();
+
+    /**
+     * @brief Get the number of sessions
+     */
+    size_t sessionCount() const;
+
+    /**
+     * @brief Get a session
+     *
+     * @param index session index
+     * @return session, or nullptr if the index is out of range
+     */
+    ControlSession *session(size_t index);
+
+private:
+    static void threadEntry(void *p1, void *p2, void *p3);
+
+    /**
+     * @brief Stop handler of the session framers, runs in the UART interrupt
+     */
+    static void stopReceived(lx200_stop_t stop, void *user_data);
+
+    void run();
+
+    /**
+     * @brief Handle the next command of a session
+     *
+     * @return true if a command was handled, false if the session is idle
+     */
+    bool serviceOne(ControlSession &session);
+
+    lx200_cache_t cache;
+    CommandHandler handler;
+    Mount &mount;
+    struct k_sem work;
+    struct k_thread thread;
+};
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef OPEN_ASTRO_FIRMWARE_CONTROL_UART_TRANSPORT_HPP
+#define OPEN_ASTRO_FIRMWARE_CONTROL_UART_TRANSPORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/kernel.h>
+
+#include <lx200/lx200_session.h>
+
+class Dispatcher;
+
+/**
+ * @brief Serial port of one session
+ *
+ * Uses the asynchronous UART API where the driver supports it: the driver
+ * receives into two buffers in turn (by DMA on STM32) and reports data when a
+ * buffer is full or the line went idle. Drivers without it (USB CDC ACM) are
+ * read from the RX interrupt. Either way the received bytes go straight into
+ * the session framer and the dispatcher is only woken when a frame is
+ * complete.
+ *
+ * Replies are sent the same way, without blocking the dispatcher: a flushed
+ * response buffer is copied to the transmit buffer of the session and sent
+ * with one uart_tx() (one USB write on CDC ACM through the TX interrupt and
+ * uart_fifo_fill()). While it is on the wire, further replies collect in a
+ * second buffer, which goes out when the first one is done. The dispatcher
+ * only serves a session while a full response buffer fits, so a client that
+ * reads slowly holds back its own commands and no other session.
+ *
+ * The alignment query (a lone ACK byte) is answered from the receive
+ * interrupt through the same buffers, so the answer never splits a reply.
+ */
+class UartTransport
+{
+public:
+    /**
+     * @brief Receive statistics
+     */
+    struct Stats
+    {
+        /** bytes received */
+        uint32_t bytes;
+        /** frames completed */
+        uint32_t frames;
+        /** receive errors (overrun, framing, ...) */
+        uint32_t errors;
+        /** alignment queries answered */
+        uint32_t acks;
+        /** transmit buffers handed to the driver */
+        uint32_t writes;
+        /** replies and answers dropped because the transmit buffer was full */
+        uint32_t overflows;
+        /** writes the driver refused or aborted */
+        uint32_t txErrors;
+    };
+
+    /**
+     * @brief Start receiving
+     *
+     * @param uart serial port of the client
+     * @param session session fed with the received bytes
+     * @param dispatcher dispatcher woken for complete frames
+     * @return 0 on success, -ENOTSUP if the port can neither receive
+     *         asynchronously nor by interrupt, negative errno otherwise
+     */
+    int start(const struct device *uart, lx200_session_t &session, Dispatcher &dispatcher);
+
+    /**
+     * @brief Queue replies for transmission, called by the dispatcher
+     *
+     * Never waits for the port. The bytes are sent after everything queued
+     * before them.
+     *
+     * @param data reply bytes
+     * @param length number of reply bytes
+     * @return 0 on success, -ENOBUFS if they do not fit the transmit buffer
+     */
+    int transmit(const char *data, size_t length);
+
+    /**
+     * @brief Check whether a reply of @p length bytes can be queued now
+     */
+    bool canTransmit(size_t length);
+
+    /**
+     * @brief Get the receive statistics
+     */
+    const Stats &getStats() const { return stats; }
+
+private:
+    /**
+     * @brief Feed received bytes into the session, called from the UART ISR
+     */
+    void receive(const uint8_t *data, size_t length);
+
+    /**
+     * @brief ACK handler of the session framer, called from the UART ISR
+     */
+    static void ackReceived(void *userData);
+
+    /**
+     * @brief Append to the collecting buffer and start it if the port is idle
+     */
+    int queue(const char *data, size_t length);
+
+    /**
+     * @brief Hand the buffer in flight to the driver
+     */
+    void startWrite();
+
+    /**
+     * @brief Release the buffer in flight and send the collected one, called from the UART ISR
+     */
+    void writeDone();
+
+#if defined(CONFIG_UART_ASYNC_API)
+    int startAsync();
+    static void asyncCallback(const struct device *dev, struct uart_event *evt, void *userData);
+#endif
+
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN)
+    int startInterrupt();
+    static void interruptCallback(const struct device *dev, void *userData);
+    /** fill the TX FIFO from the buffer in flight */
+    void fillFifo();
+#endif
+
+    const struct device *uart = nullptr;
+    lx200_session_t *session = nullptr;
+    Dispatcher *dispatcher = nullptr;
+    Stats stats{};
+    /** true if the driver uses the asynchronous API */
+    bool async = false;
+
+    /** room for alignment answers on top of a full response buffer */
+    static constexpr size_t ackRoom = 8;
+    /** protects the transmit buffers against the UART ISR */
+    struct k_spinlock txLock{};
+    /** one buffer collects replies while the other one is on the wire */
+    char txBuffers[2][CONFIG_LX200_RESPONSE_BUFFER_SIZE + ackRoom];
+    /** bytes in each buffer */
+    size_t txLength[2] = {};
+    /** buffer collecting replies, the other one is in flight while txBusy */
+    uint8_t txCollect = 0;
+    /** a buffer is in flight */
+    bool txBusy = false;
+#if defined(CONFIG_UART_INTERRUPT_DRIVEN)
+    /** bytes of the buffer in flight already in the TX FIFO, 0 between buffers */
+    size_t txFilled = 0;
+#endif
+
+#if defined(CONFIG_UART_ASYNC_API)
+    /** buffers handed to the driver in turn */
+    uint8_t buffers[2][CONFIG_CONTROL_UART_RX_BUFFER_SIZE];
+    /** buffer to hand out on the next buffer request */
+    uint8_t nextBuffer = 0;
+#endif
+};
+
+#endif
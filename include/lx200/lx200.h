@@ -199,11 +199,12 @@
  * T - TRACKING COMMANDS
  * --------------------
  * :TL#    - Set tracking rate to Lunar
- * :TQ#    - Turn tracking off
- * :TS#    - Set tracking rate to Solar
- * :TM#    - Set tracking rate to Sidereal
- * :T+#    - Increment tracking rate by 0.1 Hz
- * :T-#    - Decrement tracking rate by 0.1 Hz
+ * :TQ#    - Set tracking rate to Sidereal
+ * :TM#    - Set tracking rate to the custom rate
+ * :TDDD.DDD# - Set the custom rate in Hz
+ *             Returns: 0 (invalid) or 1 (valid)
+ * :T+#    - Increment custom rate by 0.1 Hz
+ * :T-#    - Decrement custom rate by 0.1 Hz
  *
  * U - PRECISION TOGGLE
  * -------------------
@@ -218,6 +219,15 @@
  * :MS#    - Slew to target coordinates
  *           Returns: 0# (slew possible) or 1# (object below horizon) or 2# (object below higher
  * limit)
+ * :MA#    - Slew to target altitude and azimuth
+ *           Returns: 0 (slew possible) or 1 (no site latitude or mount busy)
+ *
+ * $Q - SMART DRIVE (PERIODIC ERROR CORRECTION)
+ * -------------------------------------------
+ * :$Q#    - Toggle PEC: on records the guide corrections of a worm turn and
+ *           plays them back, off stops recording and playback
+ * :$QZ+#  - Play back the RA correction, recording a worm turn first if none was recorded
+ * :$QZ-#  - Stop the RA correction
  *
  * APPENDIX A: LX200GPS COMMAND EXTENSIONS
  * ======================================
@@ -292,6 +302,8 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include <lx200/lx200_command_ids.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -312,6 +324,9 @@ extern "C" {
 /** Maximum length of an LX200 response including terminator */
 #define LX200_MAX_RESPONSE_LENGTH 64
 
+/** Maximum length of a command key (e.g. "GVP", "$QZ+") */
+#define LX200_MAX_COMMAND_KEY_LENGTH 4
+
 /** LX200 command prefix character */
 #define LX200_COMMAND_PREFIX ':'
 
@@ -321,6 +336,18 @@ extern "C" {
 /** LX200 response terminator character */
 #define LX200_RESPONSE_TERMINATOR '#'
 
+/** Alignment query, a single byte without prefix or terminator */
+#define LX200_ACK 0x06
+
+/** Reply to the alignment query in AltAz mode */
+#define LX200_ALIGNMENT_ALTAZ 'A'
+
+/** Reply to the alignment query in Land mode */
+#define LX200_ALIGNMENT_LAND 'L'
+
+/** Reply to the alignment query in Polar mode */
+#define LX200_ALIGNMENT_POLAR 'P'
+
 /* ============================================================================
  * ENUMERATIONS
  * ============================================================================ */
@@ -385,10 +412,66 @@ typedef enum {
 	LX200_CMD_TRACKING,
 	/** Precision toggle (U) */
 	LX200_CMD_PRECISION_TOGGLE,
+	/** Active backlash compensation ($B) */
+	LX200_CMD_BACKLASH,
+	/** Fan commands (f) */
+	LX200_CMD_FAN,
+	/** Home position commands (h) */
+	LX200_CMD_HOME,
+	/** Smart drive / PEC commands ($Q) */
+	LX200_CMD_SMART_DRIVE,
+	/** Field de-rotator commands (r) */
+	LX200_CMD_DEROTATOR,
+	/** Site selection (W) */
+	LX200_CMD_SITE,
+	/** Help text commands (?) */
+	LX200_CMD_HELP,
+	/** OpenAstroFirmware extensions (X) */
+	LX200_CMD_VENDOR,
 	/** Unknown command family */
 	LX200_CMD_UNKNOWN
 } lx200_command_family_t;
 
+/**
+ * @brief LX200 parameter grammars
+ *
+ * Describes the parameter that follows a command key.
+ */
+typedef enum {
+	/** No parameter */
+	LX200_PARAM_NONE,
+	/** Right ascension, HH:MM:SS or HH:MM.T */
+	LX200_PARAM_RA,
+	/** Declination, sDD*MM:SS or sDD*MM */
+	LX200_PARAM_DEC,
+	/** Altitude, sDD*MM:SS or sDD*MM */
+	LX200_PARAM_ALT,
+	/** Azimuth, DDD*MM:SS or DDD*MM */
+	LX200_PARAM_AZ,
+	/** Latitude, sDD*MM */
+	LX200_PARAM_LATITUDE,
+	/** Longitude, DDD*MM */
+	LX200_PARAM_LONGITUDE,
+	/** Time, HH:MM:SS */
+	LX200_PARAM_TIME,
+	/** Date, MM/DD/YY */
+	LX200_PARAM_DATE,
+	/** UTC offset, sHH.H */
+	LX200_PARAM_UTC_OFFSET,
+	/** Magnitude limit, sMM.M */
+	LX200_PARAM_MAGNITUDE,
+	/** Tracking rate, TT.T */
+	LX200_PARAM_TRACKING_RATE,
+	/** Decimal number, DDD.DDD */
+	LX200_PARAM_DECIMAL,
+	/** Integer number, NNNN */
+	LX200_PARAM_NUMBER,
+	/** Single digit, N */
+	LX200_PARAM_DIGIT,
+	/** Free text, up to the terminator */
+	LX200_PARAM_STRING
+} lx200_param_grammar_t;
+
 /**
  * @brief LX200 coordinate formats
  */
@@ -465,9 +548,12 @@ typedef enum {
 
 /**
  * @brief LX200 coordinate structure
+ *
+ * All components hold magnitudes, the sign is kept in @c is_negative so that
+ * values such as -00*30 survive a round trip.
  */
 typedef struct {
-	/** Degrees component */
+	/** Degrees component (hours for right ascension) */
 	int16_t degrees;
 	/** Minutes component */
 	uint8_t minutes;
@@ -507,14 +593,34 @@ typedef struct {
 	uint8_t year;
 } lx200_date_t;
 
+/**
+ * @brief LX200 command table entry
+ *
+ * Entries are generated by scripts/gen_lx200_commands.py.
+ */
+typedef struct {
+	/** Command key, packed little endian (first character in the low byte) */
+	uint32_t key;
+	/** Length of the command key */
+	uint8_t length;
+	/** Command family (lx200_command_family_t) */
+	uint8_t family;
+	/** Parameter grammar (lx200_param_grammar_t) */
+	uint8_t grammar;
+	/** Handler id (lx200_command_id_t) */
+	uint8_t id;
+} lx200_command_info_t;
+
 /**
  * @brief LX200 parsed command structure
  */
 typedef struct {
 	/** Command family */
 	lx200_command_family_t family;
-	/** Command string (up to 3 chars + null) */
-	char command[4];
+	/** Handler id */
+	lx200_command_id_t id;
+	/** Command key (up to 4 chars + null) */
+	char command[LX200_MAX_COMMAND_KEY_LENGTH + 1];
 	/** Command parameter */
 	char parameter[LX200_MAX_COMMAND_LENGTH];
 	/** Length of parameter */
@@ -523,6 +629,40 @@ typedef struct {
 	bool has_parameter;
 } lx200_command_t;
 
+/**
+ * @brief LX200 command view into a frame
+ *
+ * Compact alternative to lx200_command_t for queueing: nothing is copied,
+ * the parameter is located by offset and length into the frame it was
+ * parsed from, e.g. a slot of the framer. The view is only valid while that
+ * frame is, so release the framer slot after the command has been handled.
+ */
+typedef struct {
+	/** Command family, see lx200_command_family_t */
+	uint8_t family;
+	/** Handler id, see lx200_command_id_t */
+	uint8_t id;
+	/** Offset of the parameter from the start of the frame */
+	uint8_t offset;
+	/** Length of the parameter, 0 if the command has none */
+	uint8_t length;
+} lx200_command_view_t;
+
+/**
+ * @brief LX200 parser counters
+ *
+ * Counted whether or not the per-command logging is enabled, see
+ * CONFIG_LX200_QUIET_HOT_PATH.
+ */
+typedef struct {
+	/** Commands parsed successfully */
+	uint32_t commands;
+	/** Commands and data chunks rejected by the parser */
+	uint32_t errors;
+	/** Bytes accepted by lx200_parser_add_data() */
+	uint32_t bytes;
+} lx200_stats_t;
+
 /**
  * @brief LX200 parser state structure
  */
@@ -555,6 +695,11 @@ void lx200_parser_reset(lx200_parser_state_t *state);
 
 /**
  * @brief Add data to LX200 parser buffer
+ *
+ * Only handles a single command per buffer. Use the streaming framer in
+ * lx200_framer.h for data coming from a UART, where one read can carry
+ * several commands.
+ *
  * @param state Pointer to parser state structure
  * @param data Pointer to input data
  * @param length Length of input data
@@ -580,12 +725,45 @@ lx200_parse_result_t lx200_parse_command(const lx200_parser_state_t *state,
  */
 lx200_parse_result_t lx200_parse_command_string(const char *cmd_string, lx200_command_t *command);
 
+/**
+ * @brief Parse a complete frame into a command view
+ *
+ * Zero-copy variant of lx200_parse_command_string() for frames handed out by
+ * lx200_framer_peek(). The frame does not need to be NUL terminated and is
+ * not modified.
+ *
+ * @param frame Frame including the ':' prefix and '#' terminator
+ * @param length Frame length in bytes
+ * @param view Pointer to output command view
+ * @return Parse result code
+ */
+lx200_parse_result_t lx200_parse_frame(const char *frame, size_t length,
+				       lx200_command_view_t *view);
+
+/**
+ * @brief Get the parameter of a command view
+ * @param frame Frame the view was parsed from
+ * @param view Command view
+ * @return Pointer to the first parameter byte, not NUL terminated
+ */
+static inline const char *lx200_command_view_parameter(const char *frame,
+							const lx200_command_view_t *view)
+{
+	return &frame[view->offset];
+}
+
 /* ============================================================================
  * COORDINATE PARSING FUNCTIONS
  * ============================================================================ */
 
 /**
  * @brief Parse right ascension coordinate
+ *
+ * The coordinate parsers scan their input once, without sscanf() or floating
+ * point, and stop at a NUL or '#'. Degrees may be separated by '*', ':' or
+ * the Meade degree sign (0xDF), minutes by ':' or '\''. On error the output
+ * structure is left unchanged.
+ *
  * @param str Input string (HH:MM:SS or HH:MM.T format)
  * @param coord Pointer to output coordinate structure
  * @return Parse result code
@@ -632,13 +810,48 @@ lx200_parse_result_t lx200_parse_longitude(const char *str, lx200_coordinate_t *
  */
 lx200_parse_result_t lx200_parse_latitude(const char *str, lx200_coordinate_t *coord);
 
+/**
+ * @brief Convert a coordinate to signed arcseconds
+ *
+ * Integer only, a tenth of a minute counts as 6 arcseconds.
+ *
+ * @param coord Coordinate as returned by the degree based parsers
+ * @return Angle in arcseconds, 0 for a NULL coordinate
+ */
+int32_t lx200_coordinate_to_arcsec(const lx200_coordinate_t *coord);
+
+/**
+ * @brief Convert a right ascension to arcseconds
+ *
+ * Integer only, one second of time is 15 arcseconds.
+ *
+ * @param coord Coordinate as returned by lx200_parse_ra_coordinate()
+ * @return Right ascension as an angle in arcseconds (0 to 1295999)
+ */
+int32_t lx200_ra_to_arcsec(const lx200_coordinate_t *coord);
+
+/**
+ * @brief Split signed arcseconds into a coordinate
+ *
+ * The inverse of lx200_coordinate_to_arcsec(), truncated to what the
+ * precision mode displays: seconds in high precision, tenths of a minute in
+ * low precision. Seconds of time give a right ascension the same way.
+ *
+ * @param arcsec Angle in arcseconds, or right ascension in seconds of time
+ * @param precision Precision mode of the coordinate
+ * @param coord Pointer to output coordinate structure
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int lx200_coordinate_from_arcsec(int32_t arcsec, lx200_precision_t precision,
+				 lx200_coordinate_t *coord);
+
 /* ============================================================================
  * TIME AND DATE PARSING FUNCTIONS
  * ============================================================================ */
 
 /**
  * @brief Parse time value
- * @param str Input string (HH:MM:SS format)
+ * @param str Input string (24 hour HH:MM:SS format), NUL or '#' terminated
  * @param time Pointer to output time structure
  * @return Parse result code
  */
@@ -646,7 +859,7 @@ lx200_parse_result_t lx200_parse_time(const char *str, lx200_time_t *time);
 
 /**
  * @brief Parse date value
- * @param str Input string (MM/DD/YY format)
+ * @param str Input string (MM/DD/YY format), NUL or '#' terminated
  * @param date Pointer to output date structure
  * @return Parse result code
  */
@@ -654,8 +867,8 @@ lx200_parse_result_t lx200_parse_date(const char *str, lx200_date_t *date);
 
 /**
  * @brief Parse UTC offset
- * @param str Input string (sHH or sHH.H format)
- * @param offset Pointer to output offset in hours
+ * @param str Input string (sHH or sHH.H format), NUL or '#' terminated
+ * @param offset Pointer to output hours added to local time to give UTC (-14.0 to 14.0)
  * @return Parse result code
  */
 lx200_parse_result_t lx200_parse_utc_offset(const char *str, float *offset);
@@ -666,8 +879,8 @@ lx200_parse_result_t lx200_parse_utc_offset(const char *str, float *offset);
 
 /**
  * @brief Parse tracking rate parameter
- * @param str Input string (TT.T format)
- * @param rate Pointer to output tracking rate
+ * @param str Input string (TT.T or DDD.DDD format), NUL or '#' terminated
+ * @param rate Pointer to output tracking rate in Hz, 60.0 is one turn per solar day
  * @return Parse result code
  */
 lx200_parse_result_t lx200_parse_tracking_rate(const char *str, float *rate);
@@ -686,22 +899,46 @@ lx200_parse_result_t lx200_parse_slew_rate(const char *str, lx200_slew_rate_t *r
 
 /**
  * @brief Format right ascension coordinate to string
+ *
+ * Writes the reply to :GR#, HH:MM:SS# in high precision and HH:MM.T# in
+ * low precision, '#' terminated and NUL terminated.
+ *
  * @param coord Pointer to coordinate structure
  * @param str Output string buffer
  * @param str_size Size of output buffer
- * @return Number of characters written, or negative on error
+ * @return Number of characters written without the NUL, -EINVAL on invalid
+ *	   parameters, -ENOSPC if the buffer is too small
  */
 int lx200_format_ra_coordinate(const lx200_coordinate_t *coord, char *str, size_t str_size);
 
 /**
  * @brief Format declination coordinate to string
+ *
+ * Writes the reply to :GD# or :GA#, sDD*MM:SS# in high precision and
+ * sDD*MM# in low precision, '#' terminated and NUL terminated.
+ *
  * @param coord Pointer to coordinate structure
  * @param str Output string buffer
  * @param str_size Size of output buffer
- * @return Number of characters written, or negative on error
+ * @return Number of characters written without the NUL, -EINVAL on invalid
+ *	   parameters, -ENOSPC if the buffer is too small
  */
 int lx200_format_dec_coordinate(const lx200_coordinate_t *coord, char *str, size_t str_size);
 
+/**
+ * @brief Format azimuth coordinate to string
+ *
+ * Writes the reply to :GZ#, DDD*MM:SS# in high precision and DDD*MM# in
+ * low precision, '#' terminated and NUL terminated.
+ *
+ * @param coord Pointer to coordinate structure, not negative
+ * @param str Output string buffer
+ * @param str_size Size of output buffer
+ * @return Number of characters written without the NUL, -EINVAL on invalid
+ *	   parameters, -ENOSPC if the buffer is too small
+ */
+int lx200_format_azimuth_coordinate(const lx200_coordinate_t *coord, char *str, size_t str_size);
+
 /**
  * @brief Format time to string
  * @param time Pointer to time structure
@@ -751,6 +988,19 @@ bool lx200_validate_date(const lx200_date_t *date);
  * UTILITY FUNCTIONS
  * ============================================================================ */
 
+/**
+ * @brief Look up a command in the generated command table
+ *
+ * Finds the longest command key that prefixes @p command. The lookup hashes
+ * at most LX200_MAX_COMMAND_KEY_LENGTH candidate keys and does not scan the
+ * table.
+ *
+ * @param command Command string, without the ':' prefix
+ * @param length Number of bytes of @p command that may be examined
+ * @return Matching table entry, or NULL if no command key matches
+ */
+const lx200_command_info_t *lx200_command_lookup(const char *command, size_t length);
+
 /**
  * @brief Get command family from command string
  * @param command Command string
@@ -772,6 +1022,17 @@ bool lx200_command_has_parameter(const char *command);
  */
 const char *lx200_get_parameter_format(const char *command);
 
+/**
+ * @brief Get the parser counters
+ * @param stats Pointer to output counters
+ */
+void lx200_get_stats(lx200_stats_t *stats);
+
+/**
+ * @brief Reset the parser counters
+ */
+void lx200_reset_stats(void);
+
 /**
  * @brief Convert parse result to string
  * @param result Parse result code
@@ -779,6 +1040,13 @@ const char *lx200_get_parameter_format(const char *command);
  */
 const char *lx200_parse_result_to_string(lx200_parse_result_t result);
 
+/**
+ * @brief Get the command designator of a family
+ * @param family Command family
+ * @return Designator of the family ("G", "$Q", ...), "unknown" for an invalid family
+ */
+const char *lx200_command_family_to_string(lx200_command_family_t family);
+
 /**
  * @brief Set precision mode
  * @param state Pointer to parser state structure
@@ -0,0 +1,219 @@
+/**
+ * @file lx200_cache.h
+ * @brief Cache of pre-formatted replies to high frequency Get commands
+ *
+ * Planetarium programs poll :GR#, :GD#, :GA#, :GZ# and :GS# several times per
+ * second, while the displayed value only changes when the mount moves by one
+ * display unit. The cache keeps the formatted reply per command and precision
+ * mode so a repeated poll is a copy into the response buffer.
+ *
+ * Entries are tagged with a generation counter. The mount reports its
+ * position with lx200_cache_update(), which bumps the generation of every
+ * entry whose displayed value changed and thereby invalidates it. Updates
+ * come from a single thread (the mount), invalidation is lock free and may
+ * run anywhere, lookups and stores come from the command dispatcher.
+ *
+ * A reply is cached like this:
+ *
+ * @code
+ * if (!lx200_cache_lookup(cache, slot, precision, response)) {
+ *         uint32_t generation = lx200_cache_generation(cache, slot, precision);
+ *         // format the reply into text
+ *         lx200_cache_store(cache, slot, precision, generation, text, length);
+ *         lx200_response_append(response, text, length);
+ * }
+ * @endcode
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <zephyr/sys/atomic.h>
+
+#include <lx200/lx200.h>
+#include <lx200/lx200_response.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup lx200_parser
+ * @{
+ */
+
+/* ============================================================================
+ * CONSTANTS AND DEFINITIONS
+ * ============================================================================ */
+
+/** Maximum length of a cached reply, "sDDD*MM:SS#" fits */
+#define LX200_CACHE_ENTRY_LENGTH 16
+
+/** Number of precision modes, see lx200_precision_t */
+#define LX200_CACHE_PRECISIONS 2
+
+/* ============================================================================
+ * ENUMERATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Cached replies
+ */
+typedef enum {
+	/** Right ascension (:GR#), value in seconds of time */
+	LX200_CACHE_RA,
+	/** Declination (:GD#), value in arcseconds */
+	LX200_CACHE_DEC,
+	/** Altitude (:GA#), value in arcseconds */
+	LX200_CACHE_ALT,
+	/** Azimuth (:GZ#), value in arcseconds */
+	LX200_CACHE_AZ,
+	/** Local sidereal time (:GS#), value in seconds of time */
+	LX200_CACHE_SIDEREAL_TIME,
+	/** Number of cached replies */
+	LX200_CACHE_COUNT
+} lx200_cache_slot_t;
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief One cached reply
+ */
+typedef struct {
+	/** Reply bytes */
+	char text[LX200_CACHE_ENTRY_LENGTH];
+	/** Reply length, 0 if nothing has been stored yet */
+	uint8_t length;
+	/** Generation the reply was formatted for */
+	uint32_t generation;
+} lx200_cache_entry_t;
+
+/**
+ * @brief Response cache statistics
+ */
+typedef struct {
+	/** Polls answered from the cache */
+	uint32_t hits;
+	/** Polls that had to be formatted */
+	uint32_t misses;
+	/** Stores dropped because the value changed while formatting */
+	uint32_t stale_stores;
+} lx200_cache_stats_t;
+
+/**
+ * @brief LX200 response cache state
+ */
+typedef struct {
+	/** Cached replies */
+	lx200_cache_entry_t entries[LX200_CACHE_COUNT][LX200_CACHE_PRECISIONS];
+	/** Current generation of each reply */
+	atomic_t generations[LX200_CACHE_COUNT][LX200_CACHE_PRECISIONS];
+	/** Last reported value in display units of each reply, signed as printed */
+	int32_t displayed[LX200_CACHE_COUNT][LX200_CACHE_PRECISIONS];
+	/** Response cache statistics */
+	lx200_cache_stats_t stats;
+} lx200_cache_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a response cache, all entries start out invalid
+ * @param cache Pointer to cache state
+ */
+void lx200_cache_init(lx200_cache_t *cache);
+
+/**
+ * @brief Get the cache slot of a command
+ * @param id Command handler id
+ * @return Cache slot, or LX200_CACHE_COUNT if the reply is not cached
+ */
+lx200_cache_slot_t lx200_cache_slot(lx200_command_id_t id);
+
+/**
+ * @brief Append a cached reply to a response
+ *
+ * Counts a hit or a miss.
+ *
+ * @param cache Pointer to cache state
+ * @param slot Cached reply
+ * @param precision Current precision mode
+ * @param response Response to append the reply to
+ * @return true if the reply was cached and appended, false otherwise
+ */
+bool lx200_cache_lookup(lx200_cache_t *cache, lx200_cache_slot_t slot,
+			lx200_precision_t precision, lx200_response_t *response);
+
+/**
+ * @brief Get the generation to pass to lx200_cache_store()
+ *
+ * Must be read before the reply is formatted, so a position update during
+ * formatting is not hidden by the store.
+ *
+ * @param cache Pointer to cache state
+ * @param slot Cached reply
+ * @param precision Precision mode of the reply
+ * @return Current generation
+ */
+uint32_t lx200_cache_generation(lx200_cache_t *cache, lx200_cache_slot_t slot,
+				lx200_precision_t precision);
+
+/**
+ * @brief Store a formatted reply
+ *
+ * The reply is dropped if the entry was invalidated after @p generation was
+ * read or if it is longer than LX200_CACHE_ENTRY_LENGTH.
+ *
+ * @param cache Pointer to cache state
+ * @param slot Cached reply
+ * @param precision Precision mode of the reply
+ * @param generation Generation read before formatting
+ * @param text Reply bytes
+ * @param length Reply length in bytes
+ */
+void lx200_cache_store(lx200_cache_t *cache, lx200_cache_slot_t slot,
+		       lx200_precision_t precision, uint32_t generation, const char *text,
+		       size_t length);
+
+/**
+ * @brief Report a new value for a cached reply
+ *
+ * Invalidates the reply of every precision mode whose displayed value
+ * changes: 1 second of time or 1 arcsecond in high precision, a tenth of a
+ * minute of time or 1 arcminute in low precision.
+ *
+ * @param cache Pointer to cache state
+ * @param slot Cached reply
+ * @param value Value in seconds of time (RA, sidereal time) or arcseconds
+ */
+void lx200_cache_update(lx200_cache_t *cache, lx200_cache_slot_t slot, int32_t value);
+
+/**
+ * @brief Invalidate a cached reply in all precision modes
+ * @param cache Pointer to cache state
+ * @param slot Cached reply
+ */
+void lx200_cache_invalidate(lx200_cache_t *cache, lx200_cache_slot_t slot);
+
+/**
+ * @brief Invalidate all cached replies
+ * @param cache Pointer to cache state
+ */
+void lx200_cache_invalidate_all(lx200_cache_t *cache);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Generated by scripts/gen_lx200_commands.py, do not edit.
+ */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief LX200 command handler ids
+ */
+typedef enum {
+	/** :Aa# */
+	LX200_ID_ALIGN_AUTO,
+	/** :AL# */
+	LX200_ID_ALIGN_LAND,
+	/** :AP# */
+	LX200_ID_ALIGN_POLAR,
+	/** :AA# */
+	LX200_ID_ALIGN_ALTAZ,
+	/** :$BA# */
+	LX200_ID_BACKLASH_DEC,
+	/** :$BZ# */
+	LX200_ID_BACKLASH_RA,
+	/** :B+# */
+	LX200_ID_RETICLE_BRIGHTER,
+	/** :B-# */
+	LX200_ID_RETICLE_DIMMER,
+	/** :B# */
+	LX200_ID_RETICLE_FLASH_RATE,
+	/** :BD# */
+	LX200_ID_RETICLE_DUTY_CYCLE,
+	/** :CL# */
+	LX200_ID_SYNC_SELENOGRAPHIC,
+	/** :CM# */
+	LX200_ID_SYNC_OBJECT,
+	/** :D# */
+	LX200_ID_DISTANCE_BARS,
+	/** :f+# */
+	LX200_ID_FAN_ON,
+	/** :f-# */
+	LX200_ID_FAN_OFF,
+	/** :fT# */
+	LX200_ID_FAN_TEMPERATURE,
+	/** :F+# */
+	LX200_ID_FOCUS_IN,
+	/** :F-# */
+	LX200_ID_FOCUS_OUT,
+	/** :FQ# */
+	LX200_ID_FOCUS_STOP,
+	/** :FF# */
+	LX200_ID_FOCUS_FAST,
+	/** :FS# */
+	LX200_ID_FOCUS_SLOW,
+	/** :F# */
+	LX200_ID_FOCUS_SPEED,
+	/** :g+# */
+	LX200_ID_GPS_ON,
+	/** :g-# */
+	LX200_ID_GPS_OFF,
+	/** :gps# */
+	LX200_ID_GPS_STREAM,
+	/** :gT# */
+	LX200_ID_GPS_UPDATE_TIME,
+	/** :G0# */
+	LX200_ID_GET_ALIGN_MENU_0,
+	/** :G1# */
+	LX200_ID_GET_ALIGN_MENU_1,
+	/** :G2# */
+	LX200_ID_GET_ALIGN_MENU_2,
+	/** :GA# */
+	LX200_ID_GET_ALTITUDE,
+	/** :Ga# */
+	LX200_ID_GET_LOCAL_TIME_12H,
+	/** :Gb# */
+	LX200_ID_GET_BRIGHTER_LIMIT,
+	/** :GC# */
+	LX200_ID_GET_DATE,
+	/** :Gc# */
+	LX200_ID_GET_CALENDAR_FORMAT,
+	/** :GD# */
+	LX200_ID_GET_DEC,
+	/** :Gd# */
+	LX200_ID_GET_TARGET_DEC,
+	/** :GF# */
+	LX200_ID_GET_FIELD_DIAMETER,
+	/** :Gf# */
+	LX200_ID_GET_FAINT_LIMIT,
+	/** :GG# */
+	LX200_ID_GET_UTC_OFFSET,
+	/** :Gg# */
+	LX200_ID_GET_LONGITUDE,
+	/** :Gh# */
+	LX200_ID_GET_HIGH_LIMIT,
+	/** :GL# */
+	LX200_ID_GET_LOCAL_TIME_24H,
+	/** :Gl# */
+	LX200_ID_GET_LARGER_SIZE_LIMIT,
+	/** :GM# */
+	LX200_ID_GET_SITE_1_NAME,
+	/** :GN# */
+	LX200_ID_GET_SITE_2_NAME,
+	/** :GO# */
+	LX200_ID_GET_SITE_3_NAME,
+	/** :GP# */
+	LX200_ID_GET_SITE_4_NAME,
+	/** :Go# */
+	LX200_ID_GET_LOWER_LIMIT,
+	/** :Gq# */
+	LX200_ID_GET_FIND_QUALITY,
+	/** :GR# */
+	LX200_ID_GET_RA,
+	/** :Gr# */
+	LX200_ID_GET_TARGET_RA,
+	/** :GS# */
+	LX200_ID_GET_SIDEREAL_TIME,
+	/** :Gs# */
+	LX200_ID_GET_SMALLER_SIZE_LIMIT,
+	/** :GT# */
+	LX200_ID_GET_TRACKING_RATE,
+	/** :Gt# */
+	LX200_ID_GET_LATITUDE,
+	/** :GVD# */
+	LX200_ID_GET_FIRMWARE_DATE,
+	/** :GVN# */
+	LX200_ID_GET_FIRMWARE_NUMBER,
+	/** :GVP# */
+	LX200_ID_GET_PRODUCT_NAME,
+	/** :GVT# */
+	LX200_ID_GET_FIRMWARE_TIME,
+	/** :Gy# */
+	LX200_ID_GET_OBJECT_SELECTION,
+	/** :GZ# */
+	LX200_ID_GET_AZIMUTH,
+	/** :hS# */
+	LX200_ID_HOME_STORE,
+	/** :hF# */
+	LX200_ID_HOME_FIND,
+	/** :hN# */
+	LX200_ID_HOME_SLEEP,
+	/** :hP# */
+	LX200_ID_HOME_PARK,
+	/** :hW# */
+	LX200_ID_HOME_WAKE,
+	/** :h?# */
+	LX200_ID_HOME_STATUS,
+	/** :H# */
+	LX200_ID_TOGGLE_TIME_FORMAT,
+	/** :I# */
+	LX200_ID_INITIALIZE,
+	/** :LB# */
+	LX200_ID_LIBRARY_PREVIOUS,
+	/** :LC# */
+	LX200_ID_LIBRARY_SELECT_DEEP_SKY,
+	/** :LF# */
+	LX200_ID_LIBRARY_FIND,
+	/** :Lf# */
+	LX200_ID_LIBRARY_IDENTIFY,
+	/** :LI# */
+	LX200_ID_LIBRARY_INFO,
+	/** :LM# */
+	LX200_ID_LIBRARY_SELECT_MESSIER,
+	/** :LN# */
+	LX200_ID_LIBRARY_NEXT,
+	/** :Lo# */
+	LX200_ID_LIBRARY_DEEP_SKY_CATALOG,
+	/** :Ls# */
+	LX200_ID_LIBRARY_STAR_CATALOG,
+	/** :LS# */
+	LX200_ID_LIBRARY_SELECT_STAR,
+	/** :MA# */
+	LX200_ID_SLEW_ALTAZ,
+	/** :Me# */
+	LX200_ID_MOVE_EAST,
+	/** :Mn# */
+	LX200_ID_MOVE_NORTH,
+	/** :Ms# */
+	LX200_ID_MOVE_SOUTH,
+	/** :Mw# */
+	LX200_ID_MOVE_WEST,
+	/** :MS# */
+	LX200_ID_SLEW_TARGET,
+	/** :P# */
+	LX200_ID_TOGGLE_HIGH_PRECISION,
+	/** :$Q# */
+	LX200_ID_PEC_TOGGLE,
+	/** :$QA+# */
+	LX200_ID_PEC_DEC_ENABLE,
+	/** :$QA-# */
+	LX200_ID_PEC_DEC_DISABLE,
+	/** :$QZ+# */
+	LX200_ID_PEC_RA_ENABLE,
+	/** :$QZ-# */
+	LX200_ID_PEC_RA_DISABLE,
+	/** :Q# */
+	LX200_ID_STOP_ALL,
+	/** :Qe# */
+	LX200_ID_STOP_EAST,
+	/** :Qn# */
+	LX200_ID_STOP_NORTH,
+	/** :Qs# */
+	LX200_ID_STOP_SOUTH,
+	/** :Qw# */
+	LX200_ID_STOP_WEST,
+	/** :r+# */
+	LX200_ID_DEROTATOR_ON,
+	/** :r-# */
+	LX200_ID_DEROTATOR_OFF,
+	/** :RC# */
+	LX200_ID_RATE_CENTERING,
+	/** :RG# */
+	LX200_ID_RATE_GUIDE,
+	/** :RM# */
+	LX200_ID_RATE_FIND,
+	/** :RS# */
+	LX200_ID_RATE_SLEW,
+	/** :RA# */
+	LX200_ID_RATE_RA_AXIS,
+	/** :RE# */
+	LX200_ID_RATE_DEC_AXIS,
+	/** :Rg# */
+	LX200_ID_RATE_GUIDE_SPEED,
+	/** :R0# */
+	LX200_ID_RATE_CUSTOM_0,
+	/** :R1# */
+	LX200_ID_RATE_CUSTOM_1,
+	/** :R2# */
+	LX200_ID_RATE_CUSTOM_2,
+	/** :R3# */
+	LX200_ID_RATE_CUSTOM_3,
+	/** :R4# */
+	LX200_ID_RATE_CUSTOM_4,
+	/** :R5# */
+	LX200_ID_RATE_CUSTOM_5,
+	/** :R6# */
+	LX200_ID_RATE_CUSTOM_6,
+	/** :R7# */
+	LX200_ID_RATE_CUSTOM_7,
+	/** :R8# */
+	LX200_ID_RATE_CUSTOM_8,
+	/** :R9# */
+	LX200_ID_RATE_CUSTOM_9,
+	/** :Sa# */
+	LX200_ID_SET_TARGET_ALTITUDE,
+	/** :Sb# */
+	LX200_ID_SET_BRIGHTER_LIMIT,
+	/** :SB# */
+	LX200_ID_SET_BAUD_RATE,
+	/** :SC# */
+	LX200_ID_SET_DATE,
+	/** :Sd# */
+	LX200_ID_SET_TARGET_DEC,
+	/** :SE# */
+	LX200_ID_SET_SELENOGRAPHIC_LATITUDE,
+	/** :Se# */
+	LX200_ID_SET_SELENOGRAPHIC_LONGITUDE,
+	/** :Sf# */
+	LX200_ID_SET_FAINT_LIMIT,
+	/** :SF# */
+	LX200_ID_SET_FIELD_DIAMETER,
+	/** :Sg# */
+	LX200_ID_SET_LONGITUDE,
+	/** :SG# */
+	LX200_ID_SET_UTC_OFFSET,
+	/** :Sh# */
+	LX200_ID_SET_HIGH_LIMIT,
+	/** :Sl# */
+	LX200_ID_SET_SMALLER_SIZE_LIMIT,
+	/** :SL# */
+	LX200_ID_SET_LOCAL_TIME,
+	/** :SM# */
+	LX200_ID_SET_SITE_1_NAME,
+	/** :SN# */
+	LX200_ID_SET_SITE_2_NAME,
+	/** :SO# */
+	LX200_ID_SET_SITE_3_NAME,
+	/** :SP# */
+	LX200_ID_SET_SITE_4_NAME,
+	/** :So# */
+	LX200_ID_SET_LOWER_LIMIT,
+	/** :Sq# */
+	LX200_ID_STEP_FIND_QUALITY,
+	/** :Sr# */
+	LX200_ID_SET_TARGET_RA,
+	/** :Ss# */
+	LX200_ID_SET_LARGER_SIZE_LIMIT,
+	/** :SS# */
+	LX200_ID_SET_SIDEREAL_TIME,
+	/** :St# */
+	LX200_ID_SET_LATITUDE,
+	/** :ST# */
+	LX200_ID_SET_TRACKING_RATE,
+	/** :Sw# */
+	LX200_ID_SET_MAX_SLEW_RATE,
+	/** :Sy# */
+	LX200_ID_SET_OBJECT_SELECTION,
+	/** :Sz# */
+	LX200_ID_SET_TARGET_AZIMUTH,
+	/** :T+# */
+	LX200_ID_TRACK_INCREMENT,
+	/** :T-# */
+	LX200_ID_TRACK_DECREMENT,
+	/** :TL# */
+	LX200_ID_TRACK_LUNAR,
+	/** :TM# */
+	LX200_ID_TRACK_CUSTOM,
+	/** :TQ# */
+	LX200_ID_TRACK_DEFAULT,
+	/** :T# */
+	LX200_ID_TRACK_SET_MANUAL_RATE,
+	/** :U# */
+	LX200_ID_TOGGLE_PRECISION,
+	/** :W# */
+	LX200_ID_SELECT_SITE,
+	/** :??# */
+	LX200_ID_HELP_START,
+	/** :?+# */
+	LX200_ID_HELP_NEXT,
+	/** :?-# */
+	LX200_ID_HELP_PREVIOUS,
+	/** :XL# */
+	LX200_ID_VENDOR_LATENCY,
+	/** Number of known commands */
+	LX200_ID_COUNT,
+	/** Unknown command */
+	LX200_ID_UNKNOWN = LX200_ID_COUNT
+} lx200_command_id_t;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,265 @@
+/**
+ * @file lx200_framer.h
+ * @brief Streaming LX200 command framer
+ *
+ * The framer turns an arbitrary byte stream (UART or USB CDC reads) into
+ * complete ":...#" frames. Every chunk is scanned exactly once, every frame
+ * contained in it is emitted, a trailing partial frame is kept for the next
+ * chunk and a stray ':' restarts the frame instead of discarding everything
+ * that has been received so far. Since parameters use ':' as a separator
+ * ("HH:MM:SS"), a ':' inside a frame only starts a new frame when it is not
+ * followed by a digit.
+ *
+ * Complete frames are stored in a ring of fixed size slots, so a frame is
+ * always contiguous in memory and can be handed to the parser without being
+ * copied again. The ring is single producer / single consumer: one context
+ * (typically the UART callback) calls lx200_framer_feed() while another one
+ * (the command thread) calls lx200_framer_peek() and lx200_framer_release().
+ *
+ * Stop commands (:Q#, :Qn#, :Qs#, :Qe#, :Qw#) must not wait for the command
+ * thread. They are matched byte by byte while feeding, independently of the
+ * frame slots, and reported through the stop handler from the context that
+ * calls lx200_framer_feed() as soon as their '#' arrives, even if the queue
+ * is full. The frame is queued as usual afterwards.
+ *
+ * The alignment query is a lone ACK byte (0x06) without prefix or terminator.
+ * It is reported through the ACK handler as soon as it is scanned, wherever it
+ * appears in the stream, and never ends up in a frame.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <zephyr/sys/atomic.h>
+
+#include <lx200/lx200.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup lx200_parser
+ * @{
+ */
+
+/* ============================================================================
+ * ENUMERATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Stop commands recognized while framing
+ */
+typedef enum {
+	/** Halt all motion (:Q#) */
+	LX200_STOP_ALL,
+	/** Halt northward motion (:Qn#) */
+	LX200_STOP_NORTH,
+	/** Halt southward motion (:Qs#) */
+	LX200_STOP_SOUTH,
+	/** Halt eastward motion (:Qe#) */
+	LX200_STOP_EAST,
+	/** Halt westward motion (:Qw#) */
+	LX200_STOP_WEST
+} lx200_stop_t;
+
+/**
+ * @brief Stop handler
+ *
+ * Called from the context feeding the framer (usually the UART ISR), so it
+ * must not block.
+ *
+ * @param stop Stop command that was received
+ * @param user_data User data passed to lx200_framer_set_stop_handler()
+ */
+typedef void (*lx200_stop_handler_t)(lx200_stop_t stop, void *user_data);
+
+/**
+ * @brief ACK handler
+ *
+ * Called from the context feeding the framer (usually the UART ISR), so it
+ * must not block.
+ *
+ * @param user_data User data passed to lx200_framer_set_ack_handler()
+ */
+typedef void (*lx200_ack_handler_t)(void *user_data);
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief A complete frame as stored in the framer
+ *
+ * @c data points into the framer slot and stays valid until the frame is
+ * released with lx200_framer_release(). The frame includes the ':' prefix and
+ * the '#' terminator and is followed by a NUL byte.
+ */
+typedef struct {
+	/** Frame bytes, starting with ':' and ending with '#' */
+	const char *data;
+	/** Frame length in bytes, excluding the trailing NUL */
+	size_t length;
+#if defined(CONFIG_LX200_LATENCY)
+	/** Cycle counter when the ':' was received */
+	uint32_t started;
+	/** Cycle counter when the '#' was received */
+	uint32_t completed;
+#endif
+} lx200_frame_t;
+
+/**
+ * @brief Framer statistics
+ */
+typedef struct {
+	/** Frames completed and queued */
+	uint32_t frames;
+	/** Bytes received outside of any frame and ignored */
+	uint32_t discarded_bytes;
+	/** Partial frames abandoned because a new ':' arrived */
+	uint32_t resyncs;
+	/** Frames dropped because they did not fit into a slot */
+	uint32_t overflows;
+	/** Frames dropped because all slots were in use */
+	uint32_t drops;
+	/** Stop commands reported to the stop handler */
+	uint32_t stops;
+	/** Alignment queries (ACK bytes) received */
+	uint32_t acks;
+} lx200_framer_stats_t;
+
+/**
+ * @brief LX200 framer state
+ */
+typedef struct {
+	/** Frame slots, each holding one frame followed by a NUL */
+	char slots[CONFIG_LX200_FRAMER_DEPTH][LX200_MAX_COMMAND_LENGTH];
+	/** Length of the frame held by each slot */
+	uint8_t lengths[CONFIG_LX200_FRAMER_DEPTH];
+#if defined(CONFIG_LX200_LATENCY)
+	/** Cycle counter when the frame of each slot started */
+	uint32_t started[CONFIG_LX200_FRAMER_DEPTH];
+	/** Cycle counter when the frame of each slot was completed */
+	uint32_t completed[CONFIG_LX200_FRAMER_DEPTH];
+#endif
+	/** Number of frames completed by the producer (free running) */
+	atomic_t head;
+	/** Number of frames released by the consumer (free running) */
+	atomic_t tail;
+	/** Number of bytes of the frame currently being assembled */
+	uint8_t fill;
+	/** True between a ':' and the matching '#' */
+	bool in_frame;
+	/** True if the last byte was a ':' inside a frame or a skipped frame */
+	bool colon_pending;
+	/** True while dropping the rest of a frame that did not fit */
+	bool skipping;
+	/** Progress of the stop command matcher */
+	uint8_t stop_match;
+	/** Called when a stop command is received, may be NULL */
+	lx200_stop_handler_t stop_handler;
+	/** User data passed to the stop handler */
+	void *stop_user_data;
+	/** Called when an ACK byte is received, may be NULL */
+	lx200_ack_handler_t ack_handler;
+	/** User data passed to the ACK handler */
+	void *ack_user_data;
+	/** Framer statistics */
+	lx200_framer_stats_t stats;
+} lx200_framer_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a framer
+ * @param framer Pointer to framer state
+ */
+void lx200_framer_init(lx200_framer_t *framer);
+
+/**
+ * @brief Drop all queued and partial frames
+ *
+ * Must not run concurrently with lx200_framer_feed() or the consumer calls.
+ *
+ * @param framer Pointer to framer state
+ */
+void lx200_framer_reset(lx200_framer_t *framer);
+
+/**
+ * @brief Set the handler called when a stop command is received
+ *
+ * Must not run concurrently with lx200_framer_feed().
+ *
+ * @param framer Pointer to framer state
+ * @param handler Stop handler, or NULL to disable stop reporting
+ * @param user_data User data passed to the handler
+ */
+void lx200_framer_set_stop_handler(lx200_framer_t *framer, lx200_stop_handler_t handler,
+				   void *user_data);
+
+/**
+ * @brief Set the handler called when an ACK byte is received
+ *
+ * Must not run concurrently with lx200_framer_feed().
+ *
+ * @param framer Pointer to framer state
+ * @param handler ACK handler, or NULL to ignore alignment queries
+ * @param user_data User data passed to the handler
+ */
+void lx200_framer_set_ack_handler(lx200_framer_t *framer, lx200_ack_handler_t handler,
+				  void *user_data);
+
+/**
+ * @brief Feed received bytes into the framer
+ *
+ * Scans @p data once. Each complete frame is queued, a trailing partial frame
+ * is kept for the next call. Bytes outside of a frame (line endings, noise)
+ * are ignored. Stop commands are reported to the stop handler before their
+ * frame is queued, ACK bytes to the ACK handler.
+ *
+ * @param framer Pointer to framer state
+ * @param data Received bytes
+ * @param length Number of received bytes
+ * @return Number of frames completed by this call
+ */
+size_t lx200_framer_feed(lx200_framer_t *framer, const char *data, size_t length);
+
+/**
+ * @brief Get the oldest queued frame without removing it
+ * @param framer Pointer to framer state
+ * @param frame Pointer to output frame
+ * @return true if a frame was available, false otherwise
+ */
+bool lx200_framer_peek(lx200_framer_t *framer, lx200_frame_t *frame);
+
+/**
+ * @brief Release the oldest queued frame
+ *
+ * Invalidates the frame returned by the last lx200_framer_peek().
+ *
+ * @param framer Pointer to framer state
+ */
+void lx200_framer_release(lx200_framer_t *framer);
+
+/**
+ * @brief Get the number of queued frames
+ * @param framer Pointer to framer state
+ * @return Number of complete frames waiting to be consumed
+ */
+size_t lx200_framer_pending(const lx200_framer_t *framer);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
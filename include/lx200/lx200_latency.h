@@ -0,0 +1,214 @@
+/**
+ * @file lx200_latency.h
+ * @brief Per command family latency histograms
+ *
+ * Every command is timestamped four times: when the ':' of its frame is
+ * received and when the '#' is (both by the framer), when its handler is done
+ * and when its reply has been transmitted (both by the dispatcher). The time
+ * between these points is kept in one histogram per command family and
+ * stage:
+ *
+ * - receive:  first byte to frame complete
+ * - handle:   frame complete to handler done, including the time queued
+ * - transmit: handler done to reply transmitted
+ * - total:    first byte to reply transmitted
+ *
+ * Histograms use power of two buckets from 16 us up to 262 ms and keep the
+ * exact minimum and maximum. Replies are transmitted per burst, so the
+ * commands handled since the last transmit are collected in a batch and all
+ * get the same transmit timestamp.
+ *
+ * Recording is not synchronized: all histograms must be recorded from one
+ * thread (the dispatcher). Readers in other threads may see a histogram
+ * that is off by the sample being recorded.
+ *
+ * Requires CONFIG_LX200_LATENCY.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <lx200/lx200.h>
+#include <lx200/lx200_framer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup lx200_parser
+ * @{
+ */
+
+/* ============================================================================
+ * CONSTANTS AND DEFINITIONS
+ * ============================================================================ */
+
+/** Number of histogram buckets */
+#define LX200_LATENCY_BUCKETS 16
+
+/** Upper bound of the first bucket in microseconds (exclusive) */
+#define LX200_LATENCY_FIRST_BUCKET_US 16
+
+/** Number of handled commands a batch can hold until their reply is transmitted */
+#define LX200_LATENCY_BATCH_SIZE CONFIG_LX200_FRAMER_DEPTH
+
+/* ============================================================================
+ * ENUMERATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Measured stages of a command
+ */
+typedef enum {
+	/** First byte to frame complete */
+	LX200_LATENCY_RECEIVE,
+	/** Frame complete to handler done */
+	LX200_LATENCY_HANDLE,
+	/** Handler done to reply transmitted */
+	LX200_LATENCY_TRANSMIT,
+	/** First byte to reply transmitted */
+	LX200_LATENCY_TOTAL,
+	/** Number of stages */
+	LX200_LATENCY_STAGES
+} lx200_latency_stage_t;
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Latency histogram of one family and stage
+ *
+ * Bucket 0 counts latencies below LX200_LATENCY_FIRST_BUCKET_US, every further
+ * bucket covers twice the range of the previous one. The last bucket also
+ * counts everything above its range.
+ */
+typedef struct {
+	/** Number of samples */
+	uint32_t count;
+	/** Smallest sample in microseconds, valid if count > 0 */
+	uint32_t min_us;
+	/** Largest sample in microseconds */
+	uint32_t max_us;
+	/** Samples per bucket */
+	uint32_t buckets[LX200_LATENCY_BUCKETS];
+} lx200_histogram_t;
+
+/**
+ * @brief Latency histograms of all command families
+ */
+typedef struct {
+	/** Histograms per command family and stage */
+	lx200_histogram_t histograms[LX200_CMD_UNKNOWN][LX200_LATENCY_STAGES];
+} lx200_latency_t;
+
+/**
+ * @brief A handled command waiting for its reply to be transmitted
+ */
+typedef struct {
+	/** Command family */
+	uint8_t family;
+	/** Cycle counter when the first byte was received */
+	uint32_t started;
+	/** Cycle counter when the handler was done */
+	uint32_t handled;
+} lx200_latency_entry_t;
+
+/**
+ * @brief Commands of one session waiting for their reply to be transmitted
+ *
+ * A zero initialized batch is empty.
+ */
+typedef struct {
+	/** Waiting commands */
+	lx200_latency_entry_t entries[LX200_LATENCY_BATCH_SIZE];
+	/** Number of waiting commands */
+	uint8_t count;
+	/** Commands whose transmit time was not measured because the batch was full */
+	uint32_t dropped;
+} lx200_latency_batch_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize latency histograms, all empty
+ * @param latency Pointer to latency histograms
+ */
+void lx200_latency_init(lx200_latency_t *latency);
+
+/**
+ * @brief Add a sample to a histogram
+ * @param latency Pointer to latency histograms
+ * @param family Command family
+ * @param stage Measured stage
+ * @param us Latency in microseconds
+ */
+void lx200_latency_record(lx200_latency_t *latency, lx200_command_family_t family,
+			  lx200_latency_stage_t stage, uint32_t us);
+
+/**
+ * @brief Record a handled command
+ *
+ * Records the receive and handle stages and adds the command to @p batch
+ * until its reply is transmitted.
+ *
+ * @param latency Pointer to latency histograms
+ * @param batch Commands of the session waiting for their reply
+ * @param family Command family
+ * @param frame Frame of the command, as returned by the framer
+ * @param now Cycle counter when the handler was done
+ */
+void lx200_latency_handled(lx200_latency_t *latency, lx200_latency_batch_t *batch,
+			   lx200_command_family_t family, const lx200_frame_t *frame, uint32_t now);
+
+/**
+ * @brief Record the transmission of the replies of a batch
+ *
+ * Records the transmit and total stages of every command in @p batch and
+ * empties it.
+ *
+ * @param latency Pointer to latency histograms
+ * @param batch Commands of the session waiting for their reply
+ * @param now Cycle counter when the replies were transmitted
+ */
+void lx200_latency_transmitted(lx200_latency_t *latency, lx200_latency_batch_t *batch,
+			       uint32_t now);
+
+/**
+ * @brief Get a histogram
+ * @param latency Pointer to latency histograms
+ * @param family Command family
+ * @param stage Measured stage
+ * @return Histogram, or NULL for an invalid family or stage
+ */
+const lx200_histogram_t *lx200_latency_histogram(const lx200_latency_t *latency,
+						 lx200_command_family_t family,
+						 lx200_latency_stage_t stage);
+
+/**
+ * @brief Estimate a percentile of a histogram
+ *
+ * Returns the upper bound of the bucket holding the percentile, capped at
+ * the largest sample, so the estimate is never below the true value.
+ *
+ * @param histogram Pointer to histogram
+ * @param permille Percentile in tenths of a percent (990 for p99)
+ * @return Percentile in microseconds, 0 for an empty histogram
+ */
+uint32_t lx200_histogram_percentile(const lx200_histogram_t *histogram, uint32_t permille);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @file lx200_response.h
+ * @brief LX200 response builder
+ *
+ * Collects the replies to all commands taken from one receive burst so they
+ * can be handed to the transport with a single write. Over USB CDC ACM every
+ * write costs at least one USB frame, so a client pipelining
+ * ":GR#:GD#:GA#:GZ#" gets all four replies in one frame instead of four.
+ *
+ * Replies are appended as a whole: lx200_response_appendv() gathers several
+ * fragments into one reply and either appends all of them or, if the buffer
+ * is too full, flushes first. A reply is never split across two writes unless
+ * it is larger than the buffer itself. Nothing is sent until the buffer runs
+ * full or lx200_response_flush() is called, typically once the framer has no
+ * more frames queued.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <lx200/lx200.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup lx200_parser
+ * @{
+ */
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Transmit callback
+ *
+ * Called with the buffered replies. The data is only valid during the call.
+ *
+ * @param data Bytes to transmit
+ * @param length Number of bytes to transmit
+ * @param user_data User data passed to lx200_response_init()
+ * @return 0 on success, negative errno on failure
+ */
+typedef int (*lx200_response_flush_t)(const char *data, size_t length, void *user_data);
+
+/**
+ * @brief One fragment of a reply
+ */
+typedef struct {
+	/** Fragment bytes */
+	const char *data;
+	/** Fragment length in bytes */
+	size_t length;
+} lx200_response_fragment_t;
+
+/**
+ * @brief Response builder statistics
+ */
+typedef struct {
+	/** Replies appended */
+	uint32_t replies;
+	/** Calls to the transmit callback */
+	uint32_t flushes;
+	/** Bytes passed to the transmit callback */
+	uint32_t bytes;
+	/** Flushes forced by a full buffer */
+	uint32_t forced_flushes;
+	/** Failed transmit callbacks */
+	uint32_t errors;
+} lx200_response_stats_t;
+
+/**
+ * @brief LX200 response builder state
+ */
+typedef struct {
+	/** Buffered replies */
+	char buffer[CONFIG_LX200_RESPONSE_BUFFER_SIZE];
+	/** Number of buffered bytes */
+	size_t length;
+	/** Transmit callback */
+	lx200_response_flush_t flush;
+	/** User data for the transmit callback */
+	void *user_data;
+	/** Response builder statistics */
+	lx200_response_stats_t stats;
+} lx200_response_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a response builder
+ * @param response Pointer to response builder state
+ * @param flush Transmit callback
+ * @param user_data User data for the transmit callback
+ */
+void lx200_response_init(lx200_response_t *response, lx200_response_flush_t flush,
+			 void *user_data);
+
+/**
+ * @brief Append one reply made of several fragments
+ *
+ * The fragments are copied back to back. If they do not fit behind the
+ * replies already buffered, those are flushed first. A reply larger than the
+ * whole buffer is passed to the transmit callback in buffer sized pieces.
+ *
+ * @param response Pointer to response builder state
+ * @param fragments Reply fragments
+ * @param count Number of fragments
+ * @return 0 on success, negative errno on failure
+ */
+int lx200_response_appendv(lx200_response_t *response,
+			   const lx200_response_fragment_t *fragments, size_t count);
+
+/**
+ * @brief Append one reply
+ * @param response Pointer to response builder state
+ * @param data Reply bytes
+ * @param length Reply length in bytes
+ * @return 0 on success, negative errno on failure
+ */
+int lx200_response_append(lx200_response_t *response, const char *data, size_t length);
+
+/**
+ * @brief Append a NUL terminated reply
+ * @param response Pointer to response builder state
+ * @param str Reply string
+ * @return 0 on success, negative errno on failure
+ */
+int lx200_response_append_str(lx200_response_t *response, const char *str);
+
+/**
+ * @brief Reserve space to format a reply in place
+ *
+ * Returns a pointer into the buffer where up to @p length bytes may be
+ * written, flushing buffered replies first if needed. The reply becomes part
+ * of the buffer with lx200_response_commit().
+ *
+ * @param response Pointer to response builder state
+ * @param length Maximum reply length, at most CONFIG_LX200_RESPONSE_BUFFER_SIZE
+ * @return Pointer to the reserved space, NULL on failure
+ */
+char *lx200_response_reserve(lx200_response_t *response, size_t length);
+
+/**
+ * @brief Commit a reply formatted with lx200_response_reserve()
+ * @param response Pointer to response builder state
+ * @param length Number of bytes actually written
+ */
+void lx200_response_commit(lx200_response_t *response, size_t length);
+
+/**
+ * @brief Transmit all buffered replies
+ *
+ * Does nothing if no reply is buffered. The buffer is emptied even if the
+ * transmit callback fails, a client will repeat a command it got no reply to.
+ *
+ * @param response Pointer to response builder state
+ * @return 0 on success, negative errno returned by the transmit callback
+ */
+int lx200_response_flush(lx200_response_t *response);
+
+/**
+ * @brief Get the number of buffered bytes
+ * @param response Pointer to response builder state
+ * @return Number of bytes waiting for lx200_response_flush()
+ */
+size_t lx200_response_pending(const lx200_response_t *response);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
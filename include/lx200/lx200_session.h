@@ -0,0 +1,145 @@
+/**
+ * @file lx200_session.h
+ * @brief Per-client LX200 session state
+ *
+ * Every client connected to the mount (a guiding application on USB, a
+ * planetarium on a Bluetooth serial bridge, ...) gets its own session: a
+ * framer for its receive stream, a response builder for its replies and its
+ * own precision mode, so toggling precision on one connection does not change
+ * the replies sent to another.
+ *
+ * The transport feeds received bytes with lx200_session_receive(), from the
+ * UART callback or a thread. One dispatcher thread takes the frames with
+ * lx200_session_next(), handles them, releases them with
+ * lx200_session_complete() and calls lx200_session_flush() once the session
+ * has no frames left. Apart from lx200_session_receive() all functions must
+ * be called from the dispatcher.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <lx200/lx200.h>
+#include <lx200/lx200_framer.h>
+#include <lx200/lx200_response.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup lx200_parser
+ * @{
+ */
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Session statistics
+ */
+typedef struct {
+	/** Frames parsed and handed to the dispatcher */
+	uint32_t commands;
+	/** Frames dropped because they did not parse */
+	uint32_t errors;
+} lx200_session_stats_t;
+
+/**
+ * @brief LX200 session state
+ */
+typedef struct {
+	/** Receive stream of the client */
+	lx200_framer_t framer;
+	/** Replies to the client */
+	lx200_response_t response;
+	/** Coordinate precision requested by the client */
+	lx200_precision_t precision;
+	/** Session index, for logging */
+	uint8_t index;
+	/** Session statistics */
+	lx200_session_stats_t stats;
+} lx200_session_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a session
+ * @param session Pointer to session state
+ * @param index Session index
+ * @param flush Transmit callback of the client connection
+ * @param user_data Passed to @p flush
+ */
+void lx200_session_init(lx200_session_t *session, uint8_t index, lx200_response_flush_t flush,
+			void *user_data);
+
+/**
+ * @brief Feed bytes received from the client
+ *
+ * May be called from interrupt context, but only from one context per
+ * session.
+ *
+ * @param session Pointer to session state
+ * @param data Received bytes
+ * @param length Number of received bytes
+ * @return Number of frames completed by this call
+ */
+size_t lx200_session_receive(lx200_session_t *session, const char *data, size_t length);
+
+/**
+ * @brief Take the next command of a session
+ *
+ * Frames that do not parse are dropped and counted. On success the frame
+ * stays queued until lx200_session_complete() is called.
+ *
+ * @param session Pointer to session state
+ * @param frame Pointer to output frame
+ * @param view Pointer to output command view into @p frame
+ * @return true if a command is available, false if the session is idle
+ */
+bool lx200_session_next(lx200_session_t *session, lx200_frame_t *frame,
+			lx200_command_view_t *view);
+
+/**
+ * @brief Release the command returned by lx200_session_next()
+ * @param session Pointer to session state
+ */
+void lx200_session_complete(lx200_session_t *session);
+
+/**
+ * @brief Transmit the replies collected for a session
+ * @param session Pointer to session state
+ * @return 0 on success, negative errno from the transmit callback otherwise
+ */
+int lx200_session_flush(lx200_session_t *session);
+
+/**
+ * @brief Set the precision mode of a session
+ * @param session Pointer to session state
+ * @param precision New precision mode
+ */
+void lx200_session_set_precision(lx200_session_t *session, lx200_precision_t precision);
+
+/**
+ * @brief Switch a session between low and high precision (":U#")
+ * @param session Pointer to session state
+ * @return New precision mode
+ */
+lx200_precision_t lx200_session_toggle_precision(lx200_session_t *session);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,213 @@
+/**
+ * @file motion_pec.h
+ * @brief Periodic error correction for the step engine
+ *
+ * The worm of an axis turns the worm wheel with an error that repeats on
+ * every turn of the worm. While guiding over one worm turn, the guide
+ * corrections are recorded against the worm phase, the position of the
+ * axis modulo the steps of a worm turn. The recording becomes a table of
+ * rate corrections, one per segment of the turn, in Q15 fractions of the
+ * step rate.
+ *
+ * During playback the step engine follows the worm phase with a counter
+ * advanced on every step and adjusts each held interval by the correction,
+ * interpolated between the two segments around the phase. This costs two
+ * table reads and a few integer multiplications per step, without division
+ * or floating point. The fraction of a tick the adjustment loses is carried
+ * to the next step, so the corrections add up exactly over a worm turn.
+ *
+ * There is no worm index sensor, the phase comes from the step position.
+ * A recording is valid as long as the position of the axis is not set.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup motion
+ * @{
+ */
+
+/** Segments of a worm turn in the correction table */
+#define MOTION_PEC_SEGMENTS CONFIG_MOTION_PEC_SEGMENTS
+/** One in Q15, a rate correction of the full step rate */
+#define MOTION_PEC_ONE 32768
+/** Largest rate correction, one eighth of the step rate */
+#define MOTION_PEC_MAX_RATE (MOTION_PEC_ONE / 8)
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Periodic error correction of an axis
+ *
+ * The table and the recording belong to the thread that records and
+ * switches playback, the phase and the carry to the step engine.
+ */
+typedef struct {
+	/** MOTION_AXIS_* bit of the corrected axis */
+	uint32_t axis;
+	/** Steps of the axis for one turn of the worm */
+	uint32_t worm_steps;
+	/** Fraction of a segment per unit of @p phase, Q32 */
+	uint32_t gain;
+
+	/** Rate correction at the start of each segment, Q15, positive is faster */
+	int16_t table[MOTION_PEC_SEGMENTS];
+	/** Guide corrections per segment in thousandths of a step */
+	int32_t record[MOTION_PEC_SEGMENTS];
+	/** Position of the axis when the recording started */
+	int32_t record_start;
+	/** A recording is running */
+	bool recording;
+	/** The table holds a finished recording */
+	bool recorded;
+	/** The step engine applies the table */
+	volatile bool playing;
+
+	/** Segment of the worm phase */
+	uint32_t segment;
+	/** Phase within the segment, in units of 1 / MOTION_PEC_SEGMENTS steps */
+	int32_t phase;
+	/** Fraction of a tick carried to the next interval, Q30 */
+	int32_t carry;
+} motion_pec_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the correction of an axis, nothing recorded
+ *
+ * @param pec Pointer to correction
+ * @param axis MOTION_AXIS_* bit of the corrected axis
+ * @param worm_steps Steps of the axis for one turn of the worm, at least
+ *	  MOTION_PEC_SEGMENTS
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int motion_pec_init(motion_pec_t *pec, uint32_t axis, uint32_t worm_steps);
+
+/**
+ * @brief Start recording a worm turn, playback stops
+ *
+ * @param pec Pointer to correction
+ * @param position Position of the axis in steps
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int motion_pec_record_start(motion_pec_t *pec, int32_t position);
+
+/**
+ * @brief Record a guide correction at the current worm phase
+ *
+ * Once the axis moved a worm turn from the start of the recording, the
+ * table is rebuilt from it. The mean of the corrections is left out, it is
+ * a drift of the tracking rate or the polar alignment, not a periodic error.
+ *
+ * @param pec Pointer to correction
+ * @param position Position of the axis in steps
+ * @param millisteps Guide correction in thousandths of a step, positive for
+ *	  the positive direction
+ * @return 1 if the recording is finished, 0 if it goes on, -EINVAL on
+ *	   invalid parameters, -ENOENT if no recording is running
+ */
+int motion_pec_record(motion_pec_t *pec, int32_t position, int32_t millisteps);
+
+/**
+ * @brief Drop a running recording, the table is kept
+ *
+ * @param pec Pointer to correction
+ */
+void motion_pec_record_cancel(motion_pec_t *pec);
+
+/**
+ * @brief Start or stop playback
+ *
+ * @param pec Pointer to correction
+ * @param on true to apply the table
+ * @return 0 on success, -EINVAL on invalid parameters, -ENOENT if nothing
+ *	   was recorded
+ */
+int motion_pec_play(motion_pec_t *pec, bool on);
+
+/**
+ * @brief Set the worm phase from the position, while the step engine is idle
+ *
+ * Called by the step engine when it starts a move on the corrected axis.
+ *
+ * @param pec Pointer to correction
+ * @param position Position of the axis in steps
+ */
+void motion_pec_sync(motion_pec_t *pec, int32_t position);
+
+/**
+ * @brief Check whether playback is on, ISR safe
+ * @param pec Pointer to correction
+ * @return true while the table is applied
+ */
+static inline bool motion_pec_playing(const motion_pec_t *pec)
+{
+	return pec->playing;
+}
+
+/**
+ * @brief Follow a step of the corrected axis, called from the step ISR
+ *
+ * @param pec Pointer to correction
+ * @param direction +1 or -1 steps
+ */
+static inline void motion_pec_step(motion_pec_t *pec, int32_t direction)
+{
+	pec->phase += direction * MOTION_PEC_SEGMENTS;
+
+	if (pec->phase >= (int32_t)pec->worm_steps) {
+		pec->phase -= pec->worm_steps;
+		pec->segment = pec->segment + 1 < MOTION_PEC_SEGMENTS ? pec->segment + 1 : 0;
+	} else if (pec->phase < 0) {
+		pec->phase += pec->worm_steps;
+		pec->segment = pec->segment > 0 ? pec->segment - 1 : MOTION_PEC_SEGMENTS - 1;
+	}
+}
+
+/**
+ * @brief Correct a held interval at the current worm phase, called from the step ISR
+ *
+ * @param pec Pointer to correction
+ * @param interval Interval in counter ticks
+ * @return Corrected interval, at least two ticks
+ */
+static inline uint32_t motion_pec_interval(motion_pec_t *pec, uint32_t interval)
+{
+	const uint32_t next = pec->segment + 1 < MOTION_PEC_SEGMENTS ? pec->segment + 1 : 0;
+	const int32_t here = pec->table[pec->segment];
+	/* Position within the segment in Q15 */
+	const int32_t fraction = (int32_t)(((uint64_t)pec->phase * pec->gain) >> 17);
+	/* Q30, not rounded so corrections of opposite sign cancel exactly */
+	const int32_t rate = here * MOTION_PEC_ONE + (pec->table[next] - here) * fraction;
+	/* A faster rate is a shorter interval */
+	const int64_t shorten = (int64_t)interval * rate + pec->carry;
+	const int64_t ticks = shorten >> 30;
+
+	pec->carry = (int32_t)(shorten - ticks * (MOTION_PEC_ONE * MOTION_PEC_ONE));
+	return (uint32_t)MAX((int64_t)interval - ticks, 2);
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @file motion_ramp.h
+ * @brief Acceleration ramps as step interval tables
+ *
+ * The step ISR has no time for square roots or floating point. A ramp is
+ * therefore planned once, outside the ISR, as the interval in counter ticks
+ * before each step from the start rate up to the cruise rate. The last
+ * entry is the cruise interval. The step engine runs a move of any length
+ * from the same table, reading it forwards to accelerate and backwards to
+ * decelerate, see motion_step_move_t.
+ *
+ * Ramps are trapezoidal, with constant acceleration, or jerk limited
+ * S-curves, where the acceleration itself ramps up and down.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup motion
+ * @{
+ */
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Rates and limits of a ramp
+ */
+typedef struct {
+	/** Rate the ramp starts from in millihertz, the tracking rate to blend into it */
+	uint32_t start_mhz;
+	/** Cruise rate in millihertz */
+	uint32_t cruise_mhz;
+	/** Acceleration in steps per second squared */
+	uint32_t accel;
+	/** Jerk in steps per second cubed, 0 for a trapezoidal ramp */
+	uint32_t jerk;
+} motion_ramp_profile_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Plan a ramp
+ *
+ * Uses floating point, call it when a move is planned or at startup, never
+ * from the step ISR.
+ *
+ * @param profile Rates and limits
+ * @param frequency Counter frequency of the step engine in Hz
+ * @param intervals Output interval before each step in counter ticks
+ * @param capacity Number of entries @p intervals can hold
+ * @return Number of intervals written, the last one is the cruise interval,
+ *	   -EINVAL on invalid parameters, -ENOSPC if the ramp does not fit
+ */
+int motion_ramp_build(const motion_ramp_profile_t *profile, uint32_t frequency,
+		      uint32_t *intervals, uint32_t capacity);
+
+/**
+ * @brief Get the size of the table of a ramp
+ *
+ * Accelerating from the start rate to the cruise rate takes as many steps
+ * as decelerating back, so a move needs about twice this many steps to
+ * reach the cruise rate.
+ *
+ * @param profile Rates and limits
+ * @return Upper bound of the intervals written by motion_ramp_build(), 0 on
+ *	   invalid parameters
+ */
+uint32_t motion_ramp_steps(const motion_ramp_profile_t *profile);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,458 @@
+/**
+ * @file motion_step.h
+ * @brief Step pulse generation from a hardware counter
+ *
+ * Every edge of the step signal is scheduled by a counter alarm. The alarm
+ * ISR drives the step pin, then arms the alarm for the next edge at an
+ * absolute counter value computed from the previous scheduled edge, never
+ * from the time the ISR happened to run. Interrupt latency therefore shows
+ * up as jitter on single edges but never accumulates into the step rate.
+ *
+ * A move is a table of precomputed intervals in counter ticks, one per step,
+ * optionally followed by a constant interval that is held until the move is
+ * replaced or stopped. The ISR only indexes the table, so the cost of a step
+ * does not depend on how the intervals were planned.
+ *
+ * The held interval can carry a fraction of a tick. A phase accumulator
+ * adds the fraction on every step and lengthens the interval by one tick
+ * each time it wraps, so a held rate like the sidereal rate is exact on
+ * average and its error never exceeds one tick, however long it runs.
+ *
+ * One engine can drive both axes from the same alarm. The move is planned
+ * for the axis with the most steps, the lead axis, and a DDA spreads the
+ * steps of the other axis evenly over them, so both axes start and arrive
+ * together and a slew costs one interrupt per step of the longer axis.
+ *
+ * With CONFIG_MOTION_PEC the held interval of one axis is corrected for the
+ * periodic error of its worm, see motion_pec.h.
+ *
+ * The engine reaches the timer and the pins through motion_step_hw_t. The
+ * counter backend uses a Zephyr counter device and GPIOs, the emulation
+ * backend in motion_step_emul.h runs the same ISR from a software counter so
+ * the timing can be tested on native_sim.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+#include <motion/motion_stop.h>
+#if defined(CONFIG_MOTION_PEC)
+#include <motion/motion_pec.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup motion
+ * @{
+ */
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Timer and pins used by the step engine
+ *
+ * All functions are called with interrupts possibly disabled and from the
+ * alarm ISR, they must not block.
+ */
+typedef struct {
+	/** Read the free running 32 bit counter */
+	uint32_t (*now)(void *user_data);
+	/**
+	 * Call motion_step_isr() when the counter reaches @p ticks. An alarm
+	 * that is already due fires as soon as possible and returns -ETIME.
+	 */
+	int (*set_alarm)(void *user_data, uint32_t ticks);
+	/** Cancel the alarm, motion_step_isr() is not called anymore */
+	void (*cancel_alarm)(void *user_data);
+	/** Drive the step pins of the MOTION_AXIS_* bits in @p axes */
+	void (*set_step)(void *user_data, uint32_t axes, bool high);
+	/** Drive the direction pin of a MOTION_AXIS_* axis, true for the positive direction */
+	void (*set_dir)(void *user_data, uint32_t axis, bool forward);
+} motion_step_hw_api_t;
+
+/**
+ * @brief Hardware instance of a step engine
+ */
+typedef struct {
+	/** Backend functions */
+	const motion_step_hw_api_t *api;
+	/** Passed to every backend function */
+	void *user_data;
+	/** Counter frequency in Hz */
+	uint32_t frequency;
+} motion_step_hw_t;
+
+/**
+ * @brief Step interval with a fraction of a counter tick
+ *
+ * The interval is @p ticks + @p frac / @p modulus counter ticks.
+ */
+typedef struct {
+	/** Whole counter ticks */
+	uint32_t ticks;
+	/** Numerator of the fraction, less than @p modulus */
+	uint64_t frac;
+	/** Denominator of the fraction, 0 for whole ticks */
+	uint64_t modulus;
+} motion_step_period_t;
+
+/**
+ * @brief Move run by the step engine
+ *
+ * With @p steps at 0 the intervals are used once each, then @p hold is
+ * held. With @p steps set the intervals are an acceleration ramp ending
+ * with the cruise interval, see motion_ramp_build(). The move accelerates
+ * up the ramp, cruises and decelerates down the same ramp so the last step
+ * has the first interval again, then holds @p hold. A move too short to
+ * reach the cruise rate turns around halfway. A stop request during the
+ * steps decelerates down the ramp from the current rate instead of stopping
+ * at once.
+ *
+ * With @p follow_steps set the other axis of the engine steps along with the
+ * ramped steps of the lead axis, @p follow_steps times in @p steps. It has
+ * no steps of its own during the hold.
+ */
+typedef struct {
+	/** Interval before each step in counter ticks, NULL if @p count is 0 */
+	const uint32_t *intervals;
+	/** Number of steps in @p intervals */
+	uint32_t count;
+	/** Steps of a ramped move, 0 to use @p intervals once */
+	uint32_t steps;
+	/** Interval held after the move, 0 to end it, the tracking interval to blend into tracking */
+	uint32_t hold;
+	/** Step in the positive direction */
+	bool forward;
+	/** MOTION_AXIS_* bit of the lead axis, 0 for the first axis of the engine */
+	uint32_t axis;
+	/** Steps of the other axis of the engine, at most @p steps */
+	uint32_t follow_steps;
+	/** Step the other axis in the positive direction */
+	bool follow_forward;
+	/** Fraction of a tick added to @p hold, numerator */
+	uint64_t hold_frac;
+	/** Fraction of a tick added to @p hold, denominator, 0 for whole ticks */
+	uint64_t hold_modulus;
+} motion_step_move_t;
+
+/**
+ * @brief Step engine statistics
+ */
+typedef struct {
+	/** Steps issued */
+	uint32_t steps;
+	/** Edges whose alarm was already due when it was set */
+	uint32_t late;
+	/** Step rate of the current or last move in millihertz, 0 before its second step */
+	uint32_t rate_mhz;
+	/** Shortest time from a scheduled edge to its ISR in nanoseconds */
+	uint32_t min_latency_ns;
+	/** Longest time from a scheduled edge to its ISR in nanoseconds */
+	uint32_t max_latency_ns;
+	/** Spread of the edge timing, max_latency_ns - min_latency_ns */
+	uint32_t jitter_ns;
+} motion_step_stats_t;
+
+/**
+ * @brief Step engine state
+ */
+typedef struct {
+	/** Timer and pins */
+	const motion_step_hw_t *hw;
+	/** Stop signal polled before every step, may be NULL */
+	motion_stop_t *stop;
+	/** MOTION_AXIS_* bits of the axes driven by this engine */
+	uint32_t axes;
+	/** Length of the step pulse in counter ticks */
+	uint32_t pulse;
+	/** Serializes start and stop with the ISR */
+	struct k_spinlock lock;
+
+	/** Intervals of the running move */
+	const uint32_t *intervals;
+	/** Number of intervals of the running move */
+	uint32_t count;
+	/** Intervals used */
+	uint32_t index;
+	/** Steps of a ramped move, 0 if the intervals are used once */
+	uint32_t length;
+	/** Interval held after the move */
+	uint32_t hold;
+	/** Fraction of a tick added to the held interval, numerator */
+	uint64_t hold_frac;
+	/** Fraction of a tick added to the held interval, denominator, 0 for none */
+	uint64_t hold_modulus;
+	/** Phase accumulator of the fraction, in units of 1 / hold_modulus ticks */
+	uint64_t phase;
+	/** +1 or -1 steps per step */
+	int32_t direction;
+	/** Axis stepped on every step of the move */
+	uint32_t lead;
+	/** Axis stepped by the DDA, 0 if the move has no follower steps */
+	uint32_t follow;
+	/** Follower steps of the move */
+	uint32_t follow_steps;
+	/** Lead steps the follower steps are spread over */
+	uint32_t dda_steps;
+	/** DDA error, a follower step is due each time it reaches dda_steps */
+	uint32_t error;
+	/** +1 or -1 follower steps per follower step */
+	int32_t follow_direction;
+
+	/** A move is running */
+	volatile bool running;
+	/** A step pin is high, the next edge is a falling edge */
+	bool high;
+	/** Axes whose step pin is high */
+	uint32_t stepping;
+	/** The move ends with the current step */
+	bool last;
+	/** Decelerating for a stop request, acknowledged at the end of the move */
+	bool stopping;
+	/** Scheduled counter value of the pending edge */
+	uint32_t edge_at;
+	/** Scheduled counter value of the next step */
+	uint32_t step_at;
+	/** Position in steps per axis */
+	volatile int32_t position[MOTION_AXIS_COUNT];
+#if defined(CONFIG_MOTION_PEC)
+	/** Periodic error correction of an axis, NULL for none */
+	motion_pec_t *pec;
+	/** The lead axis of the running move is the corrected axis */
+	bool pec_lead;
+#endif
+
+	/** Steps issued on the lead axis */
+	uint32_t steps;
+	/** Alarms that were due when set */
+	uint32_t late;
+	/** Steps of the current move */
+	uint32_t move_steps;
+	/** Scheduled ticks from the first to the last step of the current move */
+	uint64_t move_ticks;
+	/** Scheduled counter value of the last step of the current move */
+	uint32_t last_step_at;
+	/** Shortest edge latency in ticks */
+	uint32_t min_latency;
+	/** Longest edge latency in ticks */
+	uint32_t max_latency;
+} motion_step_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a step engine, no move is running
+ *
+ * A stop request on an axis the running move steps stops the move of all
+ * of them and is acknowledged for all of them. Requests on other axes are
+ * left pending, see motion_step_moving_axes().
+ *
+ * @param step Pointer to step engine
+ * @param hw Timer and pins of the axes
+ * @param stop Stop signal polled before every step, or NULL
+ * @param axes MOTION_AXIS_* bits of the axes driven, acknowledged on @p stop
+ * @param pulse_ns Length of the step pulse in nanoseconds
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+int motion_step_init(motion_step_t *step, const motion_step_hw_t *hw, motion_stop_t *stop,
+		     uint32_t axes, uint32_t pulse_ns);
+
+/**
+ * @brief Start a move
+ *
+ * The first step is issued one interval after the call. The intervals are
+ * read by the ISR while the move runs, they must stay valid until it ends.
+ *
+ * @param step Pointer to step engine
+ * @param move Move to run
+ * @return 0 on success, -EBUSY if a move is running, -EINVAL if the move
+ *	   has no steps, a ramped move has no intervals, an interval is
+ *	   shorter than two ticks or the axes do not match the engine
+ */
+int motion_step_start(motion_step_t *step, const motion_step_move_t *move);
+
+/**
+ * @brief Stop immediately, ISR safe
+ *
+ * The step pins are driven low and no further edge is scheduled. Does not
+ * acknowledge the stop signal.
+ *
+ * @param step Pointer to step engine
+ */
+void motion_step_stop(motion_step_t *step);
+
+/**
+ * @brief Decelerate to a stop, ISR safe
+ *
+ * A ramped move runs down its ramp from the current rate, like on a stop
+ * request but without acknowledging the stop signal. Any other move, or a
+ * ramped move holding its final interval, stops at once.
+ *
+ * @param step Pointer to step engine
+ */
+void motion_step_decelerate(motion_step_t *step);
+
+/**
+ * @brief Change the interval held by the running move, ISR safe
+ *
+ * The step already scheduled keeps its interval, the following steps are
+ * held at @p period. The phase of the fraction is carried over, scaled to
+ * the new denominator, so changing the rate does not lose the fraction of
+ * a tick accumulated so far.
+ *
+ * @param step Pointer to step engine
+ * @param period New interval to hold
+ * @return 0 on success, -EINVAL if @p period is shorter than two ticks,
+ *	   -ENOENT if no running move holds an interval
+ */
+int motion_step_set_hold(motion_step_t *step, const motion_step_period_t *period);
+
+/**
+ * @brief Run the pending edge, called from the alarm ISR
+ * @param step Pointer to step engine
+ */
+void motion_step_isr(motion_step_t *step);
+
+/**
+ * @brief Check whether a move is running, ISR safe
+ * @param step Pointer to step engine
+ * @return true while steps are being issued
+ */
+static inline bool motion_step_busy(const motion_step_t *step)
+{
+	return step->running;
+}
+
+/**
+ * @brief Check whether the steps of a move are done, ISR safe
+ *
+ * A move that blends into a held interval arrives with its last step and
+ * keeps running.
+ *
+ * @param step Pointer to step engine
+ * @return true once the last step of the move was issued
+ */
+static inline bool motion_step_arrived(const motion_step_t *step)
+{
+	if (!step->running) {
+		return true;
+	}
+
+	return step->length != 0 ? step->index > step->length
+				 : step->index > step->count;
+}
+
+/**
+ * @brief Get the axes the running move steps, ISR safe
+ *
+ * The follower axis steps until the move arrives, a held interval only
+ * steps the lead axis.
+ *
+ * @param step Pointer to step engine
+ * @return MOTION_AXIS_* bits of the axes stepping, 0 if no move is running
+ */
+static inline uint32_t motion_step_moving_axes(const motion_step_t *step)
+{
+	if (!step->running) {
+		return 0;
+	}
+
+	return motion_step_arrived(step) ? step->lead : step->lead | step->follow;
+}
+
+/**
+ * @brief Get the position of an axis, ISR safe
+ * @param step Pointer to step engine
+ * @param axis MOTION_AXIS_* bit of the axis
+ * @return Position in steps, 0 if the engine does not drive @p axis
+ */
+static inline int32_t motion_step_position(const motion_step_t *step, uint32_t axis)
+{
+	if ((axis & step->axes) == 0) {
+		return 0;
+	}
+
+	return step->position[find_lsb_set(axis) - 1];
+}
+
+/**
+ * @brief Set the position of an axis while no move is running
+ *
+ * @param step Pointer to step engine
+ * @param axis MOTION_AXIS_* bit of the axis
+ * @param position Position in steps
+ * @return 0 on success, -EBUSY if a move is running, -EINVAL if the engine
+ *	   does not drive @p axis
+ */
+int motion_step_set_position(motion_step_t *step, uint32_t axis, int32_t position);
+
+#if defined(CONFIG_MOTION_PEC)
+/**
+ * @brief Attach the periodic error correction of an axis while no move is running
+ *
+ * Moves led by the corrected axis follow its worm phase on every step and
+ * correct their held interval while playback is on.
+ *
+ * @param step Pointer to step engine
+ * @param pec Correction of an axis of the engine, NULL to detach
+ * @return 0 on success, -EBUSY if a move is running, -EINVAL if the engine
+ *	   does not drive the axis of @p pec
+ */
+int motion_step_set_pec(motion_step_t *step, motion_pec_t *pec);
+#endif
+
+/**
+ * @brief Get the duration of a move
+ *
+ * Runs over the ramp once, not over the steps, so slews of any length can
+ * be timed when they are planned.
+ *
+ * @param move Move to time
+ * @return Counter ticks from the start to the last step of the move, the
+ *	   hold not included
+ */
+uint64_t motion_step_move_ticks(const motion_step_move_t *move);
+
+/**
+ * @brief Convert a step rate to a step interval
+ *
+ * @param step Pointer to step engine
+ * @param rate_mhz Step rate in millihertz
+ * @return Interval in counter ticks, 0 if @p rate_mhz is 0
+ */
+uint32_t motion_step_interval(const motion_step_t *step, uint32_t rate_mhz);
+
+/**
+ * @brief Get the step engine statistics
+ * @param step Pointer to step engine
+ * @param stats Pointer to output statistics
+ */
+void motion_step_get_stats(motion_step_t *step, motion_step_stats_t *stats);
+
+/**
+ * @brief Reset the step engine statistics, the position is kept
+ * @param step Pointer to step engine
+ */
+void motion_step_reset_stats(motion_step_t *step);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
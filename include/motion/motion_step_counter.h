@@ -0,0 +1,133 @@
+/**
+ * @file motion_step_counter.h
+ * @brief Counter device backend of the step engine
+ *
+ * Schedules the step edges with absolute alarms on one channel of a Zephyr
+ * counter device and drives the step and direction pins through GPIOs. The
+ * counter must count up over the full 32 bit range, like the 32 bit general
+ * purpose timers of the STM32, so scheduled edges can be compared across a
+ * wrap. One channel schedules the edges of every axis of the engine.
+ *
+ * The enable, sleep and microstep pins of the driver of an axis are set
+ * once when the axis is added and left alone from there.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+
+#include <motion/motion_step.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup motion
+ * @{
+ */
+
+/** Microstep pins of a driver, M0 and M1 of the DRV8424 */
+#define MOTION_STEP_MODE_PINS 2
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Level of a microstep pin
+ */
+typedef enum {
+	MOTION_STEP_PIN_LOW,
+	MOTION_STEP_PIN_HIGH,
+	/** Left open, the third level of drivers like the DRV8424 */
+	MOTION_STEP_PIN_OPEN,
+} motion_step_pin_level_t;
+
+/**
+ * @brief Control pins of the driver of an axis, pins without a port are left out
+ */
+typedef struct {
+	/** Enable pin, driven active */
+	struct gpio_dt_spec enable;
+	/** Sleep pin, driven inactive to wake the driver up */
+	struct gpio_dt_spec sleep;
+	/** Microstep pins */
+	struct gpio_dt_spec mode[MOTION_STEP_MODE_PINS];
+	/** Level of each microstep pin */
+	motion_step_pin_level_t mode_level[MOTION_STEP_MODE_PINS];
+} motion_step_driver_t;
+
+/**
+ * @brief Counter and GPIOs of the axes of an engine
+ */
+typedef struct {
+	/** Hardware instance passed to motion_step_init() */
+	motion_step_hw_t hw;
+	/** Engine whose ISR runs on alarms */
+	motion_step_t *engine;
+	/** Counter device */
+	const struct device *counter;
+	/** Alarm channel */
+	uint8_t channel;
+	/** MOTION_AXIS_* bits of the axes with pins */
+	uint32_t axes;
+	/** Step pin per axis, indexed by the bit number of MOTION_AXIS_* */
+	struct gpio_dt_spec step[MOTION_AXIS_COUNT];
+	/** Direction pin per axis */
+	struct gpio_dt_spec dir[MOTION_AXIS_COUNT];
+} motion_step_counter_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Start the counter
+ *
+ * Add the pins of each axis with motion_step_counter_add_axis(), then pass
+ * @p backend->hw to motion_step_init() of @p engine.
+ *
+ * @param backend Pointer to backend
+ * @param engine Engine whose ISR runs on alarms
+ * @param counter Counter device
+ * @param channel Alarm channel of @p counter
+ * @return 0 on success, -ENODEV if the counter is not ready, -ENOTSUP if
+ *	   the counter does not wrap at 32 bits or has too few channels, other
+ *	   negative errno from the driver
+ */
+int motion_step_counter_init(motion_step_counter_t *backend, motion_step_t *engine,
+			     const struct device *counter, uint8_t channel);
+
+/**
+ * @brief Configure the pins of an axis and wake its driver up
+ *
+ * Sets the microstep pins, enables the driver and takes it out of sleep.
+ * The driver needs its wake-up time, 1 ms for the DRV8424, before the
+ * first step.
+ *
+ * @param backend Pointer to backend
+ * @param axis MOTION_AXIS_* bit of the axis
+ * @param step Step pin
+ * @param dir Direction pin
+ * @param driver Control pins of the driver, NULL if it has none
+ * @return 0 on success, -EINVAL on invalid parameters, -ENODEV if a pin is
+ *	   not ready, other negative errno from the GPIO driver
+ */
+int motion_step_counter_add_axis(motion_step_counter_t *backend, uint32_t axis,
+				 const struct gpio_dt_spec *step, const struct gpio_dt_spec *dir,
+				 const motion_step_driver_t *driver);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,115 @@
+/**
+ * @file motion_step_emul.h
+ * @brief Software counter backend of the step engine
+ *
+ * Stands in for the hardware counter and the step and direction pins so the
+ * timing of the step engine can be checked on native_sim. The counter only
+ * advances in motion_step_emul_run(), which runs every alarm that falls due
+ * in order, each after a configurable interrupt latency, and records the
+ * rising edges seen on the step pin of each axis.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <motion/motion_step.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup motion
+ * @{
+ */
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Emulated counter and pins
+ */
+typedef struct {
+	/** Hardware instance passed to motion_step_init() */
+	motion_step_hw_t hw;
+	/** Engine whose ISR runs on alarms */
+	motion_step_t *engine;
+
+	/** Counter value, the 32 bit counter read by the engine wraps */
+	uint64_t now;
+	/** An alarm is armed */
+	bool armed;
+	/** Counter value the alarm fires at */
+	uint64_t alarm_at;
+	/** Shortest interrupt latency in ticks */
+	uint32_t min_latency;
+	/** Longest interrupt latency in ticks */
+	uint32_t max_latency;
+	/** Pseudo random state of the latency */
+	uint32_t seed;
+
+	/*
+	 * Pins per axis, indexed by the bit number of MOTION_AXIS_*, so [0]
+	 * is the RA axis.
+	 */
+	/** Level of the step pin */
+	bool step_high[MOTION_AXIS_COUNT];
+	/** Level of the direction pin */
+	bool forward[MOTION_AXIS_COUNT];
+	/** Rising edges seen on the step pin */
+	uint32_t rising_edges[MOTION_AXIS_COUNT];
+	/** Counter value of the last rising edge */
+	uint64_t last_rising_at[MOTION_AXIS_COUNT];
+	/** Counter value of the last rising edge while the step pin is high */
+	uint64_t high_since[MOTION_AXIS_COUNT];
+	/** Shortest high time of any step pin in ticks */
+	uint32_t min_high;
+} motion_step_emul_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize an emulated counter at 0 with no interrupt latency
+ *
+ * Pass @p emul->hw to motion_step_init() of @p engine afterwards.
+ *
+ * @param emul Pointer to emulation
+ * @param engine Engine whose ISR runs on alarms
+ * @param frequency Counter frequency in Hz
+ */
+void motion_step_emul_init(motion_step_emul_t *emul, motion_step_t *engine, uint32_t frequency);
+
+/**
+ * @brief Set the interrupt latency, drawn uniformly for every alarm
+ *
+ * @param emul Pointer to emulation
+ * @param min_ticks Shortest latency in counter ticks
+ * @param max_ticks Longest latency in counter ticks
+ */
+void motion_step_emul_set_latency(motion_step_emul_t *emul, uint32_t min_ticks,
+				  uint32_t max_ticks);
+
+/**
+ * @brief Advance the counter, running every alarm that falls due
+ *
+ * @param emul Pointer to emulation
+ * @param ticks Counter ticks to advance
+ * @return Number of alarms run
+ */
+uint32_t motion_step_emul_run(motion_step_emul_t *emul, uint64_t ticks);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file motion_stop.h
+ * @brief Emergency stop signal between the command path and step generation
+ *
+ * A stop request must reach step generation without waiting for the command
+ * thread. The receive path calls motion_stop_request() directly from the UART
+ * ISR as soon as the '#' of a stop command arrives. Step generation polls
+ * motion_stop_pending() on every step and acknowledges with
+ * motion_stop_complete() once it has stopped issuing steps on the requested
+ * axes. Both sides only use atomics, so they may run in any context.
+ *
+ * The time between the first request and its acknowledgement is measured in
+ * hardware cycles, giving the worst case latency from the stop command to
+ * the last step.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup motion Motion control
+ * @{
+ */
+
+/* ============================================================================
+ * CONSTANTS AND DEFINITIONS
+ * ============================================================================ */
+
+/** Right ascension axis */
+#define MOTION_AXIS_RA BIT(0)
+/** Declination axis */
+#define MOTION_AXIS_DEC BIT(1)
+/** All axes */
+#define MOTION_AXIS_ALL (MOTION_AXIS_RA | MOTION_AXIS_DEC)
+/** Number of axes, per axis arrays are indexed by the bit number of MOTION_AXIS_* */
+#define MOTION_AXIS_COUNT 2
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Stop statistics
+ */
+typedef struct {
+	/** Stop requests received */
+	uint32_t requests;
+	/** Stops acknowledged by step generation */
+	uint32_t completions;
+	/** Cycles from request to acknowledgement of the last stop */
+	uint32_t last_cycles;
+	/** Longest cycles from request to acknowledgement */
+	uint32_t max_cycles;
+} motion_stop_stats_t;
+
+/**
+ * @brief Stop signal state
+ */
+typedef struct {
+	/** Axes that must stop, MOTION_AXIS_* bits */
+	atomic_t pending;
+	/** Cycle counter at the first request since the last acknowledgement */
+	atomic_t requested_at;
+	/** Stop requests received */
+	atomic_t requests;
+	/** Stops acknowledged by step generation */
+	atomic_t completions;
+	/** Cycles from request to acknowledgement of the last stop */
+	atomic_t last_cycles;
+	/** Longest cycles from request to acknowledgement */
+	atomic_t max_cycles;
+} motion_stop_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a stop signal, nothing is pending
+ * @param stop Pointer to stop signal
+ */
+void motion_stop_init(motion_stop_t *stop);
+
+/**
+ * @brief Request a stop, ISR safe
+ *
+ * The latency is measured from the first request that arrives while no stop
+ * is pending.
+ *
+ * @param stop Pointer to stop signal
+ * @param axes Axes that must stop, MOTION_AXIS_* bits
+ */
+void motion_stop_request(motion_stop_t *stop, uint32_t axes);
+
+/**
+ * @brief Get the axes that must stop, ISR safe
+ * @param stop Pointer to stop signal
+ * @return MOTION_AXIS_* bits of the axes with a pending stop
+ */
+static inline uint32_t motion_stop_pending(motion_stop_t *stop)
+{
+	return (uint32_t)atomic_get(&stop->pending);
+}
+
+/**
+ * @brief Acknowledge a stop, ISR safe
+ *
+ * Called by step generation once no more steps are issued on @p axes.
+ * Records the latency when this clears the last pending axis.
+ *
+ * @param stop Pointer to stop signal
+ * @param axes Axes that have stopped, MOTION_AXIS_* bits
+ */
+void motion_stop_complete(motion_stop_t *stop, uint32_t axes);
+
+/**
+ * @brief Get the stop statistics
+ * @param stop Pointer to stop signal
+ * @param stats Pointer to output statistics
+ */
+void motion_stop_get_stats(motion_stop_t *stop, motion_stop_stats_t *stats);
+
+/**
+ * @brief Reset the stop statistics, pending stops are kept
+ * @param stop Pointer to stop signal
+ */
+void motion_stop_reset_stats(motion_stop_t *stop);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
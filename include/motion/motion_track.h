@@ -0,0 +1,87 @@
+/**
+ * @file motion_track.h
+ * @brief Exact tracking rates for the step engine
+ *
+ * A tracking rate turns the RA axis once per day of the tracked object:
+ * the sidereal day for stars, the solar day for the Sun and the lunar day
+ * for the Moon. The step interval of such a rate is rarely a whole number
+ * of counter ticks, rounding it would drift by a fraction of a tick on
+ * every step. The interval is therefore computed as an exact fraction, the
+ * step engine adds the fraction with its phase accumulator, see
+ * motion_step_period_t.
+ *
+ * Rates follow the LX200 convention of a drive frequency, where 60 Hz turns
+ * the axis once per day. Custom rates are drive frequencies on the solar
+ * day, so 60.164 Hz is close to the sidereal rate.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <motion/motion_step.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup motion
+ * @{
+ */
+
+/** Drive frequency of one turn per day in millihertz */
+#define MOTION_TRACK_DAY_MHZ 60000U
+
+/** Sidereal day, 23h 56m 4.0905s, in units of 100 us */
+#define MOTION_TRACK_SIDEREAL_DAY 861640905U
+/** Solar day in units of 100 us */
+#define MOTION_TRACK_SOLAR_DAY 864000000U
+/** Mean lunar day, 24h 50m 28.3s, in units of 100 us */
+#define MOTION_TRACK_LUNAR_DAY 894283000U
+
+/* ============================================================================
+ * STRUCTURE DEFINITIONS
+ * ============================================================================ */
+
+/**
+ * @brief Tracking rate of an axis
+ */
+typedef struct {
+	/** Microsteps of the axis for one turn, gearing included */
+	uint32_t steps_per_rev;
+	/** Drive frequency in millihertz, MOTION_TRACK_DAY_MHZ for one turn per day */
+	uint32_t rate_mhz;
+	/** Length of the day in units of 100 us, MOTION_TRACK_*_DAY */
+	uint32_t day;
+} motion_track_rate_t;
+
+/* ============================================================================
+ * FUNCTION DECLARATIONS
+ * ============================================================================ */
+
+/**
+ * @brief Compute the exact step interval of a tracking rate
+ *
+ * The interval is frequency * 6 * day / (steps_per_rev * rate_mhz) ticks,
+ * returned as whole ticks and a reduced fraction. Integer arithmetic only.
+ *
+ * @param rate Tracking rate
+ * @param frequency Counter frequency of the step engine in Hz
+ * @param period Output interval, hold it with the step engine
+ * @return 0 on success, -EINVAL on invalid parameters, -ERANGE if the
+ *	   interval is shorter than two ticks or does not fit the counter
+ */
+int motion_track_period(const motion_track_rate_t *rate, uint32_t frequency,
+			motion_step_period_t *period);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,128 @@
+#ifndef OPEN_ASTRO_FIRMWARE_MOUNT_EXECUTOR_HPP
+#define OPEN_ASTRO_FIRMWARE_MOUNT_EXECUTOR_HPP
+
+#include <cstddef>
+#include <inttypes.h>
+
+#include <zephyr/kernel.h>
+
+#include <mount/Mount.hpp>
+
+/**
+ * @brief Runs long mount operations in the background
+ *
+ * Commands are parsed and answered by the dispatcher, operations that take
+ * longer than the command response budget (slews, homing, alignment solves)
+ * are submitted here and run one after the other on the executor thread. The
+ * dispatcher runs at a higher priority, so position polls are still answered
+ * while a goto is being planned.
+ *
+ * Every priority has its own queue. The worker always takes the oldest job of
+ * the highest priority that has one, so jobs of the same priority run in the
+ * order they were submitted.
+ */
+class Executor
+{
+public:
+    /**
+     * @brief Job priorities, highest first
+     */
+    enum class Priority : uint8_t
+    {
+        /** overtakes everything queued, e.g. aborting motion */
+        High,
+        /** commands that must run in order, e.g. target, slew, homing */
+        Normal,
+        /** background work, e.g. alignment solves */
+        Low,
+    };
+
+    /** Number of job priorities */
+    static constexpr size_t priorities = 3;
+
+    /**
+     * @brief One queued operation
+     */
+    struct Job
+    {
+        /** operation, runs on the executor thread */
+        void (*run)(Mount &mount, const Job &job);
+        /** arguments of the operation */
+        int32_t args[3];
+    };
+
+    /**
+     * @brief Executor statistics
+     */
+    struct Stats
+    {
+        /** jobs queued */
+        uint32_t submitted;
+        /** jobs rejected because their queue was full */
+        uint32_t rejected;
+        /** jobs dropped by cancel() before they ran */
+        uint32_t cancelled;
+        /** jobs run to completion */
+        uint32_t completed;
+    };
+
+    explicit Executor(Mount &mount);
+
+    /**
+     * @brief Start the executor thread
+     */
+    void start();
+
+    /**
+     * @brief Queue a job
+     *
+     * Never blocks, so the dispatcher can answer the command right away.
+     *
+     * @param priority job priority
+     * @param job operation and its arguments
+     * @return 0 on success, -ENOMEM if the queue of the priority is full
+     */
+    int submit(Priority priority, const Job &job);
+
+    /**
+     * @brief Drop the queued jobs of a priority
+     *
+     * A job that is already running is not interrupted.
+     *
+     * @param priority job priority
+     * @return number of jobs dropped
+     */
+    size_t cancel(Priority priority);
+
+    /**
+     * @brief Get the number of queued jobs of all priorities
+     */
+    size_t pending();
+
+    /**
+     * @brief Get the executor statistics
+     */
+    Stats stats() const;
+
+private:
+    static void threadEntry(void *p1, void *p2, void *p3);
+
+    void run();
+
+    /**
+     * @brief Take the next job, highest priority first
+     *
+     * @return true if a job was taken, false if all queues are empty
+     */
+    bool next(Job &job);
+
+    Mount &mount;
+    struct k_msgq queues[priorities];
+    char __aligned(4) buffers[priorities][CONFIG_MOUNT_EXECUTOR_QUEUE_DEPTH * sizeof(Job)];
+    /** given once per submitted job */
+    struct k_sem ready;
+    struct k_thread thread;
+    Stats counters{};
+};
+
+#endif
@@ -3,9 +3,141 @@
 
 #include <inttypes.h>
 
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <astro/astro_correct.h>
+#include <astro/astro_lst.h>
+#include <astro/astro_transform.h>
+#include <lx200/lx200_cache.h>
+#include <motion/motion_stop.h>
+#if defined(CONFIG_MOTION_STEP)
+#include <motion/motion_step.h>
+#endif
+#if defined(CONFIG_MOTION_STEP_EMUL)
+#include <motion/motion_step_emul.h>
+#endif
+
+#include <mount/SeqLock.hpp>
+
+/**
+ * @brief The mount and its real-time control loop
+ *
+ * The control thread wakes up on a fixed period, at absolute deadlines so the
+ * time spent in the loop does not shift the next one, and runs tracking,
+ * slews and guiding. It runs at a higher priority than the dispatcher and
+ * the executor and only takes commands from the mount command channel, so
+ * command parsing and long operations never delay a period.
+ */
 class Mount
 {
 public:
+    /**
+     * @brief Command for the control loop, published on the mount command channel
+     */
+    struct Command
+    {
+        enum class Type : uint8_t
+        {
+            /** start tracking if args[0] is not 0, stop it otherwise */
+            Track,
+            /** track at rate args[0] (a TrackingRate), custom rates at args[1] millihertz */
+            TrackRate,
+            /**
+             * slew to the place args[0] seconds of RA and args[1] arcseconds of Dec reported
+             * to the client, pointing at args[2] seconds of RA and args[3] arcseconds of Dec
+             */
+            Slew,
+            /**
+             * guide in direction args[0] (a GuideDirection) for args[1] milliseconds, until
+             * stopped if negative, RA at the tracking rate and a half or half of it, DEC at
+             * half the sidereal rate
+             */
+            Guide,
+            /** forget the slew and guide pulses of the MOTION_AXIS_* bits in args[0] */
+            Stop,
+            /** site at latitude args[0] arcseconds, for the horizontal position */
+            Site,
+            /** periodic error correction of the RA axis to args[0] (a PecMode) */
+            Pec,
+            /**
+             * stop tracking and slew to args[0] seconds of hour angle and args[1] arcseconds
+             * of Dec, args[2] and args[3] repeat them
+             */
+            Park,
+        };
+
+        Type type;
+        int32_t args[4];
+    };
+
+    /**
+     * @brief Direction of a guide pulse
+     */
+    enum class GuideDirection : int32_t
+    {
+        North,
+        South,
+        East,
+        West,
+    };
+
+    /**
+     * @brief Tracking rate, the day of the object followed
+     */
+    enum class TrackingRate : int32_t
+    {
+        Sidereal,
+        Solar,
+        Lunar,
+        /** drive frequency set with setCustomRate(), on the solar day */
+        Custom,
+    };
+
+    /**
+     * @brief Periodic error correction of the RA axis
+     */
+    enum class PecMode : int32_t
+    {
+        Off,
+        /** recording the guide corrections of a worm turn, played back once recorded */
+        Record,
+        /** playing back the last recording */
+        Play,
+    };
+
+    /**
+     * @brief Control loop statistics
+     */
+    struct ControlStats
+    {
+        /** periods run */
+        uint32_t periods;
+        /** periods that started a full period or more late and were skipped */
+        uint32_t overruns;
+        /** commands taken from the command channel */
+        uint32_t commands;
+        /** latest start of a period after its deadline in microseconds */
+        uint32_t maxLatenessUs;
+    };
+
+    /**
+     * @brief Reported position of the mount
+     */
+    struct Position
+    {
+        /** right ascension in seconds of time (0-86399) */
+        int32_t raSeconds;
+        /** declination in arcseconds */
+        int32_t decArcsec;
+        /** altitude in arcseconds */
+        int32_t altArcsec;
+        /** azimuth in arcseconds (0-1295999) */
+        int32_t azArcsec;
+        /** local sidereal time in seconds (0-86399) */
+        int32_t lstSeconds;
+    };
+
     Mount();
     ~Mount();
 
@@ -14,6 +146,26 @@ public:
      */
     void initialize();
 
+    /**
+     * @brief Start the control thread
+     */
+    void start();
+
+    /**
+     * @brief Publish a command to the control loop
+     *
+     * Never blocks, the command is applied at the start of the next period.
+     *
+     * @param command command to publish
+     * @return 0 on success, negative errno if the command could not be queued
+     */
+    int submit(const Command &command);
+
+    /**
+     * @brief Get the control loop statistics
+     */
+    ControlStats controlStats() const;
+
     /**
      * @brief Set the Target Dec
      *
@@ -25,6 +177,18 @@ public:
      */
     bool setTargetDec(int d, unsigned int m, unsigned int s);
 
+    /**
+     * @brief Set the Target Dec
+     *
+     * Unlike the degree, minute, second form this keeps the sign of
+     * declinations between 0 and -1 degree.
+     *
+     * @param arcsec declination in arcseconds (-324000 to 324000)
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setTargetDec(int32_t arcsec);
+
     /**
      * @brief Set the Target Ra
      *
@@ -35,6 +199,667 @@ public:
      * @return true if successful, false otherwise
      */
     bool setTargetRa(unsigned int h, unsigned int m, unsigned int s);
+
+    /**
+     * @brief Set the target to catalog coordinates
+     *
+     * @param raSeconds right ascension in seconds of time (0-86399)
+     * @param decArcsec declination in arcseconds (-324000 to 324000)
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setTarget(int32_t raSeconds, int32_t decArcsec);
+
+    /**
+     * @brief Slew to the target set with setTargetRa() and setTargetDec()
+     *
+     * Long running, run by the executor. With CONFIG_MOUNT_APPARENT_PLACE the
+     * target is a catalog place, corrected to the apparent place and
+     * refracted once date, time and latitude are known. Plans the slew and
+     * hands it to the control loop. The target is reported as set.
+     */
+    void slewToTarget();
+
+#if !defined(CONFIG_MOUNT_APPARENT_PLACE)
+    /**
+     * @brief Correct a place of the date to its J2000.0 catalog place
+     *
+     * For the dispatcher thread only. Left as is without a date and time.
+     *
+     * @param raSeconds right ascension in seconds of time, corrected in place
+     * @param decArcsec declination in arcseconds, corrected in place
+     */
+    void catalogPlace(int32_t &raSeconds, int32_t &decArcsec);
+#endif
+
+    /**
+     * @brief Set the target altitude of slewToAltAz()
+     *
+     * @param arcsec altitude in arcseconds (-324000 to 324000)
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setTargetAltitude(int32_t arcsec);
+
+    /**
+     * @brief Set the target azimuth of slewToAltAz()
+     *
+     * @param arcsec azimuth in arcseconds from north through east (0-1295999)
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setTargetAzimuth(int32_t arcsec);
+
+    /**
+     * @brief Slew to the target set with setTargetAltitude() and setTargetAzimuth()
+     *
+     * Long running, run by the executor. The target becomes the equatorial
+     * target at the sidereal time of the slew, so tracking follows it. With
+     * CONFIG_MOUNT_APPARENT_PLACE it is reported as its catalog place.
+     *
+     * @return true if the slew was handed to the control loop, false without a latitude
+     */
+    bool slewToAltAz();
+
+    /**
+     * @brief Slew to the home position and stop tracking
+     *
+     * Long running, run by the executor. There is no home sensor, the
+     * position is taken from the step positions.
+     */
+    void findHome();
+
+    /**
+     * @brief Slew to the park position and stop tracking
+     *
+     * Long running, run by the executor.
+     */
+    void park();
+
+    /**
+     * @brief Forget the operation interrupted by a stop command
+     *
+     * Run by the executor once the running operation returned, step
+     * generation has already been stopped by emergencyStop().
+     */
+    void abortMotion();
+
+    /**
+     * @brief Attach the LX200 response cache
+     *
+     * Cached replies are invalidated whenever the reported position changes
+     * by at least one display unit.
+     *
+     * @param cache response cache, or nullptr to detach
+     */
+    void setResponseCache(lx200_cache_t *cache);
+
+    /**
+     * @brief Report the current position of the mount
+     *
+     * @param raSeconds right ascension in seconds of time (0-86399)
+     * @param decArcsec declination in arcseconds
+     * @param altArcsec altitude in arcseconds
+     * @param azArcsec azimuth in arcseconds (0-1295999)
+     */
+    void updatePosition(int32_t raSeconds, int32_t decArcsec, int32_t altArcsec,
+                        int32_t azArcsec);
+
+    /**
+     * @brief Set the latitude of the site
+     *
+     * @param arcsec latitude in arcseconds (-324000 to 324000), north positive
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setLatitude(int32_t arcsec);
+
+    /**
+     * @brief Get the latitude of the site
+     *
+     * @param arcsec set to the latitude in arcseconds if it is known
+     *
+     * @return true if the latitude was set, false otherwise
+     */
+    bool latitude(int32_t &arcsec) const;
+
+    /**
+     * @brief Convert equatorial coordinates to horizontal coordinates now
+     *
+     * Uses the site rotation cached by setLatitude(). Call from the
+     * dispatcher or the executor thread.
+     *
+     * @param raSeconds right ascension in seconds of time (0-86399)
+     * @param decArcsec declination in arcseconds
+     * @param altArcsec set to the altitude in arcseconds
+     * @param azArcsec set to the azimuth in arcseconds (0-1295999)
+     *
+     * @return true if converted, false if the latitude is not known
+     */
+    bool horizontal(int32_t raSeconds, int32_t decArcsec, int32_t &altArcsec,
+                    int32_t &azArcsec);
+
+    /**
+     * @brief Set the longitude of the site
+     *
+     * Moves the local sidereal time with the site.
+     *
+     * @param arcsec longitude in arcseconds (-648000 to 648000), east positive
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setLongitude(int32_t arcsec);
+
+    /**
+     * @brief Set the offset of the local time from UTC
+     *
+     * @param minutes minutes added to local time to give UTC (-840 to 840)
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setUtcOffset(int32_t minutes);
+
+    /**
+     * @brief Set the local date
+     *
+     * Anchors the sidereal time once the local time is known as well.
+     *
+     * @param year year (2000-2099)
+     * @param month month (1-12)
+     * @param day day of the month (1-31)
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setLocalDate(uint32_t year, uint32_t month, uint32_t day);
+
+    /**
+     * @brief Set the local time
+     *
+     * Anchors the sidereal time once the local date is known as well.
+     *
+     * @param h hours (0-23)
+     * @param m minutes (0-59)
+     * @param s seconds (0-59)
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setLocalTime(uint32_t h, uint32_t m, uint32_t s);
+
+    /**
+     * @brief Set the local sidereal time directly
+     *
+     * Replaces the anchor of the site date and time until they are set again.
+     *
+     * @param seconds local sidereal time in seconds (0-86399)
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setSiderealTime(uint32_t seconds);
+
+    /**
+     * @brief Get the local sidereal time now
+     *
+     * O(1) integer arithmetic, safe to call from an ISR.
+     *
+     * @return local sidereal time in milliseconds (0-86399999)
+     */
+    uint32_t siderealTimeMs();
+
+    /**
+     * @brief Report the current local sidereal time
+     *
+     * @param lstSeconds local sidereal time in seconds (0-86399)
+     */
+    void updateSiderealTime(int32_t lstSeconds);
+
+    /**
+     * @brief Select the tracking rate
+     *
+     * The rate changes on the next step, without restarting tracking.
+     *
+     * @param rate rate to track at
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setTrackingRate(TrackingRate rate);
+
+    /**
+     * @brief Set the drive frequency of the custom tracking rate
+     *
+     * Applied at once if the custom rate is selected.
+     *
+     * @param mhz drive frequency in millihertz (1-999999), 60000 is one turn per solar day
+     *
+     * @return true if successful, false otherwise
+     */
+    bool setCustomRate(uint32_t mhz);
+
+    /**
+     * @brief Change the drive frequency of the custom tracking rate
+     *
+     * @param mhz millihertz to add, negative to slow down
+     *
+     * @return true if successful, false otherwise
+     */
+    bool adjustCustomRate(int32_t mhz);
+
+    /**
+     * @brief Guide at the guide rate, half the sidereal rate
+     *
+     * RA moves at the tracking rate and a half west or half of it east, DEC
+     * at half the sidereal rate. A pulse replaces the one of its axis, the RA
+     * pulses are recorded by the periodic error correction.
+     *
+     * @param direction direction to guide in
+     * @param ms length of the pulse in milliseconds, negative to guide until
+     *           a stop of the axis, 0 to end the pulse of the axis
+     *
+     * @return true if the pulse was handed to the control loop, false
+     *         without step generation
+     */
+    bool guide(GuideDirection direction, int32_t ms);
+
+    /**
+     * @brief Get the drive frequency of the selected tracking rate
+     *
+     * @return millihertz on the solar day, 60164 for the sidereal rate
+     */
+    uint32_t trackingFrequency() const;
+
+    /**
+     * @brief Record, play back or stop the periodic error correction
+     *
+     * Playing back without a recording records a worm turn first.
+     *
+     * @param mode mode to switch to, recording always starts over
+     *
+     * @return true if the mode was handed to the control loop, false without
+     *         periodic error correction
+     */
+    bool setPecMode(PecMode mode);
+
+    /**
+     * @brief Get the mode of the periodic error correction
+     */
+    PecMode pecMode() const;
+
+    /**
+     * @brief Get the progress of the running slew
+     *
+     * The duration is known when the slew starts, both axes arrive together
+     * at its end.
+     *
+     * @param remainingMs set to the time left until the slew arrives
+     * @param totalMs set to the planned duration of the slew
+     *
+     * @return true while a slew is running, false otherwise
+     */
+    bool slewProgress(uint32_t &remainingMs, uint32_t &totalMs) const;
+
+    /**
+     * @brief Get the last reported position
+     *
+     * Lock free, so any number of command sessions can poll the position
+     * without blocking each other or the mount.
+     *
+     * @return consistent copy of the last reported position
+     */
+    Position position() const;
+
+    /**
+     * @brief Stop motion on the given axes as fast as possible
+     *
+     * Only raises the stop signal polled by step generation, so it is safe
+     * to call from the UART interrupt that received the stop command.
+     *
+     * @param axes MOTION_AXIS_* bits of the axes to stop
+     */
+    void emergencyStop(uint32_t axes);
+
+    /**
+     * @brief Get the stop signal polled and acknowledged by step generation
+     */
+    motion_stop_t &stopSignal();
+
+    /**
+     * @brief Get the stop latency statistics
+     *
+     * Latency runs from the stop command being received to step generation
+     * acknowledging that no more steps are issued.
+     */
+    motion_stop_stats_t stopStats();
+
+#if defined(CONFIG_MOTION_STEP)
+    /**
+     * @brief Get the step rate and edge jitter of the leading axis
+     *
+     * All zero without step generation.
+     */
+    motion_step_stats_t stepStats();
+#endif
+
+#if defined(CONFIG_MOTION_STEP_EMUL)
+    /**
+     * @brief Get the software counter both axes step on without a stepper node
+     *
+     * Tests on native_sim advance it along with the kernel clock.
+     *
+     * @return the emulated counter, nullptr on a board with a stepper
+     */
+    motion_step_emul_t *stepEmulator();
+#endif
+
+private:
+    /**
+     * @brief Control loop state, only touched by the control thread
+     */
+    struct Control
+    {
+        bool tracking;
+        TrackingRate trackingRate;
+        /** drive frequency of the custom rate in millihertz */
+        uint32_t customRateMhz;
+        bool slewing;
+        /** the move of the slew was handed to step generation */
+        bool slewStarted;
+        /** target of the slew as the client set it */
+        int32_t slewRaSeconds;
+        int32_t slewDecArcsec;
+        /** the slew aims at hour angle slewRaSeconds, for the home and park positions */
+        bool slewHourAngle;
+        /** place the slew points at, observed with CONFIG_MOUNT_APPARENT_PLACE */
+        int32_t slewPointRaSeconds;
+        int32_t slewPointDecArcsec;
+        /** place the mount points at, for the altitude, azimuth and step positions */
+        int32_t pointRaSeconds;
+        int32_t pointDecArcsec;
+        /** periods left of the guide pulse per axis, RA first */
+        uint32_t guidePeriods[2];
+        /** direction of the guide pulse per axis, +1 or -1 */
+        int8_t guideSign[2];
+        /** RA rate held by step generation in halves of the tracking rate, negative east */
+        int32_t raHalves;
+        /** the latitude is known and site holds its rotation */
+        bool siteKnown;
+        astro_site_t site;
+        /** the step positions were tied to a place by anchorSteps() */
+        bool anchored;
+        /** hour angle of RA step position 0 in milliseconds of time (0-86399999) */
+        uint32_t raZeroMs;
+        /** declination of DEC step position 0 in arcseconds */
+        int32_t decZeroArcsec;
+        /** a stopped or replaced slew runs down its ramp, reported once at rest */
+        bool settling;
+    };
+
+    static void threadEntry(void *p1, void *p2, void *p3);
+
+    void controlLoop();
+
+    /**
+     * @brief Site date and time from the LX200 set commands
+     */
+    struct SiteClock
+    {
+        /** local midnight of the date in milliseconds since J2000.0 */
+        int64_t dateMs;
+        /** local time in milliseconds since midnight */
+        uint32_t timeMs;
+        /** uptime in ticks at which the local time was set */
+        int64_t timeTick;
+        /** minutes added to local time to give UTC */
+        int32_t utcOffsetMinutes;
+        bool dateSet;
+        bool timeSet;
+    };
+
+    /**
+     * @brief Anchor the sidereal time to the site clock, once date and time are set
+     *
+     * Called with siteLock held.
+     */
+    void anchorSiderealTime();
+
+    /**
+     * @brief Apply one command taken from the command channel
+     */
+    void apply(const Command &command);
+
+    /**
+     * @brief Run one control period
+     */
+    void controlStep();
+
+    /**
+     * @brief Report the position at the current sidereal time
+     *
+     * Altitude and azimuth are those of the place pointed at.
+     *
+     * @param raSeconds right ascension in seconds of time (0-86399)
+     * @param decArcsec declination in arcseconds
+     */
+    void updateEquatorial(int32_t raSeconds, int32_t decArcsec);
+
+    /**
+     * @brief Local sidereal time now as a binary angle
+     */
+    uint32_t siderealAngle();
+
+    /**
+     * @brief UTC now from the site clock
+     *
+     * @param utcMs set to the milliseconds since J2000.0
+     *
+     * @return true if date and time are set, false otherwise
+     */
+    bool utcNow(int64_t &utcMs);
+
+    /**
+     * @brief Correct a catalog place to the place to point at now
+     *
+     * Only touched by the executor thread. Left as is without a date and time.
+     * Shares the corrections with the control thread for the place a stopped
+     * slew reaches.
+     *
+     * @param raSeconds right ascension in seconds of time, corrected in place
+     * @param decArcsec declination in arcseconds, corrected in place
+     */
+    void observedPlace(int32_t &raSeconds, int32_t &decArcsec);
+
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+    /**
+     * @brief Share the corrections of the last slew with the control thread
+     *
+     * @param corrected the slew points at an apparent place
+     * @param refracted the slew points at a refracted place
+     */
+    void shareCorrections(bool corrected, bool refracted);
+#endif
+
+    /**
+     * @brief Take corrections out of a place pointed at
+     *
+     * @param corrections corrections from catalog to apparent places
+     * @param site rotation of the site if the place was refracted, nullptr otherwise
+     * @param raSeconds right ascension in seconds of time, corrected in place
+     * @param decArcsec declination in arcseconds, corrected in place
+     */
+    void meanPlace(const astro_corrections_t &corrections, const astro_site_t *site,
+                   int32_t &raSeconds, int32_t &decArcsec);
+
+    /**
+     * @brief Hand a slew to the control loop
+     *
+     * @param raSeconds right ascension reported to the client in seconds of time (0-86399)
+     * @param decArcsec declination reported to the client in arcseconds
+     * @param pointRaSeconds right ascension to point at in seconds of time (0-86399)
+     * @param pointDecArcsec declination to point at in arcseconds
+     */
+    void slewTo(int32_t raSeconds, int32_t decArcsec, int32_t pointRaSeconds,
+                int32_t pointDecArcsec);
+
+    /**
+     * @brief Drive the slew handed over by the executor
+     *
+     * @return true once the slew has arrived
+     */
+    bool runSlew();
+
+#if defined(CONFIG_MOTION_STEP)
+    /**
+     * @brief Plan the slew ramps from rest and from the tracking rate
+     */
+    void planRamps();
+
+    /**
+     * @brief Start the move of both axes of the slew, once step generation is free
+     */
+    void startSlew();
+
+    /**
+     * @brief Move of both axes of a slew, planned for the axis with more steps
+     */
+    motion_step_move_t slewMove(uint32_t raSteps, bool raForward, uint32_t decSteps,
+                                bool decForward) const;
+
+    /**
+     * @brief Tie the step positions to the place pointed at now
+     *
+     * @param raSeconds right ascension in seconds of time (0-86399)
+     * @param decArcsec declination in arcseconds
+     */
+    void anchorSteps(int32_t raSeconds, int32_t decArcsec);
+
+    /**
+     * @brief Hour angle of an RA step position in milliseconds of time (0-86399999)
+     */
+    uint32_t stepHourAngleMs(int32_t raPosition) const;
+
+    /**
+     * @brief Declination of a DEC step position in arcseconds
+     */
+    int32_t stepDeclination(int32_t decPosition) const;
+
+    /**
+     * @brief Report the place the step positions point at now, in the frame of the client
+     */
+    void updateFromSteps();
+
+    /**
+     * @brief Hold the RA rate of tracking and the RA guide pulse, start DEC guide pulses
+     */
+    void updateTracking();
+
+    /**
+     * @brief Start the next part of a DEC guide pulse, RA stepping along at its rate
+     *
+     * @param raHalves RA rate in halves of the tracking rate, negative east
+     *
+     * @return true if the pulse was started, false if no DEC step is left to take
+     */
+    bool startDecGuide(int32_t raHalves);
+
+    /**
+     * @brief Compute the RA step intervals of the tracking rate and hold the new one
+     */
+    void updateTrackingPeriod();
+
+#if defined(CONFIG_MOUNT_PEC)
+    /**
+     * @brief Switch the periodic error correction to a mode
+     */
+    void applyPec(PecMode mode);
+
+    /**
+     * @brief Record the RA guide correction of this period, play back once a worm turn is done
+     */
+    void recordPec();
+#endif
+#endif
+
+    lx200_cache_t *responseCache = nullptr;
+
+    /** target right ascension in seconds of time, only touched by the executor thread */
+    int32_t targetRaSeconds = 0;
+    /** target declination in arcseconds, only touched by the executor thread */
+    int32_t targetDecArcsec = 0;
+    /** target altitude of slewToAltAz() in arcseconds, only touched by the executor thread */
+    int32_t targetAltArcsec = 0;
+    /** target azimuth of slewToAltAz() in arcseconds, only touched by the executor thread */
+    int32_t targetAzArcsec = 0;
+    /** corrections from catalog to apparent places, only touched by the executor thread */
+    astro_corrections_t corrections{};
+#if defined(CONFIG_MOUNT_APPARENT_PLACE)
+    /** guards the slew corrections, the control thread preempts the executor */
+    struct k_spinlock correctionsLock{};
+    /** corrections of the last slew, taken out of the place a stopped slew reaches */
+    astro_corrections_t slewCorrections{};
+    /** the last slew pointed at a place of the date */
+    bool slewCorrected = false;
+    /** the last slew pointed at a refracted place */
+    bool slewRefracted = false;
+#else
+    /** corrections of catalogPlace(), only touched by the dispatcher thread */
+    astro_corrections_t catalogCorrections{};
+#endif
+
+    static constexpr atomic_val_t latitudeUnknown = INT32_MIN;
+    /** site latitude in arcseconds, latitudeUnknown until set */
+    atomic_t siteLatitude = ATOMIC_INIT(latitudeUnknown);
+    /** rotation of the site, written by setLatitude() before siteLatitude */
+    SeqLock<astro_site_t> site;
+
+    static constexpr uint32_t maxCustomRateMhz = 999999;
+    /** selected TrackingRate, the control loop applies it from the command channel */
+    atomic_t trackingRate = ATOMIC_INIT(static_cast<atomic_val_t>(TrackingRate::Sidereal));
+    /** drive frequency of the custom rate in millihertz, close to sidereal until set */
+    atomic_t customRateMhz = ATOMIC_INIT(60164);
+    /** PecMode of the control loop, for the toggle command */
+    atomic_t pecState = ATOMIC_INIT(static_cast<atomic_val_t>(PecMode::Off));
+
+    /** local sidereal time, advanced from the kernel uptime */
+    astro_lst_t siderealTime{};
+    /** guards siteClock against concurrent set commands */
+    struct k_spinlock siteLock{};
+    SiteClock siteClock{};
+
+    /** Stop requests from the command path to step generation */
+    motion_stop_t stop;
+
+    /** uptime in milliseconds, 32 bit, at which the running slew arrives */
+    atomic_t slewEndMs = ATOMIC_INIT(0);
+    /** planned duration of the running slew in milliseconds, 0 if no slew is running */
+    atomic_t slewTotalMs = ATOMIC_INIT(0);
+
+#if defined(CONFIG_MOTION_STEP)
+    /** step generation of both axes, driven by the alarms of one counter */
+    motion_step_t steps{};
+    /** the board has a stepper on a counter and steps was initialized */
+    bool stepsReady = false;
+    /** RA step intervals of 0 to 3 halves of the tracking rate, ticks 0 if out of range */
+    motion_step_period_t raPeriods[4]{};
+    /** interval of the steps of a DEC guide pulse, read by the step ISR */
+    uint32_t guideInterval = 0;
+    /** entries of the slew ramp from rest */
+    uint32_t restRampSize = 0;
+    /** entries of the slew ramp from the tracking rate */
+    uint32_t trackingRampSize = 0;
+#if defined(CONFIG_MOUNT_PEC)
+    /** periodic error correction of the RA axis, played back by step generation */
+    motion_pec_t pec{};
+    /** pec was initialized and attached to step generation */
+    bool pecReady = false;
+#endif
+#endif
+
+    Control control{};
+    ControlStats counters{};
+    struct k_thread thread;
+
+    /** Position being updated, only touched by the control thread */
+    Position reported{};
+    /** Position published to the command sessions */
+    SeqLock<Position> published;
 };
 
 #endif
@@ -0,0 +1,85 @@
+#ifndef OPEN_ASTRO_FIRMWARE_MOUNT_SEQLOCK_HPP
+#define OPEN_ASTRO_FIRMWARE_MOUNT_SEQLOCK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief Lock free snapshot of a small value with a single writer
+ *
+ * The writer never waits and readers never take a lock: a reader copies the
+ * value and retries if the writer changed it in the meantime. The value is
+ * kept in relaxed atomic words, so the concurrent copy is well defined.
+ *
+ * A reader spins while a store is in progress, so readers must not preempt
+ * the writer: read from threads of lower or equal priority, not from ISRs.
+ *
+ * @tparam T trivially copyable value type
+ */
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock values are copied bytewise");
+
+public:
+    /**
+     * @brief Publish a new value, single writer only
+     *
+     * @param value new value
+     */
+    void store(const T &value)
+    {
+        uint32_t copy[Words] = {};
+        std::memcpy(copy, &value, sizeof(T));
+
+        const uint32_t sequence = this->sequence.load(std::memory_order_relaxed);
+
+        this->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < Words; i++) {
+            words[i].store(copy[i], std::memory_order_relaxed);
+        }
+
+        this->sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Read a consistent copy of the value
+     *
+     * @return last published value
+     */
+    T load() const
+    {
+        uint32_t copy[Words];
+        uint32_t before;
+        uint32_t after;
+
+        do {
+            before = sequence.load(std::memory_order_acquire);
+
+            for (size_t i = 0; i < Words; i++) {
+                copy[i] = words[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while ((before & 1U) != 0 || before != after);
+
+        T value;
+        std::memcpy(&value, copy, sizeof(T));
+        return value;
+    }
+
+private:
+    static constexpr size_t Words = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    /** Odd while a store is in progress */
+    std::atomic<uint32_t> sequence{0};
+    std::atomic<uint32_t> words[Words]{};
+};
+
+#endif
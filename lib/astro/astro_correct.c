@@ -0,0 +1,468 @@
+/**
+ * @file astro_correct.c
+ * @brief Apparent place corrections implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <astro/astro_correct.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(astro, CONFIG_ASTRO_LOG_LEVEL);
+
+/* Milliseconds in a Julian century */
+#define CENTURY_MS 3155760000000.0f
+/* Binary angle units per arcsecond */
+#define ANGLE_PER_ARCSEC 3314.0625f
+/* Binary angle units per tenth of an arcsecond */
+#define ANGLE_PER_TENTH 331.40625f
+/* Radians per arcsecond */
+#define RADIANS_PER_ARCSEC 4.84813681e-6f
+/* Binary angle units in a turn */
+#define TURN 4294967296.0f
+/* Constant of aberration in arcseconds */
+#define ABERRATION_ARCSEC 20.49552f
+/* Reads of the refraction table to take refraction out, ends earlier once settled */
+#define UNREFRACT_PASSES 8
+
+/* Cadence of each term in milliseconds, in ASTRO_TERM_* bit order */
+static const int64_t periods_ms[] = {
+	CONFIG_ASTRO_PRECESSION_PERIOD * 1000LL,
+	CONFIG_ASTRO_NUTATION_PERIOD * 1000LL,
+	CONFIG_ASTRO_ABERRATION_PERIOD * 1000LL,
+};
+
+/* ============================================================================
+ * INTERNAL HELPERS
+ * ============================================================================ */
+
+/**
+ * @brief Binary angle of an angle in degrees, any number of turns
+ */
+static uint32_t degrees_angle(float degrees)
+{
+	float turns = degrees / 360.0f;
+
+	/* Drop the whole turns first, so the fraction keeps its precision */
+	turns -= (float)(int32_t)turns;
+	return (uint32_t)(int64_t)(turns * TURN);
+}
+
+/**
+ * @brief Binary angle of a small angle in arcseconds
+ */
+static uint32_t arcsec_angle(float arcsec)
+{
+	return (uint32_t)(int32_t)(arcsec * ANGLE_PER_ARCSEC);
+}
+
+/**
+ * @brief Product of two 3x3 matrices, @p out may not be an operand
+ */
+static void multiply(const float a[3][3], const float b[3][3], float out[3][3])
+{
+	for (int i = 0; i < 3; i++) {
+		for (int j = 0; j < 3; j++) {
+			out[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j] + a[i][2] * b[2][j];
+		}
+	}
+}
+
+/**
+ * @brief Precession from J2000.0, IAU 1976
+ */
+static void update_precession(astro_corrections_t *corrections, float t)
+{
+	const float zeta = t * (2306.2181f + t * (0.30188f + t * 0.017998f));
+	const float z = t * (2306.2181f + t * (1.09468f + t * 0.018203f));
+	const float theta = t * (2004.3109f - t * (0.42665f + t * 0.041833f));
+	float sin_zeta;
+	float cos_zeta;
+	float sin_z;
+	float cos_z;
+	float sin_theta;
+	float cos_theta;
+
+	astro_sincos(arcsec_angle(zeta), &sin_zeta, &cos_zeta);
+	astro_sincos(arcsec_angle(z), &sin_z, &cos_z);
+	astro_sincos(arcsec_angle(theta), &sin_theta, &cos_theta);
+
+	float(*p)[3] = corrections->precession;
+
+	p[0][0] = cos_zeta * cos_theta * cos_z - sin_zeta * sin_z;
+	p[0][1] = -sin_zeta * cos_theta * cos_z - cos_zeta * sin_z;
+	p[0][2] = -sin_theta * cos_z;
+	p[1][0] = cos_zeta * cos_theta * sin_z + sin_zeta * cos_z;
+	p[1][1] = -sin_zeta * cos_theta * sin_z + cos_zeta * cos_z;
+	p[1][2] = -sin_theta * sin_z;
+	p[2][0] = cos_zeta * sin_theta;
+	p[2][1] = -sin_zeta * sin_theta;
+	p[2][2] = cos_theta;
+}
+
+/**
+ * @brief True obliquity of the ecliptic, and nutation from the mean to the true equator
+ *
+ * The four largest terms of IAU 1980. Both angles stay below 20
+ * arcseconds, so the rotation is taken to first order.
+ */
+static void update_nutation(astro_corrections_t *corrections, float t, float *obliquity)
+{
+	const uint32_t node = degrees_angle(125.04452f - 1934.136261f * t);
+	const uint32_t sun = degrees_angle(280.4665f + 36000.7698f * t);
+	const uint32_t moon = degrees_angle(218.3165f + 481267.8813f * t);
+	const float mean_obliquity = 84381.448f - 46.815f * t;
+	float s[4];
+	float c[4];
+
+	astro_sincos(node, &s[0], &c[0]);
+	astro_sincos(2 * sun, &s[1], &c[1]);
+	astro_sincos(2 * moon, &s[2], &c[2]);
+	astro_sincos(2 * node, &s[3], &c[3]);
+
+	const float longitude = -17.20f * s[0] - 1.32f * s[1] - 0.23f * s[2] + 0.21f * s[3];
+	const float tilt = 9.20f * c[0] + 0.57f * c[1] + 0.10f * c[2] - 0.09f * c[3];
+	float sin_eps;
+	float cos_eps;
+
+	*obliquity = mean_obliquity + tilt;
+	astro_sincos(arcsec_angle(*obliquity), &sin_eps, &cos_eps);
+
+	const float dpsi = longitude * RADIANS_PER_ARCSEC;
+	const float deps = tilt * RADIANS_PER_ARCSEC;
+	float(*n)[3] = corrections->nutation;
+
+	n[0][0] = 1.0f;
+	n[0][1] = -dpsi * cos_eps;
+	n[0][2] = -dpsi * sin_eps;
+	n[1][0] = dpsi * cos_eps;
+	n[1][1] = 1.0f;
+	n[1][2] = -deps;
+	n[2][0] = dpsi * sin_eps;
+	n[2][1] = deps;
+	n[2][2] = 1.0f;
+}
+
+/**
+ * @brief Velocity of the Earth over the speed of light, from the longitude of the Sun
+ */
+static void update_aberration(astro_corrections_t *corrections, float t, float obliquity)
+{
+	const uint32_t anomaly = degrees_angle(357.52911f + 35999.05029f * t);
+	float sin_m;
+	float cos_m;
+	float sin_2m;
+	float cos_2m;
+
+	astro_sincos(anomaly, &sin_m, &cos_m);
+	astro_sincos(2 * anomaly, &sin_2m, &cos_2m);
+
+	/* True longitude of the Sun, mean longitude and equation of the center */
+	const float center = (1.914602f - 0.004817f * t) * sin_m + 0.019993f * sin_2m;
+	const uint32_t sun = degrees_angle(280.46646f + 36000.76983f * t + center);
+	const uint32_t perihelion = degrees_angle(102.93735f + 1.71946f * t);
+	const float eccentricity = 0.016708634f - 0.000042037f * t;
+	const float kappa = ABERRATION_ARCSEC * RADIANS_PER_ARCSEC;
+	float sin_sun;
+	float cos_sun;
+	float sin_pi;
+	float cos_pi;
+	float sin_eps;
+	float cos_eps;
+
+	astro_sincos(sun, &sin_sun, &cos_sun);
+	astro_sincos(perihelion, &sin_pi, &cos_pi);
+	astro_sincos(arcsec_angle(obliquity), &sin_eps, &cos_eps);
+
+	/* The Earth moves 90 degrees behind the Sun, in the plane of the ecliptic */
+	const float x = kappa * (sin_sun + eccentricity * sin_pi);
+	const float y = -kappa * (cos_sun + eccentricity * cos_pi);
+
+	corrections->aberration[0] = x;
+	corrections->aberration[1] = y * cos_eps;
+	corrections->aberration[2] = y * sin_eps;
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the corrections
+ */
+int astro_corrections_init(astro_corrections_t *corrections)
+{
+	if (corrections == NULL) {
+		LOG_ERR("astro_corrections_init: Invalid parameters (corrections=%p)", corrections);
+		return -EINVAL;
+	}
+
+	*corrections = (astro_corrections_t){0};
+	for (int i = 0; i < 3; i++) {
+		corrections->matrix[i][i] = 1.0f;
+		corrections->precession[i][i] = 1.0f;
+		corrections->nutation[i][i] = 1.0f;
+	}
+
+	return astro_corrections_set_weather(corrections, ASTRO_REFRACTION_TEMPERATURE,
+					     ASTRO_REFRACTION_PRESSURE);
+}
+
+/**
+ * @brief Recompute the terms whose cadence has run out
+ */
+int astro_corrections_update(astro_corrections_t *corrections, int64_t j2000_ms)
+{
+	if (corrections == NULL) {
+		LOG_ERR("astro_corrections_update: Invalid parameters (corrections=%p)",
+			corrections);
+		return -EINVAL;
+	}
+
+	uint32_t due = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(periods_ms); i++) {
+		const int64_t elapsed = j2000_ms - corrections->updated_ms[i];
+
+		if ((corrections->valid & BIT(i)) == 0 || elapsed >= periods_ms[i] ||
+		    -elapsed >= periods_ms[i]) {
+			due |= BIT(i);
+			corrections->updated_ms[i] = j2000_ms;
+		}
+	}
+
+	if (due == 0) {
+		return 0;
+	}
+
+	const float t = (float)j2000_ms / CENTURY_MS;
+	float obliquity;
+
+	if (due & ASTRO_TERM_PRECESSION) {
+		update_precession(corrections, t);
+	}
+
+	/* Aberration needs the obliquity, which comes with nutation */
+	if (due & (ASTRO_TERM_NUTATION | ASTRO_TERM_ABERRATION)) {
+		float nutation[3][3];
+
+		memcpy(nutation, corrections->nutation, sizeof(nutation));
+		update_nutation(corrections, t, &obliquity);
+		if ((due & ASTRO_TERM_NUTATION) == 0) {
+			memcpy(corrections->nutation, nutation, sizeof(nutation));
+		}
+	}
+
+	if (due & ASTRO_TERM_ABERRATION) {
+		update_aberration(corrections, t, obliquity);
+	}
+
+	if (due & (ASTRO_TERM_PRECESSION | ASTRO_TERM_NUTATION)) {
+		multiply(corrections->nutation, corrections->precession, corrections->matrix);
+	}
+
+	corrections->valid |= due;
+	return due;
+}
+
+/**
+ * @brief Rebuild the refraction table for the weather at the site
+ */
+int astro_corrections_set_weather(astro_corrections_t *corrections, int32_t celsius,
+				  uint32_t hpa)
+{
+	if (corrections == NULL || celsius < -60 || celsius > 60 || hpa > 1100) {
+		LOG_ERR("astro_corrections_set_weather: Invalid parameters (corrections=%p, "
+			"celsius=%d, hpa=%u)",
+			corrections, celsius, hpa);
+		return -EINVAL;
+	}
+
+	/* Denser air refracts more */
+	const float scale = (float)hpa / ASTRO_REFRACTION_PRESSURE *
+			    (273.0f + ASTRO_REFRACTION_TEMPERATURE) / (273.0f + celsius);
+
+	for (int i = 0; i < ASTRO_REFRACTION_ENTRIES; i++) {
+		const float h =
+			ASTRO_REFRACTION_MIN_DEGREES + (float)i / ASTRO_REFRACTION_PER_DEGREE;
+		float s;
+		float c;
+
+		/* Arcminutes, offset so the zenith is not refracted */
+		astro_sincos(degrees_angle(h + 10.3f / (h + 5.11f)), &s, &c);
+		const float arcmin = 1.02f * c / s + 0.0019279f;
+		const float tenths = arcmin * 600.0f * scale + 0.5f;
+
+		corrections->refraction[i] = (uint16_t)CLAMP(tenths, 0.0f, (float)UINT16_MAX);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Apparent places of catalog coordinates
+ */
+int astro_apparent_place(const astro_corrections_t *corrections, const astro_equatorial_t *in,
+			 astro_equatorial_t *out, size_t count)
+{
+	if (corrections == NULL || (count > 0 && (in == NULL || out == NULL))) {
+		LOG_ERR("astro_apparent_place: Invalid parameters (corrections=%p, in=%p, out=%p)",
+			corrections, in, out);
+		return -EINVAL;
+	}
+
+	const float(*m)[3] = corrections->matrix;
+	const float *a = corrections->aberration;
+
+	for (size_t i = 0; i < count; i++) {
+		float sin_ra;
+		float cos_ra;
+		float sin_dec;
+		float cos_dec;
+
+		astro_sincos(in[i].ra, &sin_ra, &cos_ra);
+		astro_sincos((uint32_t)in[i].dec, &sin_dec, &cos_dec);
+
+		const float x = cos_dec * cos_ra;
+		const float y = cos_dec * sin_ra;
+		const float z = sin_dec;
+		/* Rotated to the true equator of date, then shifted by aberration */
+		const float u = m[0][0] * x + m[0][1] * y + m[0][2] * z + a[0];
+		const float v = m[1][0] * x + m[1][1] * y + m[1][2] * z + a[1];
+		const float w = m[2][0] * x + m[2][1] * y + m[2][2] * z + a[2];
+
+		out[i].ra = astro_atan2(v, u);
+		out[i].dec = (int32_t)astro_atan2(w, __builtin_sqrtf(u * u + v * v));
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Catalog places of apparent places
+ */
+int astro_mean_place(const astro_corrections_t *corrections, const astro_equatorial_t *in,
+		     astro_equatorial_t *out, size_t count)
+{
+	if (corrections == NULL || (count > 0 && (in == NULL || out == NULL))) {
+		LOG_ERR("astro_mean_place: Invalid parameters (corrections=%p, in=%p, out=%p)",
+			corrections, in, out);
+		return -EINVAL;
+	}
+
+	const float(*m)[3] = corrections->matrix;
+	const float *a = corrections->aberration;
+
+	for (size_t i = 0; i < count; i++) {
+		float sin_ra;
+		float cos_ra;
+		float sin_dec;
+		float cos_dec;
+
+		astro_sincos(in[i].ra, &sin_ra, &cos_ra);
+		astro_sincos((uint32_t)in[i].dec, &sin_dec, &cos_dec);
+
+		/*
+		 * Aberration shifted a unit vector, taking it off the unit vector
+		 * of the result errs by its square, far below an arcsecond
+		 */
+		const float u = cos_dec * cos_ra - a[0];
+		const float v = cos_dec * sin_ra - a[1];
+		const float w = sin_dec - a[2];
+		/* The rotation is orthogonal, its transpose rotates back */
+		const float x = m[0][0] * u + m[1][0] * v + m[2][0] * w;
+		const float y = m[0][1] * u + m[1][1] * v + m[2][1] * w;
+		const float z = m[0][2] * u + m[1][2] * v + m[2][2] * w;
+
+		out[i].ra = astro_atan2(y, x);
+		out[i].dec = (int32_t)astro_atan2(z, __builtin_sqrtf(x * x + y * y));
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Refraction at an altitude
+ */
+int32_t astro_refraction(const astro_corrections_t *corrections, int32_t altitude)
+{
+	const float degrees = (float)altitude * (360.0f / TURN);
+	const float position =
+		(degrees - ASTRO_REFRACTION_MIN_DEGREES) * ASTRO_REFRACTION_PER_DEGREE;
+	const uint16_t *table = corrections->refraction;
+	float tenths;
+
+	if (position <= 0.0f) {
+		tenths = table[0];
+	} else if (position >= ASTRO_REFRACTION_ENTRIES - 1) {
+		tenths = table[ASTRO_REFRACTION_ENTRIES - 1];
+	} else {
+		const int i = (int)position;
+		const float fraction = position - (float)i;
+
+		tenths = table[i] + ((float)table[i + 1] - table[i]) * fraction;
+	}
+
+	return (int32_t)(tenths * ANGLE_PER_TENTH + 0.5f);
+}
+
+/**
+ * @brief Observed places of geometric horizontal coordinates
+ */
+int astro_refract(const astro_corrections_t *corrections, const astro_horizontal_t *in,
+		  astro_horizontal_t *out, size_t count)
+{
+	if (corrections == NULL || (count > 0 && (in == NULL || out == NULL))) {
+		LOG_ERR("astro_refract: Invalid parameters (corrections=%p, in=%p, out=%p)",
+			corrections, in, out);
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const int32_t altitude = in[i].alt;
+		const int32_t refracted = altitude + astro_refraction(corrections, altitude);
+
+		out[i].az = in[i].az;
+		/* Never past the zenith */
+		out[i].alt = MIN(refracted, ASTRO_ANGLE_90);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Geometric horizontal coordinates of observed places
+ */
+int astro_unrefract(const astro_corrections_t *corrections, const astro_horizontal_t *in,
+		    astro_horizontal_t *out, size_t count)
+{
+	if (corrections == NULL || (count > 0 && (in == NULL || out == NULL))) {
+		LOG_ERR("astro_unrefract: Invalid parameters (corrections=%p, in=%p, out=%p)",
+			corrections, in, out);
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		const int32_t observed = in[i].alt;
+		int32_t altitude = observed;
+
+		/* Each read shrinks the error by the slope of refraction, steepest at the horizon */
+		for (int pass = 0; pass < UNREFRACT_PASSES; pass++) {
+			const int32_t next = observed - astro_refraction(corrections, altitude);
+
+			if (next == altitude) {
+				break;
+			}
+			altitude = next;
+		}
+
+		out[i].az = in[i].az;
+		out[i].alt = altitude;
+	}
+
+	return 0;
+}
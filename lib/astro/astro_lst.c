@@ -0,0 +1,253 @@
+/**
+ * @file astro_lst.c
+ * @brief Local sidereal time implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <astro/astro_lst.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(astro, CONFIG_ASTRO_LOG_LEVEL);
+
+/*
+ * Greenwich mean sidereal time of the IAU 1982 model,
+ * 280.46061837 + 360.98564736629 * D + 0.000387933 * T^2 degrees
+ * for D days and T Julian centuries since J2000.0
+ */
+#define GMST_J2000 0xC7704C2651D6EAE6ULL
+/* 360.98564736629 degrees per day as turns per millisecond */
+#define GMST_RATE_MS 0x31D8ABD334ULL
+#define GMST_RATE_MS_FRAC 0x44F8C43DU
+/* 0.000387933 degrees as a turn fraction, divided by the days of a century */
+#define GMST_T2_PER_DAY 544231558ULL
+/* Days in a Julian century */
+#define CENTURY_DAYS 36525
+
+/* Arcseconds in a turn */
+#define TURN_ARCSEC 1296000U
+
+/* Days from 1970-01-01 to 2000-01-01 */
+#define DAYS_TO_2000 10957
+
+/* ============================================================================
+ * INTERNAL HELPERS
+ * ============================================================================ */
+
+/**
+ * @brief Divide num * 2^96 by den, for num < den
+ *
+ * Shift and subtract, so no 128 bit arithmetic is needed. Only run when
+ * anchoring, never on a read.
+ *
+ * @param hi Set to the quotient above the low 32 bits
+ * @param lo Set to the low 32 bits of the quotient
+ */
+static void div_q96(uint64_t num, uint64_t den, uint64_t *hi, uint32_t *lo)
+{
+	uint64_t q_hi = 0;
+	uint32_t q_lo = 0;
+
+	for (int bit = 0; bit < 96; bit++) {
+		const bool carry = (num >> 63) != 0;
+		uint32_t set = 0;
+
+		num <<= 1;
+		if (carry || num >= den) {
+			num -= den;
+			set = 1;
+		}
+
+		q_hi = (q_hi << 1) | (q_lo >> 31);
+		q_lo = (q_lo << 1) | set;
+	}
+
+	*hi = q_hi;
+	*lo = q_lo;
+}
+
+/**
+ * @brief Turns advanced in @p elapsed units at a rate per unit
+ *
+ * Exact modulo a turn for any @p elapsed, the 32 bit fraction of the rate
+ * is split so no product overflows.
+ */
+static uint64_t advance(uint64_t rate, uint32_t rate_frac, uint64_t elapsed)
+{
+	return elapsed * rate + (elapsed >> 32) * rate_frac +
+	       (((elapsed & UINT32_MAX) * rate_frac) >> 32);
+}
+
+/**
+ * @brief Signed version of advance()
+ */
+static uint64_t advance_signed(uint64_t rate, uint32_t rate_frac, int64_t elapsed)
+{
+	if (elapsed < 0) {
+		return -advance(rate, rate_frac, -(uint64_t)elapsed);
+	}
+
+	return advance(rate, rate_frac, elapsed);
+}
+
+/**
+ * @brief Fraction of a turn of @p num parts out of @p den, rounded
+ */
+static uint64_t to_turns(uint64_t num, uint64_t den)
+{
+	uint64_t hi;
+	uint32_t lo;
+
+	div_q96(num, den, &hi, &lo);
+	return hi + (lo >> 31);
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the sidereal time service
+ */
+int astro_lst_init(astro_lst_t *lst, uint32_t frequency)
+{
+	if (lst == NULL || frequency == 0 || frequency > ASTRO_LST_MAX_FREQUENCY) {
+		LOG_ERR("astro_lst_init: Invalid parameters (lst=%p, frequency=%u)", lst,
+			frequency);
+		return -EINVAL;
+	}
+
+	*lst = (astro_lst_t){0};
+
+	/* 10^6 / (sidereal day in us * frequency) turns per tick */
+	div_q96(USEC_PER_SEC, ASTRO_SIDEREAL_DAY_US * frequency, &lst->rate, &lst->rate_frac);
+
+	return 0;
+}
+
+/**
+ * @brief Milliseconds of UTC since J2000.0
+ */
+int64_t astro_lst_j2000_ms(int32_t year, uint32_t month, uint32_t day, uint32_t ms)
+{
+	/* Days since 1970-01-01, counted in 400 year eras starting in March */
+	const int32_t y = year - (month <= 2 ? 1 : 0);
+	const int32_t era = (y >= 0 ? y : y - 399) / 400;
+	const uint32_t yoe = (uint32_t)(y - era * 400);
+	const uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	const int64_t days = (int64_t)era * 146097 + doe - 719468;
+
+	return (days - DAYS_TO_2000) * ASTRO_DAY_MS + ms - ASTRO_DAY_MS / 2;
+}
+
+/**
+ * @brief Anchor sidereal time to UTC
+ */
+int astro_lst_anchor_utc(astro_lst_t *lst, uint64_t tick, int64_t j2000_ms)
+{
+	if (lst == NULL) {
+		LOG_ERR("astro_lst_anchor_utc: Invalid parameters (lst=%p)", lst);
+		return -EINVAL;
+	}
+
+	/* The quadratic term changes by nanoseconds a day, whole days are enough */
+	const uint64_t days = (uint64_t)(j2000_ms < 0 ? -j2000_ms : j2000_ms) / ASTRO_DAY_MS;
+	const uint64_t quadratic = GMST_T2_PER_DAY * days / CENTURY_DAYS * days;
+	const uint64_t gmst = GMST_J2000 + quadratic +
+			      advance_signed(GMST_RATE_MS, GMST_RATE_MS_FRAC, j2000_ms);
+	k_spinlock_key_t key = k_spin_lock(&lst->lock);
+
+	lst->anchor_tick = tick;
+	lst->anchor_gmst = gmst;
+	lst->anchored = true;
+	k_spin_unlock(&lst->lock, key);
+
+	return 0;
+}
+
+/**
+ * @brief Anchor local sidereal time directly
+ */
+int astro_lst_anchor_lst(astro_lst_t *lst, uint64_t tick, uint32_t ms)
+{
+	if (lst == NULL || ms >= ASTRO_DAY_MS) {
+		LOG_ERR("astro_lst_anchor_lst: Invalid parameters (lst=%p, ms=%u)", lst, ms);
+		return -EINVAL;
+	}
+
+	const uint64_t turns = to_turns(ms, ASTRO_DAY_MS);
+	k_spinlock_key_t key = k_spin_lock(&lst->lock);
+
+	lst->anchor_tick = tick;
+	lst->anchor_gmst = turns - lst->longitude;
+	lst->anchored = true;
+	k_spin_unlock(&lst->lock, key);
+
+	return 0;
+}
+
+/**
+ * @brief Set the longitude of the site
+ */
+int astro_lst_set_longitude(astro_lst_t *lst, int32_t arcsec)
+{
+	const int32_t half_turn = TURN_ARCSEC / 2;
+
+	if (lst == NULL || arcsec < -half_turn || arcsec > half_turn) {
+		LOG_ERR("astro_lst_set_longitude: Invalid parameters (lst=%p, arcsec=%d)", lst,
+			arcsec);
+		return -EINVAL;
+	}
+
+	/* West longitudes wrap to the top of the turn */
+	const uint64_t turns = arcsec < 0 ? -to_turns(-arcsec, TURN_ARCSEC)
+					  : to_turns(arcsec, TURN_ARCSEC);
+	k_spinlock_key_t key = k_spin_lock(&lst->lock);
+
+	lst->longitude = turns;
+	k_spin_unlock(&lst->lock, key);
+
+	return 0;
+}
+
+/**
+ * @brief Local sidereal time as a fraction of a turn
+ */
+uint64_t astro_lst_turns(astro_lst_t *lst, uint64_t tick)
+{
+	k_spinlock_key_t key = k_spin_lock(&lst->lock);
+	/* A tick read just before a new anchor gives a small negative elapsed time */
+	const int64_t elapsed = (int64_t)(tick - lst->anchor_tick);
+	const uint64_t turns = lst->anchor_gmst + lst->longitude +
+			       advance_signed(lst->rate, lst->rate_frac, elapsed);
+
+	k_spin_unlock(&lst->lock, key);
+
+	return turns;
+}
+
+/**
+ * @brief Local sidereal time in milliseconds
+ */
+uint32_t astro_lst_ms(astro_lst_t *lst, uint64_t tick)
+{
+	const uint64_t turns = astro_lst_turns(lst, tick);
+	/* turns * ASTRO_DAY_MS / 2^32, in two halves that do not overflow */
+	const uint64_t scaled =
+		(turns >> 32) * ASTRO_DAY_MS + (((turns & UINT32_MAX) * ASTRO_DAY_MS) >> 32);
+	const uint32_t ms = (scaled + BIT64(31)) >> 32;
+
+	return ms < ASTRO_DAY_MS ? ms : 0;
+}
+
+/**
+ * @brief Check if sidereal time was anchored to a time source
+ */
+bool astro_lst_anchored(const astro_lst_t *lst)
+{
+	return lst != NULL && lst->anchored;
+}
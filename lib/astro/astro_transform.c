@@ -0,0 +1,228 @@
+/**
+ * @file astro_transform.c
+ * @brief Equatorial and horizontal coordinate conversion implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <astro/astro_transform.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(astro, CONFIG_ASTRO_LOG_LEVEL);
+
+/* Radians per binary angle unit, 2 pi / 2^32 */
+#define RADIANS_PER_ANGLE 1.46291807926715968e-9f
+/* Binary angle units per radian */
+#define ANGLE_PER_RADIAN 683565275.576431632f
+
+/* ============================================================================
+ * INTERNAL HELPERS
+ * ============================================================================ */
+
+/**
+ * @brief Arc tangent of 0 <= t <= 1 in radians
+ *
+ * Abramowitz and Stegun 4.4.49, absolute error below 2e-8.
+ */
+static float atan_unit(float t)
+{
+	const float t2 = t * t;
+
+	return t * (0.9999993329f +
+		    t2 * (-0.3332985605f +
+			  t2 * (0.1994653599f +
+				t2 * (-0.1390853351f +
+				      t2 * (0.0964200441f +
+					    t2 * (-0.0559098861f +
+						  t2 * (0.0218612288f - t2 * 0.0040540580f)))))));
+}
+
+/**
+ * @brief Square root, without libm
+ *
+ * Compilers lower it to a single instruction on an FPU.
+ */
+static inline float square_root(float x)
+{
+	return __builtin_sqrtf(x);
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Sine and cosine of a binary angle
+ */
+void astro_sincos(uint32_t angle, float *sine, float *cosine)
+{
+	/* Nearest quadrant, the rest is within an eighth of a turn */
+	const uint32_t quadrant = (angle + (1U << 29)) >> 30;
+	const float x = (float)(int32_t)(angle - (quadrant << 30)) * RADIANS_PER_ANGLE;
+	const float x2 = x * x;
+	const float s =
+		x * (1.0f + x2 * (-1.0f / 6 + x2 * (1.0f / 120 +
+						   x2 * (-1.0f / 5040 + x2 * (1.0f / 362880)))));
+	const float c =
+		1.0f + x2 * (-0.5f + x2 * (1.0f / 24 +
+					   x2 * (-1.0f / 720 +
+						 x2 * (1.0f / 40320 - x2 * (1.0f / 3628800)))));
+
+	switch (quadrant & 3) {
+	case 0:
+		*sine = s;
+		*cosine = c;
+		break;
+	case 1:
+		*sine = c;
+		*cosine = -s;
+		break;
+	case 2:
+		*sine = -s;
+		*cosine = -c;
+		break;
+	default:
+		*sine = -c;
+		*cosine = s;
+		break;
+	}
+}
+
+/**
+ * @brief Angle of the vector (x, y) as a binary angle
+ */
+uint32_t astro_atan2(float y, float x)
+{
+	const float ax = x < 0.0f ? -x : x;
+	const float ay = y < 0.0f ? -y : y;
+	uint32_t angle;
+
+	if (ax == 0.0f && ay == 0.0f) {
+		return 0;
+	}
+
+	/* First octant, or its mirror about 45 degrees, mirrored in integers */
+	if (ay <= ax) {
+		angle = (uint32_t)(atan_unit(ay / ax) * ANGLE_PER_RADIAN + 0.5f);
+	} else {
+		angle = (1U << 30) - (uint32_t)(atan_unit(ax / ay) * ANGLE_PER_RADIAN + 0.5f);
+	}
+
+	if (x < 0.0f) {
+		angle = (1U << 31) - angle;
+	}
+
+	return y < 0.0f ? -angle : angle;
+}
+
+/**
+ * @brief Cache the rotation of a site
+ */
+int astro_site_init(astro_site_t *site, int32_t latitude)
+{
+	if (site == NULL || latitude < -ASTRO_TURN_ARCSEC / 4 || latitude > ASTRO_TURN_ARCSEC / 4) {
+		LOG_ERR("astro_site_init: Invalid parameters (site=%p, latitude=%d)", site,
+			latitude);
+		return -EINVAL;
+	}
+
+	float sin_lat;
+	float cos_lat;
+
+	site->latitude = (int32_t)astro_arcsec_to_angle(latitude);
+	astro_sincos((uint32_t)site->latitude, &sin_lat, &cos_lat);
+
+	/*
+	 * Hour angle frame: x to the meridian on the equator, y to 6h west,
+	 * z to the pole. Horizon frame: north, east, up. The rotation is its
+	 * own inverse, so both directions use the same matrix.
+	 */
+	site->matrix[0][0] = -sin_lat;
+	site->matrix[0][1] = 0.0f;
+	site->matrix[0][2] = cos_lat;
+	site->matrix[1][0] = 0.0f;
+	site->matrix[1][1] = -1.0f;
+	site->matrix[1][2] = 0.0f;
+	site->matrix[2][0] = cos_lat;
+	site->matrix[2][1] = 0.0f;
+	site->matrix[2][2] = sin_lat;
+
+	return 0;
+}
+
+/**
+ * @brief Convert equatorial coordinates to horizontal coordinates
+ */
+int astro_to_horizontal(const astro_site_t *site, uint32_t lst, const astro_equatorial_t *in,
+			astro_horizontal_t *out, size_t count)
+{
+	if (site == NULL || (count > 0 && (in == NULL || out == NULL))) {
+		LOG_ERR("astro_to_horizontal: Invalid parameters (site=%p, in=%p, out=%p)", site,
+			in, out);
+		return -EINVAL;
+	}
+
+	const float(*m)[3] = site->matrix;
+
+	for (size_t i = 0; i < count; i++) {
+		float sin_ha;
+		float cos_ha;
+		float sin_dec;
+		float cos_dec;
+
+		astro_sincos(lst - in[i].ra, &sin_ha, &cos_ha);
+		astro_sincos((uint32_t)in[i].dec, &sin_dec, &cos_dec);
+
+		const float x = cos_dec * cos_ha;
+		const float y = cos_dec * sin_ha;
+		const float z = sin_dec;
+		const float north = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+		const float east = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+		const float up = m[2][0] * x + m[2][1] * y + m[2][2] * z;
+
+		out[i].az = astro_atan2(east, north);
+		out[i].alt = (int32_t)astro_atan2(up, square_root(north * north + east * east));
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Convert horizontal coordinates to equatorial coordinates
+ */
+int astro_to_equatorial(const astro_site_t *site, uint32_t lst, const astro_horizontal_t *in,
+			astro_equatorial_t *out, size_t count)
+{
+	if (site == NULL || (count > 0 && (in == NULL || out == NULL))) {
+		LOG_ERR("astro_to_equatorial: Invalid parameters (site=%p, in=%p, out=%p)", site,
+			in, out);
+		return -EINVAL;
+	}
+
+	const float(*m)[3] = site->matrix;
+
+	for (size_t i = 0; i < count; i++) {
+		float sin_az;
+		float cos_az;
+		float sin_alt;
+		float cos_alt;
+
+		astro_sincos(in[i].az, &sin_az, &cos_az);
+		astro_sincos((uint32_t)in[i].alt, &sin_alt, &cos_alt);
+
+		const float north = cos_alt * cos_az;
+		const float east = cos_alt * sin_az;
+		const float up = sin_alt;
+		/* Transpose, which for this rotation is the matrix itself */
+		const float x = m[0][0] * north + m[1][0] * east + m[2][0] * up;
+		const float y = m[0][1] * north + m[1][1] * east + m[2][1] * up;
+		const float z = m[0][2] * north + m[1][2] * east + m[2][2] * up;
+
+		out[i].ra = lst - astro_atan2(y, x);
+		out[i].dec = (int32_t)astro_atan2(z, square_root(x * x + y * y));
+	}
+
+	return 0;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file catalog.c
+ * @brief Object catalog lookups
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <catalog/catalog.h>
+#include <errno.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(catalog, CONFIG_CATALOG_LOG_LEVEL);
+
+/* ============================================================================
+ * CATALOG SELECTION
+ * ============================================================================ */
+
+/**
+ * @brief Get the deep sky catalog of a :LoD# library digit
+ */
+const catalog_t *catalog_deep_sky(int library)
+{
+	switch (library) {
+	case 0:
+		return &catalog_ngc;
+	case 1:
+		return &catalog_ic;
+	default:
+		return NULL;
+	}
+}
+
+/**
+ * @brief Get the star catalog of a :LsD# library digit
+ */
+const catalog_t *catalog_star_library(int library)
+{
+	return library == 0 ? &catalog_star : NULL;
+}
+
+/* ============================================================================
+ * LOOKUP
+ * ============================================================================ */
+
+/**
+ * @brief Get the index of the first record whose number is not below @p number
+ */
+static uint16_t lower_bound(const catalog_t *catalog, uint16_t number)
+{
+	uint16_t low = 0;
+	uint16_t high = catalog->count;
+
+	while (low < high) {
+		uint16_t middle = low + (high - low) / 2;
+
+		if (catalog->records[middle].number < number) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	return low;
+}
+
+/**
+ * @brief Find an object by catalog number
+ */
+const catalog_record_t *catalog_find(const catalog_t *catalog, uint16_t number)
+{
+	if (catalog == NULL) {
+		LOG_ERR("catalog_find: NULL catalog pointer");
+		return NULL;
+	}
+
+	uint16_t index = lower_bound(catalog, number);
+
+	if (index == catalog->count || catalog->records[index].number != number) {
+		return NULL;
+	}
+
+	return &catalog->records[index];
+}
+
+/**
+ * @brief Get the name of an object
+ */
+const char *catalog_name(const catalog_t *catalog, const catalog_record_t *record)
+{
+	if (catalog == NULL || record == NULL || catalog->names == NULL) {
+		return NULL;
+	}
+
+	uint16_t offset = catalog->names[record - catalog->records];
+
+	return offset == CATALOG_NO_NAME ? NULL : &catalog_names[offset];
+}
+
+/**
+ * @brief Get the short name of an object type
+ */
+const char *catalog_type_to_string(catalog_object_type_t type)
+{
+	static const char *const names[] = {
+		[CATALOG_STAR] = "STAR",
+		[CATALOG_DOUBLE_STAR] = "DBL",
+		[CATALOG_GALAXY] = "GAL",
+		[CATALOG_OPEN_CLUSTER] = "OC",
+		[CATALOG_GLOBULAR_CLUSTER] = "GC",
+		[CATALOG_PLANETARY_NEBULA] = "PN",
+		[CATALOG_DIFFUSE_NEBULA] = "DN",
+		[CATALOG_SUPERNOVA_REMNANT] = "SNR",
+		[CATALOG_ASTERISM] = "AST",
+		[CATALOG_OTHER] = "OTHER",
+	};
+
+	BUILD_ASSERT(ARRAY_SIZE(names) == CATALOG_TYPE_COUNT, "every object type needs a name");
+
+	if ((unsigned int)type >= CATALOG_TYPE_COUNT) {
+		return names[CATALOG_OTHER];
+	}
+
+	return names[type];
+}
+
+/* ============================================================================
+ * CURSOR
+ * ============================================================================ */
+
+/**
+ * @brief Clear a cursor
+ */
+void catalog_cursor_init(catalog_cursor_t *cursor)
+{
+	if (cursor == NULL) {
+		LOG_ERR("catalog_cursor_init: NULL cursor pointer");
+		return;
+	}
+
+	cursor->catalog = NULL;
+	cursor->index = 0;
+}
+
+/**
+ * @brief Select an object by catalog number
+ */
+int catalog_select(catalog_cursor_t *cursor, const catalog_t *catalog, uint16_t number)
+{
+	if (cursor == NULL || catalog == NULL) {
+		LOG_ERR("catalog_select: Invalid parameters (cursor=%p, catalog=%p)", cursor,
+			catalog);
+		return -EINVAL;
+	}
+
+	const catalog_record_t *record = catalog_find(catalog, number);
+
+	if (record == NULL) {
+		return -ENOENT;
+	}
+
+	cursor->catalog = catalog;
+	cursor->index = record - catalog->records;
+	return 0;
+}
+
+/**
+ * @brief Get the selected object
+ */
+const catalog_record_t *catalog_current(const catalog_cursor_t *cursor)
+{
+	if (cursor == NULL || cursor->catalog == NULL) {
+		return NULL;
+	}
+
+	return &cursor->catalog->records[cursor->index];
+}
+
+/**
+ * @brief Select the next object
+ */
+const catalog_record_t *catalog_next(catalog_cursor_t *cursor, const catalog_t *catalog)
+{
+	if (cursor == NULL) {
+		LOG_ERR("catalog_next: NULL cursor pointer");
+		return NULL;
+	}
+
+	if (cursor->catalog == NULL) {
+		if (catalog == NULL || catalog->count == 0) {
+			return NULL;
+		}
+		cursor->catalog = catalog;
+		cursor->index = 0;
+	} else {
+		cursor->index = (cursor->index + 1) % cursor->catalog->count;
+	}
+
+	return catalog_current(cursor);
+}
+
+/**
+ * @brief Select the previous object
+ */
+const catalog_record_t *catalog_previous(catalog_cursor_t *cursor, const catalog_t *catalog)
+{
+	if (cursor == NULL) {
+		LOG_ERR("catalog_previous: NULL cursor pointer");
+		return NULL;
+	}
+
+	if (cursor->catalog == NULL) {
+		if (catalog == NULL || catalog->count == 0) {
+			return NULL;
+		}
+		cursor->catalog = catalog;
+		cursor->index = catalog->count - 1;
+	} else {
+		cursor->index = cursor->index == 0 ? cursor->catalog->count - 1 : cursor->index - 1;
+	}
+
+	return catalog_current(cursor);
+}
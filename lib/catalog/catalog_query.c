@@ -0,0 +1,295 @@
+/**
+ * @file catalog_query.c
+ * @brief Cone queries over the catalog spatial index
+ *
+ * Positions stay integer in the records. Only the distance of an object that
+ * survived the cell and limit checks is computed, in single precision, which
+ * is exact to well below an arcsecond for the separations of a field of view.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <catalog/catalog.h>
+#include <errno.h>
+#include <math.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(catalog, CONFIG_CATALOG_LOG_LEVEL);
+
+/** Arcseconds in half a circle, the largest possible distance */
+#define HALF_CIRCLE 648000
+
+/** Arcseconds from the south to the north pole */
+#define DEC_RANGE 648000
+
+/** Radians per arcsecond */
+#define ARCSEC_TO_RAD (3.14159265358979f / HALF_CIRCLE)
+
+/** Radians per right ascension unit (tenth of a second of time) */
+#define RA_TO_RAD (3.14159265358979f / (CATALOG_RA_FULL / 2))
+
+/* ============================================================================
+ * LIMITS
+ * ============================================================================ */
+
+/**
+ * @brief Set limits that let every object pass
+ */
+void catalog_limits_init(catalog_limits_t *limits)
+{
+	if (limits == NULL) {
+		LOG_ERR("catalog_limits_init: NULL limits pointer");
+		return;
+	}
+
+	limits->brighter = INT16_MIN;
+	limits->fainter = INT16_MAX;
+	limits->smallest = 0;
+	limits->largest = UINT16_MAX;
+}
+
+/**
+ * @brief Check an object against query limits
+ */
+bool catalog_limits_pass(const catalog_limits_t *limits, const catalog_record_t *record)
+{
+	const int16_t magnitude = catalog_magnitude(record);
+
+	return magnitude >= limits->brighter && magnitude <= limits->fainter &&
+	       record->size >= limits->smallest && record->size <= limits->largest;
+}
+
+/* ============================================================================
+ * GEOMETRY
+ * ============================================================================ */
+
+/**
+ * @brief Get the angular distance between two positions (haversine formula)
+ */
+uint32_t catalog_distance(uint32_t ra1, int32_t dec1, uint32_t ra2, int32_t dec2)
+{
+	const float d_dec = (float)(dec1 - dec2) * ARCSEC_TO_RAD;
+	const float d_ra = (float)((int32_t)ra1 - (int32_t)ra2) * RA_TO_RAD;
+	const float s_dec = sinf(d_dec / 2);
+	const float s_ra = sinf(d_ra / 2);
+	float h = s_dec * s_dec + cosf(dec1 * ARCSEC_TO_RAD) * cosf(dec2 * ARCSEC_TO_RAD) * s_ra * s_ra;
+
+	h = CLAMP(h, 0.0f, 1.0f);
+	return (uint32_t)lroundf(2 * asinf(sqrtf(h)) / ARCSEC_TO_RAD);
+}
+
+/**
+ * @brief Get the declination zone of the index holding a declination
+ */
+static uint16_t zone_of(const catalog_index_t *index, int32_t dec)
+{
+	int64_t zone = ((int64_t)dec + DEC_RANGE / 2) * index->zones / DEC_RANGE;
+
+	return CLAMP(zone, 0, index->zones - 1);
+}
+
+/* ============================================================================
+ * QUERIES
+ * ============================================================================ */
+
+/**
+ * @brief State of one cone query
+ */
+struct query {
+	const catalog_t *catalog;
+	uint32_t ra;
+	int32_t dec;
+	uint32_t radius;
+	const catalog_limits_t *limits;
+	catalog_visit_t visit;
+	void *user_data;
+	int visited;
+	bool stopped;
+};
+
+/**
+ * @brief Check one object and visit it if it is inside the cone
+ */
+static void test_record(struct query *query, const catalog_record_t *record)
+{
+	if (!catalog_limits_pass(query->limits, record)) {
+		return;
+	}
+
+	uint32_t distance = catalog_distance(query->ra, query->dec, record->ra, record->dec);
+
+	if (distance > query->radius) {
+		return;
+	}
+
+	query->visited++;
+	if (!query->visit(query->catalog, record, distance, query->user_data)) {
+		query->stopped = true;
+	}
+}
+
+/**
+ * @brief Walk the objects of one index cell, brightest first
+ */
+static void walk_cell(struct query *query, uint16_t cell)
+{
+	const catalog_t *catalog = query->catalog;
+	const catalog_index_t *index = catalog->index;
+	const catalog_limits_t *limits = query->limits;
+	const catalog_record_t brightest = {.magnitude = index->cell_brightest[cell]};
+
+	/* Nothing in the cell is bright or large enough */
+	if (catalog_magnitude(&brightest) > limits->fainter ||
+	    index->cell_largest[cell] < limits->smallest) {
+		return;
+	}
+
+	for (uint16_t i = index->cell_entries[cell];
+	     i < index->cell_entries[cell + 1] && !query->stopped; i++) {
+		const catalog_record_t *record = &catalog->records[index->entries[i]];
+
+		/* Every following object is fainter still */
+		if (catalog_magnitude(record) > limits->fainter) {
+			break;
+		}
+
+		test_record(query, record);
+	}
+}
+
+/**
+ * @brief Walk the cells of one declination zone that may overlap the cone
+ *
+ * @param half_width Half the right ascension range of the cone in RA units,
+ *                   CATALOG_RA_FULL or more for the full circle
+ */
+static void walk_zone(struct query *query, uint16_t zone, uint32_t half_width)
+{
+	const catalog_index_t *index = query->catalog->index;
+	const uint16_t first = index->zone_cells[zone];
+	const uint16_t cells = index->zone_cells[zone + 1] - first;
+	uint32_t from = 0;
+	uint32_t count = cells;
+
+	if (half_width < CATALOG_RA_FULL / 2) {
+		/* Shifted by a full circle so the range does not wrap below zero */
+		const uint64_t start = query->ra + CATALOG_RA_FULL - half_width;
+		const uint64_t end = query->ra + CATALOG_RA_FULL + half_width;
+		const uint32_t first_cell = (uint32_t)(start * cells / CATALOG_RA_FULL);
+		const uint32_t last_cell = (uint32_t)(end * cells / CATALOG_RA_FULL);
+
+		from = first_cell % cells;
+		count = MIN(last_cell - first_cell + 1, cells);
+	}
+
+	for (uint32_t i = 0; i < count && !query->stopped; i++) {
+		walk_cell(query, first + (from + i) % cells);
+	}
+}
+
+/**
+ * @brief Visit every object within a cone that passes the limits
+ */
+int catalog_query_cone(const catalog_t *catalog, uint32_t ra, int32_t dec, uint32_t radius,
+		       const catalog_limits_t *limits, catalog_visit_t visit, void *user_data)
+{
+	catalog_limits_t none;
+
+	if (catalog == NULL || visit == NULL || ra >= CATALOG_RA_FULL ||
+	    dec < -DEC_RANGE / 2 || dec > DEC_RANGE / 2) {
+		LOG_ERR("catalog_query_cone: Invalid parameters (catalog=%p, visit=%p)", catalog,
+			visit);
+		return -EINVAL;
+	}
+
+	if (limits == NULL) {
+		catalog_limits_init(&none);
+		limits = &none;
+	}
+
+	struct query query = {
+		.catalog = catalog,
+		.ra = ra,
+		.dec = dec,
+		.radius = MIN(radius, HALF_CIRCLE),
+		.limits = limits,
+		.visit = visit,
+		.user_data = user_data,
+	};
+
+	if (catalog->index == NULL) {
+		for (uint16_t i = 0; i < catalog->count && !query.stopped; i++) {
+			test_record(&query, &catalog->records[i]);
+		}
+		return query.visited;
+	}
+
+	const int32_t south = dec - (int32_t)query.radius;
+	const int32_t north = dec + (int32_t)query.radius;
+	uint32_t half_width = CATALOG_RA_FULL;
+
+	/*
+	 * Unless the cone holds a pole, its right ascension range is the same for
+	 * every declination it covers: sin(half width) = sin(radius) / cos(dec).
+	 * Widened by one unit against rounding.
+	 */
+	if (south > -DEC_RANGE / 2 && north < DEC_RANGE / 2) {
+		const float ratio = sinf(query.radius * ARCSEC_TO_RAD) / cosf(dec * ARCSEC_TO_RAD);
+
+		if (ratio < 1.0f) {
+			half_width = (uint32_t)(asinf(ratio) / RA_TO_RAD) + 1;
+		}
+	}
+
+	for (uint16_t zone = zone_of(catalog->index, south);
+	     zone <= zone_of(catalog->index, north) && !query.stopped; zone++) {
+		walk_zone(&query, zone, half_width);
+	}
+
+	return query.visited;
+}
+
+/**
+ * @brief Closest object seen so far by catalog_nearest()
+ */
+struct nearest {
+	const catalog_record_t *record;
+	uint32_t distance;
+};
+
+static bool keep_nearest(const catalog_t *catalog, const catalog_record_t *record,
+			 uint32_t distance, void *user_data)
+{
+	struct nearest *nearest = user_data;
+
+	ARG_UNUSED(catalog);
+
+	if (nearest->record == NULL || distance < nearest->distance) {
+		nearest->record = record;
+		nearest->distance = distance;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Find the object closest to a position within a cone
+ */
+const catalog_record_t *catalog_nearest(const catalog_t *catalog, uint32_t ra, int32_t dec,
+					uint32_t radius, const catalog_limits_t *limits,
+					uint32_t *distance)
+{
+	struct nearest nearest = {0};
+
+	if (catalog_query_cone(catalog, ra, dec, radius, limits, keep_nearest, &nearest) <= 0) {
+		return NULL;
+	}
+
+	if (distance != NULL) {
+		*distance = nearest.distance;
+	}
+
+	return nearest.record;
+}
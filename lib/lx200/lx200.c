@@ -6,13 +6,23 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
 #include <lx200/lx200.h>
 #include <string.h>
 #include <stdlib.h>
+#include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 
+#include "lx200_command_table.h"
+#include "lx200_log.h"
+
 LOG_MODULE_REGISTER(lx200, CONFIG_LX200_LOG_LEVEL);
 
+/** Parser counters, see lx200_get_stats() */
+static atomic_t stats_commands;
+static atomic_t stats_errors;
+static atomic_t stats_bytes;
+
 /**
  * @brief Initialize LX200 parser state
  */
@@ -74,6 +84,52 @@ const char *lx200_parse_result_to_string(lx200_parse_result_t result)
 	}
 }
 
+/**
+ * @brief Command designator of each family
+ */
+static const char *const family_designators[] = {
+	[LX200_CMD_ALIGNMENT] = "A",
+	[LX200_CMD_RETICLE] = "B",
+	[LX200_CMD_SYNC] = "C",
+	[LX200_CMD_DISTANCE] = "D",
+	[LX200_CMD_FOCUSER] = "F",
+	[LX200_CMD_GET] = "G",
+	[LX200_CMD_GPS] = "g",
+	[LX200_CMD_TIME_FORMAT] = "H",
+	[LX200_CMD_INITIALIZE] = "I",
+	[LX200_CMD_LIBRARY] = "L",
+	[LX200_CMD_MOVE] = "M",
+	[LX200_CMD_PRECISION] = "P",
+	[LX200_CMD_STOP] = "Q",
+	[LX200_CMD_SLEW_RATE] = "R",
+	[LX200_CMD_SET] = "S",
+	[LX200_CMD_TRACKING] = "T",
+	[LX200_CMD_PRECISION_TOGGLE] = "U",
+	[LX200_CMD_BACKLASH] = "$B",
+	[LX200_CMD_FAN] = "f",
+	[LX200_CMD_HOME] = "h",
+	[LX200_CMD_SMART_DRIVE] = "$Q",
+	[LX200_CMD_DEROTATOR] = "r",
+	[LX200_CMD_SITE] = "W",
+	[LX200_CMD_HELP] = "?",
+	[LX200_CMD_VENDOR] = "X",
+};
+
+BUILD_ASSERT(ARRAY_SIZE(family_designators) == LX200_CMD_UNKNOWN,
+	     "family_designators must cover every command family");
+
+/**
+ * @brief Get the command designator of a family
+ */
+const char *lx200_command_family_to_string(lx200_command_family_t family)
+{
+	if ((unsigned int)family >= ARRAY_SIZE(family_designators)) {
+		return "unknown";
+	}
+
+	return family_designators[family];
+}
+
 /**
  * @brief Set precision mode
  */
@@ -100,6 +156,90 @@ lx200_precision_t lx200_get_precision_mode(const lx200_parser_state_t *state)
 	return state->precision_mode;
 }
 
+/* ============================================================================
+ * COMMAND TABLE
+ * ============================================================================ */
+
+/** Human readable parameter format for each grammar */
+static const char *const parameter_formats[] = {
+	[LX200_PARAM_NONE] = "None",
+	[LX200_PARAM_RA] = "HH:MM:SS",
+	[LX200_PARAM_DEC] = "sDD*MM:SS",
+	[LX200_PARAM_ALT] = "sDD*MM:SS",
+	[LX200_PARAM_AZ] = "DDD*MM:SS",
+	[LX200_PARAM_LATITUDE] = "sDD*MM",
+	[LX200_PARAM_LONGITUDE] = "DDD*MM",
+	[LX200_PARAM_TIME] = "HH:MM:SS",
+	[LX200_PARAM_DATE] = "MM/DD/YY",
+	[LX200_PARAM_UTC_OFFSET] = "sHH.H",
+	[LX200_PARAM_MAGNITUDE] = "sMM.M",
+	[LX200_PARAM_TRACKING_RATE] = "TT.T",
+	[LX200_PARAM_DECIMAL] = "DDD.DDD",
+	[LX200_PARAM_NUMBER] = "NNNN",
+	[LX200_PARAM_DIGIT] = "N",
+	[LX200_PARAM_STRING] = "Text",
+};
+
+BUILD_ASSERT(ARRAY_SIZE(parameter_formats) == LX200_PARAM_STRING + 1,
+	     "Every parameter grammar needs a format string");
+
+/**
+ * @brief Find the table entry for a packed command key of the given length
+ */
+static const lx200_command_info_t *command_table_find(uint32_t key, size_t length)
+{
+	uint32_t bucket = (key * LX200_COMMAND_BUCKET_MULTIPLIER) >>
+			  (32 - LX200_COMMAND_BUCKET_BITS);
+	uint32_t slot = ((key ^ lx200_command_displacements[bucket]) *
+			 LX200_COMMAND_SLOT_MULTIPLIER) >>
+			(32 - LX200_COMMAND_TABLE_BITS);
+	const lx200_command_info_t *info = &lx200_command_table[slot];
+
+	/* Unused slots have a length of 0 and never match */
+	if (info->length != length || info->key != key) {
+		return NULL;
+	}
+
+	return info;
+}
+
+/**
+ * @brief Look up a command in the generated command table
+ */
+const lx200_command_info_t *lx200_command_lookup(const char *command, size_t length)
+{
+	if (command == NULL) {
+		return NULL;
+	}
+
+	uint32_t key = 0;
+	size_t key_length = 0;
+
+	while (key_length < length && key_length < LX200_MAX_COMMAND_KEY_LENGTH) {
+		const uint8_t c = (uint8_t)command[key_length];
+
+		if (c == '\0' || c == LX200_COMMAND_TERMINATOR) {
+			break;
+		}
+
+		key |= (uint32_t)c << (8 * key_length);
+		key_length++;
+	}
+
+	/* Longest match first, so "GVP" wins over "G" and "Sd" over "S" */
+	for (; key_length > 0; key_length--) {
+		const lx200_command_info_t *info = command_table_find(key, key_length);
+
+		if (info != NULL) {
+			return info;
+		}
+
+		key &= ~((uint32_t)0xFF << (8 * (key_length - 1)));
+	}
+
+	return NULL;
+}
+
 /**
  * @brief Get command family from command string
  */
@@ -110,69 +250,22 @@ lx200_command_family_t lx200_get_command_family(const char *command)
 		return LX200_CMD_UNKNOWN;
 	}
 
-	lx200_command_family_t family;
-
-	switch (command[0]) {
-	case 'A':
-		family = LX200_CMD_ALIGNMENT;
-		break;
-	case 'B':
-		family = LX200_CMD_RETICLE;
-		break;
-	case 'C':
-		family = LX200_CMD_SYNC;
-		break;
-	case 'D':
-		family = LX200_CMD_DISTANCE;
-		break;
-	case 'F':
-		family = LX200_CMD_FOCUSER;
-		break;
-	case 'G':
-		family = LX200_CMD_GET;
-		break;
-	case 'g':
-		family = LX200_CMD_GPS;
-		break;
-	case 'H':
-		family = LX200_CMD_TIME_FORMAT;
-		break;
-	case 'I':
-		family = LX200_CMD_INITIALIZE;
-		break;
-	case 'L':
-		family = LX200_CMD_LIBRARY;
-		break;
-	case 'M':
-		family = LX200_CMD_MOVE;
-		break;
-	case 'P':
-		family = LX200_CMD_PRECISION;
-		break;
-	case 'Q':
-		family = LX200_CMD_STOP;
-		break;
-	case 'R':
-		family = LX200_CMD_SLEW_RATE;
-		break;
-	case 'S':
-		family = LX200_CMD_SET;
-		break;
-	case 'T':
-		family = LX200_CMD_TRACKING;
-		break;
-	case 'U':
-		family = LX200_CMD_PRECISION_TOGGLE;
-		break;
-	default:
-		family = LX200_CMD_UNKNOWN;
-		LOG_WRN("Unknown command family for command '%s' (first char: '%c')", command,
-			command[0]);
-		break;
+	const lx200_command_info_t *info =
+		lx200_command_lookup(command, LX200_MAX_COMMAND_KEY_LENGTH);
+
+	if (info != NULL) {
+		return (lx200_command_family_t)info->family;
 	}
 
-	if (family != LX200_CMD_UNKNOWN) {
-		LOG_DBG("Command '%s' mapped to family %d", command, family);
+	/* Incomplete or unknown keys still belong to the family of their prefix */
+	const uint8_t first = (uint8_t)command[0];
+	lx200_command_family_t family = first < ARRAY_SIZE(lx200_command_prefixes)
+						? (lx200_command_family_t)lx200_command_prefixes[first]
+						: LX200_CMD_UNKNOWN;
+
+	if (family == LX200_CMD_UNKNOWN) {
+		LX200_TRACE_WRN("Unknown command family for command '%s' (first char: '%c')",
+				command, command[0]);
 	}
 
 	return family;
@@ -187,9 +280,10 @@ bool lx200_command_has_parameter(const char *command)
 		return false;
 	}
 
-	// Commands that typically have parameters start with 'S' (Set commands)
-	// This is a simplified implementation - in practice, you'd need a lookup table
-	return (command[0] == 'S');
+	const lx200_command_info_t *info =
+		lx200_command_lookup(command, LX200_MAX_COMMAND_KEY_LENGTH);
+
+	return info != NULL && info->grammar != LX200_PARAM_NONE;
 }
 
 /**
@@ -201,26 +295,15 @@ const char *lx200_get_parameter_format(const char *command)
 		return "None";
 	}
 
-	// This is a simplified implementation
-	// In practice, you'd need a comprehensive lookup table
-	switch (command[0]) {
-	case 'S':
-		if (command[1] == 'r') {
-			return "HH:MM:SS";
-		}
-		if (command[1] == 'd') {
-			return "sDD*MM:SS";
-		}
-		if (command[1] == 'L') {
-			return "HH:MM:SS";
-		}
-		if (command[1] == 'C') {
-			return "MM/DD/YY";
-		}
-		return "Various";
-	default:
-		return "None";
+	const lx200_command_info_t *info =
+		lx200_command_lookup(command, LX200_MAX_COMMAND_KEY_LENGTH);
+
+	if (info != NULL) {
+		return parameter_formats[info->grammar];
 	}
+
+	/* A bare family prefix: only the set family always takes a parameter */
+	return lx200_get_command_family(command) == LX200_CMD_SET ? "Various" : "None";
 }
 
 /**
@@ -235,32 +318,35 @@ lx200_parse_result_t lx200_parser_add_data(lx200_parser_state_t *state, const ch
 		return LX200_PARSE_ERROR;
 	}
 
-	LOG_DBG("Adding %zu bytes to parser buffer (current length: %zu)", length,
-		state->buffer_length);
+	LX200_TRACE_DBG("Adding %zu bytes to parser buffer (current length: %zu)", length,
+			state->buffer_length);
 
 	// Check for buffer overflow
 	if (state->buffer_length + length >= LX200_MAX_COMMAND_LENGTH) {
-		LOG_ERR("Buffer overflow: current=%zu, adding=%zu, max=%d", state->buffer_length,
-			length, LX200_MAX_COMMAND_LENGTH);
+		atomic_inc(&stats_errors);
+		LX200_ERR_RATELIMIT("Buffer overflow: current=%zu, adding=%zu, max=%d",
+				    state->buffer_length, length, LX200_MAX_COMMAND_LENGTH);
 		return LX200_PARSE_BUFFER_OVERFLOW;
 	}
 
+	atomic_add(&stats_bytes, (atomic_val_t)length);
+
 	// Copy data to buffer
 	memcpy(&state->buffer[state->buffer_length], data, length);
 	state->buffer_length += length;
 	state->buffer[state->buffer_length] = '\0';
 
-	LOG_HEXDUMP_DBG(data, length, "Received data:");
+	LX200_TRACE_HEXDUMP_DBG(data, length, "Received data:");
 
 	// Check if command is complete (ends with #)
 	if (state->buffer_length > 0 &&
 	    state->buffer[state->buffer_length - 1] == LX200_COMMAND_TERMINATOR) {
 		state->command_complete = true;
-		LOG_DBG("Command complete: '%s'", state->buffer);
+		LX200_TRACE_DBG("Command complete: '%s'", state->buffer);
 		return LX200_PARSE_OK;
 	}
 
-	LOG_DBG("Command incomplete, buffer: '%s'", state->buffer);
+	LX200_TRACE_DBG("Command incomplete, buffer: '%s'", state->buffer);
 	return LX200_PARSE_INCOMPLETE;
 }
 
@@ -277,211 +363,622 @@ lx200_parse_result_t lx200_parse_command(const lx200_parser_state_t *state,
 	}
 
 	if (!state->command_complete) {
-		LOG_DBG("Command not complete yet, current buffer: '%s'", state->buffer);
+		LX200_TRACE_DBG("Command not complete yet, current buffer: '%s'", state->buffer);
 		return LX200_PARSE_INCOMPLETE;
 	}
 
-	LOG_DBG("Parsing complete command: '%s'", state->buffer);
+	LX200_TRACE_DBG("Parsing complete command: '%s'", state->buffer);
 	return lx200_parse_command_string(state->buffer, command);
 }
 
 /**
- * @brief Parse LX200 command from string
+ * @brief Split a frame into key and parameter without copying
  */
-lx200_parse_result_t lx200_parse_command_string(const char *cmd_string, lx200_command_t *command)
+static lx200_parse_result_t parse_frame(const char *frame, size_t length,
+					lx200_command_view_t *view)
 {
-	if (cmd_string == NULL || command == NULL) {
-		LOG_ERR("lx200_parse_command_string: Invalid parameters (cmd_string=%p, "
-			"command=%p)",
-			cmd_string, command);
-		return LX200_PARSE_ERROR;
-	}
-
-	size_t len = strlen(cmd_string);
-	LOG_DBG("Parsing command string: '%s' (length: %zu)", cmd_string, len);
+	LX200_TRACE_DBG("Parsing frame: '%.*s' (length: %zu)", (int)length, frame, length);
 
-	if (len < 2) {
-		LOG_ERR("Command too short: %zu bytes", len);
+	if (length < 2) {
+		LX200_ERR_RATELIMIT("Command too short: %zu bytes", length);
 		return LX200_PARSE_INVALID_COMMAND;
 	}
 
 	// Check for valid prefix
-	if (cmd_string[0] != LX200_COMMAND_PREFIX) {
-		LOG_ERR("Invalid command prefix: expected '%c', got '%c'", LX200_COMMAND_PREFIX,
-			cmd_string[0]);
+	if (frame[0] != LX200_COMMAND_PREFIX) {
+		LX200_ERR_RATELIMIT("Invalid command prefix: expected '%c', got '%c'",
+				    LX200_COMMAND_PREFIX, frame[0]);
 		return LX200_PARSE_INVALID_PREFIX;
 	}
 
 	// Check for valid terminator
-	if (cmd_string[len - 1] != LX200_COMMAND_TERMINATOR) {
-		LOG_ERR("Invalid command terminator: expected '%c', got '%c'",
-			LX200_COMMAND_TERMINATOR, cmd_string[len - 1]);
+	if (frame[length - 1] != LX200_COMMAND_TERMINATOR) {
+		LX200_ERR_RATELIMIT("Invalid command terminator: expected '%c', got '%c'",
+				    LX200_COMMAND_TERMINATOR, frame[length - 1]);
 		return LX200_PARSE_INVALID_TERMINATOR;
 	}
 
-	// Extract command (skip prefix, stop at terminator or parameter start)
-	size_t cmd_len = 0;
-	for (size_t i = 1; i < len - 1 && cmd_len < 3; i++) {
-		char c = cmd_string[i];
-		// Include alphabetic characters
-		if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
-			command->command[cmd_len++] = c;
-		} else if (cmd_len > 0) {
-			// Check if this might be a symbol that's part of the command
-			// Only for specific command families that use symbol suffixes
-			char first_char = command->command[0];
-			if ((first_char == 'B' || first_char == 'F' || first_char == 'T') && 
-			    (c == '+' || c == '-')) {
-				// These commands use +/- as part of the command
-				command->command[cmd_len++] = c;
-			} else if (first_char == 'R' && (c >= '0' && c <= '9')) {
-				// Rate commands can have numbers
-				command->command[cmd_len++] = c;
-			} else {
-				// Stop here - this starts the parameter
-				break;
-			}
-		} else {
-			// Stop at first character that's not part of a command
-			break;
-		}
+	if (length > UINT8_MAX) {
+		LX200_ERR_RATELIMIT("Command too long: %zu bytes", length);
+		return LX200_PARSE_BUFFER_OVERFLOW;
 	}
-	command->command[cmd_len] = '\0';
 
-	LOG_DBG("Extracted command: '%s'", command->command);
+	// Extract command key, the table knows where the parameter starts
+	const lx200_command_info_t *info = lx200_command_lookup(&frame[1], length - 2);
+
+	if (info == NULL) {
+		LX200_ERR_RATELIMIT("Unknown command: '%.*s'", (int)length, frame);
+		return LX200_PARSE_INVALID_COMMAND;
+	}
 
-	// Get command family
-	command->family = lx200_get_command_family(command->command);
-	LOG_DBG("Command family: %d", command->family);
+	const size_t param_start = 1 + info->length;
+	const size_t param_length = length - 1 - param_start;
 
-	// Extract parameter if present
-	size_t param_start = 1 + cmd_len;
-	if (param_start < len - 1) {
-		command->has_parameter = true;
-		command->parameter_length = len - 1 - param_start;
-		if (command->parameter_length < LX200_MAX_COMMAND_LENGTH) {
-			memcpy(command->parameter, &cmd_string[param_start],
-			       command->parameter_length);
-			command->parameter[command->parameter_length] = '\0';
-			LOG_DBG("Extracted parameter: '%s' (length: %zu)", command->parameter,
-				command->parameter_length);
-		} else {
-			LOG_ERR("Parameter too long: %zu bytes", command->parameter_length);
+	if (info->grammar == LX200_PARAM_NONE && param_length > 0) {
+		LX200_ERR_RATELIMIT("Command '%.*s' does not take a parameter", info->length,
+				    &frame[1]);
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	view->family = info->family;
+	view->id = info->id;
+	view->offset = (uint8_t)param_start;
+	view->length = (uint8_t)param_length;
+
+	LX200_TRACE_DBG("Extracted command: '%.*s' (family: %d, id: %d)", info->length, &frame[1],
+			view->family, view->id);
+
+	return LX200_PARSE_OK;
+}
+
+/**
+ * @brief Parse a frame into a command view
+ */
+lx200_parse_result_t lx200_parse_frame(const char *frame, size_t length,
+				       lx200_command_view_t *view)
+{
+	if (frame == NULL || view == NULL) {
+		LOG_ERR("lx200_parse_frame: Invalid parameters (frame=%p, view=%p)", frame, view);
+		return LX200_PARSE_ERROR;
+	}
+
+	lx200_parse_result_t result = parse_frame(frame, length, view);
+
+	atomic_inc(result == LX200_PARSE_OK ? &stats_commands : &stats_errors);
+
+	return result;
+}
+
+/**
+ * @brief Split a command string into key and parameter
+ */
+static lx200_parse_result_t parse_command_string(const char *cmd_string, lx200_command_t *command)
+{
+	lx200_command_view_t view;
+	size_t len = strlen(cmd_string);
+	lx200_parse_result_t result = parse_frame(cmd_string, len, &view);
+
+	if (result != LX200_PARSE_OK) {
+		return result;
+	}
+
+	size_t cmd_len = view.offset - 1;
+	memcpy(command->command, &cmd_string[1], cmd_len);
+	command->command[cmd_len] = '\0';
+	command->family = (lx200_command_family_t)view.family;
+	command->id = (lx200_command_id_t)view.id;
+
+	// Copy parameter if present
+	if (view.length > 0) {
+		if (view.length >= LX200_MAX_COMMAND_LENGTH) {
+			LX200_ERR_RATELIMIT("Parameter too long: %u bytes", view.length);
 			return LX200_PARSE_BUFFER_OVERFLOW;
 		}
+
+		command->has_parameter = true;
+		command->parameter_length = view.length;
+		memcpy(command->parameter, &cmd_string[view.offset], view.length);
+		command->parameter[view.length] = '\0';
 	} else {
 		command->has_parameter = false;
 		command->parameter_length = 0;
 		command->parameter[0] = '\0';
-		LOG_DBG("No parameter present");
 	}
 
-	LOG_INF("Successfully parsed LX200 command: '%s'%s%s", command->command,
-		command->has_parameter ? " with parameter: '" : "",
-		command->has_parameter ? command->parameter : "");
+	LX200_TRACE_INF("Successfully parsed LX200 command: '%s'%s%s", command->command,
+			command->has_parameter ? " with parameter: '" : "",
+			command->has_parameter ? command->parameter : "");
 
 	return LX200_PARSE_OK;
 }
 
-// Placeholder implementations for the remaining functions
-// These would need to be fully implemented based on the LX200 protocol specification
+/**
+ * @brief Parse LX200 command from string
+ */
+lx200_parse_result_t lx200_parse_command_string(const char *cmd_string, lx200_command_t *command)
+{
+	if (cmd_string == NULL || command == NULL) {
+		LOG_ERR("lx200_parse_command_string: Invalid parameters (cmd_string=%p, "
+			"command=%p)",
+			cmd_string, command);
+		return LX200_PARSE_ERROR;
+	}
+
+	lx200_parse_result_t result = parse_command_string(cmd_string, command);
+
+	atomic_inc(result == LX200_PARSE_OK ? &stats_commands : &stats_errors);
+
+	return result;
+}
+
+/**
+ * @brief Get the parser counters
+ */
+void lx200_get_stats(lx200_stats_t *stats)
+{
+	if (stats == NULL) {
+		LOG_ERR("lx200_get_stats: NULL stats pointer");
+		return;
+	}
+
+	stats->commands = (uint32_t)atomic_get(&stats_commands);
+	stats->errors = (uint32_t)atomic_get(&stats_errors);
+	stats->bytes = (uint32_t)atomic_get(&stats_bytes);
+}
+
+/**
+ * @brief Reset the parser counters
+ */
+void lx200_reset_stats(void)
+{
+	atomic_clear(&stats_commands);
+	atomic_clear(&stats_errors);
+	atomic_clear(&stats_bytes);
+}
+
+/* ============================================================================
+ * COORDINATE PARSING
+ * ============================================================================ */
+
+/** Degree sign of the Meade character set, sent by some hand controllers */
+#define LX200_DEGREE_SIGN ((char)0xDF)
+
+/**
+ * @brief Description of a sexagesimal coordinate format
+ */
+struct coordinate_format {
+	/** Maximum number of digits of the leading field */
+	uint8_t digits;
+	/** Largest magnitude of the leading field */
+	uint16_t limit;
+	/** True if the limit itself is a valid value (90 degrees vs. 24 hours) */
+	bool limit_inclusive;
+	/** True if a leading '+' or '-' is accepted */
+	bool is_signed;
+	/** True for HH:MM.T / HH:MM:SS, false for DD*MM / DD*MM:SS */
+	bool is_time;
+};
+
+static const struct coordinate_format ra_format = {2, 24, false, false, true};
+static const struct coordinate_format dec_format = {2, 90, true, true, false};
+static const struct coordinate_format az_format = {3, 360, false, false, false};
+static const struct coordinate_format longitude_format = {3, 360, true, true, false};
+
+/**
+ * @brief Scan an unsigned decimal field of 1 to @p max_digits digits
+ */
+static bool scan_field(const char **cursor, uint8_t max_digits, uint16_t *value)
+{
+	const char *p = *cursor;
+	uint16_t result = 0;
+	uint8_t digits = 0;
+
+	while (digits < max_digits && *p >= '0' && *p <= '9') {
+		result = result * 10 + (uint16_t)(*p - '0');
+		p++;
+		digits++;
+	}
+
+	if (digits == 0) {
+		return false;
+	}
+
+	*cursor = p;
+	*value = result;
+	return true;
+}
+
+/**
+ * @brief Parse a coordinate in a single pass without floating point
+ *
+ * Accepts the NUL or '#' terminated low and high precision forms described by
+ * @p format. @p coord is only written on success.
+ */
+static lx200_parse_result_t parse_coordinate(const char *str,
+					     const struct coordinate_format *format,
+					     lx200_coordinate_t *coord)
+{
+	const char *p = str;
+	bool negative = false;
+	uint16_t major;
+	uint16_t minutes;
+	uint16_t seconds = 0;
+	uint16_t tenths = 0;
+	lx200_precision_t precision = LX200_COORD_LOW_PRECISION;
+
+	/* Some clients put a space between command and parameter */
+	while (*p == ' ') {
+		p++;
+	}
+
+	if (format->is_signed && (*p == '+' || *p == '-')) {
+		negative = (*p == '-');
+		p++;
+	}
+
+	if (!scan_field(&p, format->digits, &major)) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	if (format->is_time ? (*p != ':')
+			    : (*p != '*' && *p != ':' && *p != LX200_DEGREE_SIGN)) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+	p++;
 
+	if (!scan_field(&p, 2, &minutes)) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	if (*p == ':' || *p == '\'') {
+		p++;
+		if (!scan_field(&p, 2, &seconds)) {
+			return LX200_PARSE_INVALID_PARAMETER;
+		}
+		precision = LX200_COORD_HIGH_PRECISION;
+	} else if (format->is_time && *p == '.') {
+		p++;
+		if (!scan_field(&p, 1, &tenths)) {
+			return LX200_PARSE_INVALID_PARAMETER;
+		}
+	}
+
+	if (*p != '\0' && *p != LX200_COMMAND_TERMINATOR) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	if (minutes > 59 || seconds > 59) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	/* Range check in seconds of the leading unit, a tenth of a minute is 6 */
+	const uint32_t total = (uint32_t)major * 3600U + minutes * 60U + seconds + tenths * 6U;
+	const uint32_t limit = (uint32_t)format->limit * 3600U;
+
+	if (total > limit || (total == limit && !format->limit_inclusive)) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	coord->degrees = (int16_t)major;
+	coord->minutes = (uint8_t)minutes;
+	coord->seconds = (uint8_t)seconds;
+	coord->tenths = (uint8_t)tenths;
+	coord->is_negative = negative;
+	coord->precision = precision;
+
+	return LX200_PARSE_OK;
+}
+
+/**
+ * @brief Parse right ascension coordinate
+ */
 lx200_parse_result_t lx200_parse_ra_coordinate(const char *str, lx200_coordinate_t *coord)
 {
-	LOG_WRN("lx200_parse_ra_coordinate: Function not implemented yet (str='%s')",
-		str ? str : "NULL");
-	// TODO: Implement RA coordinate parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(coord);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || coord == NULL) {
+		LOG_ERR("lx200_parse_ra_coordinate: Invalid parameters (str=%p, coord=%p)", str,
+			coord);
+		return LX200_PARSE_ERROR;
+	}
+
+	return parse_coordinate(str, &ra_format, coord);
 }
 
+/**
+ * @brief Parse declination coordinate
+ */
 lx200_parse_result_t lx200_parse_dec_coordinate(const char *str, lx200_coordinate_t *coord)
 {
-	LOG_WRN("lx200_parse_dec_coordinate: Function not implemented yet (str='%s')",
-		str ? str : "NULL");
-	// TODO: Implement Dec coordinate parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(coord);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || coord == NULL) {
+		LOG_ERR("lx200_parse_dec_coordinate: Invalid parameters (str=%p, coord=%p)", str,
+			coord);
+		return LX200_PARSE_ERROR;
+	}
+
+	return parse_coordinate(str, &dec_format, coord);
 }
 
+/**
+ * @brief Parse altitude coordinate
+ */
 lx200_parse_result_t lx200_parse_alt_coordinate(const char *str, lx200_coordinate_t *coord)
 {
-	LOG_WRN("lx200_parse_alt_coordinate: Function not implemented yet (str='%s')",
-		str ? str : "NULL");
-	// TODO: Implement Alt coordinate parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(coord);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || coord == NULL) {
+		LOG_ERR("lx200_parse_alt_coordinate: Invalid parameters (str=%p, coord=%p)", str,
+			coord);
+		return LX200_PARSE_ERROR;
+	}
+
+	return parse_coordinate(str, &dec_format, coord);
 }
 
+/**
+ * @brief Parse azimuth coordinate
+ */
 lx200_parse_result_t lx200_parse_az_coordinate(const char *str, lx200_coordinate_t *coord)
 {
-	LOG_WRN("lx200_parse_az_coordinate: Function not implemented yet (str='%s')",
-		str ? str : "NULL");
-	// TODO: Implement Az coordinate parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(coord);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || coord == NULL) {
+		LOG_ERR("lx200_parse_az_coordinate: Invalid parameters (str=%p, coord=%p)", str,
+			coord);
+		return LX200_PARSE_ERROR;
+	}
+
+	return parse_coordinate(str, &az_format, coord);
 }
 
+/**
+ * @brief Parse longitude coordinate
+ */
 lx200_parse_result_t lx200_parse_longitude(const char *str, lx200_coordinate_t *coord)
 {
-	LOG_WRN("lx200_parse_longitude: Function not implemented yet (str='%s')",
-		str ? str : "NULL");
-	// TODO: Implement longitude parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(coord);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || coord == NULL) {
+		LOG_ERR("lx200_parse_longitude: Invalid parameters (str=%p, coord=%p)", str,
+			coord);
+		return LX200_PARSE_ERROR;
+	}
+
+	return parse_coordinate(str, &longitude_format, coord);
 }
 
+/**
+ * @brief Parse latitude coordinate
+ */
 lx200_parse_result_t lx200_parse_latitude(const char *str, lx200_coordinate_t *coord)
 {
-	LOG_WRN("lx200_parse_latitude: Function not implemented yet (str='%s')",
-		str ? str : "NULL");
-	// TODO: Implement latitude parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(coord);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || coord == NULL) {
+		LOG_ERR("lx200_parse_latitude: Invalid parameters (str=%p, coord=%p)", str, coord);
+		return LX200_PARSE_ERROR;
+	}
+
+	return parse_coordinate(str, &dec_format, coord);
+}
+
+/**
+ * @brief Convert a coordinate to signed arcseconds
+ */
+int32_t lx200_coordinate_to_arcsec(const lx200_coordinate_t *coord)
+{
+	if (coord == NULL) {
+		LOG_ERR("lx200_coordinate_to_arcsec: NULL coordinate pointer");
+		return 0;
+	}
+
+	const int32_t arcsec = coord->degrees * 3600 + coord->minutes * 60 + coord->seconds +
+			       coord->tenths * 6;
+
+	return coord->is_negative ? -arcsec : arcsec;
+}
+
+/**
+ * @brief Convert a right ascension to arcseconds
+ */
+int32_t lx200_ra_to_arcsec(const lx200_coordinate_t *coord)
+{
+	/* One second of time is 15 arcseconds, so this stays exact */
+	return 15 * lx200_coordinate_to_arcsec(coord);
+}
+
+/**
+ * @brief Split signed arcseconds into a coordinate
+ */
+int lx200_coordinate_from_arcsec(int32_t arcsec, lx200_precision_t precision,
+				 lx200_coordinate_t *coord)
+{
+	const uint32_t magnitude = arcsec < 0 ? 0U - (uint32_t)arcsec : (uint32_t)arcsec;
+
+	if (coord == NULL || magnitude / 3600 > INT16_MAX) {
+		LOG_ERR("lx200_coordinate_from_arcsec: Invalid parameters (arcsec=%d, coord=%p)",
+			arcsec, coord);
+		return -EINVAL;
+	}
+
+	coord->degrees = (int16_t)(magnitude / 3600);
+	coord->minutes = (uint8_t)(magnitude / 60 % 60);
+	coord->is_negative = arcsec < 0;
+	coord->precision = precision;
+
+	/* Truncated like the display, so the components add up to at most the value */
+	if (precision == LX200_COORD_LOW_PRECISION) {
+		coord->seconds = 0;
+		coord->tenths = (uint8_t)(magnitude % 60 / 6);
+	} else {
+		coord->seconds = (uint8_t)(magnitude % 60);
+		coord->tenths = 0;
+	}
+
+	return 0;
 }
 
+/**
+ * @brief Parse three fields of up to two digits separated by @p separator
+ *
+ * Shared by HH:MM:SS and MM/DD/YY, NUL or '#' terminated.
+ */
+static bool parse_triplet(const char *str, char separator, uint16_t fields[3])
+{
+	const char *p = str;
+
+	while (*p == ' ') {
+		p++;
+	}
+
+	for (int i = 0; i < 3; i++) {
+		if (i > 0 && *p++ != separator) {
+			return false;
+		}
+		if (!scan_field(&p, 2, &fields[i])) {
+			return false;
+		}
+	}
+
+	return *p == '\0' || *p == LX200_COMMAND_TERMINATOR;
+}
+
+/**
+ * @brief Parse a 24 hour time, HH:MM:SS of :SL# and :SS#
+ */
 lx200_parse_result_t lx200_parse_time(const char *str, lx200_time_t *time)
 {
-	LOG_WRN("lx200_parse_time: Function not implemented yet (str='%s')", str ? str : "NULL");
-	// TODO: Implement time parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(time);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || time == NULL) {
+		LOG_ERR("lx200_parse_time: Invalid parameters (str=%p, time=%p)", str, time);
+		return LX200_PARSE_ERROR;
+	}
+
+	uint16_t fields[3];
+
+	if (!parse_triplet(str, ':', fields) || fields[0] > 23 || fields[1] > 59 ||
+	    fields[2] > 59) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	time->hours = (uint8_t)fields[0];
+	time->minutes = (uint8_t)fields[1];
+	time->seconds = (uint8_t)fields[2];
+	time->is_24h_format = true;
+
+	return LX200_PARSE_OK;
 }
 
+/**
+ * @brief Parse a date, MM/DD/YY of :SC#
+ */
 lx200_parse_result_t lx200_parse_date(const char *str, lx200_date_t *date)
 {
-	LOG_WRN("lx200_parse_date: Function not implemented yet (str='%s')", str ? str : "NULL");
-	// TODO: Implement date parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(date);
-	return LX200_PARSE_ERROR;
+	static const uint8_t month_days[] = {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+	if (str == NULL || date == NULL) {
+		LOG_ERR("lx200_parse_date: Invalid parameters (str=%p, date=%p)", str, date);
+		return LX200_PARSE_ERROR;
+	}
+
+	uint16_t fields[3];
+
+	if (!parse_triplet(str, '/', fields) || fields[0] < 1 || fields[0] > 12 ||
+	    fields[1] < 1 || fields[1] > month_days[fields[0] - 1]) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	/* 29 February only in leap years, every fourth year of 2000-2099 */
+	if (fields[0] == 2 && fields[1] == 29 && fields[2] % 4 != 0) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	date->month = (uint8_t)fields[0];
+	date->day = (uint8_t)fields[1];
+	date->year = (uint8_t)fields[2];
+
+	return LX200_PARSE_OK;
 }
 
+/**
+ * @brief Parse a UTC offset, sHH or sHH.H of :SG#
+ *
+ * The hours added to local time to give UTC, so west of Greenwich is
+ * positive. The sign is optional.
+ */
 lx200_parse_result_t lx200_parse_utc_offset(const char *str, float *offset)
 {
-	LOG_WRN("lx200_parse_utc_offset: Function not implemented yet (str='%s')",
-		str ? str : "NULL");
-	// TODO: Implement UTC offset parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(offset);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || offset == NULL) {
+		LOG_ERR("lx200_parse_utc_offset: Invalid parameters (str=%p, offset=%p)", str,
+			offset);
+		return LX200_PARSE_ERROR;
+	}
+
+	const char *p = str;
+	bool negative = false;
+	uint16_t hours;
+	uint16_t tenths = 0;
+
+	while (*p == ' ') {
+		p++;
+	}
+
+	if (*p == '+' || *p == '-') {
+		negative = (*p == '-');
+		p++;
+	}
+
+	if (!scan_field(&p, 2, &hours)) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	if (*p == '.') {
+		p++;
+		if (!scan_field(&p, 1, &tenths)) {
+			return LX200_PARSE_INVALID_PARAMETER;
+		}
+	}
+
+	if ((*p != '\0' && *p != LX200_COMMAND_TERMINATOR) || hours * 10 + tenths > 140) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	*offset = (negative ? -1.0f : 1.0f) * ((float)hours + (float)tenths / 10.0f);
+
+	return LX200_PARSE_OK;
 }
 
+/**
+ * @brief Parse a tracking rate, TT.T of :ST# or DDD.DDD of :T#, in Hz
+ */
 lx200_parse_result_t lx200_parse_tracking_rate(const char *str, float *rate)
 {
-	LOG_WRN("lx200_parse_tracking_rate: Function not implemented yet (str='%s')",
-		str ? str : "NULL");
-	// TODO: Implement tracking rate parsing
-	ARG_UNUSED(str);
-	ARG_UNUSED(rate);
-	return LX200_PARSE_ERROR;
+	if (str == NULL || rate == NULL) {
+		LOG_ERR("lx200_parse_tracking_rate: Invalid parameters (str=%p, rate=%p)", str,
+			rate);
+		return LX200_PARSE_ERROR;
+	}
+
+	const char *p = str;
+	uint16_t whole;
+	uint16_t fraction = 0;
+	uint32_t scale = 1;
+
+	while (*p == ' ') {
+		p++;
+	}
+
+	if (!scan_field(&p, 3, &whole)) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	if (*p == '.') {
+		const char *digits = ++p;
+
+		if (!scan_field(&p, 3, &fraction)) {
+			return LX200_PARSE_INVALID_PARAMETER;
+		}
+		for (; digits < p; digits++) {
+			scale *= 10;
+		}
+	}
+
+	if (*p != '\0' && *p != LX200_COMMAND_TERMINATOR) {
+		return LX200_PARSE_INVALID_PARAMETER;
+	}
+
+	*rate = (float)whole + (float)fraction / (float)scale;
+
+	return LX200_PARSE_OK;
 }
 
 lx200_parse_result_t lx200_parse_slew_rate(const char *str, lx200_slew_rate_t *rate)
@@ -494,24 +991,110 @@ lx200_parse_result_t lx200_parse_slew_rate(const char *str, lx200_slew_rate_t *r
 	return LX200_PARSE_ERROR;
 }
 
+/**
+ * @brief Write @p value as exactly @p width decimal digits
+ * @return Pointer past the last digit
+ */
+static char *put_digits(char *p, uint32_t value, int width)
+{
+	for (int i = width - 1; i >= 0; i--) {
+		p[i] = (char)('0' + value % 10);
+		value /= 10;
+	}
+
+	return p + width;
+}
+
+/**
+ * @brief Format a coordinate reply without going through printf
+ *
+ * @param sign Print '+' or '-' in front
+ * @param width Digits of the first component
+ * @param separator Separator after the first component, ':' or '*'
+ * @return Length of the reply, -EINVAL on invalid components, -ENOSPC if it does not fit
+ */
+static int format_coordinate(const lx200_coordinate_t *coord, char *str, size_t str_size,
+			     bool sign, int width, char separator)
+{
+	const bool low = coord->precision == LX200_COORD_LOW_PRECISION;
+	/* Low precision right ascension shows tenths of a minute, angles only minutes */
+	const bool tenths = low && separator == ':';
+	const size_t length = (sign ? 1 : 0) + width + 3 + (tenths ? 2 : 0) + (low ? 0 : 3) + 1;
+	const uint32_t limit = width == 3 ? 1000 : 100;
+
+	if (coord->degrees < 0 || (uint32_t)coord->degrees >= limit || coord->minutes >= 60 ||
+	    coord->seconds >= 60 || coord->tenths >= 10) {
+		return -EINVAL;
+	}
+
+	if (length >= str_size) {
+		return -ENOSPC;
+	}
+
+	char *p = str;
+
+	if (sign) {
+		*p++ = coord->is_negative ? '-' : '+';
+	}
+
+	p = put_digits(p, coord->degrees, width);
+	*p++ = separator;
+	p = put_digits(p, coord->minutes, 2);
+
+	if (tenths) {
+		*p++ = '.';
+		p = put_digits(p, coord->tenths, 1);
+	} else if (!low) {
+		*p++ = ':';
+		p = put_digits(p, coord->seconds, 2);
+	}
+
+	*p++ = LX200_COMMAND_TERMINATOR;
+	*p = '\0';
+
+	return (int)(p - str);
+}
+
+/**
+ * @brief Format a right ascension reply, HH:MM:SS# or HH:MM.T#
+ */
 int lx200_format_ra_coordinate(const lx200_coordinate_t *coord, char *str, size_t str_size)
 {
-	LOG_WRN("lx200_format_ra_coordinate: Function not implemented yet");
-	// TODO: Implement RA coordinate formatting
-	ARG_UNUSED(coord);
-	ARG_UNUSED(str);
-	ARG_UNUSED(str_size);
-	return -1;
+	if (coord == NULL || str == NULL) {
+		LOG_ERR("lx200_format_ra_coordinate: Invalid parameters (coord=%p, str=%p)", coord,
+			str);
+		return -EINVAL;
+	}
+
+	return format_coordinate(coord, str, str_size, false, 2, ':');
 }
 
+/**
+ * @brief Format a declination or altitude reply, sDD*MM:SS# or sDD*MM#
+ */
 int lx200_format_dec_coordinate(const lx200_coordinate_t *coord, char *str, size_t str_size)
 {
-	LOG_WRN("lx200_format_dec_coordinate: Function not implemented yet");
-	// TODO: Implement Dec coordinate formatting
-	ARG_UNUSED(coord);
-	ARG_UNUSED(str);
-	ARG_UNUSED(str_size);
-	return -1;
+	if (coord == NULL || str == NULL) {
+		LOG_ERR("lx200_format_dec_coordinate: Invalid parameters (coord=%p, str=%p)", coord,
+			str);
+		return -EINVAL;
+	}
+
+	return format_coordinate(coord, str, str_size, true, 2, '*');
+}
+
+/**
+ * @brief Format an azimuth reply, DDD*MM:SS# or DDD*MM#
+ */
+int lx200_format_azimuth_coordinate(const lx200_coordinate_t *coord, char *str, size_t str_size)
+{
+	if (coord == NULL || str == NULL || coord->is_negative) {
+		LOG_ERR("lx200_format_azimuth_coordinate: Invalid parameters (coord=%p, str=%p)",
+			coord, str);
+		return -EINVAL;
+	}
+
+	return format_coordinate(coord, str, str_size, false, 3, '*');
 }
 
 int lx200_format_time(const lx200_time_t *time, char *str, size_t str_size)
@@ -0,0 +1,199 @@
+/**
+ * @file lx200_cache.c
+ * @brief LX200 response cache implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <lx200/lx200_cache.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(lx200, CONFIG_LX200_LOG_LEVEL);
+
+BUILD_ASSERT(LX200_COORD_LOW_PRECISION < LX200_CACHE_PRECISIONS &&
+		     LX200_COORD_HIGH_PRECISION < LX200_CACHE_PRECISIONS,
+	     "Every precision mode needs a cache entry");
+
+/**
+ * @brief Display unit of each reply, in units of the reported value
+ */
+static const int32_t display_units[LX200_CACHE_COUNT][LX200_CACHE_PRECISIONS] = {
+	/* HH:MM.T / HH:MM:SS */
+	[LX200_CACHE_RA] = {[LX200_COORD_LOW_PRECISION] = 6, [LX200_COORD_HIGH_PRECISION] = 1},
+	/* sDD*MM / sDD*MM:SS */
+	[LX200_CACHE_DEC] = {[LX200_COORD_LOW_PRECISION] = 60, [LX200_COORD_HIGH_PRECISION] = 1},
+	[LX200_CACHE_ALT] = {[LX200_COORD_LOW_PRECISION] = 60, [LX200_COORD_HIGH_PRECISION] = 1},
+	/* DDD*MM / DDD*MM:SS */
+	[LX200_CACHE_AZ] = {[LX200_COORD_LOW_PRECISION] = 60, [LX200_COORD_HIGH_PRECISION] = 1},
+	/* Always HH:MM:SS */
+	[LX200_CACHE_SIDEREAL_TIME] = {[LX200_COORD_LOW_PRECISION] = 1,
+				       [LX200_COORD_HIGH_PRECISION] = 1},
+};
+
+/**
+ * @brief Displayed value as the reply prints it, a sign and the truncated magnitude
+ *
+ * Negative values map to the complement, so -0*00:30 and +0*00:30 differ.
+ */
+static int32_t display_key(int32_t value, int32_t unit)
+{
+	if (value < 0) {
+		return ~(int32_t)(-(int64_t)value / unit);
+	}
+
+	return value / unit;
+}
+
+/**
+ * @brief Check the cache pointer and the entry index
+ */
+static bool valid_slot(const lx200_cache_t *cache, lx200_cache_slot_t slot,
+		       lx200_precision_t precision)
+{
+	return cache != NULL && (unsigned int)slot < LX200_CACHE_COUNT &&
+	       (unsigned int)precision < LX200_CACHE_PRECISIONS;
+}
+
+/**
+ * @brief Initialize a response cache
+ */
+void lx200_cache_init(lx200_cache_t *cache)
+{
+	if (cache == NULL) {
+		LOG_ERR("lx200_cache_init: NULL cache pointer");
+		return;
+	}
+
+	memset(cache, 0, sizeof(*cache));
+}
+
+/**
+ * @brief Get the cache slot of a command
+ */
+lx200_cache_slot_t lx200_cache_slot(lx200_command_id_t id)
+{
+	switch (id) {
+	case LX200_ID_GET_RA:
+		return LX200_CACHE_RA;
+	case LX200_ID_GET_DEC:
+		return LX200_CACHE_DEC;
+	case LX200_ID_GET_ALTITUDE:
+		return LX200_CACHE_ALT;
+	case LX200_ID_GET_AZIMUTH:
+		return LX200_CACHE_AZ;
+	case LX200_ID_GET_SIDEREAL_TIME:
+		return LX200_CACHE_SIDEREAL_TIME;
+	default:
+		return LX200_CACHE_COUNT;
+	}
+}
+
+/**
+ * @brief Append a cached reply to a response
+ */
+bool lx200_cache_lookup(lx200_cache_t *cache, lx200_cache_slot_t slot,
+			lx200_precision_t precision, lx200_response_t *response)
+{
+	if (!valid_slot(cache, slot, precision) || response == NULL) {
+		return false;
+	}
+
+	const lx200_cache_entry_t *entry = &cache->entries[slot][precision];
+
+	if (entry->length == 0 ||
+	    entry->generation != (uint32_t)atomic_get(&cache->generations[slot][precision])) {
+		cache->stats.misses++;
+		return false;
+	}
+
+	if (lx200_response_append(response, entry->text, entry->length) < 0) {
+		cache->stats.misses++;
+		return false;
+	}
+
+	cache->stats.hits++;
+	return true;
+}
+
+/**
+ * @brief Get the generation to pass to lx200_cache_store()
+ */
+uint32_t lx200_cache_generation(lx200_cache_t *cache, lx200_cache_slot_t slot,
+				lx200_precision_t precision)
+{
+	if (!valid_slot(cache, slot, precision)) {
+		return 0;
+	}
+
+	return (uint32_t)atomic_get(&cache->generations[slot][precision]);
+}
+
+/**
+ * @brief Store a formatted reply
+ */
+void lx200_cache_store(lx200_cache_t *cache, lx200_cache_slot_t slot,
+		       lx200_precision_t precision, uint32_t generation, const char *text,
+		       size_t length)
+{
+	if (!valid_slot(cache, slot, precision) || text == NULL || length == 0 ||
+	    length > LX200_CACHE_ENTRY_LENGTH) {
+		return;
+	}
+
+	if (generation != (uint32_t)atomic_get(&cache->generations[slot][precision])) {
+		cache->stats.stale_stores++;
+		return;
+	}
+
+	lx200_cache_entry_t *entry = &cache->entries[slot][precision];
+
+	memcpy(entry->text, text, length);
+	entry->length = (uint8_t)length;
+	entry->generation = generation;
+}
+
+/**
+ * @brief Report a new value for a cached reply
+ */
+void lx200_cache_update(lx200_cache_t *cache, lx200_cache_slot_t slot, int32_t value)
+{
+	if (cache == NULL || (unsigned int)slot >= LX200_CACHE_COUNT) {
+		return;
+	}
+
+	for (int precision = 0; precision < LX200_CACHE_PRECISIONS; precision++) {
+		const int32_t displayed = display_key(value, display_units[slot][precision]);
+
+		if (displayed != cache->displayed[slot][precision]) {
+			cache->displayed[slot][precision] = displayed;
+			atomic_inc(&cache->generations[slot][precision]);
+		}
+	}
+}
+
+/**
+ * @brief Invalidate a cached reply in all precision modes
+ */
+void lx200_cache_invalidate(lx200_cache_t *cache, lx200_cache_slot_t slot)
+{
+	if (cache == NULL || (unsigned int)slot >= LX200_CACHE_COUNT) {
+		return;
+	}
+
+	for (int precision = 0; precision < LX200_CACHE_PRECISIONS; precision++) {
+		atomic_inc(&cache->generations[slot][precision]);
+	}
+}
+
+/**
+ * @brief Invalidate all cached replies
+ */
+void lx200_cache_invalidate_all(lx200_cache_t *cache)
+{
+	for (int slot = 0; slot < LX200_CACHE_COUNT; slot++) {
+		lx200_cache_invalidate(cache, (lx200_cache_slot_t)slot);
+	}
+}
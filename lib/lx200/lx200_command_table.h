@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Generated by scripts/gen_lx200_commands.py, do not edit.
+ */
+
+#pragma once
+
+#include <lx200/lx200.h>
+
+#define LX200_COMMAND_TABLE_BITS 8
+#define LX200_COMMAND_BUCKET_BITS 6
+#define LX200_COMMAND_BUCKET_MULTIPLIER 0x9E3779B1U
+#define LX200_COMMAND_SLOT_MULTIPLIER 0x85EBCA77U
+
+static const uint16_t lx200_command_displacements[] = {
+	1, 1, 0, 11, 0, 0, 1, 2,
+	1, 0, 2, 3, 0, 3, 3, 1,
+	0, 2, 2, 1, 1, 0, 0, 8,
+	0, 3, 0, 1, 0, 6, 1, 2,
+	0, 0, 0, 3, 17, 3, 0, 2,
+	3, 1, 2, 0, 0, 0, 1, 0,
+	1, 8, 0, 0, 0, 1, 5, 2,
+	0, 3, 5, 0, 0, 3, 0, 2,
+};
+
+static const lx200_command_info_t lx200_command_table[1 << LX200_COMMAND_TABLE_BITS] = {
+	[0] = {0x00004D52U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_FIND}, /* RM */
+	[2] = {0x00006747U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_LONGITUDE}, /* Gg */
+	[6] = {0x00007753U, 2, LX200_CMD_SET, LX200_PARAM_DIGIT, LX200_ID_SET_MAX_SLEW_RATE}, /* Sw */
+	[7] = {0x00414224U, 3, LX200_CMD_BACKLASH, LX200_PARAM_NUMBER, LX200_ID_BACKLASH_DEC}, /* $BA */
+	[9] = {0x00005A47U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_AZIMUTH}, /* GZ */
+	[10] = {0x004E5647U, 3, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_FIRMWARE_NUMBER}, /* GVN */
+	[12] = {0x00004C43U, 2, LX200_CMD_SYNC, LX200_PARAM_NONE, LX200_ID_SYNC_SELENOGRAPHIC}, /* CL */
+	[15] = {0x00005768U, 2, LX200_CMD_HOME, LX200_PARAM_NONE, LX200_ID_HOME_WAKE}, /* hW */
+	[16] = {0x00007347U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_SMALLER_SIZE_LIMIT}, /* Gs */
+	[17] = {0x00007947U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_OBJECT_SELECTION}, /* Gy */
+	[18] = {0x00006E4DU, 2, LX200_CMD_MOVE, LX200_PARAM_NONE, LX200_ID_MOVE_NORTH}, /* Mn */
+	[20] = {0x00000051U, 1, LX200_CMD_STOP, LX200_PARAM_NONE, LX200_ID_STOP_ALL}, /* Q */
+	[23] = {0x00006647U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_FAINT_LIMIT}, /* Gf */
+	[24] = {0x00000044U, 1, LX200_CMD_DISTANCE, LX200_PARAM_NONE, LX200_ID_DISTANCE_BARS}, /* D */
+	[27] = {0x00003052U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_0}, /* R0 */
+	[30] = {0x00002B54U, 2, LX200_CMD_TRACKING, LX200_PARAM_NONE, LX200_ID_TRACK_INCREMENT}, /* T+ */
+	[32] = {0x2B5A5124U, 4, LX200_CMD_SMART_DRIVE, LX200_PARAM_NONE, LX200_ID_PEC_RA_ENABLE}, /* $QZ+ */
+	[33] = {0x00004353U, 2, LX200_CMD_SET, LX200_PARAM_DATE, LX200_ID_SET_DATE}, /* SC */
+	[34] = {0x00005068U, 2, LX200_CMD_HOME, LX200_PARAM_NONE, LX200_ID_HOME_PARK}, /* hP */
+	[36] = {0x00004C47U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_LOCAL_TIME_24H}, /* GL */
+	[37] = {0x00005247U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_RA}, /* GR */
+	[38] = {0x0000414DU, 2, LX200_CMD_MOVE, LX200_PARAM_NONE, LX200_ID_SLEW_ALTAZ}, /* MA */
+	[40] = {0x00004442U, 2, LX200_CMD_RETICLE, LX200_PARAM_NUMBER, LX200_ID_RETICLE_DUTY_CYCLE}, /* BD */
+	[46] = {0x00004F53U, 2, LX200_CMD_SET, LX200_PARAM_STRING, LX200_ID_SET_SITE_3_NAME}, /* SO */
+	[49] = {0x00003247U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_ALIGN_MENU_2}, /* G2 */
+	[51] = {0x0000734DU, 2, LX200_CMD_MOVE, LX200_PARAM_NONE, LX200_ID_MOVE_SOUTH}, /* Ms */
+	[52] = {0x00005467U, 2, LX200_CMD_GPS, LX200_PARAM_NONE, LX200_ID_GPS_UPDATE_TIME}, /* gT */
+	[53] = {0x00004253U, 2, LX200_CMD_SET, LX200_PARAM_DIGIT, LX200_ID_SET_BAUD_RATE}, /* SB */
+	[54] = {0x00006E51U, 2, LX200_CMD_STOP, LX200_PARAM_NONE, LX200_ID_STOP_NORTH}, /* Qn */
+	[57] = {0x00005146U, 2, LX200_CMD_FOCUSER, LX200_PARAM_NONE, LX200_ID_FOCUS_STOP}, /* FQ */
+	[58] = {0x00003147U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_ALIGN_MENU_1}, /* G1 */
+	[59] = {0x00004647U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_FIELD_DIAMETER}, /* GF */
+	[60] = {0x00000049U, 1, LX200_CMD_INITIALIZE, LX200_PARAM_NONE, LX200_ID_INITIALIZE}, /* I */
+	[61] = {0x00006153U, 2, LX200_CMD_SET, LX200_PARAM_ALT, LX200_ID_SET_TARGET_ALTITUDE}, /* Sa */
+	[62] = {0x00006753U, 2, LX200_CMD_SET, LX200_PARAM_LONGITUDE, LX200_ID_SET_LONGITUDE}, /* Sg */
+	[63] = {0x0000734CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_DIGIT, LX200_ID_LIBRARY_STAR_CATALOG}, /* Ls */
+	[64] = {0x00005466U, 2, LX200_CMD_FAN, LX200_PARAM_NONE, LX200_ID_FAN_TEMPERATURE}, /* fT */
+	[65] = {0x00005047U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_SITE_4_NAME}, /* GP */
+	[67] = {0x00004E53U, 2, LX200_CMD_SET, LX200_PARAM_STRING, LX200_ID_SET_SITE_2_NAME}, /* SN */
+	[68] = {0x00007A53U, 2, LX200_CMD_SET, LX200_PARAM_AZ, LX200_ID_SET_TARGET_AZIMUTH}, /* Sz */
+	[72] = {0x00004347U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_DATE}, /* GC */
+	[73] = {0x00004152U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_DECIMAL, LX200_ID_RATE_RA_AXIS}, /* RA */
+	[74] = {0x00004752U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_GUIDE}, /* RG */
+	[75] = {0x00007351U, 2, LX200_CMD_STOP, LX200_PARAM_NONE, LX200_ID_STOP_SOUTH}, /* Qs */
+	[76] = {0x00005352U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_SLEW}, /* RS */
+	[78] = {0x00003047U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_ALIGN_MENU_0}, /* G0 */
+	[83] = {0x00006347U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_CALENDAR_FORMAT}, /* Gc */
+	[84] = {0x00002D67U, 2, LX200_CMD_GPS, LX200_PARAM_NONE, LX200_ID_GPS_OFF}, /* g- */
+	[87] = {0x00004D53U, 2, LX200_CMD_SET, LX200_PARAM_STRING, LX200_ID_SET_SITE_1_NAME}, /* SM */
+	[88] = {0x00006141U, 2, LX200_CMD_ALIGNMENT, LX200_PARAM_NONE, LX200_ID_ALIGN_AUTO}, /* Aa */
+	[91] = {0x2B415124U, 4, LX200_CMD_SMART_DRIVE, LX200_PARAM_NONE, LX200_ID_PEC_DEC_ENABLE}, /* $QA+ */
+	[92] = {0x00006247U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_BRIGHTER_LIMIT}, /* Gb */
+	[95] = {0x00000054U, 1, LX200_CMD_TRACKING, LX200_PARAM_TRACKING_RATE, LX200_ID_TRACK_SET_MANUAL_RATE}, /* T */
+	[97] = {0x00006F47U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_LOWER_LIMIT}, /* Go */
+	[100] = {0x00003352U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_3}, /* R3 */
+	[102] = {0x00006551U, 2, LX200_CMD_STOP, LX200_PARAM_NONE, LX200_ID_STOP_EAST}, /* Qe */
+	[103] = {0x00002D3FU, 2, LX200_CMD_HELP, LX200_PARAM_NONE, LX200_ID_HELP_PREVIOUS}, /* ?- */
+	[104] = {0x00007147U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_FIND_QUALITY}, /* Gq */
+	[106] = {0x00003F3FU, 2, LX200_CMD_HELP, LX200_PARAM_NONE, LX200_ID_HELP_START}, /* ?? */
+	[109] = {0x00002B72U, 2, LX200_CMD_DEROTATOR, LX200_PARAM_NONE, LX200_ID_DEROTATOR_ON}, /* r+ */
+	[110] = {0x00003F68U, 2, LX200_CMD_HOME, LX200_PARAM_NONE, LX200_ID_HOME_STATUS}, /* h? */
+	[111] = {0x00002D54U, 2, LX200_CMD_TRACKING, LX200_PARAM_NONE, LX200_ID_TRACK_DECREMENT}, /* T- */
+	[112] = {0x00005124U, 2, LX200_CMD_SMART_DRIVE, LX200_PARAM_NONE, LX200_ID_PEC_TOGGLE}, /* $Q */
+	[113] = {0x00004147U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_ALTITUDE}, /* GA */
+	[114] = {0x00004D43U, 2, LX200_CMD_SYNC, LX200_PARAM_NONE, LX200_ID_SYNC_OBJECT}, /* CM */
+	[115] = {0x00004553U, 2, LX200_CMD_SET, LX200_PARAM_LATITUDE, LX200_ID_SET_SELENOGRAPHIC_LATITUDE}, /* SE */
+	[118] = {0x00007447U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_LATITUDE}, /* Gt */
+	[119] = {0x00000055U, 1, LX200_CMD_PRECISION_TOGGLE, LX200_PARAM_NONE, LX200_ID_TOGGLE_PRECISION}, /* U */
+	[121] = {0x00003852U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_8}, /* R8 */
+	[123] = {0x00004C41U, 2, LX200_CMD_ALIGNMENT, LX200_PARAM_NONE, LX200_ID_ALIGN_LAND}, /* AL */
+	[124] = {0x00002B67U, 2, LX200_CMD_GPS, LX200_PARAM_NONE, LX200_ID_GPS_ON}, /* g+ */
+	[125] = {0x00004747U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_UTC_OFFSET}, /* GG */
+	[127] = {0x00007153U, 2, LX200_CMD_SET, LX200_PARAM_NONE, LX200_ID_STEP_FIND_QUALITY}, /* Sq */
+	[128] = {0x00005154U, 2, LX200_CMD_TRACKING, LX200_PARAM_NONE, LX200_ID_TRACK_DEFAULT}, /* TQ */
+	[130] = {0x00005447U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_TRACKING_RATE}, /* GT */
+	[131] = {0x0000434CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_NUMBER, LX200_ID_LIBRARY_SELECT_DEEP_SKY}, /* LC */
+	[132] = {0x00006F4CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_DIGIT, LX200_ID_LIBRARY_DEEP_SKY_CATALOG}, /* Lo */
+	[134] = {0x00000042U, 1, LX200_CMD_RETICLE, LX200_PARAM_DIGIT, LX200_ID_RETICLE_FLASH_RATE}, /* B */
+	[136] = {0x00005053U, 2, LX200_CMD_SET, LX200_PARAM_STRING, LX200_ID_SET_SITE_4_NAME}, /* SP */
+	[137] = {0x2D5A5124U, 4, LX200_CMD_SMART_DRIVE, LX200_PARAM_NONE, LX200_ID_PEC_RA_DISABLE}, /* $QZ- */
+	[139] = {0x00005347U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_SIDEREAL_TIME}, /* GS */
+	[140] = {0x00007751U, 2, LX200_CMD_STOP, LX200_PARAM_NONE, LX200_ID_STOP_WEST}, /* Qw */
+	[141] = {0x00003152U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_1}, /* R1 */
+	[142] = {0x00003752U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_7}, /* R7 */
+	[143] = {0x00002D72U, 2, LX200_CMD_DEROTATOR, LX200_PARAM_NONE, LX200_ID_DEROTATOR_OFF}, /* r- */
+	[144] = {0x00002B3FU, 2, LX200_CMD_HELP, LX200_PARAM_NONE, LX200_ID_HELP_NEXT}, /* ?+ */
+	[145] = {0x00006C47U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_LARGER_SIZE_LIMIT}, /* Gl */
+	[146] = {0x00007247U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_TARGET_RA}, /* Gr */
+	[147] = {0x0000534DU, 2, LX200_CMD_MOVE, LX200_PARAM_NONE, LX200_ID_SLEW_TARGET}, /* MS */
+	[150] = {0x00002D46U, 2, LX200_CMD_FOCUSER, LX200_PARAM_NONE, LX200_ID_FOCUS_OUT}, /* F- */
+	[151] = {0x00005346U, 2, LX200_CMD_FOCUSER, LX200_PARAM_NONE, LX200_ID_FOCUS_SLOW}, /* FS */
+	[152] = {0x0000424CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_NONE, LX200_ID_LIBRARY_PREVIOUS}, /* LB */
+	[154] = {0x00004C53U, 2, LX200_CMD_SET, LX200_PARAM_TIME, LX200_ID_SET_LOCAL_TIME}, /* SL */
+	[155] = {0x00004352U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CENTERING}, /* RC */
+	[156] = {0x00445647U, 3, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_FIRMWARE_DATE}, /* GVD */
+	[157] = {0x00004646U, 2, LX200_CMD_FOCUSER, LX200_PARAM_NONE, LX200_ID_FOCUS_FAST}, /* FF */
+	[158] = {0x00000046U, 1, LX200_CMD_FOCUSER, LX200_PARAM_DIGIT, LX200_ID_FOCUS_SPEED}, /* F */
+	[159] = {0x00505647U, 3, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_PRODUCT_NAME}, /* GVP */
+	[162] = {0x00003652U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_6}, /* R6 */
+	[165] = {0x00004E4CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_NONE, LX200_ID_LIBRARY_NEXT}, /* LN */
+	[166] = {0x00004C58U, 2, LX200_CMD_VENDOR, LX200_PARAM_STRING, LX200_ID_VENDOR_LATENCY}, /* XL */
+	[167] = {0x00002B42U, 2, LX200_CMD_RETICLE, LX200_PARAM_NONE, LX200_ID_RETICLE_BRIGHTER}, /* B+ */
+	[168] = {0x00006F53U, 2, LX200_CMD_SET, LX200_PARAM_NUMBER, LX200_ID_SET_LOWER_LIMIT}, /* So */
+	[170] = {0x00003552U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_5}, /* R5 */
+	[173] = {0x00006447U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_TARGET_DEC}, /* Gd */
+	[174] = {0x00006253U, 2, LX200_CMD_SET, LX200_PARAM_MAGNITUDE, LX200_ID_SET_BRIGHTER_LIMIT}, /* Sb */
+	[175] = {0x00006853U, 2, LX200_CMD_SET, LX200_PARAM_NUMBER, LX200_ID_SET_HIGH_LIMIT}, /* Sh */
+	[176] = {0x00005041U, 2, LX200_CMD_ALIGNMENT, LX200_PARAM_NONE, LX200_ID_ALIGN_POLAR}, /* AP */
+	[178] = {0x00000057U, 1, LX200_CMD_SITE, LX200_PARAM_DIGIT, LX200_ID_SELECT_SITE}, /* W */
+	[179] = {0x00002B46U, 2, LX200_CMD_FOCUSER, LX200_PARAM_NONE, LX200_ID_FOCUS_IN}, /* F+ */
+	[180] = {0x0000664CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_NONE, LX200_ID_LIBRARY_IDENTIFY}, /* Lf */
+	[182] = {0x00000048U, 1, LX200_CMD_TIME_FORMAT, LX200_PARAM_NONE, LX200_ID_TOGGLE_TIME_FORMAT}, /* H */
+	[184] = {0x00006752U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_DECIMAL, LX200_ID_RATE_GUIDE_SPEED}, /* Rg */
+	[185] = {0x00004D4CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_NUMBER, LX200_ID_LIBRARY_SELECT_MESSIER}, /* LM */
+	[186] = {0x00004447U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_DEC}, /* GD */
+	[189] = {0x00007453U, 2, LX200_CMD_SET, LX200_PARAM_LATITUDE, LX200_ID_SET_LATITUDE}, /* St */
+	[190] = {0x00005453U, 2, LX200_CMD_SET, LX200_PARAM_TRACKING_RATE, LX200_ID_SET_TRACKING_RATE}, /* ST */
+	[193] = {0x0000464CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_NONE, LX200_ID_LIBRARY_FIND}, /* LF */
+	[195] = {0x2D415124U, 4, LX200_CMD_SMART_DRIVE, LX200_PARAM_NONE, LX200_ID_PEC_DEC_DISABLE}, /* $QA- */
+	[197] = {0x00007353U, 2, LX200_CMD_SET, LX200_PARAM_NUMBER, LX200_ID_SET_LARGER_SIZE_LIMIT}, /* Ss */
+	[198] = {0x0000534CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_NUMBER, LX200_ID_LIBRARY_SELECT_STAR}, /* LS */
+	[200] = {0x0000654DU, 2, LX200_CMD_MOVE, LX200_PARAM_NONE, LX200_ID_MOVE_EAST}, /* Me */
+	[201] = {0x00545647U, 3, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_FIRMWARE_TIME}, /* GVT */
+	[202] = {0x00003452U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_4}, /* R4 */
+	[204] = {0x00006653U, 2, LX200_CMD_SET, LX200_PARAM_MAGNITUDE, LX200_ID_SET_FAINT_LIMIT}, /* Sf */
+	[205] = {0x005A4224U, 3, LX200_CMD_BACKLASH, LX200_PARAM_NUMBER, LX200_ID_BACKLASH_RA}, /* $BZ */
+	[206] = {0x00002D66U, 2, LX200_CMD_FAN, LX200_PARAM_NONE, LX200_ID_FAN_OFF}, /* f- */
+	[208] = {0x00004753U, 2, LX200_CMD_SET, LX200_PARAM_UTC_OFFSET, LX200_ID_SET_UTC_OFFSET}, /* SG */
+	[209] = {0x00004E68U, 2, LX200_CMD_HOME, LX200_PARAM_NONE, LX200_ID_HOME_SLEEP}, /* hN */
+	[210] = {0x00005353U, 2, LX200_CMD_SET, LX200_PARAM_TIME, LX200_ID_SET_SIDEREAL_TIME}, /* SS */
+	[217] = {0x00000050U, 1, LX200_CMD_PRECISION, LX200_PARAM_NONE, LX200_ID_TOGGLE_HIGH_PRECISION}, /* P */
+	[218] = {0x00005368U, 2, LX200_CMD_HOME, LX200_PARAM_NONE, LX200_ID_HOME_STORE}, /* hS */
+	[220] = {0x00004F47U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_SITE_3_NAME}, /* GO */
+	[221] = {0x00004D54U, 2, LX200_CMD_TRACKING, LX200_PARAM_NONE, LX200_ID_TRACK_CUSTOM}, /* TM */
+	[222] = {0x00007953U, 2, LX200_CMD_SET, LX200_PARAM_STRING, LX200_ID_SET_OBJECT_SELECTION}, /* Sy */
+	[223] = {0x00004141U, 2, LX200_CMD_ALIGNMENT, LX200_PARAM_NONE, LX200_ID_ALIGN_ALTAZ}, /* AA */
+	[224] = {0x00006553U, 2, LX200_CMD_SET, LX200_PARAM_LONGITUDE, LX200_ID_SET_SELENOGRAPHIC_LONGITUDE}, /* Se */
+	[225] = {0x00004668U, 2, LX200_CMD_HOME, LX200_PARAM_NONE, LX200_ID_HOME_FIND}, /* hF */
+	[227] = {0x0000774DU, 2, LX200_CMD_MOVE, LX200_PARAM_NONE, LX200_ID_MOVE_WEST}, /* Mw */
+	[228] = {0x00006C53U, 2, LX200_CMD_SET, LX200_PARAM_NUMBER, LX200_ID_SET_SMALLER_SIZE_LIMIT}, /* Sl */
+	[229] = {0x00007253U, 2, LX200_CMD_SET, LX200_PARAM_RA, LX200_ID_SET_TARGET_RA}, /* Sr */
+	[233] = {0x00004D47U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_SITE_1_NAME}, /* GM */
+	[234] = {0x00006147U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_LOCAL_TIME_12H}, /* Ga */
+	[235] = {0x00003952U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_9}, /* R9 */
+	[237] = {0x00004552U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_DECIMAL, LX200_ID_RATE_DEC_AXIS}, /* RE */
+	[238] = {0x00006847U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_HIGH_LIMIT}, /* Gh */
+	[240] = {0x00004653U, 2, LX200_CMD_SET, LX200_PARAM_NUMBER, LX200_ID_SET_FIELD_DIAMETER}, /* SF */
+	[241] = {0x00004C54U, 2, LX200_CMD_TRACKING, LX200_PARAM_NONE, LX200_ID_TRACK_LUNAR}, /* TL */
+	[243] = {0x00003252U, 2, LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_2}, /* R2 */
+	[244] = {0x00006453U, 2, LX200_CMD_SET, LX200_PARAM_DEC, LX200_ID_SET_TARGET_DEC}, /* Sd */
+	[246] = {0x00002B66U, 2, LX200_CMD_FAN, LX200_PARAM_NONE, LX200_ID_FAN_ON}, /* f+ */
+	[249] = {0x00002D42U, 2, LX200_CMD_RETICLE, LX200_PARAM_NONE, LX200_ID_RETICLE_DIMMER}, /* B- */
+	[252] = {0x00004E47U, 2, LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_SITE_2_NAME}, /* GN */
+	[253] = {0x00737067U, 3, LX200_CMD_GPS, LX200_PARAM_NONE, LX200_ID_GPS_STREAM}, /* gps */
+	[254] = {0x0000494CU, 2, LX200_CMD_LIBRARY, LX200_PARAM_NONE, LX200_ID_LIBRARY_INFO}, /* LI */
+};
+
+static const uint8_t lx200_command_prefixes[128] = {
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_HELP, /* '?' */
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_ALIGNMENT, /* 'A' */
+	LX200_CMD_RETICLE, /* 'B' */
+	LX200_CMD_SYNC, /* 'C' */
+	LX200_CMD_DISTANCE, /* 'D' */
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_FOCUSER, /* 'F' */
+	LX200_CMD_GET, /* 'G' */
+	LX200_CMD_TIME_FORMAT, /* 'H' */
+	LX200_CMD_INITIALIZE, /* 'I' */
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_LIBRARY, /* 'L' */
+	LX200_CMD_MOVE, /* 'M' */
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_PRECISION, /* 'P' */
+	LX200_CMD_STOP, /* 'Q' */
+	LX200_CMD_SLEW_RATE, /* 'R' */
+	LX200_CMD_SET, /* 'S' */
+	LX200_CMD_TRACKING, /* 'T' */
+	LX200_CMD_PRECISION_TOGGLE, /* 'U' */
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_SITE, /* 'W' */
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_FAN, /* 'f' */
+	LX200_CMD_GPS, /* 'g' */
+	LX200_CMD_HOME, /* 'h' */
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_DEROTATOR, /* 'r' */
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+	LX200_CMD_UNKNOWN,
+};
@@ -0,0 +1,360 @@
+/**
+ * @file lx200_framer.c
+ * @brief Streaming LX200 command framer implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <lx200/lx200_framer.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(lx200, CONFIG_LX200_LOG_LEVEL);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_LX200_FRAMER_DEPTH),
+	     "CONFIG_LX200_FRAMER_DEPTH must be a power of two");
+
+#define FRAMER_SLOT(index) ((index) & (CONFIG_LX200_FRAMER_DEPTH - 1))
+
+#if defined(CONFIG_LX200_LATENCY)
+#define FRAMER_STAMP(framer, field, head) ((framer)->field[FRAMER_SLOT(head)] = k_cycle_get_32())
+#else
+#define FRAMER_STAMP(framer, field, head)
+#endif
+
+/* Stop matcher states, a direction is stored as STOP_MATCH_DIRECTION + lx200_stop_t */
+#define STOP_MATCH_IDLE      0
+#define STOP_MATCH_PREFIX    1
+#define STOP_MATCH_Q         2
+#define STOP_MATCH_DIRECTION 3
+
+/**
+ * @brief Initialize a framer
+ */
+void lx200_framer_init(lx200_framer_t *framer)
+{
+	if (framer == NULL) {
+		LOG_ERR("lx200_framer_init: NULL framer pointer");
+		return;
+	}
+
+	memset(framer, 0, sizeof(*framer));
+	atomic_set(&framer->head, 0);
+	atomic_set(&framer->tail, 0);
+
+	LOG_DBG("LX200 framer initialized with %d slots", CONFIG_LX200_FRAMER_DEPTH);
+}
+
+/**
+ * @brief Drop all queued and partial frames
+ */
+void lx200_framer_reset(lx200_framer_t *framer)
+{
+	if (framer == NULL) {
+		LOG_ERR("lx200_framer_reset: NULL framer pointer");
+		return;
+	}
+
+	atomic_set(&framer->tail, atomic_get(&framer->head));
+	framer->fill = 0;
+	framer->in_frame = false;
+	framer->colon_pending = false;
+	framer->skipping = false;
+	framer->stop_match = STOP_MATCH_IDLE;
+}
+
+/**
+ * @brief Set the handler called when a stop command is received
+ */
+void lx200_framer_set_stop_handler(lx200_framer_t *framer, lx200_stop_handler_t handler,
+				   void *user_data)
+{
+	if (framer == NULL) {
+		LOG_ERR("lx200_framer_set_stop_handler: NULL framer pointer");
+		return;
+	}
+
+	framer->stop_handler = handler;
+	framer->stop_user_data = user_data;
+}
+
+/**
+ * @brief Set the handler called when an ACK byte is received
+ */
+void lx200_framer_set_ack_handler(lx200_framer_t *framer, lx200_ack_handler_t handler,
+				  void *user_data)
+{
+	if (framer == NULL) {
+		LOG_ERR("lx200_framer_set_ack_handler: NULL framer pointer");
+		return;
+	}
+
+	framer->ack_handler = handler;
+	framer->ack_user_data = user_data;
+}
+
+/**
+ * @brief Advance the stop command matcher by one byte
+ *
+ * Runs on every byte, whether or not the frame gets a slot, so a stop is
+ * never lost to a full queue or an overlong frame before it.
+ */
+static void match_stop(lx200_framer_t *framer, char c)
+{
+	lx200_stop_t stop;
+
+	if (c == LX200_COMMAND_PREFIX) {
+		framer->stop_match = STOP_MATCH_PREFIX;
+		return;
+	}
+
+	switch (framer->stop_match) {
+	case STOP_MATCH_IDLE:
+		return;
+	case STOP_MATCH_PREFIX:
+		framer->stop_match = (c == 'Q') ? STOP_MATCH_Q : STOP_MATCH_IDLE;
+		return;
+	case STOP_MATCH_Q:
+		framer->stop_match = STOP_MATCH_IDLE;
+
+		switch (c) {
+		case 'n':
+			framer->stop_match = STOP_MATCH_DIRECTION + LX200_STOP_NORTH;
+			return;
+		case 's':
+			framer->stop_match = STOP_MATCH_DIRECTION + LX200_STOP_SOUTH;
+			return;
+		case 'e':
+			framer->stop_match = STOP_MATCH_DIRECTION + LX200_STOP_EAST;
+			return;
+		case 'w':
+			framer->stop_match = STOP_MATCH_DIRECTION + LX200_STOP_WEST;
+			return;
+		case LX200_COMMAND_TERMINATOR:
+			stop = LX200_STOP_ALL;
+			break;
+		default:
+			return;
+		}
+		break;
+	default:
+		stop = (lx200_stop_t)(framer->stop_match - STOP_MATCH_DIRECTION);
+		framer->stop_match = STOP_MATCH_IDLE;
+
+		if (c != LX200_COMMAND_TERMINATOR) {
+			return;
+		}
+		break;
+	}
+
+	framer->stats.stops++;
+
+	if (framer->stop_handler != NULL) {
+		framer->stop_handler(stop, framer->stop_user_data);
+	}
+}
+
+/**
+ * @brief Drop the frame being assembled up to its terminator
+ */
+static void skip_frame(lx200_framer_t *framer)
+{
+	framer->in_frame = false;
+	framer->skipping = true;
+}
+
+/**
+ * @brief Start a new frame in the head slot if there is one free
+ */
+static void start_frame(lx200_framer_t *framer, atomic_val_t head, char *slot)
+{
+	if ((atomic_val_t)(head - atomic_get(&framer->tail)) >= CONFIG_LX200_FRAMER_DEPTH) {
+		/* No free slot, skip this frame entirely */
+		framer->stats.drops++;
+		skip_frame(framer);
+		return;
+	}
+
+	slot[0] = LX200_COMMAND_PREFIX;
+	framer->fill = 1;
+	framer->in_frame = true;
+	framer->skipping = false;
+	FRAMER_STAMP(framer, started, head);
+}
+
+/**
+ * @brief Feed received bytes into the framer
+ */
+size_t lx200_framer_feed(lx200_framer_t *framer, const char *data, size_t length)
+{
+	if (framer == NULL || data == NULL) {
+		LOG_ERR("lx200_framer_feed: Invalid parameters (framer=%p, data=%p)", framer,
+			data);
+		return 0;
+	}
+
+	atomic_val_t head = atomic_get(&framer->head);
+	char *slot = framer->slots[FRAMER_SLOT(head)];
+	size_t completed = 0;
+
+	for (size_t i = 0; i < length; i++) {
+		const char c = data[i];
+
+		if (c == LX200_ACK) {
+			/*
+			 * Never part of a command, so answer it right away and leave the
+			 * frame being assembled untouched.
+			 */
+			framer->stats.acks++;
+			if (framer->ack_handler != NULL) {
+				framer->ack_handler(framer->ack_user_data);
+			}
+			continue;
+		}
+
+		match_stop(framer, c);
+
+		if (framer->colon_pending) {
+			framer->colon_pending = false;
+
+			if (c < '0' || c > '9') {
+				/*
+				 * Parameters only ever have digits after a ':', so this one
+				 * started a new command. Restart the frame in place and keep
+				 * everything that was already queued.
+				 */
+				if (framer->skipping) {
+					start_frame(framer, head, slot);
+				} else {
+					framer->stats.resyncs++;
+					slot[0] = LX200_COMMAND_PREFIX;
+					framer->fill = 1;
+					FRAMER_STAMP(framer, started, head);
+				}
+			}
+		}
+
+		if (framer->skipping) {
+			/* A ':' in a dropped frame may still start the next command */
+			if (c == LX200_COMMAND_PREFIX) {
+				framer->colon_pending = true;
+			} else if (c == LX200_COMMAND_TERMINATOR) {
+				framer->skipping = false;
+			}
+			continue;
+		}
+
+		if (c == LX200_COMMAND_PREFIX) {
+			if (framer->in_frame && framer->fill > 1) {
+				/* Separator or new command, decided by the next byte */
+				if (framer->fill >= LX200_MAX_COMMAND_LENGTH - 1) {
+					framer->stats.overflows++;
+					skip_frame(framer);
+					framer->colon_pending = true;
+					continue;
+				}
+
+				slot[framer->fill++] = c;
+				framer->colon_pending = true;
+				continue;
+			}
+
+			if (framer->in_frame) {
+				framer->stats.resyncs++;
+			}
+
+			start_frame(framer, head, slot);
+			continue;
+		}
+
+		if (!framer->in_frame) {
+			framer->stats.discarded_bytes++;
+			continue;
+		}
+
+		if (framer->fill >= LX200_MAX_COMMAND_LENGTH - 1) {
+			/* No room left for this byte and the trailing NUL */
+			framer->stats.overflows++;
+			skip_frame(framer);
+
+			if (c == LX200_COMMAND_TERMINATOR) {
+				framer->skipping = false;
+			}
+			continue;
+		}
+
+		slot[framer->fill++] = c;
+
+		if (c == LX200_COMMAND_TERMINATOR) {
+			slot[framer->fill] = '\0';
+			framer->lengths[FRAMER_SLOT(head)] = framer->fill;
+			FRAMER_STAMP(framer, completed, head);
+			framer->in_frame = false;
+			framer->stats.frames++;
+			completed++;
+
+			/* Publish the slot before moving on to the next one */
+			head++;
+			atomic_set(&framer->head, head);
+			slot = framer->slots[FRAMER_SLOT(head)];
+		}
+	}
+
+	return completed;
+}
+
+/**
+ * @brief Get the oldest queued frame without removing it
+ */
+bool lx200_framer_peek(lx200_framer_t *framer, lx200_frame_t *frame)
+{
+	if (framer == NULL || frame == NULL) {
+		return false;
+	}
+
+	atomic_val_t tail = atomic_get(&framer->tail);
+
+	if (tail == atomic_get(&framer->head)) {
+		return false;
+	}
+
+	frame->data = framer->slots[FRAMER_SLOT(tail)];
+	frame->length = framer->lengths[FRAMER_SLOT(tail)];
+#if defined(CONFIG_LX200_LATENCY)
+	frame->started = framer->started[FRAMER_SLOT(tail)];
+	frame->completed = framer->completed[FRAMER_SLOT(tail)];
+#endif
+
+	return true;
+}
+
+/**
+ * @brief Release the oldest queued frame
+ */
+void lx200_framer_release(lx200_framer_t *framer)
+{
+	if (framer == NULL) {
+		return;
+	}
+
+	atomic_val_t tail = atomic_get(&framer->tail);
+
+	if (tail != atomic_get(&framer->head)) {
+		atomic_set(&framer->tail, tail + 1);
+	}
+}
+
+/**
+ * @brief Get the number of queued frames
+ */
+size_t lx200_framer_pending(const lx200_framer_t *framer)
+{
+	if (framer == NULL) {
+		return 0;
+	}
+
+	return (size_t)(atomic_get(&framer->head) - atomic_get(&framer->tail));
+}
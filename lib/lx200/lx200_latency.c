@@ -0,0 +1,162 @@
+/**
+ * @file lx200_latency.c
+ * @brief Per command family latency histograms implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <lx200/lx200_latency.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(lx200, CONFIG_LX200_LOG_LEVEL);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(LX200_LATENCY_FIRST_BUCKET_US),
+	     "LX200_LATENCY_FIRST_BUCKET_US must be a power of two");
+
+/* log2 of the upper bound of the first bucket */
+#define FIRST_BUCKET_SHIFT (31 - __builtin_clz(LX200_LATENCY_FIRST_BUCKET_US))
+
+/**
+ * @brief Get the bucket of a latency
+ */
+static size_t bucket_of(uint32_t us)
+{
+	if (us < LX200_LATENCY_FIRST_BUCKET_US) {
+		return 0;
+	}
+
+	size_t bucket = (size_t)(31 - __builtin_clz(us)) - FIRST_BUCKET_SHIFT + 1;
+
+	return MIN(bucket, LX200_LATENCY_BUCKETS - 1);
+}
+
+/**
+ * @brief Initialize latency histograms, all empty
+ */
+void lx200_latency_init(lx200_latency_t *latency)
+{
+	if (latency == NULL) {
+		LOG_ERR("lx200_latency_init: NULL latency pointer");
+		return;
+	}
+
+	memset(latency, 0, sizeof(*latency));
+}
+
+/**
+ * @brief Add a sample to a histogram
+ */
+void lx200_latency_record(lx200_latency_t *latency, lx200_command_family_t family,
+			  lx200_latency_stage_t stage, uint32_t us)
+{
+	if (latency == NULL || (unsigned int)family >= LX200_CMD_UNKNOWN ||
+	    (unsigned int)stage >= LX200_LATENCY_STAGES) {
+		return;
+	}
+
+	lx200_histogram_t *histogram = &latency->histograms[family][stage];
+
+	if (histogram->count == 0 || us < histogram->min_us) {
+		histogram->min_us = us;
+	}
+	if (us > histogram->max_us) {
+		histogram->max_us = us;
+	}
+
+	histogram->buckets[bucket_of(us)]++;
+	histogram->count++;
+}
+
+/**
+ * @brief Record a handled command
+ */
+void lx200_latency_handled(lx200_latency_t *latency, lx200_latency_batch_t *batch,
+			   lx200_command_family_t family, const lx200_frame_t *frame, uint32_t now)
+{
+	if (latency == NULL || batch == NULL || frame == NULL) {
+		return;
+	}
+
+	lx200_latency_record(latency, family, LX200_LATENCY_RECEIVE,
+			     k_cyc_to_us_floor32(frame->completed - frame->started));
+	lx200_latency_record(latency, family, LX200_LATENCY_HANDLE,
+			     k_cyc_to_us_floor32(now - frame->completed));
+
+	if (batch->count >= ARRAY_SIZE(batch->entries)) {
+		batch->dropped++;
+		return;
+	}
+
+	lx200_latency_entry_t *entry = &batch->entries[batch->count++];
+
+	entry->family = (uint8_t)family;
+	entry->started = frame->started;
+	entry->handled = now;
+}
+
+/**
+ * @brief Record the transmission of the replies of a batch
+ */
+void lx200_latency_transmitted(lx200_latency_t *latency, lx200_latency_batch_t *batch,
+			       uint32_t now)
+{
+	if (latency == NULL || batch == NULL) {
+		return;
+	}
+
+	for (size_t i = 0; i < batch->count; i++) {
+		const lx200_latency_entry_t *entry = &batch->entries[i];
+		const lx200_command_family_t family = (lx200_command_family_t)entry->family;
+
+		lx200_latency_record(latency, family, LX200_LATENCY_TRANSMIT,
+				     k_cyc_to_us_floor32(now - entry->handled));
+		lx200_latency_record(latency, family, LX200_LATENCY_TOTAL,
+				     k_cyc_to_us_floor32(now - entry->started));
+	}
+
+	batch->count = 0;
+}
+
+/**
+ * @brief Get a histogram
+ */
+const lx200_histogram_t *lx200_latency_histogram(const lx200_latency_t *latency,
+						 lx200_command_family_t family,
+						 lx200_latency_stage_t stage)
+{
+	if (latency == NULL || (unsigned int)family >= LX200_CMD_UNKNOWN ||
+	    (unsigned int)stage >= LX200_LATENCY_STAGES) {
+		return NULL;
+	}
+
+	return &latency->histograms[family][stage];
+}
+
+/**
+ * @brief Estimate a percentile of a histogram
+ */
+uint32_t lx200_histogram_percentile(const lx200_histogram_t *histogram, uint32_t permille)
+{
+	if (histogram == NULL || histogram->count == 0) {
+		return 0;
+	}
+
+	/* Rank of the sample at the percentile, rounded up */
+	const uint64_t rank = ((uint64_t)histogram->count * MIN(permille, 1000U) + 999U) / 1000U;
+	uint64_t seen = 0;
+
+	for (size_t i = 0; i < LX200_LATENCY_BUCKETS - 1; i++) {
+		seen += histogram->buckets[i];
+		if (seen >= rank && seen > 0) {
+			const uint32_t bound = (LX200_LATENCY_FIRST_BUCKET_US << i) - 1U;
+
+			return MIN(bound, histogram->max_us);
+		}
+	}
+
+	return histogram->max_us;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file lx200_log.h
+ * @brief Logging helpers for the LX200 command hot path
+ *
+ * Everything that runs once per received chunk or command logs through these
+ * macros. With CONFIG_LX200_QUIET_HOT_PATH the trace macros compile to
+ * nothing, so neither the format strings nor their arguments reach the log
+ * core, and errors caused by client input are reported at most once per
+ * CONFIG_LX200_ERROR_LOG_INTERVAL_MS per call site. The parser counters in
+ * lx200_stats_t keep track of what is no longer logged.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#ifdef CONFIG_LX200_QUIET_HOT_PATH
+
+/* Keep the arguments referenced so quiet builds see no unused variables */
+#define LX200_TRACE_NOP(...)                                                                       \
+	do {                                                                                       \
+		if (0) {                                                                           \
+			LOG_DBG(__VA_ARGS__);                                                      \
+		}                                                                                  \
+	} while (0)
+
+#define LX200_TRACE_INF(...) LX200_TRACE_NOP(__VA_ARGS__)
+#define LX200_TRACE_WRN(...) LX200_TRACE_NOP(__VA_ARGS__)
+#define LX200_TRACE_DBG(...) LX200_TRACE_NOP(__VA_ARGS__)
+#define LX200_TRACE_HEXDUMP_DBG(data, length, str)                                                 \
+	do {                                                                                       \
+		ARG_UNUSED(data);                                                                  \
+		ARG_UNUSED(length);                                                                \
+	} while (0)
+
+/**
+ * @brief Log an error caused by client input, at most once per interval
+ *
+ * Each call site keeps its own timestamp, so one misbehaving client cannot
+ * hide unrelated errors.
+ */
+#define LX200_ERR_RATELIMIT(...)                                                                   \
+	do {                                                                                       \
+		static uint32_t lx200_err_last_ms;                                                 \
+		static bool lx200_err_logged;                                                      \
+		const uint32_t lx200_err_now_ms = k_uptime_get_32();                               \
+                                                                                                   \
+		if (!lx200_err_logged ||                                                           \
+		    lx200_err_now_ms - lx200_err_last_ms >= CONFIG_LX200_ERROR_LOG_INTERVAL_MS) {  \
+			lx200_err_logged = true;                                                   \
+			lx200_err_last_ms = lx200_err_now_ms;                                      \
+			LOG_ERR(__VA_ARGS__);                                                      \
+		}                                                                                  \
+	} while (0)
+
+#else
+
+#define LX200_TRACE_INF(...)                       LOG_INF(__VA_ARGS__)
+#define LX200_TRACE_WRN(...)                       LOG_WRN(__VA_ARGS__)
+#define LX200_TRACE_DBG(...)                       LOG_DBG(__VA_ARGS__)
+#define LX200_TRACE_HEXDUMP_DBG(data, length, str) LOG_HEXDUMP_DBG(data, length, str)
+#define LX200_ERR_RATELIMIT(...)                   LOG_ERR(__VA_ARGS__)
+
+#endif /* CONFIG_LX200_QUIET_HOT_PATH */
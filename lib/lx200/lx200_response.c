@@ -0,0 +1,222 @@
+/**
+ * @file lx200_response.c
+ * @brief LX200 response builder implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <lx200/lx200_response.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/logging/log.h>
+
+#include "lx200_log.h"
+
+LOG_MODULE_DECLARE(lx200, CONFIG_LX200_LOG_LEVEL);
+
+BUILD_ASSERT(CONFIG_LX200_RESPONSE_BUFFER_SIZE >= LX200_MAX_RESPONSE_LENGTH,
+	     "CONFIG_LX200_RESPONSE_BUFFER_SIZE must hold at least one full reply");
+
+/**
+ * @brief Pass data to the transmit callback and update the statistics
+ */
+static int transmit(lx200_response_t *response, const char *data, size_t length)
+{
+	int ret = response->flush(data, length, response->user_data);
+
+	response->stats.flushes++;
+
+	if (ret < 0) {
+		response->stats.errors++;
+		LX200_ERR_RATELIMIT("Response transmit failed: %d (%zu bytes)", ret, length);
+		return ret;
+	}
+
+	response->stats.bytes += length;
+	return 0;
+}
+
+/**
+ * @brief Make room for @p length bytes, flushing buffered replies if needed
+ */
+static int make_room(lx200_response_t *response, size_t length)
+{
+	if (response->length + length <= sizeof(response->buffer)) {
+		return 0;
+	}
+
+	response->stats.forced_flushes++;
+	return lx200_response_flush(response);
+}
+
+/**
+ * @brief Initialize a response builder
+ */
+void lx200_response_init(lx200_response_t *response, lx200_response_flush_t flush,
+			 void *user_data)
+{
+	if (response == NULL || flush == NULL) {
+		LOG_ERR("lx200_response_init: Invalid parameters (response=%p, flush=%p)",
+			response, flush);
+		return;
+	}
+
+	memset(response, 0, sizeof(*response));
+	response->flush = flush;
+	response->user_data = user_data;
+}
+
+/**
+ * @brief Append one reply made of several fragments
+ */
+int lx200_response_appendv(lx200_response_t *response,
+			   const lx200_response_fragment_t *fragments, size_t count)
+{
+	if (response == NULL || (fragments == NULL && count > 0)) {
+		LOG_ERR("lx200_response_appendv: Invalid parameters (response=%p, fragments=%p)",
+			response, fragments);
+		return -EINVAL;
+	}
+
+	size_t total = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		total += fragments[i].length;
+	}
+
+	if (total == 0) {
+		return 0;
+	}
+
+	int ret = make_room(response, total);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	response->stats.replies++;
+
+	for (size_t i = 0; i < count; i++) {
+		const char *data = fragments[i].data;
+		size_t length = fragments[i].length;
+
+		/* Only a reply larger than the whole buffer takes this path */
+		while (length > 0) {
+			size_t chunk = MIN(length, sizeof(response->buffer) - response->length);
+
+			memcpy(&response->buffer[response->length], data, chunk);
+			response->length += chunk;
+			data += chunk;
+			length -= chunk;
+
+			if (response->length == sizeof(response->buffer) && length > 0) {
+				ret = lx200_response_flush(response);
+				if (ret < 0) {
+					return ret;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Append one reply
+ */
+int lx200_response_append(lx200_response_t *response, const char *data, size_t length)
+{
+	const lx200_response_fragment_t fragment = {
+		.data = data,
+		.length = length,
+	};
+
+	if (data == NULL && length > 0) {
+		LOG_ERR("lx200_response_append: NULL data pointer");
+		return -EINVAL;
+	}
+
+	return lx200_response_appendv(response, &fragment, 1);
+}
+
+/**
+ * @brief Append a NUL terminated reply
+ */
+int lx200_response_append_str(lx200_response_t *response, const char *str)
+{
+	if (str == NULL) {
+		LOG_ERR("lx200_response_append_str: NULL string pointer");
+		return -EINVAL;
+	}
+
+	return lx200_response_append(response, str, strlen(str));
+}
+
+/**
+ * @brief Reserve space to format a reply in place
+ */
+char *lx200_response_reserve(lx200_response_t *response, size_t length)
+{
+	if (response == NULL || length > sizeof(response->buffer)) {
+		LOG_ERR("lx200_response_reserve: Invalid parameters (response=%p, length=%zu)",
+			response, length);
+		return NULL;
+	}
+
+	if (make_room(response, length) < 0) {
+		return NULL;
+	}
+
+	return &response->buffer[response->length];
+}
+
+/**
+ * @brief Commit a reply formatted with lx200_response_reserve()
+ */
+void lx200_response_commit(lx200_response_t *response, size_t length)
+{
+	if (response == NULL || response->length + length > sizeof(response->buffer)) {
+		LOG_ERR("lx200_response_commit: Invalid parameters (response=%p, length=%zu)",
+			response, length);
+		return;
+	}
+
+	if (length > 0) {
+		response->length += length;
+		response->stats.replies++;
+	}
+}
+
+/**
+ * @brief Transmit all buffered replies
+ */
+int lx200_response_flush(lx200_response_t *response)
+{
+	if (response == NULL) {
+		LOG_ERR("lx200_response_flush: NULL response pointer");
+		return -EINVAL;
+	}
+
+	if (response->length == 0) {
+		return 0;
+	}
+
+	size_t length = response->length;
+
+	response->length = 0;
+	return transmit(response, response->buffer, length);
+}
+
+/**
+ * @brief Get the number of buffered bytes
+ */
+size_t lx200_response_pending(const lx200_response_t *response)
+{
+	if (response == NULL) {
+		return 0;
+	}
+
+	return response->length;
+}
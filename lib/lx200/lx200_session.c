@@ -0,0 +1,131 @@
+/**
+ * @file lx200_session.c
+ * @brief Per-client LX200 session state implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <lx200/lx200_session.h>
+#include <errno.h>
+#include <string.h>
+#include <zephyr/logging/log.h>
+
+#include "lx200_log.h"
+
+LOG_MODULE_DECLARE(lx200, CONFIG_LX200_LOG_LEVEL);
+
+/**
+ * @brief Initialize a session
+ */
+void lx200_session_init(lx200_session_t *session, uint8_t index, lx200_response_flush_t flush,
+			void *user_data)
+{
+	if (session == NULL || flush == NULL) {
+		LOG_ERR("lx200_session_init: Invalid parameters (session=%p, flush=%p)", session,
+			flush);
+		return;
+	}
+
+	memset(session, 0, sizeof(*session));
+	lx200_framer_init(&session->framer);
+	lx200_response_init(&session->response, flush, user_data);
+	session->precision = LX200_COORD_HIGH_PRECISION;
+	session->index = index;
+}
+
+/**
+ * @brief Feed bytes received from the client
+ */
+size_t lx200_session_receive(lx200_session_t *session, const char *data, size_t length)
+{
+	if (session == NULL) {
+		return 0;
+	}
+
+	return lx200_framer_feed(&session->framer, data, length);
+}
+
+/**
+ * @brief Take the next command of a session
+ */
+bool lx200_session_next(lx200_session_t *session, lx200_frame_t *frame,
+			lx200_command_view_t *view)
+{
+	if (session == NULL || frame == NULL || view == NULL) {
+		LOG_ERR("lx200_session_next: Invalid parameters (session=%p, frame=%p, view=%p)",
+			session, frame, view);
+		return false;
+	}
+
+	while (lx200_framer_peek(&session->framer, frame)) {
+		lx200_parse_result_t result = lx200_parse_frame(frame->data, frame->length, view);
+
+		if (result == LX200_PARSE_OK) {
+			session->stats.commands++;
+			return true;
+		}
+
+		LX200_ERR_RATELIMIT("Session %u: dropping '%.*s' (%s)", session->index,
+				    (int)frame->length, frame->data,
+				    lx200_parse_result_to_string(result));
+		session->stats.errors++;
+		lx200_framer_release(&session->framer);
+	}
+
+	return false;
+}
+
+/**
+ * @brief Release the command returned by lx200_session_next()
+ */
+void lx200_session_complete(lx200_session_t *session)
+{
+	if (session == NULL) {
+		return;
+	}
+
+	lx200_framer_release(&session->framer);
+}
+
+/**
+ * @brief Transmit the replies collected for a session
+ */
+int lx200_session_flush(lx200_session_t *session)
+{
+	if (session == NULL) {
+		return -EINVAL;
+	}
+
+	return lx200_response_flush(&session->response);
+}
+
+/**
+ * @brief Set the precision mode of a session
+ */
+void lx200_session_set_precision(lx200_session_t *session, lx200_precision_t precision)
+{
+	if (session == NULL) {
+		LOG_ERR("lx200_session_set_precision: NULL session pointer");
+		return;
+	}
+
+	LX200_TRACE_INF("Session %u: precision mode %d", session->index, precision);
+	session->precision = precision;
+}
+
+/**
+ * @brief Switch a session between low and high precision
+ */
+lx200_precision_t lx200_session_toggle_precision(lx200_session_t *session)
+{
+	if (session == NULL) {
+		LOG_ERR("lx200_session_toggle_precision: NULL session pointer");
+		return LX200_COORD_HIGH_PRECISION;
+	}
+
+	lx200_session_set_precision(session, session->precision == LX200_COORD_HIGH_PRECISION
+						      ? LX200_COORD_LOW_PRECISION
+						      : LX200_COORD_HIGH_PRECISION);
+	return session->precision;
+}
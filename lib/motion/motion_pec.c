@@ -0,0 +1,181 @@
+/**
+ * @file motion_pec.c
+ * @brief Periodic error correction implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <motion/motion_pec.h>
+#include <motion/motion_stop.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(motion, CONFIG_MOTION_LOG_LEVEL);
+
+/* ============================================================================
+ * INTERNAL HELPERS
+ * ============================================================================ */
+
+/**
+ * @brief Position of the axis within the worm turn
+ * @return Steps from the start of the turn, less than worm_steps
+ */
+static uint32_t worm_position(const motion_pec_t *pec, int32_t position)
+{
+	int64_t wrapped = (int64_t)position % pec->worm_steps;
+
+	if (wrapped < 0) {
+		wrapped += pec->worm_steps;
+	}
+
+	return (uint32_t)wrapped;
+}
+
+/**
+ * @brief Turn the recorded corrections into the table of rate corrections
+ */
+static void build_table(motion_pec_t *pec)
+{
+	int64_t sum = 0;
+
+	for (int i = 0; i < MOTION_PEC_SEGMENTS; i++) {
+		sum += pec->record[i];
+	}
+
+	const int64_t mean = sum / MOTION_PEC_SEGMENTS;
+	/* Thousandths of a step over a segment to a Q15 fraction of the step rate */
+	const int64_t scale = 1000LL * pec->worm_steps;
+
+	for (int i = 0; i < MOTION_PEC_SEGMENTS; i++) {
+		const int previous = i > 0 ? i - 1 : MOTION_PEC_SEGMENTS - 1;
+		/* Read at the segment start, between the centers of two recorded segments */
+		const int64_t millisteps = (pec->record[previous] + pec->record[i] - 2 * mean) / 2;
+		const int64_t rate = millisteps * MOTION_PEC_ONE * MOTION_PEC_SEGMENTS / scale;
+
+		pec->table[i] = (int16_t)CLAMP(rate, -MOTION_PEC_MAX_RATE, MOTION_PEC_MAX_RATE);
+	}
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Initialize the correction of an axis, nothing recorded
+ */
+int motion_pec_init(motion_pec_t *pec, uint32_t axis, uint32_t worm_steps)
+{
+	if (pec == NULL || axis == 0 || (axis & (axis - 1)) != 0 ||
+	    (axis & ~MOTION_AXIS_ALL) != 0 || worm_steps < MOTION_PEC_SEGMENTS ||
+	    worm_steps > INT32_MAX / MOTION_PEC_SEGMENTS) {
+		LOG_ERR("motion_pec_init: Invalid parameters (pec=%p, axis=%u, worm_steps=%u)", pec,
+			axis, worm_steps);
+		return -EINVAL;
+	}
+
+	memset(pec, 0, sizeof(*pec));
+	pec->axis = axis;
+	pec->worm_steps = worm_steps;
+	pec->gain = (uint32_t)(BIT64(32) / worm_steps);
+
+	return 0;
+}
+
+/**
+ * @brief Start recording a worm turn, playback stops
+ */
+int motion_pec_record_start(motion_pec_t *pec, int32_t position)
+{
+	if (pec == NULL) {
+		LOG_ERR("motion_pec_record_start: NULL pec pointer");
+		return -EINVAL;
+	}
+
+	/* Corrections recorded during playback would include the playback */
+	pec->playing = false;
+	memset(pec->record, 0, sizeof(pec->record));
+	pec->record_start = position;
+	pec->recording = true;
+
+	return 0;
+}
+
+/**
+ * @brief Record a guide correction at the current worm phase
+ */
+int motion_pec_record(motion_pec_t *pec, int32_t position, int32_t millisteps)
+{
+	if (pec == NULL) {
+		LOG_ERR("motion_pec_record: NULL pec pointer");
+		return -EINVAL;
+	}
+
+	if (!pec->recording) {
+		return -ENOENT;
+	}
+
+	const uint32_t segment =
+		(uint64_t)worm_position(pec, position) * MOTION_PEC_SEGMENTS / pec->worm_steps;
+	const int64_t moved = (int64_t)position - pec->record_start;
+
+	pec->record[segment] += millisteps;
+
+	if (moved < pec->worm_steps && -moved < pec->worm_steps) {
+		return 0;
+	}
+
+	build_table(pec);
+	pec->recording = false;
+	pec->recorded = true;
+
+	return 1;
+}
+
+/**
+ * @brief Drop a running recording, the table is kept
+ */
+void motion_pec_record_cancel(motion_pec_t *pec)
+{
+	if (pec == NULL) {
+		return;
+	}
+
+	pec->recording = false;
+}
+
+/**
+ * @brief Start or stop playback
+ */
+int motion_pec_play(motion_pec_t *pec, bool on)
+{
+	if (pec == NULL) {
+		LOG_ERR("motion_pec_play: NULL pec pointer");
+		return -EINVAL;
+	}
+
+	if (on && !pec->recorded) {
+		return -ENOENT;
+	}
+
+	/* The table is complete before the step engine reads it */
+	compiler_barrier();
+	pec->playing = on;
+
+	return 0;
+}
+
+/**
+ * @brief Set the worm phase from the position, while the step engine is idle
+ */
+void motion_pec_sync(motion_pec_t *pec, int32_t position)
+{
+	const uint64_t scaled = (uint64_t)worm_position(pec, position) * MOTION_PEC_SEGMENTS;
+
+	pec->segment = (uint32_t)(scaled / pec->worm_steps);
+	pec->phase = (int32_t)(scaled % pec->worm_steps);
+	pec->carry = 0;
+}
@@ -0,0 +1,229 @@
+/**
+ * @file motion_ramp.c
+ * @brief Acceleration ramp planning
+ *
+ * The ramp is a velocity curve over time in up to three phases: jerk up to
+ * the peak acceleration, constant acceleration, jerk down to the cruise
+ * rate. A trapezoidal ramp only has the middle phase. The time of every
+ * step is found by solving position(t) = step on the piecewise polynomial
+ * and rounded to counter ticks once, so rounding never accumulates over
+ * the table.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <motion/motion_ramp.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(motion, CONFIG_MOTION_LOG_LEVEL);
+
+/** Steps a solved step time may be off, far below a counter tick at any rate */
+#define POSITION_TOLERANCE 1e-7
+/** Iterations of the step time solver */
+#define SOLVER_ITERATIONS 64
+
+/* ============================================================================
+ * VELOCITY CURVE
+ * ============================================================================ */
+
+/**
+ * @brief Phases of a ramp, rates in steps per second
+ */
+struct curve {
+	/** Start rate */
+	double v0;
+	/** Cruise rate */
+	double vc;
+	/** Jerk, 0 for a trapezoidal ramp */
+	double jerk;
+	/** Peak acceleration */
+	double accel;
+	/** End of the jerk up, constant acceleration and jerk down phases */
+	double t1, t2, t3;
+	/** Rate at the end of the first two phases */
+	double v1, v2;
+	/** Position at the end of each phase */
+	double p1, p2, p3;
+};
+
+/**
+ * @brief Lay out the phases of a ramp
+ * @return 0 on success, -EINVAL on invalid parameters
+ */
+static int curve_init(struct curve *c, const motion_ramp_profile_t *profile)
+{
+	if (profile == NULL || profile->cruise_mhz == 0 || profile->accel == 0) {
+		return -EINVAL;
+	}
+
+	c->vc = profile->cruise_mhz / 1000.0;
+	c->v0 = MIN(profile->start_mhz, profile->cruise_mhz) / 1000.0;
+	c->jerk = profile->jerk;
+	c->accel = profile->accel;
+
+	const double dv = c->vc - c->v0;
+
+	if (profile->jerk == 0) {
+		c->t1 = 0;
+	} else {
+		/* Short ramps turn around before reaching the peak acceleration */
+		if (c->accel * c->accel / c->jerk > dv) {
+			c->accel = sqrt(dv * c->jerk);
+		}
+		c->t1 = c->accel > 0 ? c->accel / c->jerk : 0;
+	}
+
+	const double t12 = c->accel > 0 ? dv / c->accel - c->t1 : 0;
+
+	c->t2 = c->t1 + t12;
+	c->t3 = c->t2 + c->t1;
+
+	c->v1 = c->v0 + c->jerk * c->t1 * c->t1 / 2;
+	c->p1 = c->v0 * c->t1 + c->jerk * c->t1 * c->t1 * c->t1 / 6;
+	c->v2 = c->v1 + c->accel * t12;
+	c->p2 = c->p1 + c->v1 * t12 + c->accel * t12 * t12 / 2;
+	c->p3 = c->p2 + c->v2 * c->t1 + c->accel * c->t1 * c->t1 / 2 -
+		c->jerk * c->t1 * c->t1 * c->t1 / 6;
+
+	return 0;
+}
+
+/**
+ * @brief Position and rate at a time on the ramp
+ */
+static double curve_position(const struct curve *c, double t, double *rate)
+{
+	if (t < c->t1) {
+		*rate = c->v0 + c->jerk * t * t / 2;
+		return c->v0 * t + c->jerk * t * t * t / 6;
+	}
+
+	if (t < c->t2) {
+		const double dt = t - c->t1;
+
+		*rate = c->v1 + c->accel * dt;
+		return c->p1 + c->v1 * dt + c->accel * dt * dt / 2;
+	}
+
+	if (t < c->t3) {
+		const double dt = t - c->t2;
+
+		*rate = c->v2 + c->accel * dt - c->jerk * dt * dt / 2;
+		return c->p2 + c->v2 * dt + c->accel * dt * dt / 2 - c->jerk * dt * dt * dt / 6;
+	}
+
+	*rate = c->vc;
+	return c->p3 + c->vc * (t - c->t3);
+}
+
+/**
+ * @brief Find the time the ramp reaches a position
+ *
+ * Newton iterations kept inside a bracket, falling back to bisection where
+ * the rate is 0 at the start from rest.
+ *
+ * @param previous Time of the previous step, the position is past it
+ */
+static double curve_time_at(const struct curve *c, double position, double previous)
+{
+	double rate;
+	double lo = previous;
+	double hi;
+
+	curve_position(c, previous, &rate);
+
+	/* The rate never drops, so one step at the current rate is far enough */
+	hi = rate > 0 ? previous + 1.0 / rate : previous + 1e-3;
+	while (curve_position(c, hi, &rate) < position) {
+		lo = hi;
+		hi = previous + 2 * (hi - previous);
+	}
+
+	double t = hi;
+
+	for (int i = 0; i < SOLVER_ITERATIONS; i++) {
+		const double error = curve_position(c, t, &rate) - position;
+
+		if (fabs(error) < POSITION_TOLERANCE) {
+			break;
+		}
+
+		if (error > 0) {
+			hi = t;
+		} else {
+			lo = t;
+		}
+
+		t = rate > 0 ? t - error / rate : lo;
+		if (t <= lo || t >= hi) {
+			t = (lo + hi) / 2;
+		}
+	}
+
+	return t;
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Plan a ramp
+ */
+int motion_ramp_build(const motion_ramp_profile_t *profile, uint32_t frequency,
+		      uint32_t *intervals, uint32_t capacity)
+{
+	struct curve curve;
+
+	if (frequency == 0 || intervals == NULL || capacity == 0 ||
+	    curve_init(&curve, profile) < 0) {
+		LOG_ERR("motion_ramp_build: Invalid parameters (profile=%p, intervals=%p)",
+			profile, intervals);
+		return -EINVAL;
+	}
+
+	const uint32_t cruise = MAX((uint32_t)llround(frequency / curve.vc), 2U);
+	uint64_t previous_tick = 0;
+	double t = 0;
+	uint32_t count = 0;
+
+	for (uint32_t step = 1;; step++) {
+		t = curve_time_at(&curve, step, t);
+		if (t >= curve.t3) {
+			/* This step is already at the cruise rate */
+			break;
+		}
+
+		const uint64_t tick = (uint64_t)llround(t * frequency);
+		const uint64_t interval = tick - previous_tick;
+
+		if (count + 1 >= capacity) {
+			return -ENOSPC;
+		}
+
+		previous_tick = tick;
+		intervals[count++] = (uint32_t)CLAMP(interval, cruise, UINT32_MAX);
+	}
+
+	intervals[count++] = cruise;
+
+	return (int)count;
+}
+
+/**
+ * @brief Get the number of steps a ramp takes
+ */
+uint32_t motion_ramp_steps(const motion_ramp_profile_t *profile)
+{
+	struct curve curve;
+
+	if (curve_init(&curve, profile) < 0) {
+		return 0;
+	}
+
+	return (uint32_t)floor(curve.p3) + 1;
+}
@@ -0,0 +1,641 @@
+/**
+ * @file motion_step.c
+ * @brief Step pulse generation implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <motion/motion_step.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(motion, CONFIG_MOTION_LOG_LEVEL);
+
+/* ============================================================================
+ * INTERNAL HELPERS
+ * ============================================================================ */
+
+/**
+ * @brief Arm the alarm for the pending edge
+ */
+static inline void schedule_edge(motion_step_t *step)
+{
+	const motion_step_hw_t *hw = step->hw;
+
+	if (hw->api->set_alarm(hw->user_data, step->edge_at) == -ETIME) {
+		step->late++;
+	}
+}
+
+/**
+ * @brief Take the held interval, advancing the phase of its fraction
+ */
+static inline uint32_t held_interval(motion_step_t *step)
+{
+	uint32_t interval = step->hold;
+
+	if (step->hold_modulus != 0) {
+		step->phase += step->hold_frac;
+		if (step->phase >= step->hold_modulus) {
+			step->phase -= step->hold_modulus;
+			interval++;
+		}
+	}
+
+#if defined(CONFIG_MOTION_PEC)
+	/* 0 ends the move, it is never corrected */
+	if (step->pec_lead && interval != 0 && motion_pec_playing(step->pec)) {
+		interval = motion_pec_interval(step->pec, interval);
+	}
+#endif
+
+	return interval;
+}
+
+/**
+ * @brief Take the interval before the next step from the move
+ * @return Interval in counter ticks, 0 if the move ends with the current step
+ */
+static inline uint32_t next_interval(motion_step_t *step)
+{
+	const uint32_t k = step->index;
+
+	if (step->length == 0) {
+		if (k < step->count) {
+			step->index++;
+			return step->intervals[k];
+		}
+	} else if (k < step->length) {
+		/* Up the ramp, cruise on its last interval, down the ramp */
+		step->index++;
+		return step->intervals[MIN(MIN(k, step->length - 1 - k), step->count - 1)];
+	}
+
+	/* Marks the move as arrived, see motion_step_arrived() */
+	step->index = MAX(step->length, step->count) + 1;
+	return held_interval(step);
+}
+
+/**
+ * @brief Shorten a ramped move so it runs down the ramp from the current rate
+ * @return true if the move decelerates, false if it has no ramp to run down
+ */
+static bool ramp_down(motion_step_t *step)
+{
+	if (step->length == 0 || step->index > step->length) {
+		return false;
+	}
+
+	/*
+	 * The interval before the current step k was read at ramp position i,
+	 * shorten the move so the steps after it read the ramp back down from i.
+	 */
+	const uint32_t k = step->index - 1;
+	const uint32_t i = MIN(MIN(k, step->length - 1 - k), step->count - 1);
+
+	step->length = step->index + i;
+	step->hold = 0;
+	step->hold_modulus = 0;
+
+	return true;
+}
+
+/**
+ * @brief Handle a stop request before a step
+ * @return true if the step is still issued while decelerating
+ */
+static bool stop_requested(motion_step_t *step)
+{
+	if (step->stopping) {
+		return true;
+	}
+
+	if (!ramp_down(step)) {
+		/* No ramp to run down, stop at once */
+		step->running = false;
+		return false;
+	}
+
+	step->stopping = true;
+	return true;
+}
+
+/**
+ * @brief Run the DDA for a step of the lead axis
+ * @return MOTION_AXIS_* bits of the axes stepping
+ */
+static inline uint32_t step_axes(motion_step_t *step)
+{
+	/* The follower only steps along with the ramped steps, not the hold */
+	if (step->follow_steps == 0 || step->index > step->length) {
+		return step->lead;
+	}
+
+	step->error += step->follow_steps;
+	if (step->error < step->dda_steps) {
+		return step->lead;
+	}
+
+	step->error -= step->dda_steps;
+	step->position[find_lsb_set(step->follow) - 1] += step->follow_direction;
+
+	return step->lead | step->follow;
+}
+
+/**
+ * @brief Compute a * b / c without overflow, for a < c < 2^63
+ *
+ * Shift and subtract, so it needs no 128 bit arithmetic on 32 bit cores.
+ */
+static uint64_t mul_div(uint64_t a, uint64_t b, uint64_t c)
+{
+	uint64_t quotient = 0;
+	uint64_t remainder = 0;
+
+	for (int bit = 63; bit >= 0; bit--) {
+		quotient <<= 1;
+		remainder <<= 1;
+		if (remainder >= c) {
+			remainder -= c;
+			quotient++;
+		}
+		if ((b >> bit) & 1) {
+			remainder += a;
+			if (remainder >= c) {
+				remainder -= c;
+				quotient++;
+			}
+		}
+	}
+
+	return quotient;
+}
+
+/**
+ * @brief Convert counter ticks to nanoseconds
+ */
+static uint32_t ticks_to_ns(const motion_step_t *step, uint32_t ticks)
+{
+	return (uint32_t)MIN((uint64_t)ticks * NSEC_PER_SEC / step->hw->frequency, UINT32_MAX);
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Initialize a step engine, no move is running
+ */
+int motion_step_init(motion_step_t *step, const motion_step_hw_t *hw, motion_stop_t *stop,
+		     uint32_t axes, uint32_t pulse_ns)
+{
+	if (step == NULL || hw == NULL || hw->api == NULL || hw->frequency == 0 || axes == 0 ||
+	    (axes & ~MOTION_AXIS_ALL) != 0) {
+		LOG_ERR("motion_step_init: Invalid parameters (step=%p, hw=%p)", step, hw);
+		return -EINVAL;
+	}
+
+	memset(step, 0, sizeof(*step));
+	step->hw = hw;
+	step->stop = stop;
+	step->axes = axes;
+	step->pulse = MAX(DIV_ROUND_UP((uint64_t)pulse_ns * hw->frequency, NSEC_PER_SEC), 1);
+	step->min_latency = UINT32_MAX;
+
+	hw->api->set_step(hw->user_data, axes, false);
+
+	return 0;
+}
+
+/**
+ * @brief Start a move
+ */
+int motion_step_start(motion_step_t *step, const motion_step_move_t *move)
+{
+	if (step == NULL || move == NULL || (move->count > 0 && move->intervals == NULL)) {
+		LOG_ERR("motion_step_start: Invalid parameters (step=%p, move=%p)", step, move);
+		return -EINVAL;
+	}
+
+	if ((move->count == 0 && (move->hold == 0 || move->steps > 0)) || move->hold == 1) {
+		return -EINVAL;
+	}
+
+	if (move->hold_modulus != 0 &&
+	    (move->hold_frac >= move->hold_modulus || move->hold_modulus > INT64_MAX)) {
+		return -EINVAL;
+	}
+
+	for (uint32_t i = 0; i < move->count; i++) {
+		if (move->intervals[i] < 2) {
+			return -EINVAL;
+		}
+	}
+
+	/* The lowest axis bit of the engine unless the move names one */
+	const uint32_t lead = move->axis != 0 ? move->axis : step->axes & -step->axes;
+	const uint32_t follow = step->axes & ~lead;
+
+	if ((lead & step->axes) != lead || (lead & (lead - 1)) != 0) {
+		return -EINVAL;
+	}
+
+	if (move->follow_steps > 0 && (follow == 0 || move->follow_steps > move->steps)) {
+		return -EINVAL;
+	}
+
+	const motion_step_hw_t *hw = step->hw;
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+
+	if (step->running) {
+		k_spin_unlock(&step->lock, key);
+		return -EBUSY;
+	}
+
+	hw->api->set_dir(hw->user_data, lead, move->forward);
+	if (move->follow_steps > 0) {
+		hw->api->set_dir(hw->user_data, follow, move->follow_forward);
+	}
+
+	step->intervals = move->intervals;
+	step->count = move->count;
+	step->index = 0;
+	step->length = move->steps;
+	step->hold = move->hold;
+	step->hold_frac = move->hold_frac;
+	step->hold_modulus = move->hold != 0 ? move->hold_modulus : 0;
+	step->phase = 0;
+	step->direction = move->forward ? 1 : -1;
+	step->lead = lead;
+	step->follow = move->follow_steps > 0 ? follow : 0;
+	step->follow_steps = move->follow_steps;
+	step->dda_steps = move->steps;
+	/* Centers the follower steps between the lead steps */
+	step->error = move->steps / 2;
+	step->follow_direction = move->follow_forward ? 1 : -1;
+	step->high = false;
+	step->stepping = 0;
+	step->last = false;
+	step->stopping = false;
+	step->move_steps = 0;
+	step->move_ticks = 0;
+#if defined(CONFIG_MOTION_PEC)
+	step->pec_lead = step->pec != NULL && step->pec->axis == lead;
+	if (step->pec_lead) {
+		motion_pec_sync(step->pec, step->position[find_lsb_set(lead) - 1]);
+	}
+#endif
+
+	/* The direction pin settles during the first interval */
+	step->edge_at = hw->api->now(hw->user_data) + next_interval(step);
+	step->step_at = step->edge_at;
+	step->running = true;
+	schedule_edge(step);
+
+	k_spin_unlock(&step->lock, key);
+
+	return 0;
+}
+
+/**
+ * @brief Stop immediately, ISR safe
+ */
+void motion_step_stop(motion_step_t *step)
+{
+	if (step == NULL) {
+		return;
+	}
+
+	const motion_step_hw_t *hw = step->hw;
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+
+	if (step->running) {
+		hw->api->cancel_alarm(hw->user_data);
+		hw->api->set_step(hw->user_data, step->axes, false);
+		step->high = false;
+		step->stepping = 0;
+		step->stopping = false;
+		step->running = false;
+	}
+
+	k_spin_unlock(&step->lock, key);
+}
+
+/**
+ * @brief Decelerate to a stop, ISR safe
+ */
+void motion_step_decelerate(motion_step_t *step)
+{
+	if (step == NULL) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+	const bool ramped = step->running && ramp_down(step);
+
+	k_spin_unlock(&step->lock, key);
+
+	if (!ramped) {
+		motion_step_stop(step);
+	}
+}
+
+/**
+ * @brief Change the interval held by the running move, ISR safe
+ */
+int motion_step_set_hold(motion_step_t *step, const motion_step_period_t *period)
+{
+	if (step == NULL || period == NULL) {
+		LOG_ERR("motion_step_set_hold: Invalid parameters (step=%p, period=%p)", step,
+			period);
+		return -EINVAL;
+	}
+
+	if (period->ticks < 2 || (period->modulus != 0 && (period->frac >= period->modulus ||
+							    period->modulus > INT64_MAX))) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+	int ret = 0;
+
+	if (!step->running || step->hold == 0) {
+		ret = -ENOENT;
+	} else {
+		/* Keep the fraction of a tick accumulated so far */
+		if (period->modulus == 0 || step->hold_modulus == 0) {
+			step->phase = 0;
+		} else if (period->modulus != step->hold_modulus) {
+			step->phase = mul_div(step->phase, period->modulus, step->hold_modulus);
+		}
+
+		step->hold = period->ticks;
+		step->hold_frac = period->frac;
+		step->hold_modulus = period->modulus;
+	}
+
+	k_spin_unlock(&step->lock, key);
+
+	return ret;
+}
+
+/**
+ * @brief Run the pending edge, called from the alarm ISR
+ */
+void motion_step_isr(motion_step_t *step)
+{
+	const motion_step_hw_t *hw = step->hw;
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+
+	if (!step->running) {
+		/* The alarm fired while the move was being stopped */
+		k_spin_unlock(&step->lock, key);
+		return;
+	}
+
+	const uint32_t latency = hw->api->now(hw->user_data) - step->edge_at;
+
+	step->min_latency = MIN(step->min_latency, latency);
+	step->max_latency = MAX(step->max_latency, latency);
+
+	if (step->high) {
+		hw->api->set_step(hw->user_data, step->stepping, false);
+		step->high = false;
+		step->stepping = 0;
+
+		if (!step->last) {
+			step->edge_at = step->step_at;
+			schedule_edge(step);
+		} else if (step->stopping) {
+			step->running = false;
+			k_spin_unlock(&step->lock, key);
+			motion_stop_complete(step->stop, step->axes);
+			return;
+		} else {
+			step->running = false;
+		}
+
+		k_spin_unlock(&step->lock, key);
+		return;
+	}
+
+	/* A stop of an axis standing still leaves the tracking of the other one alone */
+	if (step->stop != NULL &&
+	    (motion_stop_pending(step->stop) & motion_step_moving_axes(step)) != 0 &&
+	    !stop_requested(step)) {
+		k_spin_unlock(&step->lock, key);
+		motion_stop_complete(step->stop, step->axes);
+		return;
+	}
+
+	step->stepping = step_axes(step);
+	hw->api->set_step(hw->user_data, step->stepping, true);
+	step->high = true;
+	step->position[find_lsb_set(step->lead) - 1] += step->direction;
+	step->steps++;
+#if defined(CONFIG_MOTION_PEC)
+	if (step->pec_lead) {
+		motion_pec_step(step->pec, step->direction);
+	}
+#endif
+
+	if (step->move_steps++ > 0) {
+		step->move_ticks += step->edge_at - step->last_step_at;
+	}
+	step->last_step_at = step->edge_at;
+
+	uint32_t interval = next_interval(step);
+
+	if (interval == 0) {
+		/* Only the falling edge is left */
+		step->last = true;
+		interval = 2 * step->pulse;
+	}
+
+	step->step_at = step->edge_at + interval;
+	step->edge_at += MIN(step->pulse, interval / 2);
+	schedule_edge(step);
+
+	k_spin_unlock(&step->lock, key);
+}
+
+/**
+ * @brief Set the position while no move is running
+ */
+int motion_step_set_position(motion_step_t *step, uint32_t axis, int32_t position)
+{
+	if (step == NULL) {
+		LOG_ERR("motion_step_set_position: NULL step pointer");
+		return -EINVAL;
+	}
+
+	if ((axis & step->axes) == 0) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+	int ret = 0;
+
+	if (step->running) {
+		ret = -EBUSY;
+	} else {
+		step->position[find_lsb_set(axis) - 1] = position;
+	}
+
+	k_spin_unlock(&step->lock, key);
+
+	return ret;
+}
+
+#if defined(CONFIG_MOTION_PEC)
+/**
+ * @brief Attach the periodic error correction of an axis while no move is running
+ */
+int motion_step_set_pec(motion_step_t *step, motion_pec_t *pec)
+{
+	if (step == NULL) {
+		LOG_ERR("motion_step_set_pec: NULL step pointer");
+		return -EINVAL;
+	}
+
+	if (pec != NULL && (pec->axis & step->axes) == 0) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+	int ret = 0;
+
+	if (step->running) {
+		ret = -EBUSY;
+	} else {
+		step->pec = pec;
+	}
+
+	k_spin_unlock(&step->lock, key);
+
+	return ret;
+}
+#endif
+
+/**
+ * @brief Convert a step rate to a step interval
+ */
+uint32_t motion_step_interval(const motion_step_t *step, uint32_t rate_mhz)
+{
+	if (step == NULL || rate_mhz == 0) {
+		return 0;
+	}
+
+	const uint64_t ticks = ((uint64_t)step->hw->frequency * MSEC_PER_SEC + rate_mhz / 2) /
+			       rate_mhz;
+
+	return (uint32_t)MIN(ticks, UINT32_MAX);
+}
+
+/**
+ * @brief Get the duration of a move
+ */
+uint64_t motion_step_move_ticks(const motion_step_move_t *move)
+{
+	if (move == NULL || (move->count > 0 && move->intervals == NULL)) {
+		return 0;
+	}
+
+	uint64_t ticks = 0;
+
+	if (move->steps == 0) {
+		for (uint32_t i = 0; i < move->count; i++) {
+			ticks += move->intervals[i];
+		}
+		return ticks;
+	}
+
+	if (move->count == 0) {
+		return 0;
+	}
+
+	/*
+	 * Ramp entry i is read before step i going up and before step
+	 * steps - 1 - i going down, once where the two meet. The steps left
+	 * read the cruise interval.
+	 */
+	const uint32_t length = move->steps;
+	uint32_t ramped = 0;
+
+	for (uint32_t i = 0; i < move->count - 1 && 2 * (uint64_t)i + 1 <= length; i++) {
+		const uint32_t reads = 2 * (uint64_t)i + 1 < length ? 2 : 1;
+
+		ticks += (uint64_t)reads * move->intervals[i];
+		ramped += reads;
+	}
+
+	return ticks + (uint64_t)(length - ramped) * move->intervals[move->count - 1];
+}
+
+/**
+ * @brief Get the step engine statistics
+ */
+void motion_step_get_stats(motion_step_t *step, motion_step_stats_t *stats)
+{
+	if (step == NULL || stats == NULL) {
+		LOG_ERR("motion_step_get_stats: Invalid parameters (step=%p, stats=%p)", step,
+			stats);
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+	const uint32_t min_latency = step->min_latency;
+	const uint32_t max_latency = step->max_latency;
+	uint64_t intervals = step->move_steps > 0 ? step->move_steps - 1 : 0;
+	uint64_t ticks = step->move_ticks;
+
+	stats->steps = step->steps;
+	stats->late = step->late;
+	k_spin_unlock(&step->lock, key);
+
+	const uint64_t scale = (uint64_t)step->hw->frequency * MSEC_PER_SEC;
+
+	/* Keep intervals * scale within 64 bits, only drops precision after days of steps */
+	while (intervals > UINT64_MAX / scale) {
+		intervals >>= 1;
+		ticks >>= 1;
+	}
+
+	stats->rate_mhz = ticks > 0 ? (uint32_t)MIN(intervals * scale / ticks, UINT32_MAX) : 0;
+
+	if (min_latency > max_latency) {
+		/* No edge yet */
+		stats->min_latency_ns = 0;
+		stats->max_latency_ns = 0;
+	} else {
+		stats->min_latency_ns = ticks_to_ns(step, min_latency);
+		stats->max_latency_ns = ticks_to_ns(step, max_latency);
+	}
+	stats->jitter_ns = stats->max_latency_ns - stats->min_latency_ns;
+}
+
+/**
+ * @brief Reset the step engine statistics, the position is kept
+ */
+void motion_step_reset_stats(motion_step_t *step)
+{
+	if (step == NULL) {
+		LOG_ERR("motion_step_reset_stats: NULL step pointer");
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&step->lock);
+
+	step->steps = 0;
+	step->late = 0;
+	step->move_steps = 0;
+	step->move_ticks = 0;
+	step->min_latency = UINT32_MAX;
+	step->max_latency = 0;
+
+	k_spin_unlock(&step->lock, key);
+}
@@ -0,0 +1,231 @@
+/**
+ * @file motion_step_counter.c
+ * @brief Counter device backend of the step engine
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <motion/motion_step_counter.h>
+#include <string.h>
+#include <zephyr/drivers/counter.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(motion, CONFIG_MOTION_LOG_LEVEL);
+
+/* ============================================================================
+ * BACKEND
+ * ============================================================================ */
+
+static void alarm_handler(const struct device *dev, uint8_t chan_id, uint32_t ticks,
+			  void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(chan_id);
+	ARG_UNUSED(ticks);
+
+	motion_step_counter_t *backend = user_data;
+
+	motion_step_isr(backend->engine);
+}
+
+static uint32_t counter_now(void *user_data)
+{
+	const motion_step_counter_t *backend = user_data;
+	uint32_t ticks = 0;
+
+	(void)counter_get_value(backend->counter, &ticks);
+
+	return ticks;
+}
+
+static int counter_alarm(void *user_data, uint32_t ticks)
+{
+	motion_step_counter_t *backend = user_data;
+	const struct counter_alarm_cfg cfg = {
+		.callback = alarm_handler,
+		.ticks = ticks,
+		.user_data = backend,
+		/* A late edge is issued at once instead of a full counter wrap later */
+		.flags = COUNTER_ALARM_CFG_ABSOLUTE | COUNTER_ALARM_CFG_EXPIRE_WHEN_LATE,
+	};
+
+	return counter_set_channel_alarm(backend->counter, backend->channel, &cfg);
+}
+
+static void counter_cancel(void *user_data)
+{
+	const motion_step_counter_t *backend = user_data;
+
+	(void)counter_cancel_channel_alarm(backend->counter, backend->channel);
+}
+
+static void counter_step(void *user_data, uint32_t axes, bool high)
+{
+	const motion_step_counter_t *backend = user_data;
+
+	axes &= backend->axes;
+	while (axes != 0) {
+		const uint32_t i = find_lsb_set(axes) - 1;
+
+		(void)gpio_pin_set_dt(&backend->step[i], high);
+		axes &= axes - 1;
+	}
+}
+
+static void counter_dir(void *user_data, uint32_t axis, bool forward)
+{
+	const motion_step_counter_t *backend = user_data;
+
+	if ((axis & backend->axes) != 0) {
+		(void)gpio_pin_set_dt(&backend->dir[find_lsb_set(axis) - 1], forward);
+	}
+}
+
+/**
+ * @brief Configure a control pin of the driver, if the driver has it
+ */
+static int driver_pin(const struct gpio_dt_spec *pin, gpio_flags_t flags)
+{
+	if (pin->port == NULL) {
+		return 0;
+	}
+
+	if (!gpio_is_ready_dt(pin)) {
+		return -ENODEV;
+	}
+
+	return gpio_pin_configure_dt(pin, flags);
+}
+
+/**
+ * @brief Set the microstep pins, enable the driver and wake it up
+ */
+static int driver_start(const motion_step_driver_t *driver)
+{
+	static const gpio_flags_t levels[] = {
+		[MOTION_STEP_PIN_LOW] = GPIO_OUTPUT_INACTIVE,
+		[MOTION_STEP_PIN_HIGH] = GPIO_OUTPUT_ACTIVE,
+		[MOTION_STEP_PIN_OPEN] = GPIO_DISCONNECTED,
+	};
+	int ret = 0;
+
+	for (size_t i = 0; i < MOTION_STEP_MODE_PINS && ret == 0; i++) {
+		if (driver->mode_level[i] >= ARRAY_SIZE(levels)) {
+			return -EINVAL;
+		}
+		ret = driver_pin(&driver->mode[i], levels[driver->mode_level[i]]);
+	}
+
+	/* The microstep mode is set before the outputs drive the motor */
+	if (ret == 0) {
+		ret = driver_pin(&driver->enable, GPIO_OUTPUT_ACTIVE);
+	}
+	if (ret == 0) {
+		ret = driver_pin(&driver->sleep, GPIO_OUTPUT_INACTIVE);
+	}
+
+	return ret;
+}
+
+static const motion_step_hw_api_t counter_api = {
+	.now = counter_now,
+	.set_alarm = counter_alarm,
+	.cancel_alarm = counter_cancel,
+	.set_step = counter_step,
+	.set_dir = counter_dir,
+};
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Start the counter
+ */
+int motion_step_counter_init(motion_step_counter_t *backend, motion_step_t *engine,
+			     const struct device *counter, uint8_t channel)
+{
+	if (backend == NULL || engine == NULL || counter == NULL) {
+		LOG_ERR("motion_step_counter_init: Invalid parameters (backend=%p, counter=%p)",
+			backend, counter);
+		return -EINVAL;
+	}
+
+	if (!device_is_ready(counter)) {
+		LOG_ERR("Step counter not ready");
+		return -ENODEV;
+	}
+
+	if (counter_get_top_value(counter) != UINT32_MAX || !counter_is_counting_up(counter) ||
+	    channel >= counter_get_num_of_channels(counter)) {
+		LOG_ERR("%s cannot schedule steps on channel %u", counter->name, channel);
+		return -ENOTSUP;
+	}
+
+	memset(backend, 0, sizeof(*backend));
+	backend->hw.api = &counter_api;
+	backend->hw.user_data = backend;
+	backend->hw.frequency = counter_get_frequency(counter);
+	backend->engine = engine;
+	backend->counter = counter;
+	backend->channel = channel;
+
+	int ret = counter_start(counter);
+	if (ret < 0 && ret != -EALREADY) {
+		LOG_ERR("Failed to start %s (%d)", counter->name, ret);
+		return ret;
+	}
+
+	LOG_INF("Step engine on %s channel %u at %u Hz", counter->name, channel,
+		backend->hw.frequency);
+
+	return 0;
+}
+
+/**
+ * @brief Configure the pins of an axis and wake its driver up
+ */
+int motion_step_counter_add_axis(motion_step_counter_t *backend, uint32_t axis,
+				 const struct gpio_dt_spec *step, const struct gpio_dt_spec *dir,
+				 const motion_step_driver_t *driver)
+{
+	if (backend == NULL || step == NULL || dir == NULL || axis == 0 ||
+	    (axis & (axis - 1)) != 0 || (axis & ~MOTION_AXIS_ALL) != 0) {
+		LOG_ERR("motion_step_counter_add_axis: Invalid parameters (backend=%p, axis=0x%x)",
+			backend, axis);
+		return -EINVAL;
+	}
+
+	if (!gpio_is_ready_dt(step) || !gpio_is_ready_dt(dir)) {
+		LOG_ERR("Step pins not ready");
+		return -ENODEV;
+	}
+
+	int ret = gpio_pin_configure_dt(step, GPIO_OUTPUT_INACTIVE);
+
+	if (ret == 0) {
+		ret = gpio_pin_configure_dt(dir, GPIO_OUTPUT_INACTIVE);
+	}
+	if (ret < 0) {
+		LOG_ERR("Failed to configure the step pins (%d)", ret);
+		return ret;
+	}
+
+	if (driver != NULL) {
+		ret = driver_start(driver);
+		if (ret < 0) {
+			LOG_ERR("Failed to configure the driver pins (%d)", ret);
+			return ret;
+		}
+	}
+
+	const uint32_t i = find_lsb_set(axis) - 1;
+
+	backend->step[i] = *step;
+	backend->dir[i] = *dir;
+	backend->axes |= axis;
+
+	return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ * @file motion_step_emul.c
+ * @brief Software counter backend of the step engine
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <motion/motion_step_emul.h>
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(motion, CONFIG_MOTION_LOG_LEVEL);
+
+/* ============================================================================
+ * BACKEND
+ * ============================================================================ */
+
+static uint32_t emul_now(void *user_data)
+{
+	const motion_step_emul_t *emul = user_data;
+
+	return (uint32_t)emul->now;
+}
+
+static int emul_set_alarm(void *user_data, uint32_t ticks)
+{
+	motion_step_emul_t *emul = user_data;
+	const uint32_t ahead = ticks - (uint32_t)emul->now;
+
+	emul->armed = true;
+
+	/* Like a hardware compare, a target more than half the range ahead has passed */
+	if (ahead == 0 || ahead > UINT32_MAX / 2) {
+		emul->alarm_at = emul->now;
+		return -ETIME;
+	}
+
+	emul->alarm_at = emul->now + ahead;
+	return 0;
+}
+
+static void emul_cancel_alarm(void *user_data)
+{
+	motion_step_emul_t *emul = user_data;
+
+	emul->armed = false;
+}
+
+static void emul_set_step(void *user_data, uint32_t axes, bool high)
+{
+	motion_step_emul_t *emul = user_data;
+
+	for (uint32_t i = 0; i < MOTION_AXIS_COUNT; i++) {
+		if ((axes & BIT(i)) == 0) {
+			continue;
+		}
+
+		if (high && !emul->step_high[i]) {
+			emul->rising_edges[i]++;
+			emul->last_rising_at[i] = emul->now;
+			emul->high_since[i] = emul->now;
+		} else if (!high && emul->step_high[i]) {
+			emul->min_high =
+				MIN(emul->min_high, (uint32_t)(emul->now - emul->high_since[i]));
+		}
+
+		emul->step_high[i] = high;
+	}
+}
+
+static void emul_set_dir(void *user_data, uint32_t axis, bool forward)
+{
+	motion_step_emul_t *emul = user_data;
+
+	emul->forward[find_lsb_set(axis) - 1] = forward;
+}
+
+static const motion_step_hw_api_t emul_api = {
+	.now = emul_now,
+	.set_alarm = emul_set_alarm,
+	.cancel_alarm = emul_cancel_alarm,
+	.set_step = emul_set_step,
+	.set_dir = emul_set_dir,
+};
+
+/**
+ * @brief Draw the latency of the next interrupt
+ */
+static uint32_t next_latency(motion_step_emul_t *emul)
+{
+	const uint32_t span = emul->max_latency - emul->min_latency;
+
+	if (span == 0) {
+		return emul->min_latency;
+	}
+
+	/* xorshift32, the same sequence on every run */
+	emul->seed ^= emul->seed << 13;
+	emul->seed ^= emul->seed >> 17;
+	emul->seed ^= emul->seed << 5;
+
+	return emul->min_latency + emul->seed % (span + 1);
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Initialize an emulated counter at 0 with no interrupt latency
+ */
+void motion_step_emul_init(motion_step_emul_t *emul, motion_step_t *engine, uint32_t frequency)
+{
+	if (emul == NULL || engine == NULL) {
+		LOG_ERR("motion_step_emul_init: Invalid parameters (emul=%p, engine=%p)", emul,
+			engine);
+		return;
+	}
+
+	memset(emul, 0, sizeof(*emul));
+	emul->hw.api = &emul_api;
+	emul->hw.user_data = emul;
+	emul->hw.frequency = frequency;
+	emul->engine = engine;
+	emul->seed = 0x2545f491;
+	emul->min_high = UINT32_MAX;
+}
+
+/**
+ * @brief Set the interrupt latency, drawn uniformly for every alarm
+ */
+void motion_step_emul_set_latency(motion_step_emul_t *emul, uint32_t min_ticks,
+				  uint32_t max_ticks)
+{
+	if (emul == NULL || min_ticks > max_ticks) {
+		LOG_ERR("motion_step_emul_set_latency: Invalid parameters (emul=%p)", emul);
+		return;
+	}
+
+	emul->min_latency = min_ticks;
+	emul->max_latency = max_ticks;
+}
+
+/**
+ * @brief Advance the counter, running every alarm that falls due
+ */
+uint32_t motion_step_emul_run(motion_step_emul_t *emul, uint64_t ticks)
+{
+	if (emul == NULL) {
+		LOG_ERR("motion_step_emul_run: NULL emul pointer");
+		return 0;
+	}
+
+	const uint64_t end = emul->now + ticks;
+	uint32_t alarms = 0;
+
+	while (emul->armed && emul->alarm_at <= end) {
+		/* An interrupt is never taken before the one running returns */
+		emul->now = MAX(emul->now, emul->alarm_at + next_latency(emul));
+		emul->armed = false;
+		motion_step_isr(emul->engine);
+		alarms++;
+	}
+
+	emul->now = MAX(emul->now, end);
+
+	return alarms;
+}
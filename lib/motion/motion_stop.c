@@ -0,0 +1,107 @@
+/**
+ * @file motion_stop.c
+ * @brief Emergency stop signal implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <motion/motion_stop.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(motion, CONFIG_MOTION_LOG_LEVEL);
+
+/**
+ * @brief Initialize a stop signal, nothing is pending
+ */
+void motion_stop_init(motion_stop_t *stop)
+{
+	if (stop == NULL) {
+		LOG_ERR("motion_stop_init: NULL stop pointer");
+		return;
+	}
+
+	memset(stop, 0, sizeof(*stop));
+}
+
+/**
+ * @brief Request a stop, ISR safe
+ */
+void motion_stop_request(motion_stop_t *stop, uint32_t axes)
+{
+	if (stop == NULL || (axes & MOTION_AXIS_ALL) == 0) {
+		return;
+	}
+
+	/*
+	 * Stamp before publishing the axes, so step generation never sees a
+	 * pending stop with the time of an older one.
+	 */
+	if (atomic_get(&stop->pending) == 0) {
+		atomic_set(&stop->requested_at, (atomic_val_t)k_cycle_get_32());
+	}
+
+	atomic_or(&stop->pending, (atomic_val_t)(axes & MOTION_AXIS_ALL));
+	atomic_inc(&stop->requests);
+}
+
+/**
+ * @brief Acknowledge a stop, ISR safe
+ */
+void motion_stop_complete(motion_stop_t *stop, uint32_t axes)
+{
+	if (stop == NULL) {
+		return;
+	}
+
+	atomic_val_t previous = atomic_and(&stop->pending, ~(atomic_val_t)axes);
+
+	if ((previous & (atomic_val_t)axes) == 0 || (previous & ~(atomic_val_t)axes) != 0) {
+		/* Nothing was pending on these axes, or other axes still have to stop */
+		return;
+	}
+
+	uint32_t cycles = k_cycle_get_32() - (uint32_t)atomic_get(&stop->requested_at);
+	atomic_val_t max = atomic_get(&stop->max_cycles);
+
+	atomic_set(&stop->last_cycles, (atomic_val_t)cycles);
+	while ((uint32_t)max < cycles && !atomic_cas(&stop->max_cycles, max, cycles)) {
+		max = atomic_get(&stop->max_cycles);
+	}
+	atomic_inc(&stop->completions);
+}
+
+/**
+ * @brief Get the stop statistics
+ */
+void motion_stop_get_stats(motion_stop_t *stop, motion_stop_stats_t *stats)
+{
+	if (stop == NULL || stats == NULL) {
+		LOG_ERR("motion_stop_get_stats: Invalid parameters (stop=%p, stats=%p)", stop,
+			stats);
+		return;
+	}
+
+	stats->requests = (uint32_t)atomic_get(&stop->requests);
+	stats->completions = (uint32_t)atomic_get(&stop->completions);
+	stats->last_cycles = (uint32_t)atomic_get(&stop->last_cycles);
+	stats->max_cycles = (uint32_t)atomic_get(&stop->max_cycles);
+}
+
+/**
+ * @brief Reset the stop statistics, pending stops are kept
+ */
+void motion_stop_reset_stats(motion_stop_t *stop)
+{
+	if (stop == NULL) {
+		LOG_ERR("motion_stop_reset_stats: NULL stop pointer");
+		return;
+	}
+
+	atomic_clear(&stop->requests);
+	atomic_clear(&stop->completions);
+	atomic_clear(&stop->last_cycles);
+	atomic_clear(&stop->max_cycles);
+}
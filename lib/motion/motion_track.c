@@ -0,0 +1,82 @@
+/**
+ * @file motion_track.c
+ * @brief Exact tracking rate implementation
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <motion/motion_track.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_DECLARE(motion, CONFIG_MOTION_LOG_LEVEL);
+
+/* ============================================================================
+ * INTERNAL HELPERS
+ * ============================================================================ */
+
+/**
+ * @brief Greatest common divisor
+ */
+static uint64_t gcd(uint64_t a, uint64_t b)
+{
+	while (b != 0) {
+		const uint64_t r = a % b;
+
+		a = b;
+		b = r;
+	}
+
+	return a;
+}
+
+/* ============================================================================
+ * PUBLIC API IMPLEMENTATION
+ * ============================================================================ */
+
+/**
+ * @brief Compute the exact step interval of a tracking rate
+ */
+int motion_track_period(const motion_track_rate_t *rate, uint32_t frequency,
+			motion_step_period_t *period)
+{
+	if (rate == NULL || period == NULL || rate->steps_per_rev == 0 || rate->rate_mhz == 0 ||
+	    rate->day == 0 || frequency == 0) {
+		LOG_ERR("motion_track_period: Invalid parameters (rate=%p, period=%p)", rate,
+			period);
+		return -EINVAL;
+	}
+
+	/*
+	 * steps_per_rev * rate_mhz / 60000 turns per day of day / 10^4 seconds,
+	 * so an interval of frequency * 6 * day / (steps_per_rev * rate_mhz).
+	 */
+	const uint64_t scale = (uint64_t)frequency * 6U;
+
+	if (rate->day > UINT64_MAX / scale) {
+		return -ERANGE;
+	}
+
+	const uint64_t numerator = scale * rate->day;
+	const uint64_t denominator = (uint64_t)rate->steps_per_rev * rate->rate_mhz;
+	const uint64_t ticks = numerator / denominator;
+	const uint64_t frac = numerator % denominator;
+
+	if (ticks < 2 || ticks > UINT32_MAX) {
+		return -ERANGE;
+	}
+
+	const uint64_t divisor = frac != 0 ? gcd(denominator, frac) : denominator;
+
+	if (denominator / divisor > INT64_MAX) {
+		return -ERANGE;
+	}
+
+	period->ticks = (uint32_t)ticks;
+	period->frac = frac / divisor;
+	period->modulus = frac != 0 ? denominator / divisor : 0;
+
+	return 0;
+}
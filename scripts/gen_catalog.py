@@ -0,0 +1,322 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025, OpenAstroTech
+# SPDX-License-Identifier: Apache-2.0
+
+'''gen_catalog.py
+
+Generate the packed object catalogs used by lib/catalog.
+
+Every CSV file in the data directory is one catalog, named after the file
+(messier.csv, ngc.csv, ic.csv, star.csv). Each line holds
+
+  number,type,ra,dec,magnitude,size,name,also
+
+with the J2000 right ascension as HH:MM.m or HH:MM:SS.s, the declination as
+sDD:MM or sDD:MM:SS, the size in arcminutes, an empty magnitude, size or name
+if unknown and an optional cross id such as NGC224 in "also". A cross id adds
+the object to the other catalog as well, so Messier objects do not have to be
+listed twice.
+
+The records are packed into 12 bytes, sorted by catalog number and written
+as const arrays, so they stay in flash. Every catalog gets a spatial index of
+declination zones split into right ascension cells of about equal area, see
+include/catalog/catalog.h.
+
+--synthetic-ngc N fills the NGC catalog up to N objects with reproducible
+random objects, to benchmark the index with a catalog of full size.
+
+The build runs this script, it can also be run by hand:
+
+  python3 scripts/gen_catalog.py --output catalog_data.c
+'''
+
+import argparse
+import csv
+import math
+import pathlib
+import random
+import re
+import sys
+
+# file stem: (C symbol, designation prefix), in generation order
+CATALOGS = {
+    'messier': ('catalog_messier', 'M'),
+    'ngc': ('catalog_ngc', 'NGC'),
+    'ic': ('catalog_ic', 'IC'),
+    'star': ('catalog_star', 'STAR'),
+}
+
+TYPES = {
+    'STAR': 'CATALOG_STAR',
+    'DBL': 'CATALOG_DOUBLE_STAR',
+    'GAL': 'CATALOG_GALAXY',
+    'OC': 'CATALOG_OPEN_CLUSTER',
+    'GC': 'CATALOG_GLOBULAR_CLUSTER',
+    'PN': 'CATALOG_PLANETARY_NEBULA',
+    'DN': 'CATALOG_DIFFUSE_NEBULA',
+    'SNR': 'CATALOG_SUPERNOVA_REMNANT',
+    'AST': 'CATALOG_ASTERISM',
+    'OTHER': 'CATALOG_OTHER',
+}
+
+# Must match catalog.h
+MAGNITUDE_BIAS = 50
+MAGNITUDE_UNKNOWN = 0xFF
+NO_NAME = 0xFFFF
+SIZE_MAX = 0xFFF
+RA_FULL = 864000
+DEC_RANGE = 648000
+
+# Average number of objects per index cell
+OBJECTS_PER_CELL = 4
+
+HEADER = '''/*
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Generated by scripts/gen_catalog.py, do not edit.
+ */
+'''
+
+
+def parse_ra(text):
+    '''HH:MM.m or HH:MM:SS.s to tenths of a second of time'''
+    match = re.fullmatch(r'(\d{1,2}):(\d{2}(?:\.\d)?)(?::(\d{2}(?:\.\d)?))?', text)
+    if not match:
+        raise ValueError(f'bad right ascension {text!r}')
+    hours, minutes, seconds = match.groups()
+    tenths = round((int(hours) * 3600 + float(minutes) * 60 + float(seconds or 0)) * 10)
+    if tenths >= 864000:
+        raise ValueError(f'right ascension out of range {text!r}')
+    return tenths
+
+
+def parse_dec(text):
+    '''sDD:MM or sDD:MM:SS to arcseconds'''
+    match = re.fullmatch(r'([+-])(\d{2}):(\d{2})(?::(\d{2}(?:\.\d)?))?', text)
+    if not match:
+        raise ValueError(f'bad declination {text!r}')
+    sign, degrees, minutes, seconds = match.groups()
+    arcsec = round(int(degrees) * 3600 + int(minutes) * 60 + float(seconds or 0))
+    if arcsec > 324000:
+        raise ValueError(f'declination out of range {text!r}')
+    return -arcsec if sign == '-' else arcsec
+
+
+def parse_magnitude(text):
+    if not text:
+        return MAGNITUDE_UNKNOWN
+    value = round(float(text) * 10) + MAGNITUDE_BIAS
+    if not 0 <= value < MAGNITUDE_UNKNOWN:
+        raise ValueError(f'magnitude out of range {text!r}')
+    return value
+
+
+def parse_size(text):
+    '''Arcminutes to tenths of an arcminute, 0 if unknown'''
+    if not text:
+        return 0
+    value = max(1, round(float(text) * 10))
+    if value > SIZE_MAX:
+        raise ValueError(f'size out of range {text!r}')
+    return value
+
+
+def load(data):
+    '''Read all CSV files, returns {stem: {number: record}}'''
+    catalogs = {stem: {} for stem in CATALOGS}
+    prefixes = sorted(((prefix, stem) for stem, (_, prefix) in CATALOGS.items()),
+                      key=lambda item: -len(item[0]))
+
+    def add(stem, record, where):
+        number = record['number']
+        if not 0 <= number <= 0xFFFF:
+            sys.exit(f'{where}: catalog number {number} out of range')
+        if number in catalogs[stem]:
+            sys.exit(f'{where}: {CATALOGS[stem][1]}{number} defined twice')
+        catalogs[stem][number] = record
+
+    for stem in CATALOGS:
+        path = data / f'{stem}.csv'
+        if not path.exists():
+            continue
+        with path.open(newline='', encoding='utf-8') as f:
+            rows = csv.reader(line for line in f if line.strip() and not line.startswith('#'))
+            for line, row in enumerate(rows, 1):
+                where = f'{path.name}:{line}'
+                try:
+                    number, kind, ra, dec, magnitude, size, name, also = row
+                    record = {
+                        'number': int(number),
+                        'type': TYPES[kind],
+                        'ra': parse_ra(ra),
+                        'dec': parse_dec(dec),
+                        'magnitude': parse_magnitude(magnitude),
+                        'size': parse_size(size),
+                        'name': name,
+                    }
+                except (KeyError, ValueError) as e:
+                    sys.exit(f'{where}: {e}')
+                add(stem, record, where)
+
+                if not also:
+                    continue
+                for prefix, other in prefixes:
+                    if also.startswith(prefix) and also[len(prefix):].isdigit():
+                        add(other, dict(record, number=int(also[len(prefix):])), where)
+                        break
+                else:
+                    sys.exit(f'{where}: unknown cross id {also!r}')
+
+    return catalogs
+
+
+def add_synthetic(catalog, count):
+    '''Fill a catalog up to count objects spread evenly over the sky'''
+    rng = random.Random(count)
+    kinds = ['CATALOG_GALAXY', 'CATALOG_OPEN_CLUSTER', 'CATALOG_GLOBULAR_CLUSTER',
+             'CATALOG_PLANETARY_NEBULA', 'CATALOG_DIFFUSE_NEBULA']
+    number = 1
+    while len(catalog) < count:
+        if number not in catalog:
+            catalog[number] = {
+                'number': number,
+                'type': rng.choice(kinds),
+                'ra': rng.randrange(RA_FULL),
+                'dec': round(math.degrees(math.asin(rng.uniform(-1, 1))) * 3600),
+                'magnitude': round(rng.uniform(6, 15) * 10) + MAGNITUDE_BIAS,
+                'size': rng.randrange(1, 300),
+                'name': '',
+            }
+        number += 1
+
+
+def zone_of(dec, zones):
+    return min(zones - 1, (dec + DEC_RANGE // 2) * zones // DEC_RANGE)
+
+
+def build_index(records):
+    '''Declination zones of equal height, each split into right ascension
+    cells about as wide as high at the zone center'''
+    zones = max(2, min(180, round(math.sqrt(math.pi * len(records) / (4 * OBJECTS_PER_CELL)))))
+    zone_cells = [0]
+    for z in range(zones):
+        center = math.radians((z + 0.5) * 180 / zones - 90)
+        zone_cells.append(zone_cells[-1] + max(1, round(2 * zones * math.cos(center))))
+
+    cells = [[] for _ in range(zone_cells[-1])]
+    for index, r in enumerate(records):
+        z = zone_of(r['dec'], zones)
+        count = zone_cells[z + 1] - zone_cells[z]
+        cells[zone_cells[z] + r['ra'] * count // RA_FULL].append(index)
+
+    cell_entries = [0]
+    entries = []
+    brightest = []
+    largest = []
+    for cell in cells:
+        cell.sort(key=lambda i: (records[i]['magnitude'], i))
+        entries += cell
+        cell_entries.append(len(entries))
+        brightest.append(min((records[i]['magnitude'] for i in cell), default=MAGNITUDE_UNKNOWN))
+        largest.append(max((records[i]['size'] for i in cell), default=0))
+
+    return zones, zone_cells, cell_entries, brightest, largest, entries
+
+
+def array(lines, kind, name, values):
+    lines.append(f'static const {kind} {name}[] = {{')
+    for i in range(0, len(values), 12):
+        lines.append('\t' + ', '.join(f'{v}' for v in values[i:i + 12]) + ',')
+    lines += ['};', '']
+
+
+def generate(path, catalogs):
+    names = []
+    offsets = {}
+    size = 0
+
+    def name_offset(name):
+        nonlocal size
+        if not name:
+            return NO_NAME
+        if name not in offsets:
+            offsets[name] = size
+            names.append(name)
+            size += len(name.encode('utf-8')) + 1
+        return offsets[name]
+
+    lines = [HEADER, '#include <catalog/catalog.h>', '']
+
+    for stem, (symbol, prefix) in CATALOGS.items():
+        records = [catalogs[stem][number] for number in sorted(catalogs[stem])]
+
+        lines.append(f'static const catalog_record_t {symbol}_records[] = {{')
+        for r in records:
+            lines.append(f'\t{{{r["number"]}, {r["type"]}, {r["magnitude"]}, '
+                         f'{r["ra"]}, {r["size"]}, {r["dec"]}}},')
+        if not records:
+            lines.append('\t{0},')
+        lines += ['};', '']
+
+        zones, zone_cells, cell_entries, brightest, largest, entries = build_index(records)
+        array(lines, 'uint16_t', f'{symbol}_zone_cells', zone_cells)
+        array(lines, 'uint16_t', f'{symbol}_cell_entries', cell_entries)
+        array(lines, 'uint8_t', f'{symbol}_cell_brightest', brightest)
+        array(lines, 'uint16_t', f'{symbol}_cell_largest', largest)
+        array(lines, 'uint16_t', f'{symbol}_entries', entries or [0])
+        lines += [f'static const catalog_index_t {symbol}_index = {{',
+                  f'\t.zones = {zones},',
+                  f'\t.zone_cells = {symbol}_zone_cells,',
+                  f'\t.cell_entries = {symbol}_cell_entries,',
+                  f'\t.cell_brightest = {symbol}_cell_brightest,',
+                  f'\t.cell_largest = {symbol}_cell_largest,',
+                  f'\t.entries = {symbol}_entries,',
+                  '};', '']
+
+        has_names = any(r['name'] for r in records)
+        if has_names:
+            lines.append(f'static const uint16_t {symbol}_names[] = {{')
+            for i in range(0, len(records), 8):
+                row = ', '.join(f'{name_offset(r["name"])}' for r in records[i:i + 8])
+                lines.append(f'\t{row},')
+            lines += ['};', '']
+
+        lines += [f'const catalog_t {symbol} = {{',
+                  f'\t.prefix = "{prefix}",',
+                  f'\t.records = {symbol}_records,',
+                  f'\t.names = {symbol + "_names" if has_names else "NULL"},',
+                  f'\t.index = &{symbol}_index,',
+                  f'\t.count = {len(records)},',
+                  '};', '']
+
+    if size >= NO_NAME:
+        sys.exit('object names do not fit 16 bit offsets')
+
+    lines.append('const char catalog_names[] =')
+    for name in names:
+        escaped = name.replace('\\', '\\\\').replace('"', '\\"')
+        lines.append(f'\t"{escaped}\\0"')
+    lines += ['\t"";', '']
+
+    path.write_text('\n'.join(lines))
+
+
+def main():
+    root = pathlib.Path(__file__).resolve().parent.parent
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--data', type=pathlib.Path, default=root / 'lib' / 'catalog' / 'data')
+    parser.add_argument('--output', type=pathlib.Path, required=True)
+    parser.add_argument('--synthetic-ngc', type=int, default=0, metavar='N')
+    args = parser.parse_args()
+
+    catalogs = load(args.data)
+    if args.synthetic_ngc > 0xFFFF:
+        sys.exit('too many synthetic NGC objects')
+    add_synthetic(catalogs['ngc'], args.synthetic_ngc)
+    generate(args.output, catalogs)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025, OpenAstroTech
+# SPDX-License-Identifier: Apache-2.0
+
+'''gen_lx200_commands.py
+
+Generate the LX200 command table used by lib/lx200.
+
+The command list below mirrors lib/lx200/LX200CommandSet.md. For every
+command it records the command family, the parameter grammar and a handler
+id. The script searches a collision free (perfect) hash over the command
+keys and writes:
+
+  include/lx200/lx200_command_ids.h   handler id enumeration
+  lib/lx200/lx200_command_table.h     hash parameters and lookup tables
+
+Re-run it after changing the command list:
+
+  python3 scripts/gen_lx200_commands.py
+'''
+
+import argparse
+import pathlib
+import sys
+
+# (key, family, grammar, handler id)
+COMMANDS = [
+    # A - Alignment
+    ('Aa', 'ALIGNMENT', 'NONE', 'ALIGN_AUTO'),
+    ('AL', 'ALIGNMENT', 'NONE', 'ALIGN_LAND'),
+    ('AP', 'ALIGNMENT', 'NONE', 'ALIGN_POLAR'),
+    ('AA', 'ALIGNMENT', 'NONE', 'ALIGN_ALTAZ'),
+    # $B - Active backlash compensation
+    ('$BA', 'BACKLASH', 'NUMBER', 'BACKLASH_DEC'),
+    ('$BZ', 'BACKLASH', 'NUMBER', 'BACKLASH_RA'),
+    # B - Reticule/accessory control
+    ('B+', 'RETICLE', 'NONE', 'RETICLE_BRIGHTER'),
+    ('B-', 'RETICLE', 'NONE', 'RETICLE_DIMMER'),
+    ('B', 'RETICLE', 'DIGIT', 'RETICLE_FLASH_RATE'),
+    ('BD', 'RETICLE', 'NUMBER', 'RETICLE_DUTY_CYCLE'),
+    # C - Sync control
+    ('CL', 'SYNC', 'NONE', 'SYNC_SELENOGRAPHIC'),
+    ('CM', 'SYNC', 'NONE', 'SYNC_OBJECT'),
+    # D - Distance bars
+    ('D', 'DISTANCE', 'NONE', 'DISTANCE_BARS'),
+    # f - Fan
+    ('f+', 'FAN', 'NONE', 'FAN_ON'),
+    ('f-', 'FAN', 'NONE', 'FAN_OFF'),
+    ('fT', 'FAN', 'NONE', 'FAN_TEMPERATURE'),
+    # F - Focuser control
+    ('F+', 'FOCUSER', 'NONE', 'FOCUS_IN'),
+    ('F-', 'FOCUSER', 'NONE', 'FOCUS_OUT'),
+    ('FQ', 'FOCUSER', 'NONE', 'FOCUS_STOP'),
+    ('FF', 'FOCUSER', 'NONE', 'FOCUS_FAST'),
+    ('FS', 'FOCUSER', 'NONE', 'FOCUS_SLOW'),
+    ('F', 'FOCUSER', 'DIGIT', 'FOCUS_SPEED'),
+    # g - GPS
+    ('g+', 'GPS', 'NONE', 'GPS_ON'),
+    ('g-', 'GPS', 'NONE', 'GPS_OFF'),
+    ('gps', 'GPS', 'NONE', 'GPS_STREAM'),
+    ('gT', 'GPS', 'NONE', 'GPS_UPDATE_TIME'),
+    # G - Get telescope information
+    ('G0', 'GET', 'NONE', 'GET_ALIGN_MENU_0'),
+    ('G1', 'GET', 'NONE', 'GET_ALIGN_MENU_1'),
+    ('G2', 'GET', 'NONE', 'GET_ALIGN_MENU_2'),
+    ('GA', 'GET', 'NONE', 'GET_ALTITUDE'),
+    ('Ga', 'GET', 'NONE', 'GET_LOCAL_TIME_12H'),
+    ('Gb', 'GET', 'NONE', 'GET_BRIGHTER_LIMIT'),
+    ('GC', 'GET', 'NONE', 'GET_DATE'),
+    ('Gc', 'GET', 'NONE', 'GET_CALENDAR_FORMAT'),
+    ('GD', 'GET', 'NONE', 'GET_DEC'),
+    ('Gd', 'GET', 'NONE', 'GET_TARGET_DEC'),
+    ('GF', 'GET', 'NONE', 'GET_FIELD_DIAMETER'),
+    ('Gf', 'GET', 'NONE', 'GET_FAINT_LIMIT'),
+    ('GG', 'GET', 'NONE', 'GET_UTC_OFFSET'),
+    ('Gg', 'GET', 'NONE', 'GET_LONGITUDE'),
+    ('Gh', 'GET', 'NONE', 'GET_HIGH_LIMIT'),
+    ('GL', 'GET', 'NONE', 'GET_LOCAL_TIME_24H'),
+    ('Gl', 'GET', 'NONE', 'GET_LARGER_SIZE_LIMIT'),
+    ('GM', 'GET', 'NONE', 'GET_SITE_1_NAME'),
+    ('GN', 'GET', 'NONE', 'GET_SITE_2_NAME'),
+    ('GO', 'GET', 'NONE', 'GET_SITE_3_NAME'),
+    ('GP', 'GET', 'NONE', 'GET_SITE_4_NAME'),
+    ('Go', 'GET', 'NONE', 'GET_LOWER_LIMIT'),
+    ('Gq', 'GET', 'NONE', 'GET_FIND_QUALITY'),
+    ('GR', 'GET', 'NONE', 'GET_RA'),
+    ('Gr', 'GET', 'NONE', 'GET_TARGET_RA'),
+    ('GS', 'GET', 'NONE', 'GET_SIDEREAL_TIME'),
+    ('Gs', 'GET', 'NONE', 'GET_SMALLER_SIZE_LIMIT'),
+    ('GT', 'GET', 'NONE', 'GET_TRACKING_RATE'),
+    ('Gt', 'GET', 'NONE', 'GET_LATITUDE'),
+    ('GVD', 'GET', 'NONE', 'GET_FIRMWARE_DATE'),
+    ('GVN', 'GET', 'NONE', 'GET_FIRMWARE_NUMBER'),
+    ('GVP', 'GET', 'NONE', 'GET_PRODUCT_NAME'),
+    ('GVT', 'GET', 'NONE', 'GET_FIRMWARE_TIME'),
+    ('Gy', 'GET', 'NONE', 'GET_OBJECT_SELECTION'),
+    ('GZ', 'GET', 'NONE', 'GET_AZIMUTH'),
+    # h - Home position
+    ('hS', 'HOME', 'NONE', 'HOME_STORE'),
+    ('hF', 'HOME', 'NONE', 'HOME_FIND'),
+    ('hN', 'HOME', 'NONE', 'HOME_SLEEP'),
+    ('hP', 'HOME', 'NONE', 'HOME_PARK'),
+    ('hW', 'HOME', 'NONE', 'HOME_WAKE'),
+    ('h?', 'HOME', 'NONE', 'HOME_STATUS'),
+    # H - Time format
+    ('H', 'TIME_FORMAT', 'NONE', 'TOGGLE_TIME_FORMAT'),
+    # I - Initialize
+    ('I', 'INITIALIZE', 'NONE', 'INITIALIZE'),
+    # L - Object library
+    ('LB', 'LIBRARY', 'NONE', 'LIBRARY_PREVIOUS'),
+    ('LC', 'LIBRARY', 'NUMBER', 'LIBRARY_SELECT_DEEP_SKY'),
+    ('LF', 'LIBRARY', 'NONE', 'LIBRARY_FIND'),
+    ('Lf', 'LIBRARY', 'NONE', 'LIBRARY_IDENTIFY'),
+    ('LI', 'LIBRARY', 'NONE', 'LIBRARY_INFO'),
+    ('LM', 'LIBRARY', 'NUMBER', 'LIBRARY_SELECT_MESSIER'),
+    ('LN', 'LIBRARY', 'NONE', 'LIBRARY_NEXT'),
+    ('Lo', 'LIBRARY', 'DIGIT', 'LIBRARY_DEEP_SKY_CATALOG'),
+    ('Ls', 'LIBRARY', 'DIGIT', 'LIBRARY_STAR_CATALOG'),
+    ('LS', 'LIBRARY', 'NUMBER', 'LIBRARY_SELECT_STAR'),
+    # M - Movement
+    ('MA', 'MOVE', 'NONE', 'SLEW_ALTAZ'),
+    ('Me', 'MOVE', 'NONE', 'MOVE_EAST'),
+    ('Mn', 'MOVE', 'NONE', 'MOVE_NORTH'),
+    ('Ms', 'MOVE', 'NONE', 'MOVE_SOUTH'),
+    ('Mw', 'MOVE', 'NONE', 'MOVE_WEST'),
+    ('MS', 'MOVE', 'NONE', 'SLEW_TARGET'),
+    # P - High precision
+    ('P', 'PRECISION', 'NONE', 'TOGGLE_HIGH_PRECISION'),
+    # $Q - Smart drive (PEC)
+    ('$Q', 'SMART_DRIVE', 'NONE', 'PEC_TOGGLE'),
+    ('$QA+', 'SMART_DRIVE', 'NONE', 'PEC_DEC_ENABLE'),
+    ('$QA-', 'SMART_DRIVE', 'NONE', 'PEC_DEC_DISABLE'),
+    ('$QZ+', 'SMART_DRIVE', 'NONE', 'PEC_RA_ENABLE'),
+    ('$QZ-', 'SMART_DRIVE', 'NONE', 'PEC_RA_DISABLE'),
+    # Q - Stop
+    ('Q', 'STOP', 'NONE', 'STOP_ALL'),
+    ('Qe', 'STOP', 'NONE', 'STOP_EAST'),
+    ('Qn', 'STOP', 'NONE', 'STOP_NORTH'),
+    ('Qs', 'STOP', 'NONE', 'STOP_SOUTH'),
+    ('Qw', 'STOP', 'NONE', 'STOP_WEST'),
+    # r - Field de-rotator
+    ('r+', 'DEROTATOR', 'NONE', 'DEROTATOR_ON'),
+    ('r-', 'DEROTATOR', 'NONE', 'DEROTATOR_OFF'),
+    # R - Slew rate
+    ('RC', 'SLEW_RATE', 'NONE', 'RATE_CENTERING'),
+    ('RG', 'SLEW_RATE', 'NONE', 'RATE_GUIDE'),
+    ('RM', 'SLEW_RATE', 'NONE', 'RATE_FIND'),
+    ('RS', 'SLEW_RATE', 'NONE', 'RATE_SLEW'),
+    ('RA', 'SLEW_RATE', 'DECIMAL', 'RATE_RA_AXIS'),
+    ('RE', 'SLEW_RATE', 'DECIMAL', 'RATE_DEC_AXIS'),
+    ('Rg', 'SLEW_RATE', 'DECIMAL', 'RATE_GUIDE_SPEED'),
+] + [
+    # Custom slew rates documented in lx200.h
+    ('R%d' % n, 'SLEW_RATE', 'NONE', 'RATE_CUSTOM_%d' % n) for n in range(10)
+] + [
+    # S - Set telescope parameters
+    ('Sa', 'SET', 'ALT', 'SET_TARGET_ALTITUDE'),
+    ('Sb', 'SET', 'MAGNITUDE', 'SET_BRIGHTER_LIMIT'),
+    ('SB', 'SET', 'DIGIT', 'SET_BAUD_RATE'),
+    ('SC', 'SET', 'DATE', 'SET_DATE'),
+    ('Sd', 'SET', 'DEC', 'SET_TARGET_DEC'),
+    ('SE', 'SET', 'LATITUDE', 'SET_SELENOGRAPHIC_LATITUDE'),
+    ('Se', 'SET', 'LONGITUDE', 'SET_SELENOGRAPHIC_LONGITUDE'),
+    ('Sf', 'SET', 'MAGNITUDE', 'SET_FAINT_LIMIT'),
+    ('SF', 'SET', 'NUMBER', 'SET_FIELD_DIAMETER'),
+    ('Sg', 'SET', 'LONGITUDE', 'SET_LONGITUDE'),
+    ('SG', 'SET', 'UTC_OFFSET', 'SET_UTC_OFFSET'),
+    ('Sh', 'SET', 'NUMBER', 'SET_HIGH_LIMIT'),
+    ('Sl', 'SET', 'NUMBER', 'SET_SMALLER_SIZE_LIMIT'),
+    ('SL', 'SET', 'TIME', 'SET_LOCAL_TIME'),
+    ('SM', 'SET', 'STRING', 'SET_SITE_1_NAME'),
+    ('SN', 'SET', 'STRING', 'SET_SITE_2_NAME'),
+    ('SO', 'SET', 'STRING', 'SET_SITE_3_NAME'),
+    ('SP', 'SET', 'STRING', 'SET_SITE_4_NAME'),
+    ('So', 'SET', 'NUMBER', 'SET_LOWER_LIMIT'),
+    ('Sq', 'SET', 'NONE', 'STEP_FIND_QUALITY'),
+    ('Sr', 'SET', 'RA', 'SET_TARGET_RA'),
+    ('Ss', 'SET', 'NUMBER', 'SET_LARGER_SIZE_LIMIT'),
+    ('SS', 'SET', 'TIME', 'SET_SIDEREAL_TIME'),
+    ('St', 'SET', 'LATITUDE', 'SET_LATITUDE'),
+    ('ST', 'SET', 'TRACKING_RATE', 'SET_TRACKING_RATE'),
+    ('Sw', 'SET', 'DIGIT', 'SET_MAX_SLEW_RATE'),
+    ('Sy', 'SET', 'STRING', 'SET_OBJECT_SELECTION'),
+    ('Sz', 'SET', 'AZ', 'SET_TARGET_AZIMUTH'),
+    # T - Tracking
+    ('T+', 'TRACKING', 'NONE', 'TRACK_INCREMENT'),
+    ('T-', 'TRACKING', 'NONE', 'TRACK_DECREMENT'),
+    ('TL', 'TRACKING', 'NONE', 'TRACK_LUNAR'),
+    ('TM', 'TRACKING', 'NONE', 'TRACK_CUSTOM'),
+    ('TQ', 'TRACKING', 'NONE', 'TRACK_DEFAULT'),
+    ('T', 'TRACKING', 'TRACKING_RATE', 'TRACK_SET_MANUAL_RATE'),
+    # U - Precision toggle
+    ('U', 'PRECISION_TOGGLE', 'NONE', 'TOGGLE_PRECISION'),
+    # W - Site select
+    ('W', 'SITE', 'DIGIT', 'SELECT_SITE'),
+    # ? - Help text
+    ('??', 'HELP', 'NONE', 'HELP_START'),
+    ('?+', 'HELP', 'NONE', 'HELP_NEXT'),
+    ('?-', 'HELP', 'NONE', 'HELP_PREVIOUS'),
+    # X - OpenAstroFirmware extensions
+    ('XL', 'VENDOR', 'STRING', 'VENDOR_LATENCY'),
+]
+
+# Family of a command prefix when no complete key matches
+PREFIXES = {
+    'A': 'ALIGNMENT', 'B': 'RETICLE', 'C': 'SYNC', 'D': 'DISTANCE',
+    'f': 'FAN', 'F': 'FOCUSER', 'g': 'GPS', 'G': 'GET', 'h': 'HOME',
+    'H': 'TIME_FORMAT', 'I': 'INITIALIZE', 'L': 'LIBRARY', 'M': 'MOVE',
+    'P': 'PRECISION', 'Q': 'STOP', 'r': 'DEROTATOR', 'R': 'SLEW_RATE',
+    'S': 'SET', 'T': 'TRACKING', 'U': 'PRECISION_TOGGLE', 'W': 'SITE',
+    '?': 'HELP',
+}
+
+MAX_KEY_LENGTH = 4
+TABLE_BITS = 8
+BUCKET_BITS = 6
+BUCKET_MULTIPLIER = 0x9E3779B1
+SLOT_MULTIPLIER = 0x85EBCA77
+
+HEADER = '''/*
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Generated by scripts/gen_lx200_commands.py, do not edit.
+ */
+'''
+
+
+def pack(key):
+    value = 0
+    for i, c in enumerate(key.encode('ascii')):
+        value |= c << (8 * i)
+    return value
+
+
+def bucket_of(value):
+    return ((value * BUCKET_MULTIPLIER) & 0xFFFFFFFF) >> (32 - BUCKET_BITS)
+
+
+def slot_of(value, displacement):
+    return (((value ^ displacement) * SLOT_MULTIPLIER) & 0xFFFFFFFF) >> (32 - TABLE_BITS)
+
+
+def build_hash(keys):
+    '''Hash and displace: find one displacement per bucket so that all keys
+    land in distinct slots.'''
+    buckets = [[] for _ in range(1 << BUCKET_BITS)]
+    for key in keys:
+        buckets[bucket_of(pack(key))].append(key)
+
+    displacements = [0] * len(buckets)
+    slots = [None] * (1 << TABLE_BITS)
+
+    for index in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+        members = buckets[index]
+        if not members:
+            continue
+        for displacement in range(1 << 16):
+            wanted = [slot_of(pack(key), displacement) for key in members]
+            if len(set(wanted)) == len(wanted) and all(slots[s] is None for s in wanted):
+                for key, slot in zip(members, wanted):
+                    slots[slot] = key
+                displacements[index] = displacement
+                break
+        else:
+            sys.exit(f'no displacement found for bucket {index}: {members}')
+
+    return displacements, slots
+
+
+def generate_ids(path):
+    lines = [HEADER, '#pragma once', '',
+             '#ifdef __cplusplus', 'extern "C" {', '#endif', '',
+             '/**', ' * @brief LX200 command handler ids', ' */', 'typedef enum {']
+    for key, _, _, name in COMMANDS:
+        lines.append(f'\t/** :{key}# */')
+        lines.append(f'\tLX200_ID_{name},')
+    lines += ['\t/** Number of known commands */', '\tLX200_ID_COUNT,',
+              '\t/** Unknown command */', '\tLX200_ID_UNKNOWN = LX200_ID_COUNT',
+              '} lx200_command_id_t;', '',
+              '#ifdef __cplusplus', '}', '#endif', '']
+    path.write_text('\n'.join(lines))
+
+
+def generate_table(path, displacements, slots):
+    by_key = {key: (family, grammar, name) for key, family, grammar, name in COMMANDS}
+
+    lines = [HEADER, '#pragma once', '',
+             '#include <lx200/lx200.h>', '',
+             f'#define LX200_COMMAND_TABLE_BITS {TABLE_BITS}',
+             f'#define LX200_COMMAND_BUCKET_BITS {BUCKET_BITS}',
+             f'#define LX200_COMMAND_BUCKET_MULTIPLIER 0x{BUCKET_MULTIPLIER:08X}U',
+             f'#define LX200_COMMAND_SLOT_MULTIPLIER 0x{SLOT_MULTIPLIER:08X}U', '',
+             'static const uint16_t lx200_command_displacements[] = {']
+    for i in range(0, len(displacements), 8):
+        row = ', '.join(f'{d}' for d in displacements[i:i + 8])
+        lines.append(f'\t{row},')
+    lines += ['};', '',
+              'static const lx200_command_info_t lx200_command_table[1 << LX200_COMMAND_TABLE_BITS] = {']
+    for index, key in enumerate(slots):
+        if key is None:
+            continue
+        family, grammar, name = by_key[key]
+        lines.append(f'\t[{index}] = {{0x{pack(key):08X}U, {len(key)}, LX200_CMD_{family}, '
+                     f'LX200_PARAM_{grammar}, LX200_ID_{name}}}, /* {key} */')
+    lines += ['};', '', 'static const uint8_t lx200_command_prefixes[128] = {']
+    for c in range(128):
+        family = PREFIXES.get(chr(c), 'UNKNOWN')
+        label = f" /* '{chr(c)}' */" if family != 'UNKNOWN' else ''
+        lines.append(f'\tLX200_CMD_{family},{label}')
+    lines += ['};', '']
+    path.write_text('\n'.join(lines))
+
+
+def main():
+    root = pathlib.Path(__file__).resolve().parent.parent
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--ids', type=pathlib.Path,
+                        default=root / 'include' / 'lx200' / 'lx200_command_ids.h')
+    parser.add_argument('--table', type=pathlib.Path,
+                        default=root / 'lib' / 'lx200' / 'lx200_command_table.h')
+    args = parser.parse_args()
+
+    keys = [key for key, _, _, _ in COMMANDS]
+    if len(set(keys)) != len(keys):
+        sys.exit('duplicate command keys')
+    if max(len(key) for key in keys) > MAX_KEY_LENGTH:
+        sys.exit('command key too long')
+
+    displacements, slots = build_hash(keys)
+    generate_ids(args.ids)
+    generate_table(args.table, displacements, slots)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,214 @@
+/**
+ * @file test_guide.cpp
+ * @brief Mount Guiding Test Suite
+ *
+ * Runs the control thread of the mount on native_sim with both axes on the
+ * emulated counter, advanced along with the kernel clock, and checks the
+ * step rates of guide pulses and the periodic error correction recorded
+ * from them.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <motion/motion_step_emul.h>
+#include <mount/Mount.hpp>
+
+/* Emulated pins of each axis */
+#define RA 0
+#define DEC 1
+
+/* Steps in 10 s at the sidereal rate, 133.7 on the default gearing */
+#define SIDEREAL_STEPS_10S (CONFIG_MOUNT_RA_STEPS_PER_REV * 10000ULL / 86164091U)
+#define DEC_GUIDE_STEPS_10S (CONFIG_MOUNT_DEC_STEPS_PER_REV * 10000ULL / 86164091U / 2)
+#define HALF_WORM (CONFIG_MOUNT_RA_WORM_STEPS / 2)
+
+/* Test fixtures */
+static Mount mount;
+static motion_step_emul_t *emul;
+
+/**
+ * @brief Advance the emulated counter to the kernel clock
+ */
+static void sync_counter(void)
+{
+	const uint64_t now = k_ticks_to_us_floor64(k_uptime_ticks()) * emul->hw.frequency /
+			     USEC_PER_SEC;
+
+	if (now > emul->now) {
+		motion_step_emul_run(emul, now - emul->now);
+	}
+}
+
+/**
+ * @brief Run for a time, the control thread runs its periods in between
+ */
+static void run(uint32_t ms)
+{
+	const int64_t end = k_uptime_get() + ms;
+
+	while (k_uptime_get() < end) {
+		k_sleep(K_MSEC(1));
+		sync_counter();
+	}
+}
+
+/**
+ * @brief Run until the RA axis has stepped a number of times
+ * @return Milliseconds it took
+ */
+static int64_t run_until_ra_steps(uint32_t steps)
+{
+	const int64_t start = k_uptime_get();
+
+	while (emul->rising_edges[RA] < steps && k_uptime_get() - start < 600000) {
+		k_sleep(K_MSEC(1));
+		sync_counter();
+	}
+	zassert_true(emul->rising_edges[RA] >= steps, "RA should have reached step %u", steps);
+
+	return k_uptime_get() - start;
+}
+
+/**
+ * @brief Steps of both axes over a time
+ */
+static void count_steps(uint32_t ms, uint32_t &ra, uint32_t &dec)
+{
+	const uint32_t ra_start = emul->rising_edges[RA];
+	const uint32_t dec_start = emul->rising_edges[DEC];
+
+	run(ms);
+	ra = emul->rising_edges[RA] - ra_start;
+	dec = emul->rising_edges[DEC] - dec_start;
+}
+
+/**
+ * @brief Start the mount once for the suite
+ */
+static void *guide_suite_setup(void)
+{
+	mount.initialize();
+	emul = mount.stepEmulator();
+	zassert_not_null(emul, "The mount should step on the emulated counter");
+	mount.start();
+
+	return NULL;
+}
+
+/**
+ * @brief Setup function called before each test, tracking without pulses
+ */
+static void guide_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(mount.submit({Mount::Command::Type::Track, {1}}), "Tracking should start");
+	zassert_true(mount.guide(Mount::GuideDirection::North, 0), "DEC pulse should end");
+	zassert_true(mount.guide(Mount::GuideDirection::West, 0), "RA pulse should end");
+	zassert_true(mount.setPecMode(Mount::PecMode::Off), "Correction should stop");
+	run(1000);
+}
+
+/* ============================================================================
+ * RATE TESTS
+ * ============================================================================ */
+
+ZTEST(mount_guide, test_tracking_rate)
+{
+	uint32_t ra;
+	uint32_t dec;
+
+	count_steps(10000, ra, dec);
+	zassert_within(ra, SIDEREAL_STEPS_10S, 2, "Sidereal rate, %u steps", ra);
+	zassert_equal(dec, 0, "DEC stands still");
+}
+
+ZTEST(mount_guide, test_ra_pulses_change_rate)
+{
+	uint32_t ra;
+	uint32_t dec;
+
+	zassert_true(mount.guide(Mount::GuideDirection::West, 10000), "Pulse should be queued");
+	count_steps(10000, ra, dec);
+	zassert_within(ra, SIDEREAL_STEPS_10S * 3 / 2, 2, "West at 1.5 times, %u steps", ra);
+	zassert_true(emul->forward[RA], "West is the tracking direction");
+
+	zassert_true(mount.guide(Mount::GuideDirection::East, 10000), "Pulse should be queued");
+	count_steps(10000, ra, dec);
+	zassert_within(ra, SIDEREAL_STEPS_10S / 2, 2, "East at half the rate, %u steps", ra);
+	zassert_true(emul->forward[RA], "Tracking slows down, it does not turn around");
+
+	count_steps(10000, ra, dec);
+	zassert_within(ra, SIDEREAL_STEPS_10S, 2, "Back to the sidereal rate, %u steps", ra);
+	zassert_equal(dec, 0, "DEC stands still");
+}
+
+ZTEST(mount_guide, test_dec_pulses_step_dec)
+{
+	uint32_t ra;
+	uint32_t dec;
+
+	zassert_true(mount.guide(Mount::GuideDirection::North, 10000), "Pulse should be queued");
+	count_steps(10000, ra, dec);
+	zassert_within(dec, DEC_GUIDE_STEPS_10S, 2, "North at half sidereal, %u steps", dec);
+	zassert_true(emul->forward[DEC], "North is the positive direction");
+	zassert_within(ra, SIDEREAL_STEPS_10S, 2, "RA keeps tracking, %u steps", ra);
+
+	zassert_true(mount.guide(Mount::GuideDirection::South, 10000), "Pulse should be queued");
+	count_steps(10000, ra, dec);
+	zassert_within(dec, DEC_GUIDE_STEPS_10S, 2, "South at half sidereal, %u steps", dec);
+	zassert_false(emul->forward[DEC], "South is the negative direction");
+
+	count_steps(10000, ra, dec);
+	zassert_equal(dec, 0, "DEC stops with the pulse");
+}
+
+ZTEST(mount_guide, test_pulse_until_ended)
+{
+	uint32_t ra;
+	uint32_t dec;
+
+	zassert_true(mount.guide(Mount::GuideDirection::West, -1), "Pulse should be queued");
+	count_steps(20000, ra, dec);
+	zassert_within(ra, SIDEREAL_STEPS_10S * 3, 2, "West until ended, %u steps", ra);
+
+	zassert_true(mount.guide(Mount::GuideDirection::West, 0), "Pulse should end");
+	run(100);
+	count_steps(10000, ra, dec);
+	zassert_within(ra, SIDEREAL_STEPS_10S, 2, "Ended, %u steps", ra);
+}
+
+/* ============================================================================
+ * PERIODIC ERROR CORRECTION TESTS
+ * ============================================================================ */
+
+ZTEST(mount_guide, test_pec_plays_back_guide_pattern)
+{
+	uint32_t start = emul->rising_edges[RA];
+	const int64_t plain = run_until_ra_steps(start + HALF_WORM);
+
+	/* Guided west over the first half of the worm turn, left alone over the second */
+	zassert_true(mount.setPecMode(Mount::PecMode::Record), "Recording should start");
+	run(20);
+	start = emul->rising_edges[RA];
+	zassert_true(mount.guide(Mount::GuideDirection::West, -1), "Pulse should be queued");
+	run_until_ra_steps(start + HALF_WORM);
+	zassert_true(mount.guide(Mount::GuideDirection::West, 0), "Pulse should end");
+	run_until_ra_steps(start + CONFIG_MOUNT_RA_WORM_STEPS);
+	run(100);
+	zassert_equal(mount.pecMode(), Mount::PecMode::Play, "Recording should be played back");
+
+	/* Unguided, the first half of the next turn runs fast and the second slow */
+	const int64_t fast = run_until_ra_steps(start + CONFIG_MOUNT_RA_WORM_STEPS + HALF_WORM);
+	const int64_t slow = run_until_ra_steps(start + 2 * CONFIG_MOUNT_RA_WORM_STEPS);
+
+	zassert_true(fast * 10 < plain * 9, "Guided half should run fast, %lld ms for %lld ms",
+		     (long long)fast, (long long)plain);
+	zassert_true(slow * 9 > plain * 10, "Unguided half should run slow, %lld ms for %lld ms",
+		     (long long)slow, (long long)plain);
+}
+
+ZTEST_SUITE(mount_guide, NULL, guide_suite_setup, guide_test_setup, NULL, NULL);
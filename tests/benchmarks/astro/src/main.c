@@ -0,0 +1,269 @@
+/**
+ * @file main.c
+ * @brief Coordinate transformation benchmarks
+ *
+ * Converts a batch of points spread over the sky between equatorial and
+ * horizontal coordinates, with the cached site rotation in single precision
+ * and with the textbook formulas in double precision, and reports cycles
+ * per conversion. The warm-up pass also measures the largest error of the
+ * single precision conversions against the double precision ones. One line
+ * is printed per case, either as CSV or as JSON, between the begin and end
+ * markers so a script can pick the report out of the console log.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+
+#include <astro/astro_transform.h>
+
+#include "bench.h"
+
+/* Points converted per pass */
+#define POINTS 64
+/* Binary angle units in a turn */
+#define TURN 4294967296.0
+/* 52 degrees 30 minutes north */
+#define LATITUDE 189000
+/* 7h 30m of local sidereal time */
+#define LST 0x50000000U
+
+static const struct bench_report report = {
+	.name = "astro",
+	.info = "points",
+	.info_value = POINTS,
+	.column = "error_mas",
+};
+
+/* ============================================================================
+ * DOUBLE PRECISION REFERENCE
+ * ============================================================================ */
+
+static double angle_radians(int64_t angle)
+{
+	return (double)angle * 2.0 * M_PI / TURN;
+}
+
+static uint32_t radians_angle(double radians)
+{
+	return (uint32_t)(int64_t)llround(radians / (2.0 * M_PI) * TURN);
+}
+
+/**
+ * @brief Equatorial to horizontal as usually written, the site trig every time
+ */
+static void reference_horizontal(const astro_equatorial_t *in, astro_horizontal_t *out,
+				 size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		const double lat = angle_radians((int32_t)astro_arcsec_to_angle(LATITUDE));
+		const double ha = angle_radians((uint32_t)(LST - in[i].ra));
+		const double dec = angle_radians(in[i].dec);
+		const double north = cos(lat) * sin(dec) - sin(lat) * cos(dec) * cos(ha);
+
+		out[i].alt = (int32_t)radians_angle(
+			asin(sin(lat) * sin(dec) + cos(lat) * cos(dec) * cos(ha)));
+		out[i].az = radians_angle(atan2(-cos(dec) * sin(ha), north));
+	}
+}
+
+/**
+ * @brief Horizontal to equatorial as usually written
+ */
+static void reference_equatorial(const astro_horizontal_t *in, astro_equatorial_t *out,
+				 size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		const double lat = angle_radians((int32_t)astro_arcsec_to_angle(LATITUDE));
+		const double az = angle_radians(in[i].az);
+		const double alt = angle_radians(in[i].alt);
+		const double meridian = cos(lat) * sin(alt) - sin(lat) * cos(alt) * cos(az);
+
+		out[i].dec = (int32_t)radians_angle(
+			asin(sin(lat) * sin(alt) + cos(lat) * cos(alt) * cos(az)));
+		out[i].ra = LST - radians_angle(atan2(-cos(alt) * sin(az), meridian));
+	}
+}
+
+/* ============================================================================
+ * CONVERSION CASES
+ * ============================================================================ */
+
+/**
+ * @brief How a case converts a batch
+ */
+enum bench_mode {
+	/** One call for the whole batch */
+	MODE_BATCH,
+	/** One call per point */
+	MODE_SINGLE,
+	/** libm in double precision */
+	MODE_DOUBLE,
+};
+
+static astro_site_t site;
+static astro_equatorial_t equatorial[POINTS];
+static astro_horizontal_t horizontal[POINTS];
+static astro_equatorial_t equatorial_out[POINTS];
+static astro_horizontal_t horizontal_out[POINTS];
+static astro_equatorial_t equatorial_reference[POINTS];
+static astro_horizontal_t horizontal_reference[POINTS];
+
+/**
+ * @brief Error of a point in milliarcseconds, the angle around the pole on the sky
+ */
+static uint32_t error_mas(uint32_t around, uint32_t expected_around, int32_t height,
+			  int32_t expected_height)
+{
+	const double scale = 1296000000.0 / TURN;
+	const double around_error =
+		fabs((double)(int32_t)(around - expected_around)) * cos(angle_radians(height));
+	const double height_error = fabs((double)(int32_t)((uint32_t)height - expected_height));
+
+	return (uint32_t)(MAX(around_error, height_error) * scale + 0.5);
+}
+
+/**
+ * @brief Convert the batch in one direction
+ * @return Number of conversions, negative errno if a conversion failed
+ */
+static int bench_convert(bool to_horizontal, enum bench_mode mode)
+{
+	if (mode == MODE_BATCH) {
+		const int ret = to_horizontal ? astro_to_horizontal(&site, LST, equatorial,
+								    horizontal_out, POINTS)
+					      : astro_to_equatorial(&site, LST, horizontal,
+								    equatorial_out, POINTS);
+
+		return ret < 0 ? ret : POINTS;
+	}
+
+	for (size_t i = 0; i < POINTS; i++) {
+		int ret = 0;
+
+		if (mode == MODE_DOUBLE && to_horizontal) {
+			reference_horizontal(&equatorial[i], &horizontal_out[i], 1);
+		} else if (mode == MODE_DOUBLE) {
+			reference_equatorial(&horizontal[i], &equatorial_out[i], 1);
+		} else if (to_horizontal) {
+			ret = astro_to_horizontal(&site, LST, &equatorial[i], &horizontal_out[i],
+						  1);
+		} else {
+			ret = astro_to_equatorial(&site, LST, &horizontal[i], &equatorial_out[i],
+						  1);
+		}
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return POINTS;
+}
+
+/**
+ * @brief Largest error of the last conversion against the reference
+ */
+static uint32_t bench_error(bool to_horizontal)
+{
+	uint32_t worst = 0;
+
+	for (size_t i = 0; i < POINTS; i++) {
+		const uint32_t error =
+			to_horizontal
+				? error_mas(horizontal_out[i].az, horizontal_reference[i].az,
+					    horizontal_out[i].alt, horizontal_reference[i].alt)
+				: error_mas(equatorial_out[i].ra, equatorial_reference[i].ra,
+					    equatorial_out[i].dec, equatorial_reference[i].dec);
+
+		worst = MAX(worst, error);
+	}
+
+	return worst;
+}
+
+/**
+ * @brief Warm up, measure and report a case
+ */
+static void run_case(const char *suite, const char *name, bool to_horizontal,
+		     enum bench_mode mode)
+{
+	struct bench_result result;
+
+	bench_result_init(&result, bench_convert(to_horizontal, mode));
+	if (result.operations <= 0) {
+		bench_report_case(suite, name, "error", &result);
+		return;
+	}
+	result.column = bench_error(to_horizontal);
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		bench_time_t start = bench_now();
+		int operations = bench_convert(to_horizontal, mode);
+		bench_time_t end = bench_now();
+		uint64_t cycles = bench_cycles(start, end);
+
+		if (operations != result.operations) {
+			bench_report_case(suite, name, "error", &result);
+			return;
+		}
+
+		bench_result_add(&result, cycles);
+	}
+
+	bench_report_case(suite, name, "ok", &result);
+}
+
+/**
+ * @brief Run a direction in batches, point by point and in double precision
+ */
+static void run_suite(const char *suite, bool to_horizontal)
+{
+	run_case(suite, "batch", to_horizontal, MODE_BATCH);
+	run_case(suite, "single", to_horizontal, MODE_SINGLE);
+	run_case(suite, "double", to_horizontal, MODE_DOUBLE);
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	if (astro_site_init(&site, LATITUDE) < 0) {
+		printk("Site init failed\n");
+		return -EINVAL;
+	}
+
+	/* Right ascensions and azimuths all round, declinations and altitudes pole to pole */
+	for (size_t i = 0; i < POINTS; i++) {
+		const int32_t band = (int32_t)((i * 37) % POINTS) * 2 + 1;
+
+		equatorial[i].ra = (uint32_t)i * 0x0A3D70A3U;
+		equatorial[i].dec = -ASTRO_ANGLE_90 + band * (ASTRO_ANGLE_90 / POINTS);
+		horizontal[i].az = (uint32_t)i * 0x0F5C28F5U;
+		horizontal[i].alt = equatorial[i].dec;
+	}
+
+	reference_horizontal(equatorial, horizontal_reference, POINTS);
+	reference_equatorial(horizontal, equatorial_reference, POINTS);
+
+	bench_report_begin(&report);
+
+	/* :GA#, :GZ#, horizon checks and alt-az tracking */
+	run_suite("to_horizontal", true);
+
+	/* :MA# and alt-az targets */
+	run_suite("to_equatorial", false);
+
+	bench_report_end();
+
+	timing_stop();
+
+	return 0;
+}
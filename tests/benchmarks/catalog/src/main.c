@@ -0,0 +1,205 @@
+/**
+ * @file main.c
+ * @brief Catalog spatial query benchmarks
+ *
+ * Runs the cone queries behind :Lf# and :LF# over the NGC, once through the
+ * spatial index and once scanning every record, and reports cycles per
+ * query. The NGC is filled up to the size of the full catalogue by
+ * CONFIG_CATALOG_SYNTHETIC_NGC. One line is printed per case, either as CSV
+ * or as JSON, between the begin and end markers so a script can pick the
+ * report out of the console log.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+
+#include <catalog/catalog.h>
+
+#include "bench.h"
+
+#define DEGREE 3600
+#define ARCMIN 60
+
+/* Header field filled in by main() */
+static struct bench_report report = {
+	.name = "catalog",
+	.info = "ngc_objects",
+	.column = "found_per_op",
+};
+
+/* ============================================================================
+ * QUERY CASES
+ * ============================================================================ */
+
+/**
+ * @brief Cone queries of one case
+ */
+struct bench_query {
+	/** Catalog queried, the NGC with or without its index */
+	const catalog_t *catalog;
+	/** Cone radius in arcseconds */
+	uint32_t radius;
+	/** Object limits */
+	catalog_limits_t limits;
+	/** Only look for the closest object, as :Lf# does */
+	bool nearest;
+};
+
+/** Cone centers spread over the sky, right ascension in tenths of a second of time */
+static const struct {
+	uint32_t ra;
+	int32_t dec;
+} centers[] = {
+	{0, 0},
+	{25620, 148560},
+	{126000, -19800},
+	{201600, 79200},
+	{306000, -252000},
+	{378000, 324000},
+	{432000, -86400},
+	{486000, 43200},
+	{540000, 291600},
+	{612000, -324000},
+	{666000, 10800},
+	{720000, -180000},
+	{774000, 216000},
+	{810000, -36000},
+	{846000, 118800},
+	{863990, -306000},
+};
+
+/** The NGC without its index, every query scans all records */
+static catalog_t ngc_linear;
+
+static bool count_object(const catalog_t *catalog, const catalog_record_t *record,
+			 uint32_t distance, void *user_data)
+{
+	ARG_UNUSED(catalog);
+	ARG_UNUSED(record);
+	ARG_UNUSED(distance);
+
+	(*(uint32_t *)user_data)++;
+	return true;
+}
+
+/**
+ * @brief Run one query around every center
+ * @return Number of queries, negative errno if a query failed
+ */
+static int bench_queries(const struct bench_query *query, uint32_t *found)
+{
+	*found = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(centers); i++) {
+		if (query->nearest) {
+			if (catalog_nearest(query->catalog, centers[i].ra, centers[i].dec,
+					    query->radius, &query->limits, NULL) != NULL) {
+				(*found)++;
+			}
+			continue;
+		}
+
+		if (catalog_query_cone(query->catalog, centers[i].ra, centers[i].dec,
+				       query->radius, &query->limits, count_object, found) < 0) {
+			return -EINVAL;
+		}
+	}
+
+	return ARRAY_SIZE(centers);
+}
+
+/**
+ * @brief Warm up, measure and report a case
+ */
+static void run_case(const char *suite, const char *name, const struct bench_query *query)
+{
+	struct bench_result result;
+	uint32_t found;
+
+	bench_result_init(&result, bench_queries(query, &found));
+	if (result.operations <= 0) {
+		bench_report_case(suite, name, "error", &result);
+		return;
+	}
+	result.column = found / result.operations;
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		uint32_t pass_found;
+		bench_time_t start = bench_now();
+		int operations = bench_queries(query, &pass_found);
+		bench_time_t end = bench_now();
+		uint64_t cycles = bench_cycles(start, end);
+
+		if (operations != result.operations || pass_found != found) {
+			bench_report_case(suite, name, "error", &result);
+			return;
+		}
+
+		bench_result_add(&result, cycles);
+	}
+
+	bench_report_case(suite, name, "ok", &result);
+}
+
+/**
+ * @brief Run a query with the index and with a scan of all records
+ */
+static void run_pair(const char *suite, struct bench_query query)
+{
+	query.catalog = &catalog_ngc;
+	run_case(suite, "indexed", &query);
+
+	query.catalog = &ngc_linear;
+	run_case(suite, "linear", &query);
+}
+
+int main(void)
+{
+	catalog_limits_t none;
+	catalog_limits_t bright;
+	catalog_limits_t large;
+
+	timing_init();
+	timing_start();
+
+	ngc_linear = catalog_ngc;
+	ngc_linear.index = NULL;
+
+	catalog_limits_init(&none);
+	bright = none;
+	bright.fainter = 90;
+	large = none;
+	large.smallest = 150;
+
+	report.info_value = catalog_ngc.count;
+	bench_report_begin(&report);
+
+	/* :Lf# with field diameters of an eyepiece, a finder and binoculars */
+	run_pair("identify_15m", (struct bench_query){.radius = 15 * ARCMIN / 2, .limits = none,
+						      .nearest = true});
+	run_pair("identify_1d", (struct bench_query){.radius = DEGREE / 2, .limits = none,
+						     .nearest = true});
+	run_pair("identify_5d", (struct bench_query){.radius = 5 * DEGREE / 2, .limits = none,
+						     .nearest = true});
+
+	/* :LF# over the sky above 60, 30 and 0 degrees of elevation */
+	run_pair("find_30d", (struct bench_query){.radius = 30 * DEGREE, .limits = none});
+	run_pair("find_60d", (struct bench_query){.radius = 60 * DEGREE, .limits = none});
+	run_pair("find_90d", (struct bench_query){.radius = 90 * DEGREE, .limits = none});
+
+	/* :LF# with :Sf90# and :Sl015# */
+	run_pair("find_60d_mag9", (struct bench_query){.radius = 60 * DEGREE, .limits = bright});
+	run_pair("find_60d_size15", (struct bench_query){.radius = 60 * DEGREE, .limits = large});
+
+	bench_report_end();
+
+	timing_stop();
+
+	return 0;
+}
@@ -0,0 +1,13 @@
+# Copyright (c) 2025, OpenAstroTech
+# SPDX-License-Identifier: Apache-2.0
+
+# Clock and report shared by the benchmarks, included from their CMakeLists.txt
+
+target_include_directories(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/include)
+target_sources(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/src/bench.c)
+
+# Simulated time does not advance while code runs, so native_sim measures
+# with the host clock
+if(CONFIG_ARCH_POSIX)
+    target_sources(native_simulator INTERFACE ${CMAKE_CURRENT_LIST_DIR}/src/host_clock_bottom.c)
+endif()
@@ -0,0 +1,155 @@
+/**
+ * @file bench.h
+ * @brief Clock and report shared by the benchmarks
+ *
+ * Every benchmark measures its cases with the same clock and prints one
+ * line per case, either as CSV or as JSON, between begin and end markers
+ * so a script can pick the report out of the console log. A benchmark may
+ * add one field to the header and one column to the cases.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+
+#ifdef CONFIG_ARCH_POSIX
+#include "host_clock_bottom.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * CLOCK
+ * ============================================================================ */
+
+#ifdef CONFIG_ARCH_POSIX
+
+/* Simulated time stands still while code runs, count host nanoseconds */
+typedef uint64_t bench_time_t;
+
+static inline bench_time_t bench_now(void)
+{
+	return host_clock_ns();
+}
+
+static inline uint64_t bench_cycles(bench_time_t start, bench_time_t end)
+{
+	return end - start;
+}
+
+#else
+
+typedef timing_t bench_time_t;
+
+static inline bench_time_t bench_now(void)
+{
+	return timing_counter_get();
+}
+
+static inline uint64_t bench_cycles(bench_time_t start, bench_time_t end)
+{
+	return timing_cycles_get(&start, &end);
+}
+
+#endif
+
+/**
+ * @brief Convert cycles of bench_cycles() to nanoseconds
+ */
+uint64_t bench_cycles_to_ns(uint64_t cycles);
+
+/**
+ * @brief Frequency of the clock of bench_cycles() in MHz
+ */
+uint32_t bench_freq_mhz(void);
+
+/* ============================================================================
+ * REPORT
+ * ============================================================================ */
+
+/**
+ * @brief Report of a benchmark
+ */
+struct bench_report {
+	/** Name in the begin and end markers */
+	const char *name;
+	/** Name of an extra header field, NULL for none */
+	const char *info;
+	/** Value of the extra header field */
+	uint32_t info_value;
+	/** Name of an extra column of the cases, NULL for none */
+	const char *column;
+};
+
+/**
+ * @brief Result of one benchmark case
+ */
+struct bench_result {
+	/** Operations per pass */
+	int operations;
+	/** Value of the extra column */
+	uint32_t column;
+	/** Cycles of all measured passes */
+	uint64_t total;
+	/** Cycles of the fastest pass */
+	uint64_t min;
+	/** Cycles of the slowest pass */
+	uint64_t max;
+};
+
+/**
+ * @brief Start a result before its first measured pass
+ * @param result Result of the case
+ * @param operations Operations per pass
+ */
+static inline void bench_result_init(struct bench_result *result, int operations)
+{
+	*result = (struct bench_result){
+		.operations = operations,
+		.min = UINT64_MAX,
+	};
+}
+
+/**
+ * @brief Add a measured pass to a result
+ * @param result Result of the case
+ * @param cycles Cycles of the pass
+ */
+static inline void bench_result_add(struct bench_result *result, uint64_t cycles)
+{
+	result->total += cycles;
+	result->min = MIN(result->min, cycles);
+	result->max = MAX(result->max, cycles);
+}
+
+/**
+ * @brief Print the begin marker and the header
+ * @param report Report of the benchmark, kept until bench_report_end()
+ */
+void bench_report_begin(const struct bench_report *report);
+
+/**
+ * @brief Print the end marker
+ */
+void bench_report_end(void);
+
+/**
+ * @brief Print one case
+ * @param suite Suite of the case
+ * @param name Name of the case
+ * @param status "ok", "unsupported" or "error"
+ * @param result Result of the case
+ */
+void bench_report_case(const char *suite, const char *name, const char *status,
+		       const struct bench_result *result);
+
+#ifdef __cplusplus
+}
+#endif
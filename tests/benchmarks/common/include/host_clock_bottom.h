@@ -0,0 +1,17 @@
+/**
+ * @file host_clock_bottom.h
+ * @brief Host clock for benchmarks on native_sim
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Read the host monotonic clock
+ * @return Host time in nanoseconds
+ */
+uint64_t host_clock_ns(void);
@@ -0,0 +1,123 @@
+/**
+ * @file bench.c
+ * @brief Clock and report shared by the benchmarks
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#include "bench.h"
+
+static const struct bench_report *current;
+
+/* ============================================================================
+ * CLOCK
+ * ============================================================================ */
+
+/**
+ * @brief Convert cycles of bench_cycles() to nanoseconds
+ */
+uint64_t bench_cycles_to_ns(uint64_t cycles)
+{
+#ifdef CONFIG_ARCH_POSIX
+	return cycles;
+#else
+	return timing_cycles_to_ns(cycles);
+#endif
+}
+
+/**
+ * @brief Frequency of the clock of bench_cycles() in MHz
+ */
+uint32_t bench_freq_mhz(void)
+{
+#ifdef CONFIG_ARCH_POSIX
+	return 1000;
+#else
+	return timing_freq_get_mhz();
+#endif
+}
+
+/* ============================================================================
+ * REPORT
+ * ============================================================================ */
+
+/**
+ * @brief Print the begin marker and the header
+ */
+void bench_report_begin(const struct bench_report *report)
+{
+	current = report;
+
+	printk("=== %s benchmark begin ===\n", report->name);
+
+#ifdef CONFIG_BENCHMARK_OUTPUT_JSON
+	printk("{\"board\":\"%s\",\"timer_mhz\":%u,\"iterations\":%u", CONFIG_BOARD,
+	       bench_freq_mhz(), CONFIG_BENCHMARK_ITERATIONS);
+	if (report->info != NULL) {
+		printk(",\"%s\":%u", report->info, report->info_value);
+	}
+	printk("}\n");
+#else
+	printk("# board=%s timer_mhz=%u iterations=%u", CONFIG_BOARD, bench_freq_mhz(),
+	       CONFIG_BENCHMARK_ITERATIONS);
+	if (report->info != NULL) {
+		printk(" %s=%u", report->info, report->info_value);
+	}
+	printk("\nsuite,case,status,operations");
+	if (report->column != NULL) {
+		printk(",%s", report->column);
+	}
+	printk(",cycles_per_op,min_cycles_per_op,max_cycles_per_op,ns_per_op\n");
+#endif
+}
+
+/**
+ * @brief Print the end marker
+ */
+void bench_report_end(void)
+{
+	printk("=== %s benchmark end ===\n", current->name);
+}
+
+/**
+ * @brief Print one case
+ */
+void bench_report_case(const char *suite, const char *name, const char *status,
+		       const struct bench_result *result)
+{
+	unsigned long long per_op = 0;
+	unsigned long long min_per_op = 0;
+	unsigned long long max_per_op = 0;
+	unsigned long long ns_per_op = 0;
+	int operations = MAX(result->operations, 0);
+
+	if (operations > 0) {
+		const uint64_t total_ops = (uint64_t)operations * CONFIG_BENCHMARK_ITERATIONS;
+
+		per_op = result->total / total_ops;
+		min_per_op = result->min / operations;
+		max_per_op = result->max / operations;
+		ns_per_op = bench_cycles_to_ns(result->total) / total_ops;
+	}
+
+#ifdef CONFIG_BENCHMARK_OUTPUT_JSON
+	printk("{\"suite\":\"%s\",\"case\":\"%s\",\"status\":\"%s\",\"operations\":%d", suite,
+	       name, status, operations);
+	if (current->column != NULL) {
+		printk(",\"%s\":%u", current->column, result->column);
+	}
+	printk(",\"cycles_per_op\":%llu,\"min_cycles_per_op\":%llu,\"max_cycles_per_op\":%llu,"
+	       "\"ns_per_op\":%llu}\n",
+	       per_op, min_per_op, max_per_op, ns_per_op);
+#else
+	printk("%s,%s,%s,%d", suite, name, status, operations);
+	if (current->column != NULL) {
+		printk(",%u", result->column);
+	}
+	printk(",%llu,%llu,%llu,%llu\n", per_op, min_per_op, max_per_op, ns_per_op);
+#endif
+}
@@ -0,0 +1,26 @@
+/**
+ * @file host_clock_bottom.c
+ * @brief Host clock for benchmarks on native_sim
+ *
+ * Built into the native simulator runner, so it runs against the host C
+ * library instead of the embedded one. It does not see the include paths of
+ * the application, hence the relative include.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <time.h>
+
+#include "../include/host_clock_bottom.h"
+
+/**
+ * @brief Read the host monotonic clock
+ */
+uint64_t host_clock_ns(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
@@ -0,0 +1,366 @@
+/**
+ * @file main.c
+ * @brief LX200 parser throughput and latency benchmarks
+ *
+ * Replays recorded client traffic through the framer, the command table
+ * lookup and the parser, runs the coordinate parsers and reply formatting,
+ * and reports cycles per command. One line is printed per case, either as
+ * CSV or as JSON, between the begin and end markers so a script can pick the
+ * report out of the console log.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/timing/timing.h>
+
+#include <lx200/lx200.h>
+#include <lx200/lx200_cache.h>
+#include <lx200/lx200_framer.h>
+#include <lx200/lx200_response.h>
+
+#include "bench.h"
+#include "mixes.h"
+
+/** Largest number of frames in one recorded session */
+#define BENCH_MAX_FRAMES 32
+
+static const struct bench_report report = {
+	.name = "lx200",
+};
+
+/* ============================================================================
+ * RUNNER
+ * ============================================================================ */
+
+/**
+ * @brief One pass of a case
+ * @return Operations done, -ENOTSUP if the code under test is missing or a
+ *         negative errno if the recorded traffic was rejected
+ */
+typedef int (*bench_case_t)(const void *arg);
+
+/**
+ * @brief Warm up, measure and report a case
+ */
+static void run_case(const char *suite, const char *name, bench_case_t fn, const void *arg)
+{
+	struct bench_result result;
+
+	bench_result_init(&result, fn(arg));
+
+	if (result.operations == -ENOTSUP) {
+		bench_report_case(suite, name, "unsupported", &result);
+		return;
+	}
+
+	if (result.operations <= 0) {
+		bench_report_case(suite, name, "error", &result);
+		return;
+	}
+
+	for (int i = 0; i < CONFIG_BENCHMARK_ITERATIONS; i++) {
+		bench_time_t start = bench_now();
+		int operations = fn(arg);
+		bench_time_t end = bench_now();
+		uint64_t cycles = bench_cycles(start, end);
+
+		if (operations != result.operations) {
+			bench_report_case(suite, name, "error", &result);
+			return;
+		}
+
+		bench_result_add(&result, cycles);
+	}
+
+	bench_report_case(suite, name, "ok", &result);
+}
+
+/* ============================================================================
+ * COMMAND CASES
+ * ============================================================================ */
+
+static lx200_framer_t framer;
+
+/** Frames of the current session, split before measuring lookup and parsing */
+static lx200_frame_t frames[BENCH_MAX_FRAMES];
+static char frame_data[BENCH_MAX_FRAMES][LX200_MAX_COMMAND_LENGTH];
+static size_t frame_count;
+
+/**
+ * @brief Split a session into frames outside of the measurement
+ */
+static int split_frames(const bench_mix_t *mix)
+{
+	lx200_frame_t frame;
+
+	frame_count = 0;
+	lx200_framer_reset(&framer);
+
+	for (size_t i = 0; i < mix->count; i++) {
+		lx200_framer_feed(&framer, mix->chunks[i], strlen(mix->chunks[i]));
+
+		while (lx200_framer_peek(&framer, &frame)) {
+			if (frame_count == BENCH_MAX_FRAMES ||
+			    frame.length >= sizeof(frame_data[0])) {
+				return -ENOMEM;
+			}
+
+			memcpy(frame_data[frame_count], frame.data, frame.length);
+			frames[frame_count].data = frame_data[frame_count];
+			frames[frame_count].length = frame.length;
+			frame_count++;
+			lx200_framer_release(&framer);
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Feed every UART read into the framer and drain it
+ */
+static int bench_framing(const void *arg)
+{
+	const bench_mix_t *mix = arg;
+	lx200_frame_t frame;
+	int operations = 0;
+
+	for (size_t i = 0; i < mix->count; i++) {
+		lx200_framer_feed(&framer, mix->chunks[i], strlen(mix->chunks[i]));
+
+		while (lx200_framer_peek(&framer, &frame)) {
+			lx200_framer_release(&framer);
+			operations++;
+		}
+	}
+
+	return operations;
+}
+
+/**
+ * @brief Look up the command key of every frame
+ */
+static int bench_lookup(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	for (size_t i = 0; i < frame_count; i++) {
+		if (lx200_command_lookup(&frames[i].data[1], frames[i].length - 2) == NULL) {
+			return -EINVAL;
+		}
+	}
+
+	return (int)frame_count;
+}
+
+/**
+ * @brief Parse every frame into a command view
+ */
+static int bench_parse(const void *arg)
+{
+	ARG_UNUSED(arg);
+	lx200_command_view_t view;
+
+	for (size_t i = 0; i < frame_count; i++) {
+		if (lx200_parse_frame(frames[i].data, frames[i].length, &view) != LX200_PARSE_OK) {
+			return -EINVAL;
+		}
+	}
+
+	return (int)frame_count;
+}
+
+/**
+ * @brief Frame and parse every UART read, as the command thread does
+ */
+static int bench_pipeline(const void *arg)
+{
+	const bench_mix_t *mix = arg;
+	lx200_command_view_t view;
+	lx200_frame_t frame;
+	int operations = 0;
+
+	for (size_t i = 0; i < mix->count; i++) {
+		lx200_framer_feed(&framer, mix->chunks[i], strlen(mix->chunks[i]));
+
+		while (lx200_framer_peek(&framer, &frame)) {
+			lx200_parse_result_t result = lx200_parse_frame(frame.data, frame.length, &view);
+
+			lx200_framer_release(&framer);
+			if (result != LX200_PARSE_OK) {
+				return -EINVAL;
+			}
+			operations++;
+		}
+	}
+
+	return operations;
+}
+
+/**
+ * @brief Legacy parser with strlen() and copies, for comparison
+ */
+static int bench_parse_string(const void *arg)
+{
+	ARG_UNUSED(arg);
+	lx200_command_t command;
+
+	for (size_t i = 0; i < frame_count; i++) {
+		char cmd_string[LX200_MAX_COMMAND_LENGTH];
+
+		memcpy(cmd_string, frames[i].data, frames[i].length);
+		cmd_string[frames[i].length] = '\0';
+
+		if (lx200_parse_command_string(cmd_string, &command) != LX200_PARSE_OK) {
+			return -EINVAL;
+		}
+	}
+
+	return (int)frame_count;
+}
+
+static void run_mix(const bench_mix_t *mix)
+{
+	lx200_framer_reset(&framer);
+	run_case(mix->name, "framing", bench_framing, mix);
+
+	if (split_frames(mix) < 0) {
+		const struct bench_result none = {0};
+
+		bench_report_case(mix->name, "split", "error", &none);
+		return;
+	}
+
+	run_case(mix->name, "lookup", bench_lookup, NULL);
+	run_case(mix->name, "parse_frame", bench_parse, NULL);
+	run_case(mix->name, "parse_string", bench_parse_string, NULL);
+
+	lx200_framer_reset(&framer);
+	run_case(mix->name, "pipeline", bench_pipeline, mix);
+}
+
+/* ============================================================================
+ * COORDINATE CASES
+ * ============================================================================ */
+
+/**
+ * @brief Parse every recorded parameter of one format
+ */
+static int bench_coordinates(const void *arg)
+{
+	const bench_coordinate_set_t *set = arg;
+	lx200_coordinate_t coord;
+
+	for (size_t i = 0; i < set->count; i++) {
+		if (set->parse(set->inputs[i], &coord) != LX200_PARSE_OK) {
+			return -EINVAL;
+		}
+	}
+
+	return (int)set->count;
+}
+
+/* ============================================================================
+ * REPLY CASES
+ * ============================================================================ */
+
+/**
+ * @brief Format a position reply the way the command handler does
+ */
+static int bench_format(const void *arg)
+{
+	ARG_UNUSED(arg);
+	char buffer[LX200_MAX_RESPONSE_LENGTH];
+	lx200_coordinate_t coord;
+
+	/* 12:34:56 and -45*30:15 */
+	if (lx200_coordinate_from_arcsec(45296, LX200_COORD_HIGH_PRECISION, &coord) < 0 ||
+	    lx200_format_ra_coordinate(&coord, buffer, sizeof(buffer)) < 0 ||
+	    lx200_coordinate_from_arcsec(-163815, LX200_COORD_HIGH_PRECISION, &coord) < 0 ||
+	    lx200_format_dec_coordinate(&coord, buffer, sizeof(buffer)) < 0) {
+		return -ENOTSUP;
+	}
+
+	return 2;
+}
+
+static lx200_cache_t cache;
+static lx200_response_t response;
+
+static int discard_flush(const char *data, size_t length, void *user_data)
+{
+	ARG_UNUSED(data);
+	ARG_UNUSED(length);
+	ARG_UNUSED(user_data);
+	return 0;
+}
+
+/**
+ * @brief Answer a planetarium poll burst from the response cache
+ */
+static int bench_cached_replies(const void *arg)
+{
+	ARG_UNUSED(arg);
+	static const lx200_cache_slot_t polls[] = {LX200_CACHE_RA, LX200_CACHE_DEC,
+						   LX200_CACHE_RA, LX200_CACHE_DEC};
+
+	for (size_t i = 0; i < ARRAY_SIZE(polls); i++) {
+		if (!lx200_cache_lookup(&cache, polls[i], LX200_COORD_HIGH_PRECISION, &response)) {
+			return -EINVAL;
+		}
+	}
+
+	if (lx200_response_flush(&response) < 0) {
+		return -EIO;
+	}
+
+	return ARRAY_SIZE(polls);
+}
+
+static void run_replies(void)
+{
+	run_case("reply", "format", bench_format, NULL);
+
+	lx200_cache_init(&cache);
+	lx200_response_init(&response, discard_flush, NULL);
+	lx200_cache_store(&cache, LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION,
+			  lx200_cache_generation(&cache, LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION),
+			  "12:34:56#", 9);
+	lx200_cache_store(&cache, LX200_CACHE_DEC, LX200_COORD_HIGH_PRECISION,
+			  lx200_cache_generation(&cache, LX200_CACHE_DEC, LX200_COORD_HIGH_PRECISION),
+			  "-45*30:15#", 10);
+	run_case("reply", "cached", bench_cached_replies, NULL);
+}
+
+int main(void)
+{
+	timing_init();
+	timing_start();
+
+	lx200_framer_init(&framer);
+
+	bench_report_begin(&report);
+
+	for (size_t i = 0; i < bench_mix_count; i++) {
+		run_mix(&bench_mixes[i]);
+	}
+
+	for (size_t i = 0; i < bench_coordinate_set_count; i++) {
+		run_case("coordinates", bench_coordinate_sets[i].name, bench_coordinates,
+			 &bench_coordinate_sets[i]);
+	}
+
+	run_replies();
+
+	bench_report_end();
+
+	timing_stop();
+
+	return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file mixes.c
+ * @brief Recorded LX200 traffic used by the benchmarks
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/sys/util.h>
+
+#include "mixes.h"
+
+/* ============================================================================
+ * CLIENT SESSIONS
+ * ============================================================================ */
+
+/* Planetarium position polling, one command per read */
+static const char *const stellarium_poll[] = {
+	":GR#", ":GD#", ":GR#", ":GD#", ":GR#", ":GD#", ":GR#", ":GD#",
+};
+
+/* ASCOM driver connecting to the mount */
+static const char *const ascom_connect[] = {
+	":GVP#", ":GVN#", ":GVD#", ":GVT#", ":U#",  ":GR#", ":GD#",
+	":Gt#",  ":Gg#",  ":GG#",  ":GL#",  ":GC#", ":GS#", ":Gc#",
+};
+
+/* Capture software polling in bursts while guiding */
+static const char *const guiding_poll[] = {
+	":GR#:GD#", ":GA#:GZ#", ":GS#", ":D#", ":RG#:Mn#", ":Qn#", ":GR#:GD#", ":D#",
+};
+
+/* Goto with progress polling and a final sync */
+static const char *const goto_sequence[] = {
+	":Sr12:34:56#", ":Sd+45*30:15#", ":MS#", ":GR#:GD#", ":D#",
+	":GR#:GD#",     ":D#",           ":CM#", ":Q#",
+};
+
+/* Site and time setup followed by a first goto */
+static const char *const site_setup[] = {
+	":St+48*08#",  ":Sg-011*35#",   ":SG-01.0#", ":SL21:15:00#",
+	":SC10/16/25#", ":Sr05:35:17#", ":Sd-05*23:28#", ":MS#",
+};
+
+const bench_mix_t bench_mixes[] = {
+	{"stellarium_poll", stellarium_poll, ARRAY_SIZE(stellarium_poll)},
+	{"ascom_connect", ascom_connect, ARRAY_SIZE(ascom_connect)},
+	{"guiding_poll", guiding_poll, ARRAY_SIZE(guiding_poll)},
+	{"goto_sequence", goto_sequence, ARRAY_SIZE(goto_sequence)},
+	{"site_setup", site_setup, ARRAY_SIZE(site_setup)},
+};
+
+const size_t bench_mix_count = ARRAY_SIZE(bench_mixes);
+
+/* ============================================================================
+ * COORDINATE PARAMETERS
+ * ============================================================================ */
+
+static const char *const ra_high[] = {"12:34:56", "05:35:17", "23:59:59", "00:00:00"};
+static const char *const ra_low[] = {"12:34.5", "05:35.3", "23:59.9", "00:00.0"};
+static const char *const dec_high[] = {"+45*30:15", "-05*23:28", "+89*59:59", "-00*00:30"};
+static const char *const dec_low[] = {"+45*30", "-05*23", "+89*59", "-00*01"};
+static const char *const azimuth[] = {"123*45:56", "359*59:59", "000*00:00", "180*00"};
+static const char *const latitude[] = {"+48*08", "-33*52", "+51*28:38", "-90*00"};
+static const char *const longitude[] = {"-011*35", "+151*12", "+000*00", "-122*25:10"};
+
+const bench_coordinate_set_t bench_coordinate_sets[] = {
+	{"ra_high", lx200_parse_ra_coordinate, ra_high, ARRAY_SIZE(ra_high)},
+	{"ra_low", lx200_parse_ra_coordinate, ra_low, ARRAY_SIZE(ra_low)},
+	{"dec_high", lx200_parse_dec_coordinate, dec_high, ARRAY_SIZE(dec_high)},
+	{"dec_low", lx200_parse_dec_coordinate, dec_low, ARRAY_SIZE(dec_low)},
+	{"azimuth", lx200_parse_az_coordinate, azimuth, ARRAY_SIZE(azimuth)},
+	{"latitude", lx200_parse_latitude, latitude, ARRAY_SIZE(latitude)},
+	{"longitude", lx200_parse_longitude, longitude, ARRAY_SIZE(longitude)},
+};
+
+const size_t bench_coordinate_set_count = ARRAY_SIZE(bench_coordinate_sets);
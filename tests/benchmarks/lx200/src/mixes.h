@@ -0,0 +1,60 @@
+/**
+ * @file mixes.h
+ * @brief Recorded LX200 traffic used by the benchmarks
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include <lx200/lx200.h>
+
+/**
+ * @brief A recorded client session
+ *
+ * Each chunk is the data returned by one UART read, so framing sees the same
+ * split of commands as on the wire.
+ */
+typedef struct {
+	/** Name used in the report */
+	const char *name;
+	/** UART reads in order of arrival */
+	const char *const *chunks;
+	/** Number of reads */
+	size_t count;
+} bench_mix_t;
+
+/**
+ * @brief Coordinate parser
+ */
+typedef lx200_parse_result_t (*bench_coordinate_parser_t)(const char *str,
+							   lx200_coordinate_t *coord);
+
+/**
+ * @brief Recorded parameters of one coordinate format
+ */
+typedef struct {
+	/** Name used in the report */
+	const char *name;
+	/** Parser for the format */
+	bench_coordinate_parser_t parse;
+	/** Parameters as sent by clients */
+	const char *const *inputs;
+	/** Number of parameters */
+	size_t count;
+} bench_coordinate_set_t;
+
+/** Recorded client sessions */
+extern const bench_mix_t bench_mixes[];
+
+/** Number of recorded client sessions */
+extern const size_t bench_mix_count;
+
+/** Recorded coordinate parameters */
+extern const bench_coordinate_set_t bench_coordinate_sets[];
+
+/** Number of recorded coordinate formats */
+extern const size_t bench_coordinate_set_count;
@@ -0,0 +1,233 @@
+/**
+ * @file test_correct.c
+ * @brief Apparent Place Corrections Test Suite
+ *
+ * Checks the corrections against the worked example of Meeus, Astronomical
+ * Algorithms chapter 23, the cadence of each term, the refraction table and
+ * the inverse of each correction.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <astro/astro_correct.h>
+
+/* Binary angle units in a turn */
+#define TURN 4294967296.0
+/* Milliseconds in a day */
+#define DAY_MS 86400000LL
+/* 2028 November 13.19 TD, Meeus example 23.a */
+#define EXAMPLE_MS ((int64_t)(10543.69 * DAY_MS))
+
+/* Test fixtures */
+static astro_corrections_t corrections;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void correct_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(astro_corrections_init(&corrections), "Init should succeed");
+}
+
+/**
+ * @brief Binary angle of an angle in arcseconds
+ */
+static uint32_t arcsec_angle(double arcsec)
+{
+	return (uint32_t)(int64_t)llround(arcsec / ASTRO_TURN_ARCSEC * TURN);
+}
+
+/**
+ * @brief Difference of two binary angles in arcseconds, across the wrap
+ */
+static double error_arcsec(uint32_t a, uint32_t b)
+{
+	return (double)(int32_t)(a - b) * ASTRO_TURN_ARCSEC / TURN;
+}
+
+/* ============================================================================
+ * APPARENT PLACE TESTS
+ * ============================================================================ */
+
+ZTEST(astro_correct, test_initial_identity)
+{
+	astro_equatorial_t place = {
+		.ra = arcsec_angle(123456.0),
+		.dec = -(int32_t)arcsec_angle(9876.0),
+	};
+	const astro_equatorial_t mean = place;
+
+	zassert_ok(astro_apparent_place(&corrections, &place, &place, 1),
+		   "In place should succeed");
+	zassert_true(fabs(error_arcsec(place.ra, mean.ra)) < 0.05, "No term before the update");
+	zassert_true(fabs(error_arcsec((uint32_t)place.dec, (uint32_t)mean.dec)) < 0.05,
+		     "No term before the update");
+}
+
+ZTEST(astro_correct, test_meeus_example)
+{
+	/* Theta Persei, J2000.0 with proper motion to the date */
+	const astro_equatorial_t mean = {
+		.ra = arcsec_angle(((2 * 60 + 44) * 60 + 12.975) * 15.0),
+		.dec = (int32_t)arcsec_angle((49 * 60 + 13) * 60 + 39.90),
+	};
+	const uint32_t ra = arcsec_angle(((2 * 60 + 46) * 60 + 14.390) * 15.0);
+	const uint32_t dec = arcsec_angle((49 * 60 + 21) * 60 + 7.45);
+	astro_equatorial_t apparent;
+
+	zassert_equal(astro_corrections_update(&corrections, EXAMPLE_MS), ASTRO_TERM_ALL,
+		      "First update computes every term");
+	zassert_ok(astro_apparent_place(&corrections, &mean, &apparent, 1),
+		   "Correction should succeed");
+
+	/* On the sky, right ascension shrinks towards the pole */
+	const double ra_error = error_arcsec(apparent.ra, ra) * cos(49.35 * M_PI / 180.0);
+	const double dec_error = error_arcsec((uint32_t)apparent.dec, dec);
+
+	zassert_true(fabs(ra_error) < 1.0, "Right ascension off by %f arcsec", ra_error);
+	zassert_true(fabs(dec_error) < 1.0, "Declination off by %f arcsec", dec_error);
+}
+
+ZTEST(astro_correct, test_cadence)
+{
+	const int64_t start = EXAMPLE_MS;
+	const int64_t aberration = CONFIG_ASTRO_ABERRATION_PERIOD * 1000LL;
+	const int64_t nutation = CONFIG_ASTRO_NUTATION_PERIOD * 1000LL;
+	const int64_t precession = CONFIG_ASTRO_PRECESSION_PERIOD * 1000LL;
+	const int64_t longest = MAX(MAX(aberration, nutation), precession);
+
+	zassert_equal(astro_corrections_update(&corrections, start), ASTRO_TERM_ALL,
+		      "First update computes every term");
+	zassert_equal(astro_corrections_update(&corrections, start + 1), 0, "Nothing is due yet");
+	zassert_true(astro_corrections_update(&corrections, start + aberration) &
+			     ASTRO_TERM_ABERRATION,
+		     "Aberration is due after its period");
+	zassert_equal(astro_corrections_update(&corrections, start + longest), ASTRO_TERM_ALL,
+		      "Every term is due after the longest period");
+	zassert_equal(astro_corrections_update(&corrections, start + longest - 1), 0,
+		      "A step back within the periods is kept");
+	zassert_equal(astro_corrections_update(&corrections, start), ASTRO_TERM_ALL,
+		      "A clock set back recomputes every term");
+}
+
+ZTEST(astro_correct, test_mean_place_round_trip)
+{
+	const astro_equatorial_t mean[] = {
+		{.ra = arcsec_angle(((2 * 60 + 44) * 60 + 12.975) * 15.0),
+		 .dec = (int32_t)arcsec_angle((49 * 60 + 13) * 60 + 39.90)},
+		{.ra = arcsec_angle(300000.0), .dec = -(int32_t)arcsec_angle(80.0 * 3600.0)},
+		{.ra = arcsec_angle(1000000.0), .dec = 0},
+	};
+	astro_equatorial_t places[ARRAY_SIZE(mean)];
+
+	zassert_equal(astro_corrections_update(&corrections, EXAMPLE_MS), ASTRO_TERM_ALL,
+		      "First update computes every term");
+	zassert_ok(astro_apparent_place(&corrections, mean, places, ARRAY_SIZE(places)),
+		   "Correction should succeed");
+	zassert_ok(astro_mean_place(&corrections, places, places, ARRAY_SIZE(places)),
+		   "In place should succeed");
+
+	for (size_t i = 0; i < ARRAY_SIZE(places); i++) {
+		const double dec = (double)mean[i].dec * 2.0 * M_PI / TURN;
+		const double ra_error = error_arcsec(places[i].ra, mean[i].ra) * cos(dec);
+		const double dec_error =
+			error_arcsec((uint32_t)places[i].dec, (uint32_t)mean[i].dec);
+
+		zassert_true(fabs(ra_error) < 1.0, "Right ascension %zu off by %f arcsec", i,
+			     ra_error);
+		zassert_true(fabs(dec_error) < 1.0, "Declination %zu off by %f arcsec", i,
+			     dec_error);
+	}
+}
+
+/* ============================================================================
+ * REFRACTION TESTS
+ * ============================================================================ */
+
+ZTEST(astro_correct, test_refraction)
+{
+	const double horizon = error_arcsec(astro_refraction(&corrections, 0), 0);
+	const double half = error_arcsec(astro_refraction(&corrections, ASTRO_ANGLE_90 / 2), 0);
+	const double zenith = error_arcsec(astro_refraction(&corrections, ASTRO_ANGLE_90), 0);
+	const double below = error_arcsec(astro_refraction(&corrections, -ASTRO_ANGLE_90), 0);
+
+	/* Saemundsson at the standard temperature and pressure */
+	zassert_within(horizon, 1739.0, 1.0, "Horizon refracts by %f arcsec", horizon);
+	zassert_within(half, 60.9, 0.2, "45 degrees refracts by %f arcsec", half);
+	zassert_within(zenith, 0.0, 0.1, "Zenith refracts by %f arcsec", zenith);
+	zassert_true(below >= horizon, "Below the table uses its lowest entry");
+
+	zassert_ok(astro_corrections_set_weather(&corrections, -20, 1010), "Cold air is valid");
+	zassert_true(error_arcsec(astro_refraction(&corrections, 0), 0) > horizon,
+		     "Cold air refracts more");
+
+	zassert_ok(astro_corrections_set_weather(&corrections, 10, 0), "No air is valid");
+	zassert_equal(astro_refraction(&corrections, 0), 0, "No air does not refract");
+}
+
+ZTEST(astro_correct, test_refract_batch)
+{
+	astro_horizontal_t places[] = {
+		{.az = 1234, .alt = 0},
+		{.az = 5678, .alt = ASTRO_ANGLE_90 / 2},
+		{.az = 9012, .alt = ASTRO_ANGLE_90},
+	};
+
+	zassert_ok(astro_refract(&corrections, places, places, ARRAY_SIZE(places)),
+		   "In place should succeed");
+	zassert_equal(places[0].az, 1234, "Azimuth is kept");
+	zassert_within(error_arcsec((uint32_t)places[0].alt, 0), 1739.0, 1.0,
+		       "Horizon is lifted");
+	zassert_equal(places[2].alt, ASTRO_ANGLE_90, "Never past the zenith");
+}
+
+ZTEST(astro_correct, test_unrefract_round_trip)
+{
+	const int32_t altitudes[] = {0, ASTRO_ANGLE_90 / 18, ASTRO_ANGLE_90 / 2,
+				     ASTRO_ANGLE_90 - ASTRO_ANGLE_90 / 90};
+
+	for (size_t i = 0; i < ARRAY_SIZE(altitudes); i++) {
+		astro_horizontal_t place = {.az = 4321, .alt = altitudes[i]};
+
+		zassert_ok(astro_refract(&corrections, &place, &place, 1), "Refract should succeed");
+		zassert_ok(astro_unrefract(&corrections, &place, &place, 1),
+			   "Unrefract should succeed");
+
+		const double error = error_arcsec((uint32_t)place.alt, (uint32_t)altitudes[i]);
+
+		zassert_equal(place.az, 4321, "Azimuth is kept");
+		zassert_true(fabs(error) < 1.0, "Altitude %zu off by %f arcsec", i, error);
+	}
+}
+
+ZTEST(astro_correct, test_invalid_parameters)
+{
+	astro_equatorial_t equatorial = {0};
+	astro_horizontal_t horizontal = {0};
+
+	zassert_equal(astro_corrections_init(NULL), -EINVAL, "NULL should fail");
+	zassert_equal(astro_corrections_update(NULL, 0), -EINVAL, "NULL should fail");
+	zassert_equal(astro_corrections_set_weather(NULL, 10, 1010), -EINVAL, "NULL should fail");
+	zassert_equal(astro_corrections_set_weather(&corrections, 61, 1010), -EINVAL,
+		      "Too hot should fail");
+	zassert_equal(astro_corrections_set_weather(&corrections, 10, 1101), -EINVAL,
+		      "Too dense should fail");
+	zassert_equal(astro_apparent_place(&corrections, NULL, &equatorial, 1), -EINVAL,
+		      "NULL input should fail");
+	zassert_equal(astro_refract(&corrections, &horizontal, NULL, 1), -EINVAL,
+		      "NULL output should fail");
+	zassert_equal(astro_mean_place(NULL, &equatorial, &equatorial, 1), -EINVAL,
+		      "NULL should fail");
+	zassert_equal(astro_unrefract(&corrections, NULL, &horizontal, 1), -EINVAL,
+		      "NULL input should fail");
+	zassert_ok(astro_apparent_place(&corrections, NULL, NULL, 0), "Empty batch is fine");
+}
+
+ZTEST_SUITE(astro_correct, NULL, NULL, correct_test_setup, NULL, NULL);
@@ -0,0 +1,241 @@
+/**
+ * @file test_lst.c
+ * @brief Local Sidereal Time Test Suite
+ *
+ * Checks the integer sidereal time against published values and against
+ * the IAU 1982 polynomial evaluated in double precision.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <astro/astro_lst.h>
+
+/* Kernel tick of most boards */
+#define FREQUENCY 10000U
+/* Fast hardware counter */
+#define FAST_FREQUENCY 84000000U
+
+/* Test fixtures */
+static astro_lst_t lst;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void lst_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(astro_lst_init(&lst, FREQUENCY), "Init should succeed");
+}
+
+/**
+ * @brief Milliseconds of a sidereal time
+ */
+static uint32_t hms_ms(uint32_t h, uint32_t m, double s)
+{
+	return (h * 3600 + m * 60) * 1000U + (uint32_t)lround(s * 1000.0);
+}
+
+/**
+ * @brief Difference of two times of day in milliseconds, across midnight
+ */
+static int32_t ms_difference(uint32_t a, uint32_t b)
+{
+	int32_t difference = (int32_t)(a - b);
+
+	if (difference > (int32_t)ASTRO_DAY_MS / 2) {
+		difference -= ASTRO_DAY_MS;
+	} else if (difference < -(int32_t)ASTRO_DAY_MS / 2) {
+		difference += ASTRO_DAY_MS;
+	}
+
+	return difference;
+}
+
+/**
+ * @brief Greenwich mean sidereal time of the IAU 1982 polynomial in double
+ */
+static uint32_t gmst_reference_ms(int64_t j2000_ms)
+{
+	const double d = (double)j2000_ms / ASTRO_DAY_MS;
+	const double t = d / 36525.0;
+	const double degrees = 280.46061837 + 360.98564736629 * d + 0.000387933 * t * t -
+			       t * t * t / 38710000.0;
+	double turns = fmod(degrees / 360.0, 1.0);
+
+	if (turns < 0.0) {
+		turns += 1.0;
+	}
+
+	return (uint32_t)(turns * ASTRO_DAY_MS) % ASTRO_DAY_MS;
+}
+
+/* ============================================================================
+ * CALENDAR TESTS
+ * ============================================================================ */
+
+ZTEST(astro_lst, test_j2000_ms)
+{
+	zassert_equal(astro_lst_j2000_ms(2000, 1, 1, 12 * 3600000), 0, "J2000.0 is noon");
+	zassert_equal(astro_lst_j2000_ms(2000, 1, 1, 0), -43200000, "Midnight is before");
+	zassert_equal(astro_lst_j2000_ms(2024, 2, 29, 23400000), 762460200000LL,
+		      "Leap day should count");
+	zassert_equal(astro_lst_j2000_ms(2099, 12, 31, 86399000), 3155716799000LL,
+		      "End of the LX200 century");
+	zassert_equal(astro_lst_j2000_ms(1987, 4, 10, 0), -401716800000LL,
+		      "Dates before 2000 should be negative");
+}
+
+/* ============================================================================
+ * ANCHOR TESTS
+ * ============================================================================ */
+
+ZTEST(astro_lst, test_gmst_at_j2000)
+{
+	zassert_false(astro_lst_anchored(&lst), "Not anchored after init");
+	zassert_ok(astro_lst_anchor_utc(&lst, 0, 0), "Anchor should succeed");
+	zassert_true(astro_lst_anchored(&lst), "Anchored");
+
+	/* 18h 41m 50.54841s */
+	zassert_within(astro_lst_ms(&lst, 0), hms_ms(18, 41, 50.548), 1,
+		       "GMST at J2000.0 should match");
+}
+
+ZTEST(astro_lst, test_gmst_published)
+{
+	/* Meeus, Astronomical Algorithms, examples 12.a and 12.b */
+	zassert_ok(astro_lst_anchor_utc(&lst, 0, astro_lst_j2000_ms(1987, 4, 10, 0)),
+		   "Anchor should succeed");
+	zassert_within(astro_lst_ms(&lst, 0), hms_ms(13, 10, 46.367), 1,
+		       "GMST at 0h UT should match");
+
+	zassert_ok(astro_lst_anchor_utc(&lst, 0,
+					astro_lst_j2000_ms(1987, 4, 10, (19 * 60 + 21) * 60000)),
+		   "Anchor should succeed");
+	zassert_within(astro_lst_ms(&lst, 0), hms_ms(8, 34, 57.090), 1,
+		       "GMST during the day should match");
+}
+
+ZTEST(astro_lst, test_gmst_against_reference)
+{
+	/* Every 37 days and 7 hours across the LX200 century */
+	const int64_t step = (37LL * 24 + 7) * 3600000;
+
+	for (int64_t ms = astro_lst_j2000_ms(2000, 1, 1, 0);
+	     ms < astro_lst_j2000_ms(2100, 1, 1, 0); ms += step) {
+		zassert_ok(astro_lst_anchor_utc(&lst, 0, ms), "Anchor should succeed");
+		zassert_within(ms_difference(astro_lst_ms(&lst, 0), gmst_reference_ms(ms)), 0, 1,
+			       "GMST should match the polynomial at %lld ms", ms);
+	}
+}
+
+ZTEST(astro_lst, test_longitude)
+{
+	const uint32_t greenwich = hms_ms(18, 41, 50.548);
+
+	zassert_ok(astro_lst_anchor_utc(&lst, 0, 0), "Anchor should succeed");
+
+	/* 15 degrees is one hour */
+	zassert_ok(astro_lst_set_longitude(&lst, 54000), "East longitude should be set");
+	zassert_within(astro_lst_ms(&lst, 0), greenwich + 3600000, 1, "East is later");
+	zassert_ok(astro_lst_set_longitude(&lst, -10 * 54000), "West longitude should be set");
+	zassert_within(astro_lst_ms(&lst, 0), greenwich - 10 * 3600000, 1, "West is earlier");
+	zassert_ok(astro_lst_set_longitude(&lst, 6 * 54000), "East longitude should be set");
+	zassert_within(astro_lst_ms(&lst, 0), greenwich - 18 * 3600000, 1,
+		       "East wraps across midnight");
+
+	/* A re-anchor keeps the site */
+	zassert_ok(astro_lst_anchor_utc(&lst, 500, 0), "Anchor should succeed");
+	zassert_within(astro_lst_ms(&lst, 500), greenwich - 18 * 3600000, 1,
+		       "Longitude should be kept");
+}
+
+ZTEST(astro_lst, test_anchor_lst)
+{
+	zassert_ok(astro_lst_set_longitude(&lst, -54000), "Longitude should be set");
+	zassert_ok(astro_lst_anchor_lst(&lst, 1000, hms_ms(6, 0, 0)), "Anchor should succeed");
+	zassert_equal(astro_lst_ms(&lst, 1000), hms_ms(6, 0, 0), "LST should be set");
+
+	/* The site moves, sidereal time at Greenwich does not */
+	zassert_ok(astro_lst_set_longitude(&lst, 0), "Longitude should be set");
+	zassert_equal(astro_lst_ms(&lst, 1000), hms_ms(7, 0, 0), "LST should follow the site");
+}
+
+ZTEST(astro_lst, test_invalid_parameters)
+{
+	zassert_equal(astro_lst_init(NULL, FREQUENCY), -EINVAL, "NULL should fail");
+	zassert_equal(astro_lst_init(&lst, 0), -EINVAL, "No frequency should fail");
+	zassert_equal(astro_lst_init(&lst, ASTRO_LST_MAX_FREQUENCY + 1), -EINVAL,
+		      "Too fast should fail");
+	zassert_equal(astro_lst_anchor_utc(NULL, 0, 0), -EINVAL, "NULL should fail");
+	zassert_equal(astro_lst_anchor_lst(&lst, 0, ASTRO_DAY_MS), -EINVAL,
+		      "24h should fail");
+	zassert_equal(astro_lst_set_longitude(&lst, 648001), -EINVAL, "Too far east should fail");
+	zassert_equal(astro_lst_set_longitude(&lst, -648001), -EINVAL,
+		      "Too far west should fail");
+	zassert_false(astro_lst_anchored(NULL), "NULL is never anchored");
+}
+
+/* ============================================================================
+ * RATE TESTS
+ * ============================================================================ */
+
+ZTEST(astro_lst, test_solar_day_gains)
+{
+	const uint64_t day = 86400ULL * FREQUENCY;
+
+	zassert_ok(astro_lst_anchor_lst(&lst, 0, 0), "Anchor should succeed");
+
+	/* 3m 56.5554s a day */
+	zassert_within(astro_lst_ms(&lst, day), hms_ms(0, 3, 56.555), 1,
+		       "A solar day should gain on sidereal time");
+	zassert_within(astro_lst_ms(&lst, day / 2), hms_ms(12, 1, 58.278), 1,
+		       "Half a solar day");
+}
+
+ZTEST(astro_lst, test_sidereal_day_returns)
+{
+	/* A sidereal day is a whole number of ticks at 1 MHz */
+	zassert_ok(astro_lst_init(&lst, 1000000), "Init should succeed");
+	zassert_ok(astro_lst_anchor_lst(&lst, 0, hms_ms(12, 0, 0)), "Anchor should succeed");
+
+	zassert_within(astro_lst_ms(&lst, ASTRO_SIDEREAL_DAY_US), hms_ms(12, 0, 0), 1,
+		       "Sidereal time should return after a sidereal day");
+	zassert_within(astro_lst_ms(&lst, 100 * ASTRO_SIDEREAL_DAY_US), hms_ms(12, 0, 0), 1,
+		       "And after a hundred");
+}
+
+ZTEST(astro_lst, test_years_of_uptime)
+{
+	/* Ten years of a fast counter, against the rate in double */
+	const double per_second = 86400e6 / ASTRO_SIDEREAL_DAY_US;
+
+	zassert_ok(astro_lst_init(&lst, FAST_FREQUENCY), "Init should succeed");
+	zassert_ok(astro_lst_anchor_lst(&lst, 12345, 0), "Anchor should succeed");
+
+	for (uint32_t days = 1; days <= 3653; days += 97) {
+		const uint64_t seconds = days * 86400ULL + 12345;
+		const double expected = fmod(seconds * per_second * 1000.0, ASTRO_DAY_MS);
+		const uint32_t ms =
+			astro_lst_ms(&lst, seconds * FAST_FREQUENCY + 12345);
+
+		zassert_within(ms_difference(ms, (uint32_t)expected), 0, 1,
+			       "No drift expected after %u days", days);
+	}
+}
+
+ZTEST(astro_lst, test_tick_before_anchor)
+{
+	zassert_ok(astro_lst_anchor_lst(&lst, 5000, 100), "Anchor should succeed");
+
+	/* Half a second of sidereal time, read from a tick taken before the anchor */
+	zassert_within(astro_lst_ms(&lst, 0), ASTRO_DAY_MS - 401, 1,
+		       "Should run back across midnight");
+}
+
+ZTEST_SUITE(astro_lst, NULL, NULL, lst_test_setup, NULL, NULL);
@@ -0,0 +1,254 @@
+/**
+ * @file test_transform.c
+ * @brief Coordinate Transformation Test Suite
+ *
+ * Checks the single precision kernels and conversions against the same
+ * formulas evaluated with libm in double precision.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <astro/astro_transform.h>
+
+/* Largest error of a converted coordinate in arcseconds */
+#define MAX_ERROR_ARCSEC 0.1
+/* Binary angle units in a turn */
+#define TURN 4294967296.0
+
+/* Test fixtures */
+static astro_site_t site;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void transform_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* 52 degrees 30 minutes north */
+	zassert_ok(astro_site_init(&site, 189000), "Init should succeed");
+}
+
+/**
+ * @brief Binary angle of an angle in degrees
+ */
+static uint32_t degrees_angle(double degrees)
+{
+	return (uint32_t)(int64_t)llround(degrees / 360.0 * TURN);
+}
+
+/**
+ * @brief Binary angle in radians
+ */
+static double angle_radians(int64_t angle)
+{
+	return (double)angle * 2.0 * M_PI / TURN;
+}
+
+/**
+ * @brief Difference of two binary angles in arcseconds, across the wrap
+ */
+static double error_arcsec(uint32_t a, uint32_t b)
+{
+	return (double)(int32_t)(a - b) * ASTRO_TURN_ARCSEC / TURN;
+}
+
+/**
+ * @brief Horizontal coordinates in double precision
+ */
+static void reference_horizontal(int32_t latitude, uint32_t lst, const astro_equatorial_t *in,
+				 double *az, double *alt)
+{
+	const double lat = angle_radians(latitude);
+	const double ha = angle_radians(lst - in->ra);
+	const double dec = angle_radians(in->dec);
+	const double up = sin(lat) * sin(dec) + cos(lat) * cos(dec) * cos(ha);
+
+	*alt = asin(up);
+	*az = atan2(-cos(dec) * sin(ha), cos(lat) * sin(dec) - sin(lat) * cos(dec) * cos(ha));
+}
+
+/**
+ * @brief Check a batch across the sky at one site against double precision
+ */
+static void check_sky(int32_t latitude_arcsec, uint32_t lst)
+{
+	static astro_equatorial_t in[36 * 17];
+	static astro_horizontal_t out[36 * 17];
+	size_t count = 0;
+
+	zassert_ok(astro_site_init(&site, latitude_arcsec), "Init should succeed");
+
+	for (int ra = 0; ra < 360; ra += 10) {
+		for (int dec = -80; dec <= 80; dec += 10) {
+			in[count].ra = degrees_angle(ra + 0.123);
+			in[count].dec = (int32_t)degrees_angle(dec + 0.456);
+			count++;
+		}
+	}
+
+	zassert_ok(astro_to_horizontal(&site, lst, in, out, count), "Conversion should succeed");
+
+	for (size_t i = 0; i < count; i++) {
+		double az;
+		double alt;
+
+		reference_horizontal(site.latitude, lst, &in[i], &az, &alt);
+
+		const double alt_error =
+			error_arcsec((uint32_t)out[i].alt, degrees_angle(alt * 180.0 / M_PI));
+		/* On the sky, azimuth shrinks towards the zenith */
+		const double az_error =
+			error_arcsec(out[i].az, degrees_angle(az * 180.0 / M_PI)) * cos(alt);
+
+		zassert_true(fabs(alt_error) < MAX_ERROR_ARCSEC,
+			     "Altitude off by %f arcsec at latitude %d, point %zu", alt_error,
+			     latitude_arcsec, i);
+		zassert_true(fabs(az_error) < MAX_ERROR_ARCSEC,
+			     "Azimuth off by %f arcsec at latitude %d, point %zu", az_error,
+			     latitude_arcsec, i);
+	}
+}
+
+/* ============================================================================
+ * ANGLE TESTS
+ * ============================================================================ */
+
+ZTEST(astro_transform, test_angle_conversions)
+{
+	zassert_equal(astro_arcsec_to_angle(324000), ASTRO_ANGLE_90, "90 degrees");
+	zassert_equal((int32_t)astro_arcsec_to_angle(-324000), -ASTRO_ANGLE_90, "-90 degrees");
+	zassert_equal(astro_angle_to_arcsec((int32_t)astro_arcsec_to_angle(-123456)), -123456,
+		      "Signed round trip");
+	zassert_equal(astro_angle_to_arcsec_unsigned(astro_arcsec_to_angle(1295999)), 1295999,
+		      "Unsigned round trip");
+	zassert_equal(astro_angle_to_arcsec_unsigned(UINT32_MAX), 0, "Should wrap to 0");
+	zassert_equal(astro_ra_seconds_to_angle(21600), ASTRO_ANGLE_90, "6h is 90 degrees");
+	zassert_equal(astro_angle_to_ra_seconds(astro_ra_seconds_to_angle(86399)), 86399,
+		      "RA round trip");
+	zassert_equal(astro_angle_to_ra_seconds(UINT32_MAX), 0, "Should wrap to 0");
+}
+
+ZTEST(astro_transform, test_sincos_against_libm)
+{
+	double worst = 0.0;
+
+	/* A prime step, so every quadrant and reduction boundary is crossed */
+	for (uint64_t angle = 0; angle < (1ULL << 32); angle += 1000003) {
+		float s;
+		float c;
+
+		astro_sincos((uint32_t)angle, &s, &c);
+		worst = fmax(worst, fabs(s - sin(angle_radians(angle))));
+		worst = fmax(worst, fabs(c - cos(angle_radians(angle))));
+	}
+
+	zassert_true(worst < 3e-7, "Sine and cosine off by %g", worst);
+}
+
+ZTEST(astro_transform, test_atan2_octants)
+{
+	/* Axes are exact, in between single precision holds a few tens of units */
+	zassert_equal(astro_atan2(0.0f, 1.0f), 0, "Along x");
+	zassert_within(astro_atan2(1.0f, 1.0f), 1U << 29, 64, "45 degrees");
+	zassert_equal(astro_atan2(1.0f, 0.0f), 1U << 30, "90 degrees");
+	zassert_equal(astro_atan2(0.0f, -1.0f), 1U << 31, "180 degrees");
+	zassert_equal(astro_atan2(-1.0f, 0.0f), 3U << 30, "270 degrees");
+	zassert_equal(astro_atan2(0.0f, 0.0f), 0, "Origin has no angle");
+
+	for (int degrees = -179; degrees < 180; degrees += 7) {
+		const double radians = degrees * M_PI / 180.0;
+		const uint32_t angle = astro_atan2(3.0f * (float)sin(radians),
+						   3.0f * (float)cos(radians));
+
+		zassert_true(fabs(error_arcsec(angle, degrees_angle(degrees))) < 0.02,
+			     "atan2 should match at %d degrees", degrees);
+	}
+}
+
+/* ============================================================================
+ * CONVERSION TESTS
+ * ============================================================================ */
+
+ZTEST(astro_transform, test_zenith_and_pole)
+{
+	const uint32_t lst = degrees_angle(100.0);
+	const astro_equatorial_t in[] = {
+		{.ra = lst, .dec = site.latitude},
+		{.ra = 0, .dec = ASTRO_ANGLE_90},
+		{.ra = lst, .dec = 0},
+	};
+	astro_horizontal_t out[ARRAY_SIZE(in)];
+
+	zassert_ok(astro_to_horizontal(&site, lst, in, out, ARRAY_SIZE(in)),
+		   "Conversion should succeed");
+	zassert_true(fabs(error_arcsec((uint32_t)out[0].alt, ASTRO_ANGLE_90)) < MAX_ERROR_ARCSEC,
+		     "Declination of the latitude on the meridian is the zenith");
+	zassert_true(fabs(error_arcsec((uint32_t)out[1].alt, (uint32_t)site.latitude)) <
+			     MAX_ERROR_ARCSEC,
+		     "Pole is at the altitude of the latitude");
+	zassert_true(fabs(error_arcsec(out[1].az, 0)) < MAX_ERROR_ARCSEC, "Pole is north");
+	zassert_true(fabs(error_arcsec(out[2].az, 2U * ASTRO_ANGLE_90)) < MAX_ERROR_ARCSEC,
+		     "Equator on the meridian is south");
+}
+
+ZTEST(astro_transform, test_against_reference)
+{
+	static const int32_t latitudes[] = {-324000, -216000, 0, 126000, 189000, 320400};
+
+	for (size_t i = 0; i < ARRAY_SIZE(latitudes); i++) {
+		check_sky(latitudes[i], degrees_angle(i * 47.3));
+	}
+}
+
+ZTEST(astro_transform, test_round_trip)
+{
+	static astro_horizontal_t in[24 * 9];
+	static astro_equatorial_t equatorial[ARRAY_SIZE(in)];
+	static astro_horizontal_t out[ARRAY_SIZE(in)];
+	const uint32_t lst = degrees_angle(271.5);
+
+	for (size_t i = 0; i < ARRAY_SIZE(in); i++) {
+		in[i].az = degrees_angle((i % 24) * 15.0 + 0.2);
+		in[i].alt = (int32_t)degrees_angle((double)(i / 24) * 10.0 - 5.0);
+	}
+
+	zassert_ok(astro_to_equatorial(&site, lst, in, equatorial, ARRAY_SIZE(in)),
+		   "Conversion should succeed");
+	zassert_ok(astro_to_horizontal(&site, lst, equatorial, out, ARRAY_SIZE(in)),
+		   "Conversion should succeed");
+
+	for (size_t i = 0; i < ARRAY_SIZE(in); i++) {
+		const double cos_alt = cos(angle_radians(in[i].alt));
+
+		zassert_true(fabs(error_arcsec((uint32_t)out[i].alt, (uint32_t)in[i].alt)) <
+				     MAX_ERROR_ARCSEC,
+			     "Altitude should come back at point %zu", i);
+		zassert_true(fabs(error_arcsec(out[i].az, in[i].az)) * cos_alt < MAX_ERROR_ARCSEC,
+			     "Azimuth should come back at point %zu", i);
+	}
+}
+
+ZTEST(astro_transform, test_invalid_parameters)
+{
+	astro_equatorial_t equatorial = {0};
+	astro_horizontal_t horizontal = {0};
+
+	zassert_equal(astro_site_init(NULL, 0), -EINVAL, "NULL should fail");
+	zassert_equal(astro_site_init(&site, 324001), -EINVAL, "Beyond the pole should fail");
+	zassert_equal(astro_site_init(&site, -324001), -EINVAL, "Beyond the pole should fail");
+	zassert_equal(astro_to_horizontal(NULL, 0, &equatorial, &horizontal, 1), -EINVAL,
+		      "NULL site should fail");
+	zassert_equal(astro_to_horizontal(&site, 0, NULL, &horizontal, 1), -EINVAL,
+		      "NULL input should fail");
+	zassert_equal(astro_to_equatorial(&site, 0, &horizontal, NULL, 1), -EINVAL,
+		      "NULL output should fail");
+	zassert_ok(astro_to_equatorial(&site, 0, NULL, NULL, 0), "Empty batch is fine");
+}
+
+ZTEST_SUITE(astro_transform, NULL, NULL, transform_test_setup, NULL, NULL);
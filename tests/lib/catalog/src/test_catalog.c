@@ -0,0 +1,191 @@
+/**
+ * @file test_catalog.c
+ * @brief Object Catalog Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <catalog/catalog.h>
+
+/* Test fixtures */
+static catalog_cursor_t cursor;
+
+static const catalog_t *const catalogs[] = {
+	&catalog_messier,
+	&catalog_ngc,
+	&catalog_ic,
+	&catalog_star,
+};
+
+/**
+ * @brief Setup function called before each test
+ */
+static void catalog_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	catalog_cursor_init(&cursor);
+}
+
+/* ============================================================================
+ * GENERATED DATA TESTS
+ * ============================================================================ */
+
+ZTEST(catalog, test_records_sorted_by_number)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(catalogs); i++) {
+		const catalog_t *catalog = catalogs[i];
+
+		zassert_true(catalog->count > 0, "%s catalog should not be empty", catalog->prefix);
+
+		for (uint16_t j = 1; j < catalog->count; j++) {
+			zassert_true(catalog->records[j - 1].number < catalog->records[j].number,
+				     "%s%u should precede %s%u", catalog->prefix,
+				     catalog->records[j - 1].number, catalog->prefix,
+				     catalog->records[j].number);
+		}
+	}
+}
+
+ZTEST(catalog, test_messier_complete)
+{
+	zassert_equal(catalog_messier.count, 110, "All Messier objects should be present");
+	zassert_equal(catalog_messier.records[0].number, 1, "M1 should come first");
+	zassert_equal(catalog_messier.records[109].number, 110, "M110 should come last");
+}
+
+ZTEST(catalog, test_packed_record)
+{
+	const catalog_record_t *m31 = catalog_find(&catalog_messier, 31);
+
+	zassert_not_null(m31, "M31 should be found");
+	/* 00:42.7 +41:16 */
+	zassert_equal(m31->ra, 25620, "RA should be in tenths of a second of time");
+	zassert_equal(m31->dec, 148560, "Dec should be in arcseconds");
+	zassert_equal(m31->type, CATALOG_GALAXY, "M31 is a galaxy");
+	zassert_equal(catalog_magnitude(m31), 34, "Magnitude should be in tenths");
+	zassert_str_equal(catalog_name(&catalog_messier, m31), "Andromeda Galaxy",
+			  "Name should be kept");
+}
+
+ZTEST(catalog, test_cross_ids)
+{
+	const catalog_record_t *m42 = catalog_find(&catalog_messier, 42);
+	const catalog_record_t *ngc1976 = catalog_find(&catalog_ngc, 1976);
+	const catalog_record_t *ic4725 = catalog_find(&catalog_ic, 4725);
+
+	zassert_not_null(ngc1976, "M42 should also be NGC 1976");
+	zassert_equal(ngc1976->ra, m42->ra, "Cross id should share the position");
+	zassert_equal(ngc1976->dec, m42->dec, "Cross id should share the position");
+	zassert_not_null(ic4725, "M25 should also be IC 4725");
+}
+
+ZTEST(catalog, test_southern_and_unknown_values)
+{
+	/* M77 at -00:01 must keep its sign */
+	zassert_equal(catalog_find(&catalog_messier, 77)->dec, -60, "Sign should be kept");
+	zassert_equal(catalog_magnitude(catalog_find(&catalog_ic, 434)), INT16_MAX,
+		      "Unknown magnitude should be reported");
+	zassert_equal(catalog_magnitude(catalog_find(&catalog_star, 1)), -15,
+		      "Negative magnitudes should be kept");
+	zassert_is_null(catalog_name(&catalog_messier, catalog_find(&catalog_messier, 2)),
+			"Unnamed object should have no name");
+}
+
+/* ============================================================================
+ * LOOKUP TESTS
+ * ============================================================================ */
+
+ZTEST(catalog, test_find_every_record)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(catalogs); i++) {
+		const catalog_t *catalog = catalogs[i];
+
+		for (uint16_t j = 0; j < catalog->count; j++) {
+			zassert_equal_ptr(catalog_find(catalog, catalog->records[j].number),
+					  &catalog->records[j], "%s%u should be found in place",
+					  catalog->prefix, catalog->records[j].number);
+		}
+	}
+}
+
+ZTEST(catalog, test_find_missing)
+{
+	zassert_is_null(catalog_find(&catalog_messier, 0), "M0 does not exist");
+	zassert_is_null(catalog_find(&catalog_messier, 111), "M111 does not exist");
+	zassert_is_null(catalog_find(&catalog_ngc, 1), "NGC 1 is not in the catalog");
+	zassert_is_null(catalog_find(&catalog_ngc, UINT16_MAX), "Past the end");
+	zassert_is_null(catalog_find(NULL, 1), "Should handle NULL catalog");
+}
+
+ZTEST(catalog, test_library_digits)
+{
+	zassert_equal_ptr(catalog_deep_sky(0), &catalog_ngc, "0 selects NGC");
+	zassert_equal_ptr(catalog_deep_sky(1), &catalog_ic, "1 selects IC");
+	zassert_is_null(catalog_deep_sky(2), "UGC is not available");
+	zassert_equal_ptr(catalog_star_library(0), &catalog_star, "0 selects STAR");
+	zassert_is_null(catalog_star_library(1), "SAO is not available");
+}
+
+ZTEST(catalog, test_type_names)
+{
+	zassert_str_equal(catalog_type_to_string(CATALOG_GALAXY), "GAL", "Galaxy");
+	zassert_str_equal(catalog_type_to_string(CATALOG_PLANETARY_NEBULA), "PN",
+			  "Planetary nebula");
+	zassert_str_equal(catalog_type_to_string(CATALOG_TYPE_COUNT), "OTHER",
+			  "Unknown type");
+}
+
+/* ============================================================================
+ * CURSOR TESTS
+ * ============================================================================ */
+
+ZTEST(catalog, test_select)
+{
+	zassert_is_null(catalog_current(&cursor), "Nothing should be selected");
+
+	zassert_equal(catalog_select(&cursor, &catalog_messier, 45), 0, "M45 should exist");
+	zassert_equal(catalog_current(&cursor)->number, 45, "M45 should be selected");
+
+	zassert_equal(catalog_select(&cursor, &catalog_messier, 200), -ENOENT,
+		      "M200 does not exist");
+	zassert_equal(catalog_current(&cursor)->number, 45, "Selection should be kept");
+
+	zassert_equal(catalog_select(NULL, &catalog_messier, 1), -EINVAL,
+		      "Should handle NULL cursor");
+}
+
+ZTEST(catalog, test_next_and_previous)
+{
+	zassert_equal(catalog_select(&cursor, &catalog_ngc, 224), 0, "NGC 224 should exist");
+
+	const catalog_record_t *next = catalog_next(&cursor, &catalog_messier);
+
+	zassert_true(next->number > 224, "Next should follow in the selected catalog");
+	zassert_equal_ptr(cursor.catalog, &catalog_ngc, "Catalog should be kept");
+	zassert_equal(catalog_previous(&cursor, &catalog_messier)->number, 224,
+		      "Previous should return");
+}
+
+ZTEST(catalog, test_wrap_around)
+{
+	zassert_equal(catalog_previous(&cursor, &catalog_messier)->number, 110,
+		      "Previous without selection should start at the end");
+	zassert_equal(catalog_next(&cursor, &catalog_messier)->number, 1,
+		      "Next should wrap to the start");
+	zassert_equal(catalog_previous(&cursor, &catalog_messier)->number, 110,
+		      "Previous should wrap to the end");
+
+	catalog_cursor_init(&cursor);
+	zassert_equal(catalog_next(&cursor, &catalog_star)->number, 1,
+		      "Next without selection should start at the beginning");
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(catalog, NULL, NULL, catalog_test_setup, NULL, NULL);
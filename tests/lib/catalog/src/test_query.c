@@ -0,0 +1,250 @@
+/**
+ * @file test_query.c
+ * @brief Catalog Spatial Query Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/ztest.h>
+#include <catalog/catalog.h>
+
+#define DEGREE   3600
+#define ARCMIN   60
+#define RA_HOUR  (CATALOG_RA_FULL / 24)
+
+/* Test fixtures */
+static catalog_limits_t limits;
+
+/**
+ * @brief Objects seen by a query, compared between the index and a full scan
+ */
+struct found {
+	uint32_t count;
+	uint64_t index_sum;
+	uint32_t farthest;
+	int16_t faintest;
+	uint16_t stop_after;
+};
+
+static bool collect(const catalog_t *catalog, const catalog_record_t *record, uint32_t distance,
+		    void *user_data)
+{
+	struct found *found = user_data;
+
+	found->count++;
+	found->index_sum += (uint64_t)(record - catalog->records) + 1;
+	found->farthest = MAX(found->farthest, distance);
+	found->faintest = MAX(found->faintest, catalog_magnitude(record));
+
+	return found->stop_after == 0 || found->count < found->stop_after;
+}
+
+/**
+ * @brief Run a cone query with and without the index and check both agree
+ */
+static void check_cone(const catalog_t *catalog, uint32_t ra, int32_t dec, uint32_t radius,
+		       struct found *indexed_out)
+{
+	catalog_t linear = *catalog;
+	struct found indexed = {0};
+	struct found scanned = {0};
+
+	linear.index = NULL;
+
+	int result = catalog_query_cone(catalog, ra, dec, radius, &limits, collect, &indexed);
+
+	zassert_equal(catalog_query_cone(&linear, ra, dec, radius, &limits, collect, &scanned),
+		      result, "Index and scan should agree at %u/%d r=%u", ra, dec, radius);
+	zassert_equal(result, indexed.count, "Result should be the number visited");
+	zassert_equal(indexed.count, scanned.count, "Same number of objects at %u/%d r=%u", ra,
+		      dec, radius);
+	zassert_equal(indexed.index_sum, scanned.index_sum, "Same objects at %u/%d r=%u", ra, dec,
+		      radius);
+	zassert_true(indexed.farthest <= radius, "Objects should be inside the cone");
+
+	if (indexed_out != NULL) {
+		*indexed_out = indexed;
+	}
+}
+
+/**
+ * @brief Setup function called before each test
+ */
+static void query_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	catalog_limits_init(&limits);
+}
+
+/* ============================================================================
+ * INDEX TESTS
+ * ============================================================================ */
+
+ZTEST(catalog_query, test_index_covers_every_record)
+{
+	const catalog_t *const catalogs[] = {
+		&catalog_messier, &catalog_ngc, &catalog_ic, &catalog_star,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(catalogs); i++) {
+		const catalog_index_t *index = catalogs[i]->index;
+
+		zassert_not_null(index, "%s should be indexed", catalogs[i]->prefix);
+
+		const uint16_t cells = index->zone_cells[index->zones];
+
+		zassert_equal(index->cell_entries[cells], catalogs[i]->count,
+			      "%s index should hold every record once", catalogs[i]->prefix);
+
+		for (uint16_t cell = 0; cell < cells; cell++) {
+			for (uint16_t e = index->cell_entries[cell] + 1;
+			     e < index->cell_entries[cell + 1]; e++) {
+				zassert_true(catalogs[i]->records[index->entries[e - 1]].magnitude <=
+						     catalogs[i]->records[index->entries[e]].magnitude,
+					     "Cells should be sorted brightest first");
+			}
+		}
+	}
+}
+
+ZTEST(catalog_query, test_distance)
+{
+	zassert_equal(catalog_distance(0, 0, 0, 0), 0, "Same position");
+	zassert_equal(catalog_distance(0, 0, RA_HOUR, 0), 15 * DEGREE,
+		      "An hour on the equator is 15 degrees");
+	zassert_equal(catalog_distance(0, 0, CATALOG_RA_FULL / 2, 0), 180 * DEGREE,
+		      "Opposite points");
+	zassert_equal(catalog_distance(0, 90 * DEGREE, 5 * RA_HOUR, 80 * DEGREE), 10 * DEGREE,
+		      "Right ascension does not matter at the pole");
+	zassert_equal(catalog_distance(23 * RA_HOUR + RA_HOUR / 2, 0, RA_HOUR / 2, 0), 15 * DEGREE,
+		      "Distance should wrap at 0h");
+}
+
+/* ============================================================================
+ * CONE QUERY TESTS
+ * ============================================================================ */
+
+ZTEST(catalog_query, test_cone_matches_scan)
+{
+	static const int32_t decs[] = {-89 * DEGREE, -45 * DEGREE, -1 * DEGREE, 0,
+				       22 * DEGREE,  60 * DEGREE,  88 * DEGREE};
+	static const uint32_t radii[] = {30 * ARCMIN, 3 * DEGREE, 15 * DEGREE, 60 * DEGREE,
+					 120 * DEGREE};
+
+	for (uint32_t ra = 0; ra < CATALOG_RA_FULL; ra += 5 * RA_HOUR / 2) {
+		for (size_t d = 0; d < ARRAY_SIZE(decs); d++) {
+			for (size_t r = 0; r < ARRAY_SIZE(radii); r++) {
+				check_cone(&catalog_ngc, ra, decs[d], radii[r], NULL);
+				check_cone(&catalog_messier, ra, decs[d], radii[r], NULL);
+			}
+		}
+	}
+}
+
+ZTEST(catalog_query, test_cone_finds_object)
+{
+	const catalog_record_t *m31 = catalog_find(&catalog_messier, 31);
+	uint32_t distance = UINT32_MAX;
+
+	zassert_equal_ptr(catalog_nearest(&catalog_messier, m31->ra + 10, m31->dec + 30,
+					  10 * ARCMIN, NULL, &distance),
+			  m31, "M31 should be nearest to its own position");
+	zassert_true(distance < 60, "Distance should be small, got %u", distance);
+
+	zassert_is_null(catalog_nearest(&catalog_messier, m31->ra, -m31->dec, 1 * DEGREE, NULL,
+					NULL),
+			"Nothing should be near the mirrored position");
+}
+
+ZTEST(catalog_query, test_cone_across_zero_hours)
+{
+	/* M31 at 00:42.7 seen from 23:50 */
+	const catalog_record_t *m31 = catalog_find(&catalog_messier, 31);
+	struct found found;
+
+	check_cone(&catalog_messier, 23 * RA_HOUR + 5 * RA_HOUR / 6, m31->dec, 12 * DEGREE, &found);
+
+	zassert_true(found.count > 0, "Cone should wrap past 0h");
+}
+
+ZTEST(catalog_query, test_cone_around_pole)
+{
+	struct found all;
+	struct found north;
+	struct found south;
+
+	check_cone(&catalog_star, 0, 90 * DEGREE, 180 * DEGREE, &all);
+	check_cone(&catalog_star, 0, 90 * DEGREE, 90 * DEGREE, &north);
+	check_cone(&catalog_star, 0, -90 * DEGREE, 90 * DEGREE - 1, &south);
+
+	zassert_equal(all.count, catalog_star.count, "Whole sky should hold every star");
+	zassert_true(north.count + south.count >= catalog_star.count,
+		     "Both hemispheres should hold every star");
+}
+
+/* ============================================================================
+ * LIMIT TESTS
+ * ============================================================================ */
+
+ZTEST(catalog_query, test_magnitude_limits)
+{
+	struct found bright;
+	struct found all;
+
+	limits.fainter = 80;
+	check_cone(&catalog_ngc, 0, 0, 180 * DEGREE, &bright);
+	zassert_true(bright.count > 0, "Some NGC objects are brighter than 8");
+	zassert_true(bright.faintest <= 80, "Fainter objects should be skipped");
+
+	limits.brighter = 60;
+	check_cone(&catalog_ngc, 0, 0, 180 * DEGREE, NULL);
+
+	limits.fainter = INT16_MAX;
+	limits.brighter = INT16_MIN;
+	check_cone(&catalog_ic, 0, 0, 180 * DEGREE, &all);
+	zassert_equal(all.count, catalog_ic.count, "Unknown magnitudes should pass without limits");
+}
+
+ZTEST(catalog_query, test_size_limits)
+{
+	const catalog_record_t *m31 = catalog_find(&catalog_messier, 31);
+	struct found stars;
+
+	limits.smallest = 1000;
+	zassert_equal_ptr(catalog_nearest(&catalog_messier, m31->ra, m31->dec, 5 * DEGREE,
+					  &limits, NULL),
+			  m31, "M31 is larger than 100'");
+	check_cone(&catalog_star, 0, 0, 180 * DEGREE, &stars);
+	zassert_equal(stars.count, 0, "Stars have no size");
+
+	limits.smallest = 0;
+	limits.largest = 100;
+	zassert_not_equal_ptr(catalog_nearest(&catalog_messier, m31->ra, m31->dec, 5 * DEGREE,
+					      &limits, NULL),
+			      m31, "M31 is larger than 10'");
+	check_cone(&catalog_ngc, 12 * RA_HOUR, 12 * DEGREE, 30 * DEGREE, NULL);
+}
+
+ZTEST(catalog_query, test_stop_and_errors)
+{
+	struct found found = {.stop_after = 3};
+
+	zassert_equal(catalog_query_cone(&catalog_ngc, 0, 0, 180 * DEGREE, NULL, collect, &found),
+		      3, "Query should stop when asked");
+	zassert_equal(catalog_query_cone(NULL, 0, 0, DEGREE, NULL, collect, &found), -EINVAL,
+		      "Should handle NULL catalog");
+	zassert_equal(catalog_query_cone(&catalog_ngc, CATALOG_RA_FULL, 0, DEGREE, NULL, collect,
+					 &found),
+		      -EINVAL, "Should reject right ascension out of range");
+	zassert_equal(catalog_query_cone(&catalog_ngc, 0, 91 * DEGREE, DEGREE, NULL, collect,
+					 &found),
+		      -EINVAL, "Should reject declination out of range");
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(catalog_query, NULL, NULL, query_test_setup, NULL, NULL);
@@ -414,6 +414,28 @@ ZTEST(lx200_utils, test_get_parameter_format)
 	zassert_str_equal(format, "None", "Should return 'None' for NULL");
 }
 
+ZTEST(lx200_utils, test_parser_stats)
+{
+	lx200_stats_t stats;
+	
+	lx200_reset_stats();
+	lx200_parse_command_string(":GR#", &command);
+	lx200_parse_command_string(":Sr14:30:45#", &command);
+	lx200_parse_command_string(":GR", &command);
+	lx200_parser_init(&parser_state);
+	lx200_parser_add_data(&parser_state, ":GD#", 4);
+	
+	lx200_get_stats(&stats);
+	zassert_equal(stats.bytes, 4, "Received bytes should be counted");
+	zassert_equal(stats.commands, 2, "Parsed commands should be counted");
+	zassert_equal(stats.errors, 1, "Rejected commands should be counted");
+	
+	lx200_reset_stats();
+	lx200_get_stats(&stats);
+	zassert_equal(stats.commands, 0, "Counters should be reset");
+	zassert_equal(stats.errors, 0, "Counters should be reset");
+}
+
 ZTEST(lx200_utils, test_parse_result_to_string)
 {
 	struct {
@@ -0,0 +1,210 @@
+/**
+ * @file test_cache.c
+ * @brief LX200 Response Cache Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <lx200/lx200_cache.h>
+
+/* Test fixtures */
+static lx200_cache_t cache;
+static lx200_response_t response;
+static char sent[64];
+static size_t sent_length;
+
+/**
+ * @brief Transmit callback keeping the last write
+ */
+static int record_flush(const char *data, size_t length, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	sent_length = MIN(length, sizeof(sent));
+	memcpy(sent, data, sent_length);
+	return 0;
+}
+
+/**
+ * @brief Setup function called before each test
+ */
+static void cache_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	lx200_cache_init(&cache);
+	lx200_response_init(&response, record_flush, NULL);
+	sent_length = 0;
+}
+
+/**
+ * @brief Store a reply the way the dispatcher does after a miss
+ */
+static void store(lx200_cache_slot_t slot, lx200_precision_t precision, const char *text)
+{
+	uint32_t generation = lx200_cache_generation(&cache, slot, precision);
+
+	lx200_cache_store(&cache, slot, precision, generation, text, strlen(text));
+}
+
+/* ============================================================================
+ * LOOKUP TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_cache, test_slot_mapping)
+{
+	zassert_equal(lx200_cache_slot(LX200_ID_GET_RA), LX200_CACHE_RA, "GR should be cached");
+	zassert_equal(lx200_cache_slot(LX200_ID_GET_DEC), LX200_CACHE_DEC, "GD should be cached");
+	zassert_equal(lx200_cache_slot(LX200_ID_GET_ALTITUDE), LX200_CACHE_ALT,
+		      "GA should be cached");
+	zassert_equal(lx200_cache_slot(LX200_ID_GET_AZIMUTH), LX200_CACHE_AZ,
+		      "GZ should be cached");
+	zassert_equal(lx200_cache_slot(LX200_ID_GET_SIDEREAL_TIME), LX200_CACHE_SIDEREAL_TIME,
+		      "GS should be cached");
+	zassert_equal(lx200_cache_slot(LX200_ID_GET_TARGET_RA), LX200_CACHE_COUNT,
+		      "Gr should not be cached");
+}
+
+ZTEST(lx200_cache, test_miss_then_hit)
+{
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION,
+					 &response),
+		      "Empty cache should miss");
+
+	store(LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION, "12:34:56#");
+
+	zassert_true(lx200_cache_lookup(&cache, LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION,
+					&response),
+		     "Stored reply should hit");
+	lx200_response_flush(&response);
+	zassert_equal(sent_length, 9, "Cached reply should be appended");
+	zassert_mem_equal(sent, "12:34:56#", 9, "Cached reply should be appended");
+
+	zassert_equal(cache.stats.hits, 1, "Hit should be counted");
+	zassert_equal(cache.stats.misses, 1, "Miss should be counted");
+}
+
+ZTEST(lx200_cache, test_precision_modes_are_separate)
+{
+	store(LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION, "12:34:56#");
+
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_RA, LX200_COORD_LOW_PRECISION,
+					 &response),
+		      "Other precision mode should miss");
+}
+
+/* ============================================================================
+ * INVALIDATION TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_cache, test_update_within_display_unit_keeps_entry)
+{
+	/* 12:34:56 is 45296 seconds */
+	lx200_cache_update(&cache, LX200_CACHE_RA, 45296);
+	store(LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION, "12:34:56#");
+	store(LX200_CACHE_RA, LX200_COORD_LOW_PRECISION, "12:34.9#");
+
+	lx200_cache_update(&cache, LX200_CACHE_RA, 45296);
+	zassert_true(lx200_cache_lookup(&cache, LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION,
+					&response),
+		     "Unchanged value should hit");
+
+	/* 12:34:57 still shows as 12:34.9 */
+	lx200_cache_update(&cache, LX200_CACHE_RA, 45297);
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION,
+					 &response),
+		      "High precision reply should be invalidated");
+	zassert_true(lx200_cache_lookup(&cache, LX200_CACHE_RA, LX200_COORD_LOW_PRECISION,
+					&response),
+		     "Low precision reply should still hit");
+
+	/* 12:35:00 shows as 12:35.0 */
+	lx200_cache_update(&cache, LX200_CACHE_RA, 45300);
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_RA, LX200_COORD_LOW_PRECISION,
+					 &response),
+		      "Low precision reply should be invalidated");
+}
+
+ZTEST(lx200_cache, test_sign_change_invalidates)
+{
+	lx200_cache_update(&cache, LX200_CACHE_DEC, 30);
+	store(LX200_CACHE_DEC, LX200_COORD_LOW_PRECISION, "+00*00#");
+
+	lx200_cache_update(&cache, LX200_CACHE_DEC, -30);
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_DEC, LX200_COORD_LOW_PRECISION,
+					 &response),
+		      "Crossing zero should change the displayed sign");
+}
+
+ZTEST(lx200_cache, test_negative_unit_boundary_invalidates)
+{
+	/* -00*01:59 shows as -00*01 */
+	lx200_cache_update(&cache, LX200_CACHE_DEC, -119);
+	store(LX200_CACHE_DEC, LX200_COORD_LOW_PRECISION, "-00*01#");
+
+	lx200_cache_update(&cache, LX200_CACHE_DEC, -100);
+	zassert_true(lx200_cache_lookup(&cache, LX200_CACHE_DEC, LX200_COORD_LOW_PRECISION,
+					&response),
+		     "-00*01:40 should still show as -00*01");
+
+	/* -00*02:00 shows as -00*02 */
+	lx200_cache_update(&cache, LX200_CACHE_DEC, -120);
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_DEC, LX200_COORD_LOW_PRECISION,
+					 &response),
+		      "Crossing a negative minute should be invalidated");
+}
+
+ZTEST(lx200_cache, test_stale_store_dropped)
+{
+	uint32_t generation = lx200_cache_generation(&cache, LX200_CACHE_AZ,
+						     LX200_COORD_HIGH_PRECISION);
+
+	/* The mount moves while the reply is being formatted */
+	lx200_cache_update(&cache, LX200_CACHE_AZ, 648000);
+	lx200_cache_store(&cache, LX200_CACHE_AZ, LX200_COORD_HIGH_PRECISION, generation,
+			  "179*59:59#", 10);
+
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_AZ, LX200_COORD_HIGH_PRECISION,
+					 &response),
+		      "Stale reply should not be cached");
+	zassert_equal(cache.stats.stale_stores, 1, "Stale store should be counted");
+}
+
+ZTEST(lx200_cache, test_invalidate_all)
+{
+	store(LX200_CACHE_ALT, LX200_COORD_HIGH_PRECISION, "+45*00:00#");
+	store(LX200_CACHE_SIDEREAL_TIME, LX200_COORD_HIGH_PRECISION, "01:02:03#");
+
+	lx200_cache_invalidate_all(&cache);
+
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_ALT, LX200_COORD_HIGH_PRECISION,
+					 &response),
+		      "Altitude should be invalidated");
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_SIDEREAL_TIME,
+					 LX200_COORD_HIGH_PRECISION, &response),
+		      "Sidereal time should be invalidated");
+}
+
+ZTEST(lx200_cache, test_invalid_parameters)
+{
+	zassert_false(lx200_cache_lookup(NULL, LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION,
+					 &response),
+		      "Should handle NULL cache");
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_COUNT, LX200_COORD_HIGH_PRECISION,
+					 &response),
+		      "Should handle invalid slot");
+
+	/* Too long for an entry, must be ignored */
+	store(LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION, "0123456789abcdefg");
+	zassert_false(lx200_cache_lookup(&cache, LX200_CACHE_RA, LX200_COORD_HIGH_PRECISION,
+					 &response),
+		      "Oversized reply should not be cached");
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(lx200_cache, NULL, NULL, cache_test_setup, NULL, NULL);
@@ -0,0 +1,217 @@
+/**
+ * @file test_command_table.c
+ * @brief LX200 Command Table Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <lx200/lx200.h>
+#include <lx200/lx200_framer.h>
+
+/* Test fixtures */
+static lx200_command_t command;
+
+/* ============================================================================
+ * LOOKUP TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_command_table, test_lookup_known_commands)
+{
+	struct {
+		const char *key;
+		lx200_command_family_t family;
+		lx200_param_grammar_t grammar;
+		lx200_command_id_t id;
+	} test_cases[] = {
+		{"GR", LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_RA},
+		{"Gr", LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_TARGET_RA},
+		{"GVP", LX200_CMD_GET, LX200_PARAM_NONE, LX200_ID_GET_PRODUCT_NAME},
+		{"Sr", LX200_CMD_SET, LX200_PARAM_RA, LX200_ID_SET_TARGET_RA},
+		{"Sd", LX200_CMD_SET, LX200_PARAM_DEC, LX200_ID_SET_TARGET_DEC},
+		{"Sz", LX200_CMD_SET, LX200_PARAM_AZ, LX200_ID_SET_TARGET_AZIMUTH},
+		{"SC", LX200_CMD_SET, LX200_PARAM_DATE, LX200_ID_SET_DATE},
+		{"Q", LX200_CMD_STOP, LX200_PARAM_NONE, LX200_ID_STOP_ALL},
+		{"Qn", LX200_CMD_STOP, LX200_PARAM_NONE, LX200_ID_STOP_NORTH},
+		{"R7", LX200_CMD_SLEW_RATE, LX200_PARAM_NONE, LX200_ID_RATE_CUSTOM_7},
+		{"$QZ+", LX200_CMD_SMART_DRIVE, LX200_PARAM_NONE, LX200_ID_PEC_RA_ENABLE},
+		{"$BA", LX200_CMD_BACKLASH, LX200_PARAM_NUMBER, LX200_ID_BACKLASH_DEC},
+		{"hP", LX200_CMD_HOME, LX200_PARAM_NONE, LX200_ID_HOME_PARK},
+		{"W", LX200_CMD_SITE, LX200_PARAM_DIGIT, LX200_ID_SELECT_SITE},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(test_cases); i++) {
+		const lx200_command_info_t *info =
+			lx200_command_lookup(test_cases[i].key, strlen(test_cases[i].key));
+
+		zassert_not_null(info, "Command '%s' should be found", test_cases[i].key);
+		zassert_equal(info->length, strlen(test_cases[i].key), "Length mismatch for '%s'",
+			      test_cases[i].key);
+		zassert_equal(info->family, test_cases[i].family, "Family mismatch for '%s'",
+			      test_cases[i].key);
+		zassert_equal(info->grammar, test_cases[i].grammar, "Grammar mismatch for '%s'",
+			      test_cases[i].key);
+		zassert_equal(info->id, test_cases[i].id, "Id mismatch for '%s'",
+			      test_cases[i].key);
+	}
+}
+
+ZTEST(lx200_command_table, test_lookup_longest_match)
+{
+	const lx200_command_info_t *info;
+
+	info = lx200_command_lookup("Sr14:30:45#", 11);
+	zassert_not_null(info, "Command with parameter should be found");
+	zassert_equal(info->id, LX200_ID_SET_TARGET_RA, "Parameter should not be part of key");
+
+	info = lx200_command_lookup("B+#", 3);
+	zassert_not_null(info, "Command with symbol suffix should be found");
+	zassert_equal(info->id, LX200_ID_RETICLE_BRIGHTER, "Symbol should be part of key");
+
+	info = lx200_command_lookup("B3#", 3);
+	zassert_not_null(info, "Command with digit parameter should be found");
+	zassert_equal(info->id, LX200_ID_RETICLE_FLASH_RATE, "Digit should be the parameter");
+
+	info = lx200_command_lookup("$QZ-", 3);
+	zassert_not_null(info, "Truncated lookup should find the shorter key");
+	zassert_equal(info->id, LX200_ID_PEC_TOGGLE, "Only the first 3 bytes may be used");
+}
+
+ZTEST(lx200_command_table, test_lookup_unknown_commands)
+{
+	zassert_is_null(lx200_command_lookup("X", 1), "Unknown command should not be found");
+	zassert_is_null(lx200_command_lookup("Zz", 2), "Unknown command should not be found");
+	zassert_is_null(lx200_command_lookup("G", 1), "Bare family prefix is not a command");
+	zassert_is_null(lx200_command_lookup("", 0), "Empty command should not be found");
+	zassert_is_null(lx200_command_lookup(NULL, 2), "Should handle NULL");
+}
+
+/* ============================================================================
+ * PARSER INTEGRATION TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_command_table, test_parse_sets_command_id)
+{
+	zassert_equal(lx200_parse_command_string(":GVN#", &command), LX200_PARSE_OK,
+		      "Parse should succeed");
+	zassert_str_equal(command.command, "GVN", "Three character key should be extracted");
+	zassert_equal(command.id, LX200_ID_GET_FIRMWARE_NUMBER, "Id should be set");
+
+	zassert_equal(lx200_parse_command_string(":$QZ+#", &command), LX200_PARSE_OK,
+		      "Parse should succeed");
+	zassert_str_equal(command.command, "$QZ+", "Four character key should be extracted");
+	zassert_equal(command.family, LX200_CMD_SMART_DRIVE, "Family should be set");
+	zassert_false(command.has_parameter, "Should not have parameter");
+
+	zassert_equal(lx200_parse_command_string(":SG-05.0#", &command), LX200_PARSE_OK,
+		      "Parse should succeed");
+	zassert_str_equal(command.command, "SG", "Sign should start the parameter");
+	zassert_str_equal(command.parameter, "-05.0", "Parameter should be extracted");
+}
+
+ZTEST(lx200_command_table, test_parse_rejects_unknown_command)
+{
+	zassert_equal(lx200_parse_command_string(":Xyz#", &command), LX200_PARSE_INVALID_COMMAND,
+		      "Unknown command should be rejected");
+}
+
+ZTEST(lx200_command_table, test_parse_vendor_command)
+{
+	zassert_equal(lx200_parse_command_string(":XL$Q#", &command), LX200_PARSE_OK,
+		      "Parse should succeed");
+	zassert_equal(command.id, LX200_ID_VENDOR_LATENCY, "Id should be set");
+	zassert_equal(command.family, LX200_CMD_VENDOR, "Family should be set");
+	zassert_str_equal(command.parameter, "$Q", "Family designator should be the parameter");
+}
+
+ZTEST(lx200_command_table, test_family_designators)
+{
+	zassert_str_equal(lx200_command_family_to_string(LX200_CMD_GET), "G",
+			  "Get family designator");
+	zassert_str_equal(lx200_command_family_to_string(LX200_CMD_SMART_DRIVE), "$Q",
+			  "Smart drive family designator");
+	zassert_str_equal(lx200_command_family_to_string(LX200_CMD_VENDOR), "X",
+			  "Vendor family designator");
+	zassert_str_equal(lx200_command_family_to_string(LX200_CMD_UNKNOWN), "unknown",
+			  "Unknown family has no designator");
+}
+
+ZTEST(lx200_command_table, test_parse_rejects_unexpected_parameter)
+{
+	zassert_equal(lx200_parse_command_string(":GR12#", &command),
+		      LX200_PARSE_INVALID_PARAMETER, "Get command takes no parameter");
+}
+
+/* ============================================================================
+ * COMMAND VIEW TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_command_table, test_view_is_compact)
+{
+	zassert_true(sizeof(lx200_command_view_t) <= 4, "View should fit a 4 byte queue item");
+}
+
+ZTEST(lx200_command_table, test_view_from_framer)
+{
+	static lx200_framer_t framer;
+	static const char input[] = ":GR#:Sr12:34:56#";
+	lx200_command_view_t view;
+	lx200_frame_t frame;
+
+	lx200_framer_init(&framer);
+	lx200_framer_feed(&framer, input, sizeof(input) - 1);
+
+	zassert_true(lx200_framer_peek(&framer, &frame), "First frame should be queued");
+	zassert_equal(lx200_parse_frame(frame.data, frame.length, &view), LX200_PARSE_OK,
+		      "Parse should succeed");
+	zassert_equal(view.id, LX200_ID_GET_RA, "Id should be set");
+	zassert_equal(view.family, LX200_CMD_GET, "Family should be set");
+	zassert_equal(view.length, 0, "Should not have parameter");
+	lx200_framer_release(&framer);
+
+	zassert_true(lx200_framer_peek(&framer, &frame), "Second frame should be queued");
+	zassert_equal(lx200_parse_frame(frame.data, frame.length, &view), LX200_PARSE_OK,
+		      "Parse should succeed");
+	zassert_equal(view.id, LX200_ID_SET_TARGET_RA, "Id should be set");
+	zassert_equal(view.length, 8, "Parameter length should be set");
+	zassert_mem_equal(lx200_command_view_parameter(frame.data, &view), "12:34:56", 8,
+			  "Parameter should point into the frame");
+	lx200_framer_release(&framer);
+}
+
+ZTEST(lx200_command_table, test_view_without_terminating_nul)
+{
+	/* Only the first four bytes are part of the frame */
+	static const char frame[] = ":GD#:GR#";
+	lx200_command_view_t view;
+
+	zassert_equal(lx200_parse_frame(frame, 4, &view), LX200_PARSE_OK,
+		      "Parse should succeed");
+	zassert_equal(view.id, LX200_ID_GET_DEC, "Length should bound the frame");
+}
+
+ZTEST(lx200_command_table, test_view_errors)
+{
+	lx200_command_view_t view;
+
+	zassert_equal(lx200_parse_frame(":", 1, &view), LX200_PARSE_INVALID_COMMAND,
+		      "Short frame should be rejected");
+	zassert_equal(lx200_parse_frame("GR#", 3, &view), LX200_PARSE_INVALID_PREFIX,
+		      "Missing prefix should be rejected");
+	zassert_equal(lx200_parse_frame(":GR", 3, &view), LX200_PARSE_INVALID_TERMINATOR,
+		      "Missing terminator should be rejected");
+	zassert_equal(lx200_parse_frame(":GR12#", 6, &view), LX200_PARSE_INVALID_PARAMETER,
+		      "Get command takes no parameter");
+	zassert_equal(lx200_parse_frame(NULL, 4, &view), LX200_PARSE_ERROR,
+		      "Should handle NULL frame");
+	zassert_equal(lx200_parse_frame(":GR#", 4, NULL), LX200_PARSE_ERROR,
+		      "Should handle NULL view");
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(lx200_command_table, NULL, NULL, NULL, NULL, NULL);
@@ -2,17 +2,23 @@
  * @file test_coordinates.c
  * @brief LX200 Coordinate Parsing Test Suite
  *
- * These tests are for the coordinate parsing functions that are currently
- * unimplemented. They serve as specifications for future implementation.
+ * The coordinate parsing tests cover the implemented RA/Dec/Alt/Az and
+ * geographic parsers. The remaining tests are for functions that are
+ * currently unimplemented and serve as specifications for future
+ * implementation.
  *
  * Copyright (c) 2025, OpenAstroTech
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <errno.h>
 #include <string.h>
 #include <zephyr/ztest.h>
 #include <lx200/lx200.h>
 
+/* Test helper macros */
+#define ASSERT_PARSE_OK(result) zassert_equal(result, LX200_PARSE_OK, "Parse should succeed")
+
 /* Test fixtures */
 static lx200_coordinate_t coordinate;
 static lx200_time_t time_val;
@@ -35,22 +41,15 @@ static void coordinate_test_setup(void *fixture)
 
 ZTEST(lx200_coordinates, test_parse_ra_high_precision)
 {
-	/* These tests will pass once the functions are implemented */
-	
 	/* Test valid RA in high precision format: HH:MM:SS */
 	const char *ra_str = "14:30:45";
 	lx200_parse_result_t result = lx200_parse_ra_coordinate(ra_str, &coordinate);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
-	
-	/* TODO: When implemented, test should be:
-	 * ASSERT_PARSE_OK(result);
-	 * zassert_equal(coordinate.degrees, 14, "Hours should be 14");
-	 * zassert_equal(coordinate.minutes, 30, "Minutes should be 30");
-	 * zassert_equal(coordinate.seconds, 45, "Seconds should be 45");
-	 * zassert_equal(coordinate.precision, LX200_COORD_HIGH_PRECISION, "Should be high precision");
-	 */
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 14, "Hours should be 14");
+	zassert_equal(coordinate.minutes, 30, "Minutes should be 30");
+	zassert_equal(coordinate.seconds, 45, "Seconds should be 45");
+	zassert_equal(coordinate.precision, LX200_COORD_HIGH_PRECISION, "Should be high precision");
 }
 
 ZTEST(lx200_coordinates, test_parse_ra_low_precision)
@@ -59,16 +58,11 @@ ZTEST(lx200_coordinates, test_parse_ra_low_precision)
 	const char *ra_str = "14:30.5";
 	lx200_parse_result_t result = lx200_parse_ra_coordinate(ra_str, &coordinate);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
-	
-	/* TODO: When implemented, test should be:
-	 * ASSERT_PARSE_OK(result);
-	 * zassert_equal(coordinate.degrees, 14, "Hours should be 14");
-	 * zassert_equal(coordinate.minutes, 30, "Minutes should be 30");
-	 * zassert_equal(coordinate.tenths, 5, "Tenths should be 5");
-	 * zassert_equal(coordinate.precision, LX200_COORD_LOW_PRECISION, "Should be low precision");
-	 */
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 14, "Hours should be 14");
+	zassert_equal(coordinate.minutes, 30, "Minutes should be 30");
+	zassert_equal(coordinate.tenths, 5, "Tenths should be 5");
+	zassert_equal(coordinate.precision, LX200_COORD_LOW_PRECISION, "Should be low precision");
 }
 
 ZTEST(lx200_coordinates, test_parse_ra_boundary_values)
@@ -87,12 +81,39 @@ ZTEST(lx200_coordinates, test_parse_ra_boundary_values)
 	for (size_t i = 0; i < ARRAY_SIZE(test_cases); i++) {
 		lx200_parse_result_t result = lx200_parse_ra_coordinate(test_cases[i].ra_str, &coordinate);
 		
-		/* Currently all return error since not implemented */
-		zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet: %s", 
+		zassert_equal(result, LX200_PARSE_OK, "Parse should succeed: %s",
 			      test_cases[i].description);
 	}
 }
 
+ZTEST(lx200_coordinates, test_parse_ra_terminated_by_hash)
+{
+	/* Parameters are parsed straight out of the command frame */
+	lx200_parse_result_t result = lx200_parse_ra_coordinate("06:07:08#", &coordinate);
+	
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 6, "Hours should be 6");
+	zassert_equal(coordinate.minutes, 7, "Minutes should be 7");
+	zassert_equal(coordinate.seconds, 8, "Seconds should be 8");
+}
+
+ZTEST(lx200_coordinates, test_parse_ra_invalid)
+{
+	const char *test_cases[] = {
+		"24:00:00", "12:60:00", "12:30:60", "12*30:00", "12:30:45x",
+		"12:30.", ":30:00", "", "+12:30:00",
+	};
+	
+	coordinate.degrees = 99;
+	for (size_t i = 0; i < ARRAY_SIZE(test_cases); i++) {
+		lx200_parse_result_t result = lx200_parse_ra_coordinate(test_cases[i], &coordinate);
+		
+		zassert_equal(result, LX200_PARSE_INVALID_PARAMETER, "'%s' should be rejected",
+			      test_cases[i]);
+	}
+	zassert_equal(coordinate.degrees, 99, "Output should be untouched on error");
+}
+
 /* ============================================================================
  * DECLINATION COORDINATE PARSING TESTS
  * ============================================================================ */
@@ -103,16 +124,11 @@ ZTEST(lx200_coordinates, test_parse_dec_positive)
 	const char *dec_str = "+45*30:15";
 	lx200_parse_result_t result = lx200_parse_dec_coordinate(dec_str, &coordinate);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
-	
-	/* TODO: When implemented, test should be:
-	 * ASSERT_PARSE_OK(result);
-	 * zassert_equal(coordinate.degrees, 45, "Degrees should be 45");
-	 * zassert_equal(coordinate.minutes, 30, "Minutes should be 30");
-	 * zassert_equal(coordinate.seconds, 15, "Seconds should be 15");
-	 * zassert_false(coordinate.is_negative, "Should be positive");
-	 */
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 45, "Degrees should be 45");
+	zassert_equal(coordinate.minutes, 30, "Minutes should be 30");
+	zassert_equal(coordinate.seconds, 15, "Seconds should be 15");
+	zassert_false(coordinate.is_negative, "Should be positive");
 }
 
 ZTEST(lx200_coordinates, test_parse_dec_negative)
@@ -121,16 +137,11 @@ ZTEST(lx200_coordinates, test_parse_dec_negative)
 	const char *dec_str = "-30*15:45";
 	lx200_parse_result_t result = lx200_parse_dec_coordinate(dec_str, &coordinate);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
-	
-	/* TODO: When implemented, test should be:
-	 * ASSERT_PARSE_OK(result);
-	 * zassert_equal(coordinate.degrees, 30, "Degrees should be 30");
-	 * zassert_equal(coordinate.minutes, 15, "Minutes should be 15");
-	 * zassert_equal(coordinate.seconds, 45, "Seconds should be 45");
-	 * zassert_true(coordinate.is_negative, "Should be negative");
-	 */
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 30, "Degrees should be 30");
+	zassert_equal(coordinate.minutes, 15, "Minutes should be 15");
+	zassert_equal(coordinate.seconds, 45, "Seconds should be 45");
+	zassert_true(coordinate.is_negative, "Should be negative");
 }
 
 ZTEST(lx200_coordinates, test_parse_dec_boundary_values)
@@ -149,12 +160,50 @@ ZTEST(lx200_coordinates, test_parse_dec_boundary_values)
 	for (size_t i = 0; i < ARRAY_SIZE(test_cases); i++) {
 		lx200_parse_result_t result = lx200_parse_dec_coordinate(test_cases[i].dec_str, &coordinate);
 		
-		/* Currently all return error since not implemented */
-		zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet: %s", 
+		zassert_equal(result, LX200_PARSE_OK, "Parse should succeed: %s",
 			      test_cases[i].description);
 	}
 }
 
+ZTEST(lx200_coordinates, test_parse_dec_low_precision_and_separators)
+{
+	lx200_parse_result_t result;
+	
+	result = lx200_parse_dec_coordinate("-05*20", &coordinate);
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 5, "Degrees should be 5");
+	zassert_equal(coordinate.minutes, 20, "Minutes should be 20");
+	zassert_true(coordinate.is_negative, "Should be negative");
+	zassert_equal(coordinate.precision, LX200_COORD_LOW_PRECISION, "Should be low precision");
+	
+	/* Meade degree sign and minute mark */
+	result = lx200_parse_dec_coordinate("+12\xdf" "34'56", &coordinate);
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 12, "Degrees should be 12");
+	zassert_equal(coordinate.minutes, 34, "Minutes should be 34");
+	zassert_equal(coordinate.seconds, 56, "Seconds should be 56");
+	
+	/* The sign of a value below one degree must not get lost */
+	result = lx200_parse_dec_coordinate("-00*30:00", &coordinate);
+	ASSERT_PARSE_OK(result);
+	zassert_true(coordinate.is_negative, "Should be negative");
+}
+
+ZTEST(lx200_coordinates, test_parse_dec_invalid)
+{
+	const char *test_cases[] = {
+		"+91*00:00", "+90*00:01", "-90*30", "+45*60:00", "+45*30:60", "+45", "++45*30",
+		"+45#30", "+45*30:15:00",
+	};
+	
+	for (size_t i = 0; i < ARRAY_SIZE(test_cases); i++) {
+		lx200_parse_result_t result = lx200_parse_dec_coordinate(test_cases[i], &coordinate);
+		
+		zassert_equal(result, LX200_PARSE_INVALID_PARAMETER, "'%s' should be rejected",
+			      test_cases[i]);
+	}
+}
+
 /* ============================================================================
  * ALTITUDE/AZIMUTH COORDINATE PARSING TESTS
  * ============================================================================ */
@@ -165,8 +214,11 @@ ZTEST(lx200_coordinates, test_parse_altitude)
 	const char *alt_str = "+30*15:30";
 	lx200_parse_result_t result = lx200_parse_alt_coordinate(alt_str, &coordinate);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 30, "Degrees should be 30");
+	zassert_equal(coordinate.minutes, 15, "Minutes should be 15");
+	zassert_equal(coordinate.seconds, 30, "Seconds should be 30");
+	zassert_false(coordinate.is_negative, "Should be positive");
 }
 
 ZTEST(lx200_coordinates, test_parse_azimuth)
@@ -175,8 +227,15 @@ ZTEST(lx200_coordinates, test_parse_azimuth)
 	const char *az_str = "180*30:15";
 	lx200_parse_result_t result = lx200_parse_az_coordinate(az_str, &coordinate);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 180, "Degrees should be 180");
+	zassert_equal(coordinate.minutes, 30, "Minutes should be 30");
+	zassert_equal(coordinate.seconds, 15, "Seconds should be 15");
+	
+	zassert_equal(lx200_parse_az_coordinate("360*00:00", &coordinate),
+		      LX200_PARSE_INVALID_PARAMETER, "360 degrees should wrap, not parse");
+	zassert_equal(lx200_parse_az_coordinate("-10*00", &coordinate),
+		      LX200_PARSE_INVALID_PARAMETER, "Azimuth has no sign");
 }
 
 /* ============================================================================
@@ -189,8 +248,11 @@ ZTEST(lx200_coordinates, test_parse_longitude)
 	const char *lon_str = "-122*30";
 	lx200_parse_result_t result = lx200_parse_longitude(lon_str, &coordinate);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 122, "Degrees should be 122");
+	zassert_equal(coordinate.minutes, 30, "Minutes should be 30");
+	zassert_true(coordinate.is_negative, "Should be negative");
+	zassert_equal(coordinate.precision, LX200_COORD_LOW_PRECISION, "Should be low precision");
 }
 
 ZTEST(lx200_coordinates, test_parse_latitude)
@@ -199,8 +261,43 @@ ZTEST(lx200_coordinates, test_parse_latitude)
 	const char *lat_str = "+37*45";
 	lx200_parse_result_t result = lx200_parse_latitude(lat_str, &coordinate);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
+	ASSERT_PARSE_OK(result);
+	zassert_equal(coordinate.degrees, 37, "Degrees should be 37");
+	zassert_equal(coordinate.minutes, 45, "Minutes should be 45");
+	zassert_false(coordinate.is_negative, "Should be positive");
+}
+
+/* ============================================================================
+ * FIXED-POINT CONVERSION TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_coordinates, test_coordinate_to_arcsec)
+{
+	zassert_ok(lx200_parse_dec_coordinate("-30*15:45", &coordinate), "Parse should succeed");
+	zassert_equal(lx200_coordinate_to_arcsec(&coordinate), -(30 * 3600 + 15 * 60 + 45),
+		      "Declination in arcseconds");
+	
+	zassert_ok(lx200_parse_dec_coordinate("+90*00", &coordinate), "Parse should succeed");
+	zassert_equal(lx200_coordinate_to_arcsec(&coordinate), 324000, "Pole in arcseconds");
+	
+	zassert_ok(lx200_parse_longitude("-122*30", &coordinate), "Parse should succeed");
+	zassert_equal(lx200_coordinate_to_arcsec(&coordinate), -441000, "Longitude in arcseconds");
+	
+	zassert_equal(lx200_coordinate_to_arcsec(NULL), 0, "Should handle NULL");
+}
+
+ZTEST(lx200_coordinates, test_ra_to_arcsec)
+{
+	zassert_ok(lx200_parse_ra_coordinate("14:30:45", &coordinate), "Parse should succeed");
+	zassert_equal(lx200_ra_to_arcsec(&coordinate), 15 * (14 * 3600 + 30 * 60 + 45),
+		      "High precision RA in arcseconds");
+	
+	zassert_ok(lx200_parse_ra_coordinate("14:30.5", &coordinate), "Parse should succeed");
+	zassert_equal(lx200_ra_to_arcsec(&coordinate), 15 * (14 * 3600 + 30 * 60 + 30),
+		      "Low precision RA in arcseconds");
+	
+	zassert_ok(lx200_parse_ra_coordinate("23:59:59", &coordinate), "Parse should succeed");
+	zassert_equal(lx200_ra_to_arcsec(&coordinate), 1295985, "Largest RA in arcseconds");
 }
 
 /* ============================================================================
@@ -213,15 +310,22 @@ ZTEST(lx200_time_date, test_parse_time)
 	const char *time_str = "14:30:45";
 	lx200_parse_result_t result = lx200_parse_time(time_str, &time_val);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
-	
-	/* TODO: When implemented, test should be:
-	 * ASSERT_PARSE_OK(result);
-	 * zassert_equal(time_val.hours, 14, "Hours should be 14");
-	 * zassert_equal(time_val.minutes, 30, "Minutes should be 30");
-	 * zassert_equal(time_val.seconds, 45, "Seconds should be 45");
-	 */
+	ASSERT_PARSE_OK(result);
+	zassert_equal(time_val.hours, 14, "Hours should be 14");
+	zassert_equal(time_val.minutes, 30, "Minutes should be 30");
+	zassert_equal(time_val.seconds, 45, "Seconds should be 45");
+	zassert_true(time_val.is_24h_format, "Time should be 24 hour");
+
+	ASSERT_PARSE_OK(lx200_parse_time("00:00:00#", &time_val));
+	ASSERT_PARSE_OK(lx200_parse_time("23:59:59", &time_val));
+	zassert_equal(lx200_parse_time("24:00:00", &time_val), LX200_PARSE_INVALID_PARAMETER,
+		      "24h should be invalid");
+	zassert_equal(lx200_parse_time("12:60:00", &time_val), LX200_PARSE_INVALID_PARAMETER,
+		      "60 minutes should be invalid");
+	zassert_equal(lx200_parse_time("12:30", &time_val), LX200_PARSE_INVALID_PARAMETER,
+		      "Seconds are required");
+	zassert_equal(lx200_parse_time("12:30:00x", &time_val), LX200_PARSE_INVALID_PARAMETER,
+		      "Trailing characters should be invalid");
 }
 
 ZTEST(lx200_time_date, test_parse_date)
@@ -230,15 +334,20 @@ ZTEST(lx200_time_date, test_parse_date)
 	const char *date_str = "12/25/23";
 	lx200_parse_result_t result = lx200_parse_date(date_str, &date_val);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
-	
-	/* TODO: When implemented, test should be:
-	 * ASSERT_PARSE_OK(result);
-	 * zassert_equal(date_val.month, 12, "Month should be 12");
-	 * zassert_equal(date_val.day, 25, "Day should be 25");
-	 * zassert_equal(date_val.year, 23, "Year should be 23");
-	 */
+	ASSERT_PARSE_OK(result);
+	zassert_equal(date_val.month, 12, "Month should be 12");
+	zassert_equal(date_val.day, 25, "Day should be 25");
+	zassert_equal(date_val.year, 23, "Year should be 23");
+
+	ASSERT_PARSE_OK(lx200_parse_date("02/29/24#", &date_val));
+	zassert_equal(lx200_parse_date("02/29/23", &date_val), LX200_PARSE_INVALID_PARAMETER,
+		      "29 February needs a leap year");
+	zassert_equal(lx200_parse_date("13/01/23", &date_val), LX200_PARSE_INVALID_PARAMETER,
+		      "Month 13 should be invalid");
+	zassert_equal(lx200_parse_date("04/31/23", &date_val), LX200_PARSE_INVALID_PARAMETER,
+		      "31 April should be invalid");
+	zassert_equal(lx200_parse_date("00/10/23", &date_val), LX200_PARSE_INVALID_PARAMETER,
+		      "Month 0 should be invalid");
 }
 
 ZTEST(lx200_time_date, test_parse_utc_offset)
@@ -248,8 +357,19 @@ ZTEST(lx200_time_date, test_parse_utc_offset)
 	float offset = 0.0f;
 	lx200_parse_result_t result = lx200_parse_utc_offset(offset_str, &offset);
 	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
+	ASSERT_PARSE_OK(result);
+	zassert_within(offset, -8.0f, 0.001f, "Offset should be -8");
+
+	ASSERT_PARSE_OK(lx200_parse_utc_offset("+05.5#", &offset));
+	zassert_within(offset, 5.5f, 0.001f, "Offset should be 5.5");
+	ASSERT_PARSE_OK(lx200_parse_utc_offset("3", &offset));
+	zassert_within(offset, 3.0f, 0.001f, "The sign is optional");
+	zassert_equal(lx200_parse_utc_offset("-14.1", &offset), LX200_PARSE_INVALID_PARAMETER,
+		      "More than 14 hours should be invalid");
+	zassert_equal(lx200_parse_utc_offset("+5.", &offset), LX200_PARSE_INVALID_PARAMETER,
+		      "A tenth is required after the point");
+	zassert_equal(lx200_parse_utc_offset(NULL, &offset), LX200_PARSE_ERROR,
+		      "Should handle NULL string");
 }
 
 /* ============================================================================
@@ -262,9 +382,27 @@ ZTEST(lx200_rates, test_parse_tracking_rate)
 	const char *rate_str = "60.1";
 	float rate = 0.0f;
 	lx200_parse_result_t result = lx200_parse_tracking_rate(rate_str, &rate);
-	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, LX200_PARSE_ERROR, "Function not implemented yet");
+
+	zassert_equal(result, LX200_PARSE_OK, "TT.T should parse");
+	zassert_within(rate, 60.1f, 0.0001f, "Rate should be 60.1 Hz");
+
+	/* DDD.DDD of :T#, terminated by the '#' of the frame */
+	result = lx200_parse_tracking_rate("057.968#", &rate);
+	zassert_equal(result, LX200_PARSE_OK, "DDD.DDD should parse");
+	zassert_within(rate, 57.968f, 0.0001f, "Rate should be 57.968 Hz");
+
+	result = lx200_parse_tracking_rate("60", &rate);
+	zassert_equal(result, LX200_PARSE_OK, "Whole Hz should parse");
+	zassert_within(rate, 60.0f, 0.0001f, "Rate should be 60 Hz");
+
+	zassert_equal(lx200_parse_tracking_rate("60.", &rate), LX200_PARSE_INVALID_PARAMETER,
+		      "Missing decimals should fail");
+	zassert_equal(lx200_parse_tracking_rate("1000.0", &rate), LX200_PARSE_INVALID_PARAMETER,
+		      "Four digits should fail");
+	zassert_equal(lx200_parse_tracking_rate("60.1234", &rate),
+		      LX200_PARSE_INVALID_PARAMETER, "Four decimals should fail");
+	zassert_equal(lx200_parse_tracking_rate("-60.0", &rate), LX200_PARSE_INVALID_PARAMETER,
+		      "Negative rates should fail");
 }
 
 ZTEST(lx200_rates, test_parse_slew_rate)
@@ -284,7 +422,6 @@ ZTEST(lx200_rates, test_parse_slew_rate)
 
 ZTEST(lx200_formatting, test_format_ra_coordinate)
 {
-	/* Test RA coordinate formatting */
 	lx200_coordinate_t coord = {
 		.degrees = 14,
 		.minutes = 30,
@@ -292,17 +429,30 @@ ZTEST(lx200_formatting, test_format_ra_coordinate)
 		.is_negative = false,
 		.precision = LX200_COORD_HIGH_PRECISION
 	};
-	
 	char buffer[32];
-	int result = lx200_format_ra_coordinate(&coord, buffer, sizeof(buffer));
-	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, -1, "Function not implemented yet");
+
+	zassert_equal(lx200_format_ra_coordinate(&coord, buffer, sizeof(buffer)), 9,
+		      "High precision reply length");
+	zassert_str_equal(buffer, "14:30:45#", "High precision RA");
+
+	coord.seconds = 0;
+	coord.tenths = 7;
+	coord.precision = LX200_COORD_LOW_PRECISION;
+	zassert_equal(lx200_format_ra_coordinate(&coord, buffer, sizeof(buffer)), 8,
+		      "Low precision reply length");
+	zassert_str_equal(buffer, "14:30.7#", "Low precision RA");
+
+	zassert_equal(lx200_format_ra_coordinate(&coord, buffer, 8), -ENOSPC,
+		      "No room for the NUL");
+	coord.minutes = 60;
+	zassert_equal(lx200_format_ra_coordinate(&coord, buffer, sizeof(buffer)), -EINVAL,
+		      "Minutes out of range");
+	zassert_equal(lx200_format_ra_coordinate(NULL, buffer, sizeof(buffer)), -EINVAL,
+		      "Should handle NULL");
 }
 
 ZTEST(lx200_formatting, test_format_dec_coordinate)
 {
-	/* Test Dec coordinate formatting */
 	lx200_coordinate_t coord = {
 		.degrees = 45,
 		.minutes = 30,
@@ -310,12 +460,70 @@ ZTEST(lx200_formatting, test_format_dec_coordinate)
 		.is_negative = false,
 		.precision = LX200_COORD_HIGH_PRECISION
 	};
-	
 	char buffer[32];
-	int result = lx200_format_dec_coordinate(&coord, buffer, sizeof(buffer));
-	
-	/* Currently returns error since not implemented */
-	zassert_equal(result, -1, "Function not implemented yet");
+
+	zassert_equal(lx200_format_dec_coordinate(&coord, buffer, sizeof(buffer)), 10,
+		      "High precision reply length");
+	zassert_str_equal(buffer, "+45*30:15#", "High precision Dec");
+
+	coord.degrees = 0;
+	coord.is_negative = true;
+	coord.precision = LX200_COORD_LOW_PRECISION;
+	zassert_equal(lx200_format_dec_coordinate(&coord, buffer, sizeof(buffer)), 7,
+		      "Low precision reply length");
+	zassert_str_equal(buffer, "-00*30#", "Sign of a value below one degree");
+
+	coord.degrees = 100;
+	zassert_equal(lx200_format_dec_coordinate(&coord, buffer, sizeof(buffer)), -EINVAL,
+		      "Degrees out of range");
+}
+
+ZTEST(lx200_formatting, test_format_azimuth_coordinate)
+{
+	lx200_coordinate_t coord = {
+		.degrees = 7,
+		.minutes = 5,
+		.seconds = 3,
+		.precision = LX200_COORD_HIGH_PRECISION
+	};
+	char buffer[32];
+
+	zassert_equal(lx200_format_azimuth_coordinate(&coord, buffer, sizeof(buffer)), 10,
+		      "High precision reply length");
+	zassert_str_equal(buffer, "007*05:03#", "High precision azimuth");
+
+	coord.precision = LX200_COORD_LOW_PRECISION;
+	zassert_equal(lx200_format_azimuth_coordinate(&coord, buffer, sizeof(buffer)), 7,
+		      "Low precision reply length");
+	zassert_str_equal(buffer, "007*05#", "Low precision azimuth");
+
+	coord.is_negative = true;
+	zassert_equal(lx200_format_azimuth_coordinate(&coord, buffer, sizeof(buffer)), -EINVAL,
+		      "Azimuth is never negative");
+}
+
+ZTEST(lx200_formatting, test_coordinate_from_arcsec)
+{
+	char buffer[32];
+
+	/* -00*01:59 is shown as -00*01 in low precision */
+	zassert_ok(lx200_coordinate_from_arcsec(-119, LX200_COORD_LOW_PRECISION, &coordinate),
+		   "Conversion should succeed");
+	lx200_format_dec_coordinate(&coordinate, buffer, sizeof(buffer));
+	zassert_str_equal(buffer, "-00*01#", "Truncated towards zero");
+
+	zassert_ok(lx200_coordinate_from_arcsec(-119, LX200_COORD_HIGH_PRECISION, &coordinate),
+		   "Conversion should succeed");
+	zassert_equal(lx200_coordinate_to_arcsec(&coordinate), -119, "Round trip");
+
+	/* 12:34:56 is 45296 seconds of time, 12:34.9 in low precision */
+	zassert_ok(lx200_coordinate_from_arcsec(45296, LX200_COORD_LOW_PRECISION, &coordinate),
+		   "Conversion should succeed");
+	lx200_format_ra_coordinate(&coordinate, buffer, sizeof(buffer));
+	zassert_str_equal(buffer, "12:34.9#", "Tenths of a minute");
+
+	zassert_equal(lx200_coordinate_from_arcsec(0, LX200_COORD_HIGH_PRECISION, NULL), -EINVAL,
+		      "Should handle NULL");
 }
 
 ZTEST(lx200_formatting, test_format_time)
@@ -0,0 +1,358 @@
+/**
+ * @file test_framer.c
+ * @brief LX200 Streaming Framer Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <lx200/lx200_framer.h>
+
+/* Test fixtures */
+static lx200_framer_t framer;
+static lx200_stop_t stops[8];
+static size_t stop_count;
+static size_t ack_count;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void framer_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	lx200_framer_init(&framer);
+	stop_count = 0;
+	ack_count = 0;
+}
+
+/**
+ * @brief Stop handler recording the reported stops
+ */
+static void record_stop(lx200_stop_t stop, void *user_data)
+{
+	zassert_equal_ptr(user_data, &framer, "User data should be passed through");
+	if (stop_count < ARRAY_SIZE(stops)) {
+		stops[stop_count] = stop;
+	}
+	stop_count++;
+}
+
+/**
+ * @brief ACK handler counting the alignment queries
+ */
+static void record_ack(void *user_data)
+{
+	zassert_equal_ptr(user_data, &framer, "User data should be passed through");
+	ack_count++;
+}
+
+/**
+ * @brief Feed a NUL terminated string into the framer
+ */
+static size_t feed(const char *data)
+{
+	return lx200_framer_feed(&framer, data, strlen(data));
+}
+
+/**
+ * @brief Pop the oldest frame and compare it against the expected string
+ */
+static void expect_frame(const char *expected)
+{
+	lx200_frame_t frame;
+
+	zassert_true(lx200_framer_peek(&framer, &frame), "Expected frame '%s'", expected);
+	zassert_equal(frame.length, strlen(expected), "Length mismatch for '%s'", expected);
+	zassert_str_equal(frame.data, expected, "Frame content mismatch");
+	lx200_framer_release(&framer);
+}
+
+/* ============================================================================
+ * FRAMING TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_framer, test_single_frame)
+{
+	zassert_equal(feed(":GR#"), 1, "One frame should complete");
+	zassert_equal(lx200_framer_pending(&framer), 1, "One frame should be pending");
+
+	expect_frame(":GR#");
+	zassert_equal(lx200_framer_pending(&framer), 0, "No frame should be pending");
+}
+
+ZTEST(lx200_framer, test_back_to_back_frames)
+{
+	zassert_equal(feed(":GR#:GD#:GA#:GZ#"), 4, "Four frames should complete");
+
+	expect_frame(":GR#");
+	expect_frame(":GD#");
+	expect_frame(":GA#");
+	expect_frame(":GZ#");
+}
+
+ZTEST(lx200_framer, test_frame_split_across_chunks)
+{
+	zassert_equal(feed(":G"), 0, "No frame should complete");
+	zassert_equal(feed("R#:S"), 1, "First frame should complete");
+	zassert_equal(feed("r14:30"), 0, "Partial frame should be kept");
+	zassert_equal(feed(":45#"), 1, "Second frame should complete");
+
+	expect_frame(":GR#");
+	expect_frame(":Sr14:30:45#");
+}
+
+ZTEST(lx200_framer, test_resync_on_stray_prefix)
+{
+	zassert_equal(feed(":GR:GD#"), 1, "Only the second frame should complete");
+	zassert_equal(framer.stats.resyncs, 1, "Partial frame should be counted as resync");
+
+	expect_frame(":GD#");
+}
+
+ZTEST(lx200_framer, test_parameter_separators_kept)
+{
+	zassert_equal(feed(":Sd+45*30:15#:SL12:"), 1, "First frame should complete");
+	zassert_equal(feed("00:00#"), 1, "Separator split across chunks should be kept");
+	zassert_equal(framer.stats.resyncs, 0, "Separators should not resync");
+
+	expect_frame(":Sd+45*30:15#");
+	expect_frame(":SL12:00:00#");
+}
+
+ZTEST(lx200_framer, test_resync_split_across_chunks)
+{
+	zassert_equal(feed(":Sr12:"), 0, "No frame should complete");
+	zassert_equal(feed("GD#"), 1, "New command should complete");
+
+	expect_frame(":GD#");
+}
+
+ZTEST(lx200_framer, test_resync_keeps_queued_frames)
+{
+	feed(":GR#:Sr12");
+	feed(":GD#");
+
+	expect_frame(":GR#");
+	expect_frame(":GD#");
+	zassert_equal(framer.stats.resyncs, 1, "Abandoned partial frame should be counted");
+}
+
+ZTEST(lx200_framer, test_bytes_outside_frames_ignored)
+{
+	zassert_equal(feed("\r\n:GR#\r\n"), 1, "Frame should complete");
+	zassert_equal(framer.stats.discarded_bytes, 4, "Line endings should be discarded");
+
+	expect_frame(":GR#");
+}
+
+ZTEST(lx200_framer, test_oversized_frame_dropped)
+{
+	char data[LX200_MAX_COMMAND_LENGTH + 16];
+
+	data[0] = ':';
+	memset(&data[1], 'X', sizeof(data) - 3);
+	data[sizeof(data) - 2] = '#';
+	data[sizeof(data) - 1] = '\0';
+
+	zassert_equal(feed(data), 0, "Oversized frame should not complete");
+	zassert_equal(framer.stats.overflows, 1, "Overflow should be counted");
+
+	zassert_equal(feed(":GR#"), 1, "Framer should recover on next prefix");
+	expect_frame(":GR#");
+}
+
+ZTEST(lx200_framer, test_oversized_frame_skipped_to_terminator)
+{
+	char data[LX200_MAX_COMMAND_LENGTH + 16];
+	size_t length = 0;
+
+	data[length++] = ':';
+	while (length < sizeof(data) - 4) {
+		/* Separators past the overflow must not start a frame */
+		data[length] = (length % 3 == 0) ? ':' : '1';
+		length++;
+	}
+	data[length] = '\0';
+
+	zassert_equal(feed(data), 0, "Oversized frame should not complete");
+	zassert_equal(feed("1#:GD#"), 1, "Only the next command should complete");
+	zassert_equal(framer.stats.overflows, 1, "Overflow should be counted");
+	expect_frame(":GD#");
+	zassert_equal(lx200_framer_pending(&framer), 0, "No bogus frame should be queued");
+}
+
+ZTEST(lx200_framer, test_full_queue_drops_frames)
+{
+	for (int i = 0; i < CONFIG_LX200_FRAMER_DEPTH; i++) {
+		zassert_equal(feed(":GR#"), 1, "Frame %d should complete", i);
+	}
+
+	zassert_equal(feed(":GD#"), 0, "Frame should be dropped when all slots are used");
+	zassert_equal(framer.stats.drops, 1, "Drop should be counted");
+
+	lx200_framer_release(&framer);
+	zassert_equal(feed(":GD#"), 1, "Released slot should be reused");
+	zassert_equal(lx200_framer_pending(&framer), CONFIG_LX200_FRAMER_DEPTH,
+		      "All slots should be in use again");
+}
+
+ZTEST(lx200_framer, test_dropped_frame_skipped_to_terminator)
+{
+	for (int i = 0; i < CONFIG_LX200_FRAMER_DEPTH; i++) {
+		feed(":GR#");
+	}
+
+	/* The separators of the dropped parameter must not start a frame */
+	feed(":Sr12:");
+	for (int i = 0; i < CONFIG_LX200_FRAMER_DEPTH; i++) {
+		lx200_framer_release(&framer);
+	}
+	zassert_equal(feed("34:56#:GD#"), 1, "Only the next command should complete");
+	expect_frame(":GD#");
+	zassert_equal(framer.stats.drops, 1, "Drop should be counted");
+}
+
+ZTEST(lx200_framer, test_command_after_dropped_frame)
+{
+	for (int i = 0; i < CONFIG_LX200_FRAMER_DEPTH; i++) {
+		feed(":GR#");
+	}
+
+	/* Unterminated dropped frame followed by a new command */
+	feed(":Sr12");
+	lx200_framer_release(&framer);
+	zassert_equal(feed(":GD#"), 1, "New command should complete");
+	zassert_equal(lx200_framer_pending(&framer), CONFIG_LX200_FRAMER_DEPTH,
+		      "New command should be queued");
+}
+
+ZTEST(lx200_framer, test_slots_wrap_around)
+{
+	for (int i = 0; i < CONFIG_LX200_FRAMER_DEPTH * 3; i++) {
+		zassert_equal(feed(":Gd#:Gr"), 1, "Frame %d should complete", i);
+		zassert_equal(feed("#"), 1, "Frame %d should complete", i);
+		expect_frame(":Gd#");
+		expect_frame(":Gr#");
+	}
+}
+
+ZTEST(lx200_framer, test_reset_drops_everything)
+{
+	feed(":GR#:GD#:Sr1");
+	lx200_framer_reset(&framer);
+
+	zassert_equal(lx200_framer_pending(&framer), 0, "Queue should be empty");
+	zassert_equal(feed("2#"), 0, "Partial frame should have been dropped");
+}
+
+/* ============================================================================
+ * STOP COMMAND TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_framer, test_stop_commands_reported)
+{
+	lx200_framer_set_stop_handler(&framer, record_stop, &framer);
+
+	feed(":Q#:Qn#:Qs");
+	zassert_equal(stop_count, 2, "Stops should be reported when their '#' arrives");
+	feed("#:Qe#:Qw#");
+
+	zassert_equal(stop_count, 5, "All stops should be reported");
+	zassert_equal(stops[0], LX200_STOP_ALL, "Q should stop everything");
+	zassert_equal(stops[1], LX200_STOP_NORTH, "Qn should stop north");
+	zassert_equal(stops[2], LX200_STOP_SOUTH, "Qs should stop south");
+	zassert_equal(stops[3], LX200_STOP_EAST, "Qe should stop east");
+	zassert_equal(stops[4], LX200_STOP_WEST, "Qw should stop west");
+	zassert_equal(framer.stats.stops, 5, "Stops should be counted");
+
+	/* The frames still go to the command thread */
+	zassert_equal(lx200_framer_pending(&framer), 5, "Stop frames should be queued");
+	expect_frame(":Q#");
+}
+
+ZTEST(lx200_framer, test_other_commands_not_reported)
+{
+	lx200_framer_set_stop_handler(&framer, record_stop, &framer);
+
+	feed(":GR#:Qx#:QnX#:Sr12:34#Q#:MS#");
+	zassert_equal(stop_count, 0, "Only exact stop commands should be reported");
+}
+
+ZTEST(lx200_framer, test_stop_reported_with_full_queue)
+{
+	lx200_framer_set_stop_handler(&framer, record_stop, &framer);
+
+	for (int i = 0; i < CONFIG_LX200_FRAMER_DEPTH; i++) {
+		feed(":GR#");
+	}
+
+	zassert_equal(feed(":Q#"), 0, "Frame should be dropped when all slots are used");
+	zassert_equal(stop_count, 1, "Stop should be reported even if it was dropped");
+	zassert_equal(stops[0], LX200_STOP_ALL, "Q should stop everything");
+}
+
+ZTEST(lx200_framer, test_stop_without_handler)
+{
+	zassert_equal(feed(":Q#"), 1, "Stop should be framed without a handler");
+	zassert_equal(framer.stats.stops, 1, "Stop should still be counted");
+}
+
+/* ============================================================================
+ * ACK TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_framer, test_ack_reported_without_frame)
+{
+	lx200_framer_set_ack_handler(&framer, record_ack, &framer);
+
+	zassert_equal(feed("\x06"), 0, "ACK should not complete a frame");
+	zassert_equal(ack_count, 1, "ACK should be reported immediately");
+	zassert_equal(lx200_framer_pending(&framer), 0, "ACK should not be queued");
+
+	/* Drivers probing the connection send it repeatedly */
+	feed("\x06\x06\x06");
+	zassert_equal(ack_count, 4, "Every ACK should be reported");
+	zassert_equal(framer.stats.acks, 4, "ACKs should be counted");
+	zassert_equal(framer.stats.discarded_bytes, 0, "ACKs should not be discarded bytes");
+}
+
+ZTEST(lx200_framer, test_ack_does_not_disturb_frames)
+{
+	lx200_framer_set_ack_handler(&framer, record_ack, &framer);
+
+	zassert_equal(feed("\x06:GR#\x06:Sr12:\x06"), 1, "Frame before the ACK should complete");
+	zassert_equal(feed("34:56#"), 1, "Frame around the ACK should complete");
+	zassert_equal(ack_count, 3, "All ACKs should be reported");
+
+	expect_frame(":GR#");
+	expect_frame(":Sr12:34:56#");
+}
+
+ZTEST(lx200_framer, test_ack_without_handler)
+{
+	zassert_equal(feed("\x06:GR#"), 1, "Command after the ACK should complete");
+	zassert_equal(framer.stats.acks, 1, "ACK should still be counted");
+	expect_frame(":GR#");
+}
+
+ZTEST(lx200_framer, test_invalid_parameters)
+{
+	lx200_frame_t frame;
+
+	zassert_equal(lx200_framer_feed(NULL, ":GR#", 4), 0, "Should handle NULL framer");
+	zassert_equal(lx200_framer_feed(&framer, NULL, 4), 0, "Should handle NULL data");
+	zassert_false(lx200_framer_peek(&framer, NULL), "Should handle NULL frame");
+	zassert_false(lx200_framer_peek(&framer, &frame), "Empty framer has no frame");
+
+	/* Releasing an empty framer must not underflow */
+	lx200_framer_release(&framer);
+	zassert_equal(lx200_framer_pending(&framer), 0, "Queue should still be empty");
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(lx200_framer, NULL, NULL, framer_test_setup, NULL, NULL);
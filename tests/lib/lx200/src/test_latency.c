@@ -0,0 +1,195 @@
+/**
+ * @file test_latency.c
+ * @brief LX200 Latency Histogram Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <lx200/lx200_latency.h>
+
+/* Test fixtures */
+static lx200_latency_t latency;
+static lx200_latency_batch_t batch;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void latency_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	lx200_latency_init(&latency);
+	memset(&batch, 0, sizeof(batch));
+}
+
+/**
+ * @brief Build a frame with the given receive timestamps in microseconds
+ */
+static lx200_frame_t frame_at(uint32_t started_us, uint32_t completed_us)
+{
+	lx200_frame_t frame = {
+		.data = ":GR#",
+		.length = 4,
+		.started = k_us_to_cyc_floor32(started_us),
+		.completed = k_us_to_cyc_floor32(completed_us),
+	};
+
+	return frame;
+}
+
+/* ============================================================================
+ * HISTOGRAM TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_latency, test_empty_histogram)
+{
+	const lx200_histogram_t *histogram =
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_TOTAL);
+
+	zassert_not_null(histogram, "Histogram should exist");
+	zassert_equal(histogram->count, 0, "Histogram should be empty");
+	zassert_equal(lx200_histogram_percentile(histogram, 990), 0, "Empty p99 should be 0");
+}
+
+ZTEST(lx200_latency, test_min_max_and_p99)
+{
+	const lx200_histogram_t *histogram =
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_HANDLE);
+
+	for (int i = 0; i < 99; i++) {
+		lx200_latency_record(&latency, LX200_CMD_GET, LX200_LATENCY_HANDLE, 10 + i % 5);
+	}
+	lx200_latency_record(&latency, LX200_CMD_GET, LX200_LATENCY_HANDLE, 5000);
+
+	zassert_equal(histogram->count, 100, "All samples should be counted");
+	zassert_equal(histogram->min_us, 10, "Minimum should be exact");
+	zassert_equal(histogram->max_us, 5000, "Maximum should be exact");
+
+	/* 99 samples below 16 us, the outlier only shows above p99 */
+	zassert_equal(lx200_histogram_percentile(histogram, 990), 15,
+		      "p99 should be the bound of the first bucket");
+	zassert_equal(lx200_histogram_percentile(histogram, 1000), 5000,
+		      "p100 should be the maximum");
+}
+
+ZTEST(lx200_latency, test_percentile_never_below_samples)
+{
+	const lx200_histogram_t *histogram =
+		lx200_latency_histogram(&latency, LX200_CMD_SET, LX200_LATENCY_TOTAL);
+
+	/* 100 us lands in the 64..127 us bucket */
+	lx200_latency_record(&latency, LX200_CMD_SET, LX200_LATENCY_TOTAL, 100);
+	lx200_latency_record(&latency, LX200_CMD_SET, LX200_LATENCY_TOTAL, 120);
+	zassert_equal(lx200_histogram_percentile(histogram, 500), 120,
+		      "Estimate should be capped at the maximum");
+
+	lx200_latency_record(&latency, LX200_CMD_SET, LX200_LATENCY_TOTAL, 1000);
+	zassert_equal(lx200_histogram_percentile(histogram, 500), 127,
+		      "Estimate should be the upper bound of the bucket");
+}
+
+ZTEST(lx200_latency, test_overflow_bucket)
+{
+	const lx200_histogram_t *histogram =
+		lx200_latency_histogram(&latency, LX200_CMD_MOVE, LX200_LATENCY_TOTAL);
+
+	lx200_latency_record(&latency, LX200_CMD_MOVE, LX200_LATENCY_TOTAL, 2000000);
+	zassert_equal(histogram->buckets[LX200_LATENCY_BUCKETS - 1], 1,
+		      "Slow samples should land in the last bucket");
+	zassert_equal(lx200_histogram_percentile(histogram, 990), 2000000,
+		      "Last bucket should report the maximum");
+}
+
+ZTEST(lx200_latency, test_families_are_separate)
+{
+	lx200_latency_record(&latency, LX200_CMD_GET, LX200_LATENCY_TOTAL, 100);
+
+	zassert_equal(lx200_latency_histogram(&latency, LX200_CMD_SET, LX200_LATENCY_TOTAL)->count,
+		      0, "Other families should not see the sample");
+	zassert_equal(
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_HANDLE)->count, 0,
+		"Other stages should not see the sample");
+}
+
+/* ============================================================================
+ * COMMAND TIMING TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_latency, test_command_stages)
+{
+	lx200_frame_t frame = frame_at(0, 100);
+
+	lx200_latency_handled(&latency, &batch, LX200_CMD_GET, &frame,
+			      k_us_to_cyc_floor32(300));
+	zassert_equal(batch.count, 1, "Command should wait for its reply");
+
+	lx200_latency_transmitted(&latency, &batch, k_us_to_cyc_floor32(1000));
+	zassert_equal(batch.count, 0, "Batch should be empty after transmit");
+
+	zassert_within(
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_RECEIVE)->max_us,
+		100, 1, "Receive should run from first byte to frame complete");
+	zassert_within(
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_HANDLE)->max_us,
+		200, 1, "Handle should run from frame complete to handler done");
+	zassert_within(
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_TRANSMIT)->max_us,
+		700, 1, "Transmit should run from handler done to reply sent");
+	zassert_within(
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_TOTAL)->max_us,
+		1000, 1, "Total should run from first byte to reply sent");
+}
+
+ZTEST(lx200_latency, test_full_batch_drops_transmit_samples)
+{
+	lx200_frame_t frame = frame_at(0, 10);
+
+	for (int i = 0; i < LX200_LATENCY_BATCH_SIZE + 2; i++) {
+		lx200_latency_handled(&latency, &batch, LX200_CMD_GET, &frame,
+				      k_us_to_cyc_floor32(20));
+	}
+	lx200_latency_transmitted(&latency, &batch, k_us_to_cyc_floor32(50));
+
+	zassert_equal(batch.dropped, 2, "Commands beyond the batch should be counted");
+	zassert_equal(
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_HANDLE)->count,
+		LX200_LATENCY_BATCH_SIZE + 2, "Handle stage should see every command");
+	zassert_equal(
+		lx200_latency_histogram(&latency, LX200_CMD_GET, LX200_LATENCY_TOTAL)->count,
+		LX200_LATENCY_BATCH_SIZE, "Total stage should see the batched commands");
+}
+
+ZTEST(lx200_latency, test_framer_timestamps)
+{
+	static lx200_framer_t framer;
+	lx200_frame_t frame;
+
+	lx200_framer_init(&framer);
+	lx200_framer_feed(&framer, ":G", 2);
+	k_busy_wait(200);
+	lx200_framer_feed(&framer, "R#", 2);
+
+	zassert_true(lx200_framer_peek(&framer, &frame), "Frame should be queued");
+	zassert_true(k_cyc_to_us_floor32(frame.completed - frame.started) >= 200,
+		     "Frame should be stamped at its first and last byte");
+}
+
+ZTEST(lx200_latency, test_invalid_parameters)
+{
+	lx200_latency_record(&latency, LX200_CMD_UNKNOWN, LX200_LATENCY_TOTAL, 10);
+	lx200_latency_record(&latency, LX200_CMD_GET, LX200_LATENCY_STAGES, 10);
+	lx200_latency_record(NULL, LX200_CMD_GET, LX200_LATENCY_TOTAL, 10);
+
+	zassert_is_null(lx200_latency_histogram(&latency, LX200_CMD_UNKNOWN, LX200_LATENCY_TOTAL),
+			"Unknown family has no histogram");
+	zassert_equal(lx200_histogram_percentile(NULL, 990), 0, "Should handle NULL");
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(lx200_latency, NULL, NULL, latency_test_setup, NULL, NULL);
@@ -0,0 +1,171 @@
+/**
+ * @file test_response.c
+ * @brief LX200 Response Builder Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <lx200/lx200_response.h>
+
+/* Test fixtures */
+static lx200_response_t response;
+
+/** Everything passed to the transmit callback, one write after another */
+static char sent[CONFIG_LX200_RESPONSE_BUFFER_SIZE * 4];
+static size_t sent_length;
+static size_t writes;
+static int flush_result;
+
+/**
+ * @brief Transmit callback recording every write
+ */
+static int record_flush(const char *data, size_t length, void *user_data)
+{
+	if (user_data != &response || sent_length + length > sizeof(sent)) {
+		return -EFAULT;
+	}
+
+	if (flush_result < 0) {
+		return flush_result;
+	}
+
+	memcpy(&sent[sent_length], data, length);
+	sent_length += length;
+	writes++;
+
+	return 0;
+}
+
+/**
+ * @brief Setup function called before each test
+ */
+static void response_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	memset(sent, 0, sizeof(sent));
+	sent_length = 0;
+	writes = 0;
+	flush_result = 0;
+	lx200_response_init(&response, record_flush, &response);
+}
+
+/* ============================================================================
+ * COALESCING TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_response, test_replies_coalesced_until_flush)
+{
+	zassert_ok(lx200_response_append_str(&response, "12:34:56#"), "Append should succeed");
+	zassert_ok(lx200_response_append_str(&response, "+45*30:15#"), "Append should succeed");
+	zassert_ok(lx200_response_append(&response, "1", 1), "Append should succeed");
+
+	zassert_equal(writes, 0, "Nothing should be sent before the flush");
+	zassert_equal(lx200_response_pending(&response), 20, "All replies should be buffered");
+
+	zassert_ok(lx200_response_flush(&response), "Flush should succeed");
+	zassert_equal(writes, 1, "All replies should be sent with one write");
+	zassert_mem_equal(sent, "12:34:56#+45*30:15#1", 20, "Replies should be in order");
+	zassert_equal(lx200_response_pending(&response), 0, "Buffer should be empty");
+	zassert_equal(response.stats.replies, 3, "Replies should be counted");
+}
+
+ZTEST(lx200_response, test_flush_without_replies)
+{
+	zassert_ok(lx200_response_flush(&response), "Empty flush should succeed");
+	zassert_equal(writes, 0, "Empty flush should not write");
+}
+
+ZTEST(lx200_response, test_gather_fragments)
+{
+	const lx200_response_fragment_t fragments[] = {
+		{"12", 2},
+		{":34", 3},
+		{":56", 3},
+		{"#", 1},
+	};
+
+	zassert_ok(lx200_response_appendv(&response, fragments, ARRAY_SIZE(fragments)),
+		   "Append should succeed");
+	zassert_ok(lx200_response_flush(&response), "Flush should succeed");
+	zassert_mem_equal(sent, "12:34:56#", 9, "Fragments should be joined");
+	zassert_equal(response.stats.replies, 1, "Fragments should form one reply");
+}
+
+ZTEST(lx200_response, test_reserve_and_commit)
+{
+	char *space = lx200_response_reserve(&response, LX200_MAX_RESPONSE_LENGTH);
+
+	zassert_not_null(space, "Reserve should succeed");
+	memcpy(space, "OAT#", 4);
+	lx200_response_commit(&response, 4);
+
+	zassert_ok(lx200_response_flush(&response), "Flush should succeed");
+	zassert_mem_equal(sent, "OAT#", 4, "Formatted reply should be sent");
+}
+
+ZTEST(lx200_response, test_full_buffer_keeps_replies_whole)
+{
+	char reply[LX200_MAX_RESPONSE_LENGTH];
+	size_t appended = 0;
+
+	memset(reply, 'x', sizeof(reply) - 1);
+	reply[sizeof(reply) - 1] = '#';
+
+	/* Fill the buffer so the next reply does not fit */
+	while (appended + sizeof(reply) <= CONFIG_LX200_RESPONSE_BUFFER_SIZE) {
+		zassert_ok(lx200_response_append(&response, reply, sizeof(reply)), "Append failed");
+		appended += sizeof(reply);
+	}
+	zassert_equal(writes, 0, "Buffer should not be flushed yet");
+
+	zassert_ok(lx200_response_append(&response, reply, sizeof(reply)), "Append failed");
+	zassert_equal(writes, 1, "Full buffer should be flushed before the reply");
+	zassert_equal(sent_length, appended, "Only whole replies should be sent");
+	zassert_equal(response.stats.forced_flushes, 1, "Forced flush should be counted");
+	zassert_equal(lx200_response_pending(&response), sizeof(reply),
+		      "New reply should be buffered");
+}
+
+ZTEST(lx200_response, test_oversized_reply_is_split)
+{
+	char reply[CONFIG_LX200_RESPONSE_BUFFER_SIZE + 10];
+
+	memset(reply, 'y', sizeof(reply));
+
+	zassert_ok(lx200_response_append(&response, reply, sizeof(reply)), "Append failed");
+	zassert_ok(lx200_response_flush(&response), "Flush should succeed");
+	zassert_equal(writes, 2, "Oversized reply should take two writes");
+	zassert_equal(sent_length, sizeof(reply), "Whole reply should be sent");
+}
+
+ZTEST(lx200_response, test_transmit_error)
+{
+	zassert_ok(lx200_response_append_str(&response, "1"), "Append should succeed");
+
+	flush_result = -EIO;
+	zassert_equal(lx200_response_flush(&response), -EIO, "Error should be returned");
+	zassert_equal(lx200_response_pending(&response), 0, "Buffer should be emptied");
+	zassert_equal(response.stats.errors, 1, "Error should be counted");
+}
+
+ZTEST(lx200_response, test_invalid_parameters)
+{
+	zassert_equal(lx200_response_append(NULL, "1", 1), -EINVAL, "Should handle NULL builder");
+	zassert_equal(lx200_response_append(&response, NULL, 1), -EINVAL,
+		      "Should handle NULL data");
+	zassert_equal(lx200_response_append_str(&response, NULL), -EINVAL,
+		      "Should handle NULL string");
+	zassert_is_null(lx200_response_reserve(&response, CONFIG_LX200_RESPONSE_BUFFER_SIZE + 1),
+			"Reserve larger than the buffer should fail");
+	zassert_equal(lx200_response_flush(NULL), -EINVAL, "Should handle NULL builder");
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(lx200_response, NULL, NULL, response_test_setup, NULL, NULL);
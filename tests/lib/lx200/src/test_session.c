@@ -0,0 +1,139 @@
+/**
+ * @file test_session.c
+ * @brief LX200 Session Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <lx200/lx200_session.h>
+
+/* Test fixtures */
+static lx200_session_t sessions[2];
+
+/** Replies sent to each session */
+static char sent[2][64];
+static size_t sent_length[2];
+
+/**
+ * @brief Transmit callback, user_data is the session index
+ */
+static int record_flush(const char *data, size_t length, void *user_data)
+{
+	uintptr_t index = (uintptr_t)user_data;
+
+	if (index >= ARRAY_SIZE(sent) || sent_length[index] + length > sizeof(sent[0])) {
+		return -EFAULT;
+	}
+
+	memcpy(&sent[index][sent_length[index]], data, length);
+	sent_length[index] += length;
+	return 0;
+}
+
+/**
+ * @brief Setup function called before each test
+ */
+static void session_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (uintptr_t i = 0; i < ARRAY_SIZE(sessions); i++) {
+		lx200_session_init(&sessions[i], i, record_flush, (void *)i);
+		sent_length[i] = 0;
+	}
+}
+
+/**
+ * @brief Feed a NUL terminated string into a session
+ */
+static size_t receive(lx200_session_t *session, const char *data)
+{
+	return lx200_session_receive(session, data, strlen(data));
+}
+
+/* ============================================================================
+ * SESSION TESTS
+ * ============================================================================ */
+
+ZTEST(lx200_session, test_commands_in_order)
+{
+	lx200_command_view_t view;
+	lx200_frame_t frame;
+
+	zassert_equal(receive(&sessions[0], ":GR#:Sd+45*30:15#"), 2, "Two frames expected");
+
+	zassert_true(lx200_session_next(&sessions[0], &frame, &view), "First command expected");
+	zassert_equal(view.id, LX200_ID_GET_RA, "Commands should keep their order");
+	lx200_session_complete(&sessions[0]);
+
+	zassert_true(lx200_session_next(&sessions[0], &frame, &view), "Second command expected");
+	zassert_equal(view.id, LX200_ID_SET_TARGET_DEC, "Commands should keep their order");
+	zassert_mem_equal(lx200_command_view_parameter(frame.data, &view), "+45*30:15", view.length,
+			  "Parameter should be available");
+	lx200_session_complete(&sessions[0]);
+
+	zassert_false(lx200_session_next(&sessions[0], &frame, &view), "Session should be idle");
+	zassert_equal(sessions[0].stats.commands, 2, "Commands should be counted");
+}
+
+ZTEST(lx200_session, test_invalid_frames_dropped)
+{
+	lx200_command_view_t view;
+	lx200_frame_t frame;
+
+	receive(&sessions[0], ":Xyz#:GD#");
+
+	zassert_true(lx200_session_next(&sessions[0], &frame, &view), "Valid command expected");
+	zassert_equal(view.id, LX200_ID_GET_DEC, "Unknown command should be skipped");
+	zassert_equal(sessions[0].stats.errors, 1, "Dropped frame should be counted");
+}
+
+ZTEST(lx200_session, test_sessions_are_independent)
+{
+	lx200_command_view_t view;
+	lx200_frame_t frame;
+
+	receive(&sessions[0], ":GR");
+	receive(&sessions[1], ":GD#");
+	receive(&sessions[0], "#");
+
+	zassert_true(lx200_session_next(&sessions[1], &frame, &view), "Command expected");
+	zassert_equal(view.id, LX200_ID_GET_DEC, "Partial frame of the other session leaked");
+	zassert_true(lx200_session_next(&sessions[0], &frame, &view), "Command expected");
+	zassert_equal(view.id, LX200_ID_GET_RA, "Split frame should be assembled");
+
+	zassert_equal(lx200_session_toggle_precision(&sessions[0]), LX200_COORD_LOW_PRECISION,
+		      "Precision should toggle");
+	zassert_equal(sessions[1].precision, LX200_COORD_HIGH_PRECISION,
+		      "Other session should keep its precision");
+
+	lx200_response_append_str(&sessions[0].response, "12:34.5#");
+	lx200_response_append_str(&sessions[1].response, "+45*30:15#");
+	zassert_ok(lx200_session_flush(&sessions[0]), "Flush should succeed");
+	zassert_ok(lx200_session_flush(&sessions[1]), "Flush should succeed");
+	zassert_equal(sent_length[0], 8, "Reply should go to its own session");
+	zassert_mem_equal(sent[0], "12:34.5#", 8, "Reply should go to its own session");
+	zassert_equal(sent_length[1], 10, "Reply should go to its own session");
+	zassert_mem_equal(sent[1], "+45*30:15#", 10, "Reply should go to its own session");
+}
+
+ZTEST(lx200_session, test_invalid_parameters)
+{
+	lx200_command_view_t view;
+	lx200_frame_t frame;
+
+	zassert_equal(lx200_session_receive(NULL, ":GR#", 4), 0, "Should handle NULL session");
+	zassert_false(lx200_session_next(NULL, &frame, &view), "Should handle NULL session");
+	zassert_false(lx200_session_next(&sessions[0], NULL, &view), "Should handle NULL frame");
+	zassert_equal(lx200_session_flush(NULL), -EINVAL, "Should handle NULL session");
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(lx200_session, NULL, NULL, session_test_setup, NULL, NULL);
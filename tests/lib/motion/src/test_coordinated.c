@@ -0,0 +1,271 @@
+/**
+ * @file test_coordinated.c
+ * @brief Coordinated Move Test Suite
+ *
+ * Runs moves of both axes from one engine on the emulated counter, the
+ * follower axis stepped by the DDA along with the lead axis.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <motion/motion_ramp.h>
+#include <motion/motion_step.h>
+#include <motion/motion_step_emul.h>
+
+#define FREQUENCY 90000000U
+#define CAPACITY 4096
+
+/* Trapezoidal ramp up to 10 kHz */
+#define CRUISE_MHZ 10000000U
+#define ACCEL 20000U
+
+/* Emulated pins of each axis */
+#define RA 0
+#define DEC 1
+
+/* Test fixtures */
+static uint32_t intervals[CAPACITY];
+static int count;
+static motion_step_t step;
+static motion_step_emul_t emul;
+static motion_stop_t stop;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void coordinated_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+
+	count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+	zassert_true(count > 0, "Ramp should be planned");
+
+	motion_stop_init(&stop);
+	motion_step_emul_init(&emul, &step, FREQUENCY);
+	zassert_ok(motion_step_init(&step, &emul.hw, &stop, MOTION_AXIS_ALL, 2000),
+		   "Init should succeed");
+}
+
+/**
+ * @brief Ramped move of the lead axis with follower steps
+ */
+static motion_step_move_t coordinated_move(uint32_t steps, uint32_t follow_steps)
+{
+	const motion_step_move_t move = {
+		.intervals = intervals,
+		.count = count,
+		.steps = steps,
+		.forward = true,
+		.follow_steps = follow_steps,
+		.follow_forward = false,
+	};
+
+	return move;
+}
+
+/* ============================================================================
+ * DDA TESTS
+ * ============================================================================ */
+
+ZTEST(motion_coordinated, test_follower_steps_exactly)
+{
+	const motion_step_move_t move = coordinated_move(10000, 3333);
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	zassert_true(emul.forward[RA], "Lead direction pin should be set");
+	zassert_false(emul.forward[DEC], "Follower direction pin should be set");
+
+	motion_step_emul_run(&emul, 10ULL * FREQUENCY);
+	zassert_false(motion_step_busy(&step), "Move should end");
+	zassert_equal(emul.rising_edges[RA], 10000, "Every lead step should be issued");
+	zassert_equal(emul.rising_edges[DEC], 3333, "Every follower step should be issued");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_RA), 10000,
+		      "Lead position should follow the steps");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_DEC), -3333,
+		      "Follower position should follow the steps");
+	zassert_false(emul.step_high[RA] || emul.step_high[DEC], "Step pins should end low");
+}
+
+ZTEST(motion_coordinated, test_axes_arrive_together)
+{
+	const motion_step_move_t move = coordinated_move(10000, 3333);
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 10ULL * FREQUENCY);
+
+	/* The follower steps centered between lead steps, at most two lead steps apart */
+	zassert_true(emul.last_rising_at[DEC] <= emul.last_rising_at[RA],
+		     "Follower should not step after the lead");
+	zassert_true(emul.last_rising_at[RA] - emul.last_rising_at[DEC] <= 2 * intervals[0],
+		     "Both axes should arrive together");
+}
+
+ZTEST(motion_coordinated, test_equal_steps_step_together)
+{
+	const motion_step_move_t move = coordinated_move(5000, 5000);
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 10ULL * FREQUENCY);
+
+	zassert_equal(emul.rising_edges[DEC], 5000, "Follower should step with every lead step");
+	zassert_equal(emul.last_rising_at[DEC], emul.last_rising_at[RA],
+		      "Axes should step on the same edges");
+}
+
+ZTEST(motion_coordinated, test_dec_leads)
+{
+	motion_step_move_t move = coordinated_move(4000, 1000);
+
+	move.axis = MOTION_AXIS_DEC;
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 10ULL * FREQUENCY);
+
+	zassert_equal(emul.rising_edges[DEC], 4000, "DEC should take every step");
+	zassert_equal(emul.rising_edges[RA], 1000, "RA should follow");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_DEC), 4000,
+		      "Lead position should follow the steps");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_RA), -1000,
+		      "Follower position should follow the steps");
+}
+
+ZTEST(motion_coordinated, test_follower_does_not_hold)
+{
+	motion_step_move_t move = coordinated_move(1000, 500);
+
+	move.hold = 10000;
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 2ULL * FREQUENCY);
+
+	zassert_true(motion_step_busy(&step), "Lead should hold its interval");
+	zassert_true(emul.rising_edges[RA] > 1000, "Lead should keep stepping");
+	zassert_equal(emul.rising_edges[DEC], 500, "Follower should stop with the move");
+	motion_step_stop(&step);
+}
+
+/* ============================================================================
+ * STOP TESTS
+ * ============================================================================ */
+
+ZTEST(motion_coordinated, test_stop_keeps_ratio)
+{
+	const motion_step_move_t move = coordinated_move(100000, 25000);
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, FREQUENCY / 4);
+
+	/* A stop of either axis runs both down the ramp */
+	motion_stop_request(&stop, MOTION_AXIS_DEC);
+	motion_step_emul_run(&emul, 10ULL * FREQUENCY);
+
+	const uint32_t lead = emul.rising_edges[RA];
+
+	zassert_false(motion_step_busy(&step), "Move should stop");
+	zassert_true(lead < 100000, "Move should end early");
+	zassert_within(emul.rising_edges[DEC], lead / 4, 1, "Follower should keep the ratio");
+	zassert_equal(motion_stop_pending(&stop), 0, "Stop should be acknowledged at rest");
+}
+
+ZTEST(motion_coordinated, test_stop_of_standing_axis_ignored)
+{
+	motion_step_move_t move = coordinated_move(1000, 500);
+
+	move.hold = 10000;
+	move.hold_frac = 1;
+	move.hold_modulus = 3;
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, FREQUENCY);
+	zassert_true(motion_step_arrived(&step), "Move should hold its interval");
+	zassert_equal(motion_step_moving_axes(&step), MOTION_AXIS_RA, "Only RA holds");
+
+	const uint32_t edges = emul.rising_edges[RA];
+	const uint64_t phase = step.phase;
+
+	motion_stop_request(&stop, MOTION_AXIS_DEC);
+	motion_step_emul_run(&emul, 30000);
+
+	zassert_true(motion_step_busy(&step), "RA should keep tracking");
+	zassert_equal(emul.rising_edges[RA], edges + 3, "RA should keep its rate");
+	zassert_equal(step.phase, phase, "The phase should go on");
+	zassert_equal(motion_stop_pending(&stop), MOTION_AXIS_DEC, "DEC stop stays pending");
+	motion_step_stop(&step);
+}
+
+ZTEST(motion_coordinated, test_stop_acknowledges_all_axes)
+{
+	const motion_step_move_t move = {.hold = 1000, .forward = true};
+	motion_stop_stats_t stats;
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_stop_request(&stop, MOTION_AXIS_ALL);
+	motion_step_emul_run(&emul, 1000);
+
+	zassert_false(motion_step_busy(&step), "Move should stop");
+	zassert_equal(motion_stop_pending(&stop), 0, "Both axes should be acknowledged");
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(stats.completions, 1, "One completion expected");
+}
+
+/* ============================================================================
+ * PLANNING TESTS
+ * ============================================================================ */
+
+ZTEST(motion_coordinated, test_move_ticks_match_steps)
+{
+	/* Turning around at odd and even lengths, reaching the cruise rate or not */
+	static const uint32_t lengths[] = {1, 2, 101, 1000, 2 * CAPACITY, 30001};
+
+	for (size_t i = 0; i < ARRAY_SIZE(lengths); i++) {
+		const motion_step_move_t move = coordinated_move(lengths[i], lengths[i] / 3);
+		const uint64_t started = emul.now;
+
+		zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+		motion_step_emul_run(&emul, 20ULL * FREQUENCY);
+		zassert_equal(emul.last_rising_at[RA] - started, motion_step_move_ticks(&move),
+			      "Planned duration of %u steps should match", lengths[i]);
+	}
+}
+
+ZTEST(motion_coordinated, test_move_ticks_of_table)
+{
+	static const uint32_t table[] = {4000, 3000, 2000, 1000};
+	const motion_step_move_t move = {.intervals = table, .count = 4, .hold = 500};
+
+	zassert_equal(motion_step_move_ticks(&move), 10000, "Table should add up");
+	zassert_equal(motion_step_move_ticks(NULL), 0, "No move has no duration");
+}
+
+ZTEST(motion_coordinated, test_invalid_coordinated_moves)
+{
+	motion_step_move_t move = coordinated_move(1000, 1001);
+
+	zassert_equal(motion_step_start(&step, &move), -EINVAL,
+		      "More follower than lead steps should fail");
+
+	move = coordinated_move(1000, 10);
+	move.axis = MOTION_AXIS_ALL;
+	zassert_equal(motion_step_start(&step, &move), -EINVAL, "Two lead axes should fail");
+
+	const motion_step_move_t unramped = {.hold = 1000, .follow_steps = 1};
+
+	zassert_equal(motion_step_start(&step, &unramped), -EINVAL,
+		      "Follower steps need a ramped move");
+
+	/* An engine of one axis has no follower */
+	zassert_ok(motion_step_init(&step, &emul.hw, &stop, MOTION_AXIS_RA, 2000),
+		   "Init should succeed");
+	move = coordinated_move(1000, 10);
+	zassert_equal(motion_step_start(&step, &move), -EINVAL, "Follower should be missing");
+	move.axis = MOTION_AXIS_DEC;
+	move.follow_steps = 0;
+	zassert_equal(motion_step_start(&step, &move), -EINVAL, "Lead should be missing");
+	zassert_equal(motion_step_set_position(&step, MOTION_AXIS_DEC, 0), -EINVAL,
+		      "Axis should be missing");
+}
+
+ZTEST_SUITE(motion_coordinated, NULL, NULL, coordinated_test_setup, NULL, NULL);
@@ -0,0 +1,198 @@
+/**
+ * @file test_pec.c
+ * @brief Periodic Error Correction Test Suite
+ *
+ * Records a square wave of guide corrections over a worm turn and plays it
+ * back on the emulated counter.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <motion/motion_pec.h>
+#include <motion/motion_step.h>
+#include <motion/motion_step_emul.h>
+
+#define FREQUENCY 90000000U
+/* 50 steps per segment */
+#define WORM_STEPS (50U * MOTION_PEC_SEGMENTS)
+#define HALF_TURN (WORM_STEPS / 2)
+/* 10 kHz */
+#define HOLD 9000U
+/* Guide correction per step, a rate of 1 / 50 */
+#define CORRECTION 20
+/* Q15 rate of CORRECTION */
+#define RATE (MOTION_PEC_ONE / 50)
+
+/* Test fixtures */
+static motion_step_t step;
+static motion_step_emul_t emul;
+static motion_stop_t stop;
+static motion_pec_t pec;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void pec_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	motion_stop_init(&stop);
+	motion_step_emul_init(&emul, &step, FREQUENCY);
+	zassert_ok(motion_step_init(&step, &emul.hw, &stop, MOTION_AXIS_RA, 2000),
+		   "Init should succeed");
+	zassert_ok(motion_pec_init(&pec, MOTION_AXIS_RA, WORM_STEPS), "Init should succeed");
+	zassert_ok(motion_step_set_pec(&step, &pec), "Attach should succeed");
+}
+
+/**
+ * @brief Record a worm turn running fast in the first half, slow in the second
+ */
+static void record_square_wave(int32_t start)
+{
+	zassert_ok(motion_pec_record_start(&pec, start), "Recording should start");
+
+	for (uint32_t i = 0; i < WORM_STEPS; i++) {
+		const int32_t position = start + (int32_t)i;
+		const uint32_t worm = (uint32_t)position % WORM_STEPS;
+
+		/* Plus a constant drift, which is not periodic */
+		zassert_equal(motion_pec_record(&pec, position,
+						(worm < HALF_TURN ? CORRECTION : -CORRECTION) + 7),
+			      0, "Recording should go on at step %u", i);
+	}
+
+	zassert_equal(motion_pec_record(&pec, start + WORM_STEPS, 0), 1,
+		      "Recording should end after a worm turn");
+}
+
+/**
+ * @brief Hold the test interval on the corrected axis
+ */
+static void hold_start(void)
+{
+	const motion_step_move_t move = {.hold = HOLD, .forward = true};
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+}
+
+/* ============================================================================
+ * RECORDING TESTS
+ * ============================================================================ */
+
+ZTEST(motion_pec, test_record_builds_table)
+{
+	zassert_equal(motion_pec_play(&pec, true), -ENOENT, "Nothing to play before recording");
+
+	record_square_wave(0);
+
+	/* The drift is left out, the square wave is interpolated at the edges */
+	zassert_equal(pec.table[0], 0, "Edge at the start of the turn");
+	zassert_equal(pec.table[MOTION_PEC_SEGMENTS / 2], 0, "Edge at the half turn");
+	zassert_within(pec.table[1], RATE, 1, "Fast in the first half");
+	zassert_within(pec.table[MOTION_PEC_SEGMENTS - 1], -RATE, 1, "Slow in the second half");
+	zassert_equal(motion_pec_record(&pec, 0, 0), -ENOENT, "Recording should have ended");
+}
+
+ZTEST(motion_pec, test_record_cancel_keeps_table)
+{
+	record_square_wave(0);
+	zassert_ok(motion_pec_play(&pec, true), "Play should succeed");
+
+	zassert_ok(motion_pec_record_start(&pec, 0), "Recording should start");
+	zassert_false(motion_pec_playing(&pec), "Recording stops playback");
+	zassert_equal(motion_pec_record(&pec, 1000, -5000), 0, "Recording should go on");
+	motion_pec_record_cancel(&pec);
+
+	zassert_within(pec.table[1], RATE, 1, "Table of the last finished recording");
+	zassert_ok(motion_pec_play(&pec, true), "Play should succeed");
+}
+
+/* ============================================================================
+ * PLAYBACK TESTS
+ * ============================================================================ */
+
+ZTEST(motion_pec, test_playback_off_is_exact)
+{
+	record_square_wave(0);
+	hold_start();
+
+	motion_step_emul_run(&emul, (uint64_t)HALF_TURN * HOLD);
+	zassert_equal(emul.rising_edges[0], HALF_TURN, "No correction without playback");
+}
+
+ZTEST(motion_pec, test_playback_follows_recording)
+{
+	record_square_wave(0);
+	zassert_ok(motion_pec_play(&pec, true), "Play should succeed");
+	hold_start();
+
+	/* About 63 segments at the full rate over the first half */
+	motion_step_emul_run(&emul, (uint64_t)HALF_TURN * HOLD);
+	zassert_between_inclusive(emul.rising_edges[0], HALF_TURN + 60, HALF_TURN + 66,
+				  "First half should run fast, %u steps",
+				  emul.rising_edges[0]);
+
+	/* The corrections of a turn add up to nothing, to the tick */
+	motion_step_emul_run(&emul, (uint64_t)HALF_TURN * HOLD - 100 * HOLD);
+	zassert_within(emul.rising_edges[0], WORM_STEPS - 100, 1, "Turn should end on time");
+	motion_step_emul_run(&emul, 100 * HOLD + HOLD / 2);
+	zassert_equal(emul.rising_edges[0], WORM_STEPS, "A worm turn of steps");
+	zassert_within(emul.last_rising_at[0], (uint64_t)WORM_STEPS * HOLD, 1,
+		       "Last step of the turn on schedule");
+}
+
+ZTEST(motion_pec, test_playback_follows_position)
+{
+	record_square_wave(0);
+	zassert_ok(motion_pec_play(&pec, true), "Play should succeed");
+	zassert_ok(motion_step_set_position(&step, MOTION_AXIS_RA, HALF_TURN + 3 * WORM_STEPS),
+		   "Position should be set");
+	hold_start();
+
+	motion_step_emul_run(&emul, (uint64_t)HALF_TURN * HOLD);
+	zassert_between_inclusive(emul.rising_edges[0], HALF_TURN - 66, HALF_TURN - 60,
+				  "Second half of the worm should run slow, %u steps",
+				  emul.rising_edges[0]);
+}
+
+ZTEST(motion_pec, test_backwards_follows_phase)
+{
+	const motion_step_move_t move = {.hold = HOLD, .forward = false};
+
+	record_square_wave(0);
+	zassert_ok(motion_pec_play(&pec, true), "Play should succeed");
+	zassert_ok(motion_step_set_position(&step, MOTION_AXIS_RA, HALF_TURN),
+		   "Position should be set");
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+
+	/* Backwards from the half turn runs through the fast half */
+	motion_step_emul_run(&emul, (uint64_t)HALF_TURN * HOLD);
+	zassert_between_inclusive(emul.rising_edges[0], HALF_TURN + 60, HALF_TURN + 66,
+				  "Fast half backwards, %u steps", emul.rising_edges[0]);
+}
+
+ZTEST(motion_pec, test_invalid_parameters)
+{
+	motion_pec_t other;
+
+	zassert_equal(motion_pec_init(NULL, MOTION_AXIS_RA, WORM_STEPS), -EINVAL,
+		      "NULL should fail");
+	zassert_equal(motion_pec_init(&other, MOTION_AXIS_ALL, WORM_STEPS), -EINVAL,
+		      "One axis only");
+	zassert_equal(motion_pec_init(&other, MOTION_AXIS_RA, MOTION_PEC_SEGMENTS - 1), -EINVAL,
+		      "A worm turn needs a step per segment");
+	zassert_equal(motion_pec_record(NULL, 0, 0), -EINVAL, "NULL should fail");
+	zassert_equal(motion_pec_play(NULL, false), -EINVAL, "NULL should fail");
+
+	zassert_ok(motion_pec_init(&other, MOTION_AXIS_DEC, WORM_STEPS), "Init should succeed");
+	zassert_equal(motion_step_set_pec(&step, &other), -EINVAL, "Engine drives RA only");
+
+	hold_start();
+	zassert_equal(motion_step_set_pec(&step, NULL), -EBUSY, "Not while a move runs");
+}
+
+ZTEST_SUITE(motion_pec, NULL, NULL, pec_test_setup, NULL, NULL);
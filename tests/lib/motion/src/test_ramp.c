@@ -0,0 +1,342 @@
+/**
+ * @file test_ramp.c
+ * @brief Motion Ramp Test Suite
+ *
+ * Plans ramps for a 90 MHz counter and runs ramped moves on the emulated
+ * counter.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <motion/motion_ramp.h>
+#include <motion/motion_step.h>
+#include <motion/motion_step_emul.h>
+
+#define FREQUENCY 90000000U
+#define CAPACITY 4096
+
+/* 10 kHz reached at 20000 steps/s^2 */
+#define CRUISE_MHZ 10000000U
+#define ACCEL 20000U
+#define JERK 200000U
+/* 13.37 Hz, sidereal rate of 1152000 steps per revolution */
+#define TRACKING_MHZ 13370U
+
+/* Test fixtures */
+static uint32_t intervals[CAPACITY];
+static motion_step_t step;
+static motion_step_emul_t emul;
+static motion_stop_t stop;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void ramp_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	motion_stop_init(&stop);
+	motion_step_emul_init(&emul, &step, FREQUENCY);
+	zassert_ok(motion_step_init(&step, &emul.hw, &stop, MOTION_AXIS_RA, 2000),
+		   "Init should succeed");
+}
+
+/**
+ * @brief Interval before step k of a ramped move of the given length
+ */
+static uint32_t ramped_interval(uint32_t count, uint32_t length, uint32_t k)
+{
+	return intervals[MIN(MIN(k, length - 1 - k), count - 1)];
+}
+
+/**
+ * @brief Check that a ramp only speeds up and ends on the cruise interval
+ */
+static void check_ramp(int count, uint32_t cruise_mhz)
+{
+	zassert_true(count > 1, "Ramp should have steps, got %d", count);
+
+	/* Step times are rounded to ticks, near the cruise rate that may add a tick */
+	for (int i = 1; i < count; i++) {
+		zassert_true(intervals[i] <= intervals[i - 1] + 1, "Ramp should speed up at %d", i);
+	}
+
+	zassert_equal(intervals[count - 1], (uint32_t)((uint64_t)FREQUENCY * 1000 / cruise_mhz),
+		      "Ramp should end on the cruise interval");
+}
+
+/**
+ * @brief Sum the intervals of a ramp without its cruise interval
+ */
+static uint64_t ramp_ticks(int count)
+{
+	uint64_t ticks = 0;
+
+	for (int i = 0; i < count - 1; i++) {
+		ticks += intervals[i];
+	}
+
+	return ticks;
+}
+
+/* ============================================================================
+ * PLANNING TESTS
+ * ============================================================================ */
+
+ZTEST(motion_ramp, test_trapezoid_from_rest)
+{
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+
+	check_ramp(count, CRUISE_MHZ);
+	zassert_true((uint32_t)count <= motion_ramp_steps(&profile), "Size bound should hold");
+
+	/* v^2 / 2a steps in v / a seconds */
+	zassert_within(count, 2500, 2, "Steps of the ramp");
+	zassert_within(ramp_ticks(count), FREQUENCY / 2, FREQUENCY / 1000,
+		       "Duration of the ramp");
+
+	/* The first step from rest comes after sqrt(2 / a) */
+	zassert_within(intervals[0], 900000, 1, "First interval");
+}
+
+ZTEST(motion_ramp, test_s_curve_from_rest)
+{
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL,
+					       .jerk = JERK};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+
+	check_ramp(count, CRUISE_MHZ);
+	zassert_true((uint32_t)count <= motion_ramp_steps(&profile), "Size bound should hold");
+
+	/* The jerk phases add a / j to the duration */
+	zassert_within(ramp_ticks(count), FREQUENCY / 2 + FREQUENCY / 10, FREQUENCY / 1000,
+		       "Duration of the ramp");
+
+	/* The first step from rest comes after cbrt(6 / j) */
+	zassert_within(intervals[0], 2796500, 1000, "First interval");
+
+	/* The acceleration ends smoothly, the last steps are nearly at cruise rate */
+	zassert_true(intervals[count - 2] - intervals[count - 1] <= 1, "Ramp should flatten out");
+}
+
+ZTEST(motion_ramp, test_short_s_curve_lowers_peak)
+{
+	/* 500 Hz is reached before the jerk reaches the full acceleration */
+	const motion_ramp_profile_t profile = {.cruise_mhz = 500000, .accel = ACCEL,
+					       .jerk = JERK};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+
+	check_ramp(count, 500000);
+
+	/* Two jerk phases of sqrt(dv / j) each */
+	zassert_within(ramp_ticks(count), FREQUENCY / 10, FREQUENCY / 250, "Duration of the ramp");
+}
+
+ZTEST(motion_ramp, test_ramp_from_tracking)
+{
+	const motion_ramp_profile_t profile = {.start_mhz = TRACKING_MHZ,
+					       .cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+
+	check_ramp(count, CRUISE_MHZ);
+
+	/* The first step comes after t with v0 t + a t^2 / 2 = 1, a bit sooner than from rest */
+	zassert_within(intervals[0], 841843, 100, "First interval");
+}
+
+ZTEST(motion_ramp, test_invalid_profiles)
+{
+	const motion_ramp_profile_t no_accel = {.cruise_mhz = CRUISE_MHZ};
+	const motion_ramp_profile_t no_rate = {.accel = ACCEL};
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+
+	zassert_equal(motion_ramp_build(&no_accel, FREQUENCY, intervals, CAPACITY), -EINVAL,
+		      "Acceleration is required");
+	zassert_equal(motion_ramp_build(&no_rate, FREQUENCY, intervals, CAPACITY), -EINVAL,
+		      "Cruise rate is required");
+	zassert_equal(motion_ramp_build(NULL, FREQUENCY, intervals, CAPACITY), -EINVAL,
+		      "Profile is required");
+	zassert_equal(motion_ramp_build(&profile, FREQUENCY, intervals, 100), -ENOSPC,
+		      "Ramp should not fit");
+	zassert_equal(motion_ramp_steps(&no_accel), 0, "No size for an invalid profile");
+}
+
+ZTEST(motion_ramp, test_already_at_cruise)
+{
+	const motion_ramp_profile_t profile = {.start_mhz = CRUISE_MHZ, .cruise_mhz = CRUISE_MHZ,
+					       .accel = ACCEL};
+
+	zassert_equal(motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY), 1,
+		      "Only the cruise interval expected");
+	zassert_equal(intervals[0], FREQUENCY / 10000, "Cruise interval");
+}
+
+/* ============================================================================
+ * RAMPED MOVE TESTS
+ * ============================================================================ */
+
+ZTEST(motion_ramp, test_move_accelerates_and_decelerates)
+{
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL,
+					       .jerk = JERK};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+	const motion_step_move_t move = {.intervals = intervals, .count = count, .steps = 10000,
+					 .forward = true};
+	uint64_t expected = 0;
+
+	for (uint32_t k = 0; k < move.steps; k++) {
+		expected += ramped_interval(count, move.steps, k);
+	}
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, expected - 1);
+	zassert_false(motion_step_arrived(&step), "Last step is still to come");
+	motion_step_emul_run(&emul, 10 * FREQUENCY);
+
+	zassert_equal(emul.rising_edges[0], 10000, "Every step should be issued");
+	zassert_equal(emul.last_rising_at[0], expected, "Steps should follow the ramp");
+	zassert_true(motion_step_arrived(&step), "Move should have arrived");
+	zassert_false(motion_step_busy(&step), "Move should end");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_RA), 10000,
+		      "Position should follow the steps");
+}
+
+ZTEST(motion_ramp, test_short_move_turns_around)
+{
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+	const motion_step_move_t move = {.intervals = intervals, .count = count, .steps = 101,
+					 .forward = false};
+	uint64_t expected = 0;
+
+	for (uint32_t k = 0; k < move.steps; k++) {
+		expected += ramped_interval(count, move.steps, k);
+	}
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 10 * FREQUENCY);
+
+	zassert_equal(emul.rising_edges[0], 101, "Every step should be issued");
+	zassert_equal(emul.last_rising_at[0], expected, "Ramp should turn around halfway");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_RA), -101,
+		      "Position should follow the steps");
+}
+
+ZTEST(motion_ramp, test_stop_decelerates_early)
+{
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+	const motion_step_move_t move = {.intervals = intervals, .count = count, .steps = 100000,
+					 .forward = true};
+	motion_stop_stats_t stats;
+	uint64_t accelerating = 0;
+
+	/* Stop halfway up the ramp, after the step at ramp position 1000 */
+	for (uint32_t k = 0; k <= 1000; k++) {
+		accelerating += intervals[k];
+	}
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, accelerating);
+	zassert_equal(emul.rising_edges[0], 1001, "Steps up the ramp");
+
+	motion_stop_request(&stop, MOTION_AXIS_RA);
+	motion_step_emul_run(&emul, intervals[1001] - 1);
+	zassert_equal(motion_stop_pending(&stop), MOTION_AXIS_RA, "Stop waits for the ramp");
+	zassert_true(motion_step_busy(&step), "Engine should decelerate");
+
+	motion_step_emul_run(&emul, 10 * FREQUENCY);
+	zassert_false(motion_step_busy(&step), "Engine should come to rest");
+	zassert_equal(motion_stop_pending(&stop), 0, "Stop should be acknowledged at rest");
+	/* The step already scheduled at ramp position 1001, then back down from 1000 */
+	zassert_equal(emul.rising_edges[0], 1001 + 1 + 1001,
+		      "Back down the ramp from where it was");
+	zassert_equal(emul.last_rising_at[0], 2 * accelerating + intervals[1001],
+		      "Deceleration should mirror the acceleration");
+
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(stats.completions, 1, "Completion should be counted");
+}
+
+ZTEST(motion_ramp, test_decelerate_without_stop_signal)
+{
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+	const motion_step_move_t move = {.intervals = intervals, .count = count, .steps = 100000,
+					 .hold = 1000000, .forward = true};
+	motion_stop_stats_t stats;
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, FREQUENCY);
+	zassert_true(emul.rising_edges[0] > (uint32_t)count, "Move should cruise");
+
+	motion_step_decelerate(&step);
+	motion_step_emul_run(&emul, 10 * FREQUENCY);
+	zassert_false(motion_step_busy(&step), "Move should come to rest without holding");
+	zassert_true(emul.rising_edges[0] < 100000, "Move should end early");
+
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(stats.completions, 0, "No stop to acknowledge");
+}
+
+ZTEST(motion_ramp, test_stop_while_holding)
+{
+	const motion_ramp_profile_t profile = {.cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+	const motion_step_move_t move = {.intervals = intervals, .count = count, .steps = 10,
+					 .hold = 1000000, .forward = true};
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 10 * FREQUENCY);
+	zassert_true(motion_step_arrived(&step), "Move should have arrived");
+
+	motion_stop_request(&stop, MOTION_AXIS_RA);
+	motion_step_emul_run(&emul, 1000000);
+	zassert_false(motion_step_busy(&step), "Held rate should stop at once");
+	zassert_equal(motion_stop_pending(&stop), 0, "Stop should be acknowledged");
+}
+
+ZTEST(motion_ramp, test_goto_blends_into_tracking)
+{
+	const motion_ramp_profile_t profile = {.start_mhz = TRACKING_MHZ,
+					       .cruise_mhz = CRUISE_MHZ, .accel = ACCEL};
+	int count = motion_ramp_build(&profile, FREQUENCY, intervals, CAPACITY);
+	const motion_step_move_t move = {
+		.intervals = intervals,
+		.count = count,
+		.steps = 20000,
+		.hold = motion_step_interval(&step, TRACKING_MHZ),
+		.forward = true,
+	};
+	motion_step_stats_t stats;
+	uint64_t expected = 0;
+
+	for (uint32_t k = 0; k < move.steps; k++) {
+		expected += ramped_interval(count, move.steps, k);
+	}
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, expected);
+	zassert_true(motion_step_arrived(&step), "Goto should have arrived");
+	zassert_true(motion_step_busy(&step), "Tracking should go on");
+
+	motion_step_reset_stats(&step);
+	motion_step_emul_run(&emul, 100 * (uint64_t)move.hold);
+	motion_step_get_stats(&step, &stats);
+	zassert_equal(stats.steps, 100, "Tracking steps expected");
+	zassert_within(stats.rate_mhz, TRACKING_MHZ, 1, "Tracking rate expected");
+}
+
+ZTEST(motion_ramp, test_ramped_move_needs_intervals)
+{
+	const motion_step_move_t move = {.steps = 100, .hold = 1000, .forward = true};
+
+	zassert_equal(motion_step_start(&step, &move), -EINVAL, "Ramp is required");
+}
+
+ZTEST_SUITE(motion_ramp, NULL, NULL, ramp_test_setup, NULL, NULL);
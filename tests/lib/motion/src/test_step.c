@@ -0,0 +1,261 @@
+/**
+ * @file test_step.c
+ * @brief Step Engine Test Suite
+ *
+ * Runs the step engine on the emulated counter at the frequency of the
+ * STM32F446 timers.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <motion/motion_step.h>
+#include <motion/motion_step_emul.h>
+
+/* APB1 timer clock of the nucleo_f446re with TIM2 unprescaled */
+#define FREQUENCY 90000000U
+/* 50 kHz */
+#define INTERVAL_50KHZ (FREQUENCY / 50000U)
+/* Half a microsecond */
+#define HALF_US (FREQUENCY / 2000000U)
+
+/* Test fixtures */
+static motion_step_t step;
+static motion_step_emul_t emul;
+static motion_stop_t stop;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void step_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	motion_stop_init(&stop);
+	motion_step_emul_init(&emul, &step, FREQUENCY);
+	zassert_ok(motion_step_init(&step, &emul.hw, &stop, MOTION_AXIS_RA, 2000),
+		   "Init should succeed");
+}
+
+/* ============================================================================
+ * MOVE TESTS
+ * ============================================================================ */
+
+ZTEST(motion_step, test_hold_runs_at_constant_rate)
+{
+	const motion_step_move_t move = {.hold = 1000, .forward = true};
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	zassert_true(motion_step_busy(&step), "Move should run");
+	zassert_true(emul.forward[0], "Direction pin should be set");
+
+	motion_step_emul_run(&emul, 100 * 1000);
+	zassert_equal(emul.rising_edges[0], 100, "One step per interval expected");
+	zassert_equal(emul.last_rising_at[0], 100 * 1000, "Last step should be on schedule");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_RA), 100,
+		      "Position should follow the steps");
+	zassert_equal(emul.min_high, 180, "Pulse should last 2 us");
+}
+
+ZTEST(motion_step, test_table_then_end)
+{
+	static const uint32_t intervals[] = {4000, 3000, 2000, 1000};
+	const motion_step_move_t move = {.intervals = intervals, .count = 4, .forward = false};
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+
+	motion_step_emul_run(&emul, 4000);
+	zassert_equal(emul.rising_edges[0], 1, "First step after the first interval");
+	motion_step_emul_run(&emul, 3000 + 2000 + 1000);
+	zassert_equal(emul.rising_edges[0], 4, "One step per table entry expected");
+	zassert_equal(emul.last_rising_at[0], 10000, "Intervals should add up");
+
+	motion_step_emul_run(&emul, 100000);
+	zassert_false(motion_step_busy(&step), "Move should end with the table");
+	zassert_false(emul.step_high[0], "Step pin should end low");
+	zassert_equal(emul.rising_edges[0], 4, "No step after the table");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_RA), -4, "Steps should go backwards");
+}
+
+ZTEST(motion_step, test_table_then_hold)
+{
+	static const uint32_t intervals[] = {3000, 2000};
+	const motion_step_move_t move = {.intervals = intervals, .count = 2, .hold = 500,
+					 .forward = true};
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 3000 + 2000 + 10 * 500);
+	zassert_equal(emul.rising_edges[0], 12, "Hold should follow the table");
+	zassert_true(motion_step_busy(&step), "Hold should keep running");
+
+	motion_step_stop(&step);
+	zassert_false(motion_step_busy(&step), "Stop should end the move");
+	zassert_false(emul.step_high[0], "Step pin should be low after a stop");
+	motion_step_emul_run(&emul, 10000);
+	zassert_equal(emul.rising_edges[0], 12, "No step after a stop");
+}
+
+ZTEST(motion_step, test_short_interval_shortens_pulse)
+{
+	const motion_step_move_t move = {.hold = 100, .forward = true};
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 100 * 100);
+	zassert_equal(emul.rising_edges[0], 100, "Every step should be issued");
+	zassert_equal(emul.min_high, 50, "Pulse should be half the interval");
+}
+
+ZTEST(motion_step, test_invalid_moves)
+{
+	static const uint32_t too_short[] = {1000, 1};
+	const motion_step_move_t empty = {.forward = true};
+	const motion_step_move_t bad_table = {.intervals = too_short, .count = 2};
+	const motion_step_move_t bad_hold = {.hold = 1};
+	const motion_step_move_t move = {.hold = 1000};
+
+	zassert_equal(motion_step_start(&step, &empty), -EINVAL, "Empty move should fail");
+	zassert_equal(motion_step_start(&step, &bad_table), -EINVAL, "Short interval should fail");
+	zassert_equal(motion_step_start(&step, &bad_hold), -EINVAL, "Short hold should fail");
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	zassert_equal(motion_step_start(&step, &move), -EBUSY, "Second start should fail");
+	zassert_equal(motion_step_set_position(&step, MOTION_AXIS_RA, 0), -EBUSY,
+		      "Position is busy");
+
+	motion_step_stop(&step);
+	zassert_ok(motion_step_set_position(&step, MOTION_AXIS_RA, 42), "Position should be set");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_RA), 42, "Position should be kept");
+}
+
+ZTEST(motion_step, test_counter_wrap)
+{
+	const motion_step_move_t move = {.hold = 1000, .forward = true};
+
+	emul.now = UINT32_MAX - 10500;
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 100 * 1000);
+	zassert_equal(emul.rising_edges[0], 100, "Steps should go on across the wrap");
+	zassert_equal(emul.last_rising_at[0], (uint64_t)UINT32_MAX - 10500 + 100 * 1000,
+		      "Steps should stay on schedule across the wrap");
+}
+
+/* ============================================================================
+ * TIMING TESTS
+ * ============================================================================ */
+
+ZTEST(motion_step, test_latency_does_not_accumulate)
+{
+	const motion_step_move_t move = {.hold = INTERVAL_50KHZ, .forward = true};
+	motion_step_stats_t stats;
+
+	motion_step_emul_set_latency(&emul, 100, 100);
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 1000 * INTERVAL_50KHZ + 100);
+
+	zassert_equal(emul.rising_edges[0], 1000, "Every step should be issued");
+	zassert_equal(emul.last_rising_at[0], 1000 * INTERVAL_50KHZ + 100,
+		      "Latency should delay edges without shifting the schedule");
+
+	motion_step_get_stats(&step, &stats);
+	zassert_equal(stats.rate_mhz, 50000000, "Rate should be exactly 50 kHz");
+	zassert_equal(stats.jitter_ns, 0, "Constant latency has no jitter");
+}
+
+ZTEST(motion_step, test_50khz_with_jitter)
+{
+	const motion_step_move_t move = {
+		.hold = motion_step_interval(&step, 50000000),
+		.forward = true,
+	};
+	motion_step_stats_t stats;
+
+	zassert_equal(move.hold, INTERVAL_50KHZ, "Interval of 50 kHz expected");
+
+	/* Up to half a microsecond of interrupt latency */
+	motion_step_emul_set_latency(&emul, 20, 20 + HALF_US);
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, FREQUENCY);
+
+	motion_step_get_stats(&step, &stats);
+	zassert_within(stats.steps, 50000, 1, "One second at 50 kHz expected");
+	zassert_equal(stats.rate_mhz, 50000000, "Achieved rate should be 50 kHz");
+	zassert_equal(stats.late, 0, "No edge should be late");
+	zassert_true(stats.min_latency_ns >= 222, "Latency should be measured");
+	zassert_true(stats.jitter_ns <= 500, "Jitter should stay below 0.5 us, got %u",
+		     stats.jitter_ns);
+	zassert_true(stats.jitter_ns > 0, "Jitter should be measured");
+}
+
+ZTEST(motion_step, test_late_edges_catch_up)
+{
+	const motion_step_move_t move = {.hold = 400, .forward = true};
+	motion_step_stats_t stats;
+
+	/* An interrupt now and then delayed past the next edge */
+	motion_step_emul_set_latency(&emul, 0, 300);
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 1000 * 400);
+
+	motion_step_get_stats(&step, &stats);
+	zassert_true(stats.late > 0, "Late edges should be counted");
+	zassert_within(emul.rising_edges[0], 1000, 2, "Late edges should catch up");
+	zassert_equal(stats.rate_mhz, 225000000, "Scheduled rate should be kept");
+}
+
+ZTEST(motion_step, test_reset_stats)
+{
+	const motion_step_move_t move = {.hold = 1000, .forward = true};
+	motion_step_stats_t stats;
+
+	motion_step_emul_set_latency(&emul, 10, 20);
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 10 * 1000);
+
+	motion_step_reset_stats(&step);
+	motion_step_get_stats(&step, &stats);
+	zassert_equal(stats.steps, 0, "Steps should be reset");
+	zassert_equal(stats.rate_mhz, 0, "Rate should be reset");
+	zassert_equal(stats.max_latency_ns, 0, "Latency should be reset");
+	zassert_equal(motion_step_position(&step, MOTION_AXIS_RA), 10, "Position should be kept");
+}
+
+/* ============================================================================
+ * STOP TESTS
+ * ============================================================================ */
+
+ZTEST(motion_step, test_stop_signal_acknowledged)
+{
+	const motion_step_move_t move = {.hold = 1000, .forward = true};
+	motion_stop_stats_t stop_stats;
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_step_emul_run(&emul, 10 * 1000);
+
+	motion_stop_request(&stop, MOTION_AXIS_RA);
+	motion_step_emul_run(&emul, 1000);
+
+	zassert_false(motion_step_busy(&step), "Engine should stop at the next step");
+	zassert_equal(emul.rising_edges[0], 10, "No step after the request");
+	zassert_equal(motion_stop_pending(&stop), 0, "Stop should be acknowledged");
+
+	motion_stop_get_stats(&stop, &stop_stats);
+	zassert_equal(stop_stats.completions, 1, "Completion should be counted");
+}
+
+ZTEST(motion_step, test_stop_other_axis_ignored)
+{
+	const motion_step_move_t move = {.hold = 1000, .forward = true};
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	motion_stop_request(&stop, MOTION_AXIS_DEC);
+	motion_step_emul_run(&emul, 10 * 1000);
+
+	zassert_true(motion_step_busy(&step), "RA should keep stepping");
+	zassert_equal(emul.rising_edges[0], 10, "Steps should go on");
+	zassert_equal(motion_stop_pending(&stop), MOTION_AXIS_DEC, "DEC stop stays pending");
+}
+
+ZTEST_SUITE(motion_step, NULL, NULL, step_test_setup, NULL, NULL);
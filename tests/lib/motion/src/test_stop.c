@@ -0,0 +1,142 @@
+/**
+ * @file test_stop.c
+ * @brief Motion Stop Signal Test Suite
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <motion/motion_stop.h>
+
+/* Test fixtures */
+static motion_stop_t stop;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void stop_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+	motion_stop_init(&stop);
+}
+
+/* ============================================================================
+ * SIGNAL TESTS
+ * ============================================================================ */
+
+ZTEST(motion_stop, test_nothing_pending_after_init)
+{
+	motion_stop_stats_t stats;
+
+	zassert_equal(motion_stop_pending(&stop), 0, "No stop should be pending");
+
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(stats.requests, 0, "No request should be counted");
+	zassert_equal(stats.completions, 0, "No completion should be counted");
+}
+
+ZTEST(motion_stop, test_request_and_complete)
+{
+	motion_stop_stats_t stats;
+
+	motion_stop_request(&stop, MOTION_AXIS_ALL);
+	zassert_equal(motion_stop_pending(&stop), MOTION_AXIS_ALL, "Both axes should stop");
+
+	motion_stop_complete(&stop, MOTION_AXIS_ALL);
+	zassert_equal(motion_stop_pending(&stop), 0, "Stop should be acknowledged");
+
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(stats.requests, 1, "Request should be counted");
+	zassert_equal(stats.completions, 1, "Completion should be counted");
+}
+
+ZTEST(motion_stop, test_axes_accumulate)
+{
+	motion_stop_stats_t stats;
+
+	motion_stop_request(&stop, MOTION_AXIS_DEC);
+	motion_stop_request(&stop, MOTION_AXIS_RA);
+	zassert_equal(motion_stop_pending(&stop), MOTION_AXIS_ALL, "Both axes should stop");
+
+	/* Latency is only recorded once every axis has stopped */
+	motion_stop_complete(&stop, MOTION_AXIS_RA);
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(motion_stop_pending(&stop), MOTION_AXIS_DEC, "DEC should still stop");
+	zassert_equal(stats.completions, 0, "Partial stop should not be counted");
+
+	motion_stop_complete(&stop, MOTION_AXIS_DEC);
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(stats.requests, 2, "Both requests should be counted");
+	zassert_equal(stats.completions, 1, "Stop should be counted once");
+}
+
+ZTEST(motion_stop, test_complete_without_request)
+{
+	motion_stop_stats_t stats;
+
+	motion_stop_complete(&stop, MOTION_AXIS_RA);
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(stats.completions, 0, "Spurious acknowledgement should be ignored");
+}
+
+/* ============================================================================
+ * LATENCY TESTS
+ * ============================================================================ */
+
+ZTEST(motion_stop, test_latency_measured_from_first_request)
+{
+	motion_stop_stats_t stats;
+	uint32_t bound = k_us_to_cyc_floor32(200);
+
+	motion_stop_request(&stop, MOTION_AXIS_RA);
+	k_busy_wait(100);
+	/* A second request while stopping must not restart the clock */
+	motion_stop_request(&stop, MOTION_AXIS_RA);
+	k_busy_wait(100);
+	motion_stop_complete(&stop, MOTION_AXIS_RA);
+
+	motion_stop_get_stats(&stop, &stats);
+	zassert_true(stats.last_cycles >= bound, "Latency should cover both waits");
+	zassert_equal(stats.max_cycles, stats.last_cycles, "First stop should be the maximum");
+}
+
+ZTEST(motion_stop, test_latency_keeps_maximum)
+{
+	motion_stop_stats_t stats;
+	uint32_t longest;
+
+	motion_stop_request(&stop, MOTION_AXIS_ALL);
+	k_busy_wait(200);
+	motion_stop_complete(&stop, MOTION_AXIS_ALL);
+	motion_stop_get_stats(&stop, &stats);
+	longest = stats.max_cycles;
+
+	motion_stop_request(&stop, MOTION_AXIS_ALL);
+	motion_stop_complete(&stop, MOTION_AXIS_ALL);
+	motion_stop_get_stats(&stop, &stats);
+	zassert_true(stats.last_cycles < longest, "Immediate stop should be faster");
+	zassert_equal(stats.max_cycles, longest, "Maximum should be kept");
+
+	motion_stop_reset_stats(&stop);
+	motion_stop_get_stats(&stop, &stats);
+	zassert_equal(stats.max_cycles, 0, "Maximum should be reset");
+	zassert_equal(stats.requests, 0, "Requests should be reset");
+}
+
+ZTEST(motion_stop, test_invalid_parameters)
+{
+	motion_stop_request(&stop, 0);
+	zassert_equal(motion_stop_pending(&stop), 0, "Empty request should be ignored");
+
+	motion_stop_request(NULL, MOTION_AXIS_ALL);
+	motion_stop_complete(NULL, MOTION_AXIS_ALL);
+	motion_stop_get_stats(&stop, NULL);
+}
+
+/* ============================================================================
+ * TEST SUITE DEFINITIONS
+ * ============================================================================ */
+
+ZTEST_SUITE(motion_stop, NULL, NULL, stop_test_setup, NULL, NULL);
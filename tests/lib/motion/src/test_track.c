@@ -0,0 +1,243 @@
+/**
+ * @file test_track.c
+ * @brief Tracking Rate Test Suite
+ *
+ * Tracks for whole simulated days on the emulated counter and checks every
+ * step against the exact schedule of the rate.
+ *
+ * Copyright (c) 2025, OpenAstroTech
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <motion/motion_step.h>
+#include <motion/motion_step_emul.h>
+#include <motion/motion_track.h>
+
+#define FREQUENCY 90000000U
+#define STEPS_PER_REV 1152000U
+/* Counter ticks in 24 hours */
+#define DAY_TICKS (86400ULL * FREQUENCY)
+
+/* Test fixtures */
+static motion_step_t step;
+static motion_step_emul_t emul;
+static motion_stop_t stop;
+
+/**
+ * @brief Setup function called before each test
+ */
+static void track_test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	motion_stop_init(&stop);
+	motion_step_emul_init(&emul, &step, FREQUENCY);
+	zassert_ok(motion_step_init(&step, &emul.hw, &stop, MOTION_AXIS_RA, 2000),
+		   "Init should succeed");
+}
+
+/**
+ * @brief Period of a rate on the test axis
+ */
+static void track_period(uint32_t rate_mhz, uint32_t day, motion_step_period_t *period)
+{
+	const motion_track_rate_t rate = {
+		.steps_per_rev = STEPS_PER_REV,
+		.rate_mhz = rate_mhz,
+		.day = day,
+	};
+
+	zassert_ok(motion_track_period(&rate, FREQUENCY, period), "Period should be computed");
+}
+
+/**
+ * @brief Start holding a period
+ */
+static void track_start(const motion_step_period_t *period)
+{
+	const motion_step_move_t move = {
+		.hold = period->ticks,
+		.forward = true,
+		.hold_frac = period->frac,
+		.hold_modulus = period->modulus,
+	};
+
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+}
+
+/**
+ * @brief Exact time of a step, rounded down to a tick
+ */
+static uint64_t exact_at(const motion_step_period_t *period, uint64_t steps)
+{
+	return steps * period->ticks + (period->modulus != 0 ? steps * period->frac /
+								  period->modulus
+							      : 0);
+}
+
+/* ============================================================================
+ * PERIOD TESTS
+ * ============================================================================ */
+
+ZTEST(motion_track, test_sidereal_period)
+{
+	motion_step_period_t period;
+
+	track_period(MOTION_TRACK_DAY_MHZ, MOTION_TRACK_SIDEREAL_DAY, &period);
+
+	/* 90 MHz * 86164.0905 s / 1152000 steps */
+	zassert_equal(period.ticks, 6731569, "Whole ticks of the sidereal interval");
+	zassert_equal(period.frac, 73, "Fraction should be reduced");
+	zassert_equal(period.modulus, 128, "Fraction should be reduced");
+}
+
+ZTEST(motion_track, test_custom_rate_on_solar_day)
+{
+	/* 60.0 Hz is one turn per solar day */
+	motion_step_period_t period;
+
+	track_period(60000, MOTION_TRACK_SOLAR_DAY, &period);
+
+	zassert_equal(period.ticks, 6750000, "Solar interval is whole ticks");
+	zassert_equal(period.modulus, 0, "No fraction expected");
+
+	/* 60.1 Hz */
+	track_period(60100, MOTION_TRACK_SOLAR_DAY, &period);
+	zassert_equal(period.modulus, 601, "Fraction should be reduced");
+	zassert_equal((uint64_t)period.ticks * 601 + period.frac, 6750000ULL * 600,
+		      "Interval should be 6750000 * 600 / 601 ticks");
+}
+
+ZTEST(motion_track, test_invalid_rates)
+{
+	motion_track_rate_t rate = {.steps_per_rev = STEPS_PER_REV, .rate_mhz = 0,
+				    .day = MOTION_TRACK_SIDEREAL_DAY};
+	motion_step_period_t period;
+
+	zassert_equal(motion_track_period(&rate, FREQUENCY, &period), -EINVAL,
+		      "Rate 0 should fail");
+
+	/* 1 mHz is more than a counter wrap per step */
+	rate.rate_mhz = 1;
+	zassert_equal(motion_track_period(&rate, FREQUENCY, &period), -ERANGE,
+		      "Too slow should fail");
+
+	rate.rate_mhz = 60000;
+	rate.steps_per_rev = UINT32_MAX;
+	zassert_equal(motion_track_period(&rate, 1000, &period), -ERANGE,
+		      "Too fast should fail");
+}
+
+/* ============================================================================
+ * DRIFT TESTS
+ * ============================================================================ */
+
+ZTEST(motion_track, test_sidereal_day_exact)
+{
+	const uint64_t day = (uint64_t)FREQUENCY * MOTION_TRACK_SIDEREAL_DAY / 10000;
+	motion_step_period_t period;
+
+	track_period(MOTION_TRACK_DAY_MHZ, MOTION_TRACK_SIDEREAL_DAY, &period);
+	track_start(&period);
+	motion_step_emul_run(&emul, day);
+
+	/* A rounded interval would be 496355 ticks, 5.5 ms, off by now */
+	zassert_equal(emul.rising_edges[0], STEPS_PER_REV, "One turn per sidereal day");
+	zassert_equal(emul.last_rising_at[0], day, "Last step should end the day exactly");
+	motion_step_stop(&step);
+}
+
+ZTEST(motion_track, test_24_hours_without_drift)
+{
+	static const uint32_t days[] = {
+		MOTION_TRACK_SIDEREAL_DAY,
+		MOTION_TRACK_LUNAR_DAY,
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(days); i++) {
+		const uint64_t started = emul.now;
+		motion_step_period_t period;
+
+		track_period(MOTION_TRACK_DAY_MHZ, days[i], &period);
+		track_start(&period);
+		motion_step_emul_run(&emul, DAY_TICKS);
+
+		const uint32_t steps = emul.rising_edges[0];
+
+		zassert_equal(exact_at(&period, steps) <= DAY_TICKS &&
+				      exact_at(&period, steps + 1) > DAY_TICKS,
+			      true, "Every step of 24 hours should be issued");
+		zassert_equal(emul.last_rising_at[0] - started, exact_at(&period, steps),
+			      "Last step should be on the exact schedule");
+
+		motion_step_stop(&step);
+		emul.rising_edges[0] = 0;
+	}
+}
+
+ZTEST(motion_track, test_same_period_keeps_phase)
+{
+	motion_step_period_t period;
+
+	track_period(60100, MOTION_TRACK_SOLAR_DAY, &period);
+	track_start(&period);
+	motion_step_emul_run(&emul, exact_at(&period, 1000));
+	zassert_equal(emul.rising_edges[0], 1000, "Steps before the change");
+
+	/* Setting the period again must not reset the fraction accumulated */
+	for (uint32_t n = 1001; n <= 2000; n++) {
+		zassert_ok(motion_step_set_hold(&step, &period), "Hold should change");
+		motion_step_emul_run(&emul, exact_at(&period, n) - emul.now);
+		zassert_equal(emul.last_rising_at[0], exact_at(&period, n),
+			      "Step %u should stay on the exact schedule", n);
+	}
+	motion_step_stop(&step);
+}
+
+ZTEST(motion_track, test_rate_change_carries_phase)
+{
+	motion_step_period_t sidereal;
+	motion_step_period_t lunar;
+
+	track_period(MOTION_TRACK_DAY_MHZ, MOTION_TRACK_SIDEREAL_DAY, &sidereal);
+	track_period(MOTION_TRACK_DAY_MHZ, MOTION_TRACK_LUNAR_DAY, &lunar);
+	track_start(&sidereal);
+	motion_step_emul_run(&emul, exact_at(&sidereal, 1001));
+	zassert_ok(motion_step_set_hold(&step, &lunar), "Hold should change");
+
+	/* Step 1002 was already scheduled at the sidereal interval */
+	const uint64_t changed = exact_at(&sidereal, 1002);
+	const uint64_t fraction = 1002 * sidereal.frac % sidereal.modulus;
+
+	motion_step_emul_run(&emul, DAY_TICKS);
+
+	const uint64_t steps = emul.rising_edges[0] - 1002;
+	/* Exact time, the fraction of a tick left at the change included */
+	const uint64_t expected =
+		changed + steps * lunar.ticks +
+		(fraction * lunar.modulus / sidereal.modulus + steps * lunar.frac) / lunar.modulus;
+
+	zassert_true(steps > 0, "Lunar steps expected");
+	zassert_within(emul.last_rising_at[0], expected, 1,
+		       "Lunar steps should follow on from the sidereal phase");
+	motion_step_stop(&step);
+}
+
+ZTEST(motion_track, test_set_hold_needs_holding_move)
+{
+	static const uint32_t table[] = {1000, 1000};
+	const motion_step_period_t period = {.ticks = 1000};
+	const motion_step_period_t too_short = {.ticks = 1};
+	const motion_step_move_t move = {.intervals = table, .count = 2};
+
+	zassert_equal(motion_step_set_hold(&step, &period), -ENOENT, "Nothing is running");
+	zassert_ok(motion_step_start(&step, &move), "Start should succeed");
+	zassert_equal(motion_step_set_hold(&step, &period), -ENOENT, "Move does not hold");
+	zassert_equal(motion_step_set_hold(&step, &too_short), -EINVAL, "Too short should fail");
+	motion_step_stop(&step);
+}
+
+ZTEST_SUITE(motion_track, NULL, NULL, track_test_setup, NULL, NULL);